@@ -10,17 +10,46 @@
 #include <immintrin.h>
 #endif
 
+#include <atomic>
 #include <iostream>
 #include <iomanip>
 #include <cmath>
 #include <chrono>
+#include <cstring>
+#include <string>
+#include <sstream>
+#include <vector>
 
 #include "root_cellar.h"
+#include "root_cellar_verify.h"
+#include "root_cellar_pow.h"
+#include "root_cellar_fastpow.h"
+#include "root_cellar_bench.h"
+#include "root_cellar_codegen.h"
+#include "root_cellar_designs.h"
+#include "root_cellar_table.h"
+#include "root_cellar_minimax.h"
+#include "root_cellar_fixed.h"
+#include "root_cellar_vector.h"
+#include "root_cellar_safe.h"
+#include "root_cellar_catalog.h"
+#include "root_cellar_dispatch.h"
 #include "root_cellar_generated.h"
+#include "root_cellar_table_generated.h"
+#include "root_cellar_minimax_generated.h"
 
 using namespace rootbeer;
 
-static float TEST_VALUES[8192];
+static ThreadPool THREADS;
+
+// The fast_root examples in root_cellar_catalog.h and README.md
+static_assert(fast_root<-2, float, max_rel_error_e<1,-3>>::catalog().steps == 1
+	&& fast_root<-2, float, max_rel_error_e<1,-3>>::catalog().constant == 0x5f32a121, "1e-3 selects rb_inv_2_root's design");
+static_assert(fast_root<-2, float, max_rel_error_e<1,-4>>::catalog().steps == 2, "1e-4 selects rb2_inv_2_root's design");
+static_assert(fast_root< 3, double, max_rel_error_e<5,-7>>::catalog().steps == 2, "5e-7 needs two refinements for double cube roots");
+static constexpr fast_root<3, float, max_rel_error_e<3,-7>> cbrt_3e7;
+static_assert(cbrt_3e7.catalog().basis == CERTIFIED_WORST_CASE && cbrt_3e7.newton_m[0] != cbrt_3e7.newton_m[1],
+	"3e-7 selects the float cube root design with a constant per refinement");
 
 template<int ROOT_INDEX, typename T_Func>
 void Print_Test_Root_Approx(const char *name, const T_Func &func)
@@ -37,7 +66,7 @@ void Print_Test_Root_Approx(const char *name, const T_Func &func)
 		<< std::endl;
 	if (sizeof(float_t) <= 4)
 	{
-		auto test = Test_Root_Approx<ROOT_INDEX>(func, range_min, range_max);
+		auto test = Test_Root_Approx<ROOT_INDEX>(func, range_min, range_max, THREADS);
 		std::cout
 			<< "\tError:" << std::endl
 			<< "\t\tRMS:  " << std::sqrt(test.mean_sq_error) << std::endl
@@ -47,41 +76,1131 @@ void Print_Test_Root_Approx(const char *name, const T_Func &func)
 	}
 }
 
-template<typename T_Func>
-void Print_Func_Profile(const char *name, const T_Func &func)
+template<int ROOT_INDEX, typename T_Func>
+void Print_Histogram_Root_Approx(const char *name, const T_Func &func)
+{
+	using float_t = decltype(func(1.0));
+	
+	PowApprox_Histogram<float_t> histogram;
+	auto test = Test_Root_Approx<ROOT_INDEX>(func, float_t(1), float_t(1 << std::abs(ROOT_INDEX)), THREADS, histogram);
+	std::cout << "\tHistogram of x^(1/" << double(ROOT_INDEX) << ") with " << name
+		<< ", max error " << std::max(-test.min_error, test.max_error) << std::endl;
+	std::cout << histogram << std::endl;
+}
+
+template<int ROOT_INDEX, typename T_Func>
+bool Print_Verify_Root_Approx(const char *name, const T_Func &func)
+{
+	std::string checkpoint = std::string("verify_") + name + ".txt";
+	std::cout << "\tVerify x^(1/" << double(ROOT_INDEX) << ") with " << name
+		<< " over all floats (checkpoint: " << checkpoint << ")" << std::endl;
+	auto report = Verify_Root_Approx<ROOT_INDEX>(func, THREADS, checkpoint.c_str());
+	if (report.resumed) std::cout << "\t" << std::dec << report.resumed << " binades resumed" << std::endl;
+	std::cout << report << std::endl;
+	if (!report.complete())
+		std::cout << "\tINCOMPLETE: " << report.total().samples << " of " << Verify_Report::input_count << " inputs scanned" << std::endl;
+	return report.complete();
+}
+
+static const char *const DESIGN_STORE = "root_cellar_designs.txt";
+
+/*
+	Print a design from the store with its measurements, searching only if
+	the store has no valid record for it.
+*/
+template<int ROOT, typename T_Float, unsigned NewtonSteps, BEST_APPROX_BASIS Basis>
+RootApprox<ROOT, T_Float, NewtonSteps> generate_root_functions(Design_Database &designs, const char *prefix = "rb")
 {
-	float total = 0.f;
-	auto start = std::chrono::high_resolution_clock::now();
-	for (int i = 0; i < 16; ++i)
-		for (const auto v : TEST_VALUES)
+	auto best = RootApprox_Stored<ROOT, T_Float, NewtonSteps, Basis>(designs, THREADS);
+	const Design_Record &record = *designs.find(Design_Record::key<ROOT, T_Float, NewtonSteps, Basis>());
+	
+	std::cout << "//  design k=" << std::hex << best.constant << std::dec;
+	if (NewtonSteps) std::cout << ", m=" << best.newton_m[0];
+	std::cout << " with error score " << record.score;
+	if (record.search_seconds > 0) std::cout << ", searched in " << std::setprecision(3) << record.search_seconds << std::setprecision(6) << " s";
+	std::cout << std::endl;
+	
+	std::cout << "/*" << std::endl;
+	std::cout << "\tApproximate x^(1/" << double(ROOT) << ") with " << NewtonSteps << " newtonian steps" << std::endl;
+	if (record.tested)
 	{
-		total += func(v);
+		const PowApprox_Stats &e = record.error;
+		std::cout
+			<< "\tError:" << std::endl
+			<< "\t\tRMS:  " << std::sqrt(e.mean_sq_error) << std::endl
+			<< "\t\tmean: " << e.mean_error << std::endl
+			<< "\t\tmin:  " << e.min_error << " @ " << e.min_error_arg << std::endl
+			<< "\t\tmax:  " << e.max_error << " @ " << e.max_error_arg << std::endl;
 	}
-	auto end = std::chrono::high_resolution_clock::now();
-	std::cout << std::dec << std::setw(12) << (end-start).count()
-		<< " | " << name << std::endl;
+	std::cout << "\tCertified worst-case error: " << record.certified << std::endl;
+	std::cout << "*/" << std::endl;
+	
+	Print_Generated_Root(std::cout, best, prefix) << std::endl << std::endl;
+	return best;
 }
 
-template<int ROOT, typename T_Float, unsigned NewtonSteps, BEST_APPROX_BASIS Basis>
-void generate_root_functions()
+template<int P, int Q, typename T_Float, unsigned NewtonSteps>
+void generate_pow_functions()
 {
-	auto best = RootApprox_Best<ROOT, T_Float, NewtonSteps, Basis>();
+	auto best = PowApprox_Best<P, Q, T_Float, NewtonSteps>(THREADS);
+	auto range = best.test_param_range();
 	
 	std::cout << "/*" << std::endl;
-	char name[] = "0 newtonian steps";
-	name[0] = char('0' + NewtonSteps);
-	Print_Test_Root_Approx<ROOT>(name, best);
+	std::cout << "\tApproximate x^(" << std::dec << P << "/" << Q << ") with " << NewtonSteps << " newtonian steps" << std::endl;
+	if (sizeof(T_Float) <= 4)
+	{
+		auto test = Test_Pow_Approx<P, Q>(best, range.first, range.second, THREADS);
+		std::cout
+			<< "\tError:" << std::endl
+			<< "\t\tRMS:  " << std::sqrt(test.mean_sq_error) << std::endl
+			<< "\t\tmean: " << test.mean_error << std::endl
+			<< "\t\tmin:  " << test.min_error << " @ " << test.min_error_arg << std::endl
+			<< "\t\tmax:  " << test.max_error << " @ " << test.max_error_arg << std::endl;
+	}
+	std::cout << "\tAnalytic worst-case error: " << best.error_worstCase() << std::endl;
 	std::cout << "*/" << std::endl;
 	
 	std::cout << best << std::endl << std::endl;
 }
 
+template<int ROOT, unsigned NewtonSteps>
+void generate_simd_functions(std::ostream &out, const char *prefix, const RootApprox<ROOT, float, NewtonSteps> &design)
+{
+	for (GENERATED_ISA isa : {GENERATED_SSE41, GENERATED_AVX2, GENERATED_AVX512})
+		Print_Generated_SIMD(out, design, isa, prefix) << std::endl << std::endl;
+	Print_Generated_Batch(out, design, prefix) << std::endl << std::endl;
+	for (GENERATED_ISA isa : {GENERATED_SSE41, GENERATED_AVX2, GENERATED_AVX512})
+		Print_Generated_SIMD(out, design, isa, prefix, ROOT_SAFE) << std::endl << std::endl;
+	Print_Generated_Batch(out, design, prefix, ROOT_SAFE) << std::endl << std::endl;
+}
+
+template<unsigned NewtonSteps>
+void generate_simd_family(const char *prefix)
+{
+	generate_simd_functions(std::cout, prefix, RootApprox_Tuned< 2, float, NewtonSteps>());
+	generate_simd_functions(std::cout, prefix, RootApprox_Tuned<-2, float, NewtonSteps>());
+	generate_simd_functions(std::cout, prefix, RootApprox_Tuned< 3, float, NewtonSteps>());
+	generate_simd_functions(std::cout, prefix, RootApprox_Tuned<-3, float, NewtonSteps>());
+	generate_simd_functions(std::cout, prefix, RootApprox_Tuned< 4, float, NewtonSteps>());
+	generate_simd_functions(std::cout, prefix, RootApprox_Tuned<-4, float, NewtonSteps>());
+}
+
+/*
+	A published function: its scalar version, from the design store, with
+	its safe variant, and its vector kernels, printed separately so they
+	can follow all scalars.
+*/
+template<int ROOT, unsigned NewtonSteps>
+void generate_published_root(Design_Database &designs, const char *prefix, std::ostream &simd)
+{
+	auto design = generate_root_functions<ROOT, float, NewtonSteps, BEST_WORST_CASE>(designs, prefix);
+	Print_Generated_Root(std::cout, design, prefix, ROOT_SAFE) << std::endl << std::endl;
+	generate_simd_functions(simd, prefix, design);
+}
+
+template<unsigned NewtonSteps>
+void generate_published_family(Design_Database &designs, const char *prefix, std::ostream &simd)
+{
+	generate_published_root< 2, NewtonSteps>(designs, prefix, simd);
+	generate_published_root<-2, NewtonSteps>(designs, prefix, simd);
+	generate_published_root< 3, NewtonSteps>(designs, prefix, simd);
+	generate_published_root<-3, NewtonSteps>(designs, prefix, simd);
+	generate_published_root< 4, NewtonSteps>(designs, prefix, simd);
+	generate_published_root<-4, NewtonSteps>(designs, prefix, simd);
+}
+
+/*
+	Record the published designs in the store, measured but not searched, so
+	that generating the header doesn't replace them with fresh search results.
+*/
+template<unsigned NewtonSteps>
+void seed_published_family(Design_Database &designs)
+{
+	designs.store(Design_Record_Measure<BEST_WORST_CASE>(RootApprox_Tuned< 2, float, NewtonSteps>(), THREADS));
+	designs.store(Design_Record_Measure<BEST_WORST_CASE>(RootApprox_Tuned<-2, float, NewtonSteps>(), THREADS));
+	designs.store(Design_Record_Measure<BEST_WORST_CASE>(RootApprox_Tuned< 3, float, NewtonSteps>(), THREADS));
+	designs.store(Design_Record_Measure<BEST_WORST_CASE>(RootApprox_Tuned<-3, float, NewtonSteps>(), THREADS));
+	designs.store(Design_Record_Measure<BEST_WORST_CASE>(RootApprox_Tuned< 4, float, NewtonSteps>(), THREADS));
+	designs.store(Design_Record_Measure<BEST_WORST_CASE>(RootApprox_Tuned<-4, float, NewtonSteps>(), THREADS));
+}
+
+/*
+	Check a generated kernel against its reference over a sample of all float
+	bit patterns, treating NaN as equal to NaN.  Returns the mismatch count.
+*/
+template<typename T_Kernel, typename T_Reference>
+static uint64_t check_simd_kernel(const char *name, const T_Kernel &kernel, const T_Reference &reference)
+{
+	static const uint32_t STRIDE = 257;
+	uint64_t checked = 0, mismatched = 0;
+	float y[64], x[64];
+	for (uint64_t bits = 0; bits <= 0xFFFFFFFFu; )
+	{
+		size_t n = 0;
+		for (; n < 64 && bits <= 0xFFFFFFFFu; ++n, bits += STRIDE)
+			y[n] = reinterpret_int_float(int32_t(uint32_t(bits)));
+		kernel(y, x, n);
+		for (size_t j = 0; j < n; ++j)
+		{
+			const float expect = reference(y[j]);
+			if (std::isnan(expect) ? !std::isnan(x[j]) :
+				(reinterpret_float_int(expect) != reinterpret_float_int(x[j])))
+			{
+				if (!mismatched) std::cout << "\t\tfirst mismatch @ " << y[j] << ": " << x[j] << " != " << expect << std::endl;
+				++mismatched;
+			}
+		}
+		checked += n;
+	}
+	std::cout << "\t" << std::left << std::setw(28) << name << std::right << std::dec
+		<< checked << " checked, " << mismatched << " mismatched" << std::endl;
+	return mismatched;
+}
+
+/*
+	Generated kernels must reproduce the scalar function (SSE4.1) or the
+	fused reference (AVX2, AVX-512) bit for bit.  Build with -ffp-contract=off
+	so that the compiler doesn't fuse the unfused references.
+*/
+template<int ROOT, unsigned NewtonSteps, typename T_Scalar, typename T_Batch>
+static uint64_t check_simd_functions(const char *name, const T_Scalar &scalar, const T_Batch &batch)
+{
+	using unfused = simd::root_kernel<ROOT, NewtonSteps, simd::ops_scalar<float, false>>;
+	using fused   = simd::root_kernel<ROOT, NewtonSteps, simd::ops_scalar<float, true>>;
+	const auto design = RootApprox_Tuned<ROOT, float, NewtonSteps>();
+	const unfused reference(design);
+	const fused   reference_fused(design);
+	
+	std::string label(name);
+	uint64_t failures = 0;
+	
+	failures += check_simd_kernel((label + " design").c_str(),
+		[&](const float *y, float *x, size_t n) {for (size_t i = 0; i < n; ++i) x[i] = design(y[i]);}, scalar);
+	failures += check_simd_kernel((label + " reference").c_str(),
+		[&](const float *y, float *x, size_t n) {for (size_t i = 0; i < n; ++i) x[i] = reference(y[i]);}, scalar);
+#if defined(__AVX512F__)
+	failures += check_simd_kernel((label + "_batch").c_str(), batch, reference_fused);
+#elif defined(__AVX2__) && defined(__FMA__)
+	failures += check_simd_kernel((label + "_batch").c_str(), batch, reference_fused);
+#else
+	failures += check_simd_kernel((label + "_batch").c_str(), batch, scalar);
+#endif
+	(void) reference_fused;
+	return failures;
+}
+
+template<int ROOT, unsigned NewtonSteps, unsigned TableBits>
+void generate_table_functions(const char *prefix)
+{
+	auto best = RootTableApprox_Best<ROOT, float, NewtonSteps, TableBits>(THREADS);
+	
+	std::cout << "/*" << std::endl;
+	std::cout << "\tApproximate x^(1/" << double(ROOT) << ") with a " << std::dec << best.table_size
+		<< "-entry table and " << NewtonSteps << " newtonian steps" << std::endl;
+	auto range = best.test_param_range();
+	auto test = Test_Root_Approx<ROOT>(best, range.first, range.second, THREADS);
+	std::cout
+		<< "\tError:" << std::endl
+		<< "\t\tRMS:  " << std::sqrt(test.mean_sq_error) << std::endl
+		<< "\t\tmean: " << test.mean_error << std::endl
+		<< "\t\tmin:  " << test.min_error << " @ " << test.min_error_arg << std::endl
+		<< "\t\tmax:  " << test.max_error << " @ " << test.max_error_arg << std::endl;
+	std::cout << "\tAnalytic worst-case error: " << best.error_worstCase() << std::endl;
+	std::cout << "*/" << std::endl;
+	
+	Print_Generated_Root_Table(std::cout, best, prefix) << std::endl << std::endl;
+}
+
+template<unsigned NewtonSteps, unsigned TableBits>
+void generate_table_family(const char *prefix)
+{
+	generate_table_functions< 2, NewtonSteps, TableBits>(prefix);
+	generate_table_functions<-2, NewtonSteps, TableBits>(prefix);
+	generate_table_functions< 3, NewtonSteps, TableBits>(prefix);
+	generate_table_functions<-3, NewtonSteps, TableBits>(prefix);
+	generate_table_functions< 4, NewtonSteps, TableBits>(prefix);
+	generate_table_functions<-4, NewtonSteps, TableBits>(prefix);
+}
+
+/*
+	Inputs outside the fast domain must give the results listed at ROOT_DOMAIN,
+	with NaNs returned bit for bit.  Denormals must be within the certified
+	worst-case error, plus rounding, of the true root.
+*/
+template<int ROOT, typename T_Scalar>
+static uint64_t check_safe_domain(const char *name, const T_Scalar &safe, const double worst_case)
+{
+	static const float inf = std::numeric_limits<float>::infinity();
+	uint64_t checked = 0, mismatched = 0;
+	
+	auto check = [&](const float y)
+	{
+		const float x = safe(y);
+		bool ok;
+		if      (std::isnan(y))             ok = (reinterpret_float_int(x) == reinterpret_float_int(y));
+		else if (y < 0 && ROOT % 2 == 0)    ok = std::isnan(x);
+		else if (y == 0)        ok = (reinterpret_float_int(x) == reinterpret_float_int((ROOT > 0) ? y : std::copysign(inf, y)));
+		else if (std::isinf(y)) ok = (reinterpret_float_int(x) == reinterpret_float_int((ROOT > 0) ? y : std::copysign(0.f, y)));
+		else if (y < 0)         ok = (reinterpret_float_int(x) == reinterpret_float_int(-safe(-y)));
+		else                    ok = (std::abs(double(x) / root_i<ROOT>(double(y)) - 1.0) <= worst_case);
+		if (!ok && !mismatched) std::cout << "\t\tfirst mismatch @ " << y << ": " << x << std::endl;
+		mismatched += !ok;
+		++checked;
+	};
+	
+	for (const float y : {0.f, -0.f, inf, -inf, std::numeric_limits<float>::quiet_NaN(), -std::numeric_limits<float>::quiet_NaN(),
+		std::numeric_limits<float>::signaling_NaN(), -1.f, -4.f, -8.f, -1e30f, -1e-30f})
+		check(y);
+	for (uint32_t bits = 1; bits < 0x00800000u; bits += 31)
+	{
+		check(reinterpret_int_float(int32_t(bits)));
+		check(reinterpret_int_float(int32_t(bits | 0x80000000u)));
+	}
+	std::cout << "\t" << std::left << std::setw(28) << name << std::right << std::dec
+		<< checked << " checked, " << mismatched << " mismatched" << std::endl;
+	return mismatched;
+}
+
+/*
+	NaNs, quiet and signaling with either sign and assorted payloads,
+	must pass through a batch function bit for bit.
+*/
+template<typename T_Batch>
+static uint64_t check_safe_nan(const char *name, const T_Batch &batch)
+{
+	std::vector<float> y, x;
+	for (uint32_t bits = 0x7f800001u; bits <= 0x7fffffffu; bits += 4099)
+	{
+		y.push_back(reinterpret_int_float(int32_t(bits)));
+		y.push_back(reinterpret_int_float(int32_t(bits | 0x80000000u)));
+	}
+	y.push_back(reinterpret_int_float(int32_t(0x7fffffffu)));
+	y.push_back(reinterpret_int_float(int32_t(0xffffffffu)));
+	x.resize(y.size());
+	batch(y.data(), x.data(), y.size());
+	
+	uint64_t mismatched = 0;
+	for (size_t i = 0; i < y.size(); ++i)
+	{
+		if (reinterpret_float_int(x[i]) == reinterpret_float_int(y[i])) continue;
+		if (!mismatched) std::cout << "\t\tfirst mismatch @ 0x" << std::hex << uint32_t(reinterpret_float_int(y[i]))
+			<< ": 0x" << uint32_t(reinterpret_float_int(x[i])) << std::dec << std::endl;
+		++mismatched;
+	}
+	std::cout << "\t" << std::left << std::setw(28) << name << std::right << std::dec
+		<< y.size() << " checked, " << mismatched << " mismatched" << std::endl;
+	return mismatched;
+}
+
+/*
+	Generated safe functions must reproduce RootApprox_Safe (scalar) or the
+	fused safe_kernel (batches, with AVX2 or AVX-512) bit for bit.
+*/
+template<int ROOT, unsigned NewtonSteps, typename T_Scalar, typename T_Batch>
+static uint64_t check_safe_functions(const char *name, const T_Scalar &scalar, const T_Batch &batch)
+{
+	using fused = simd::safe_kernel<ROOT, NewtonSteps, simd::ops_scalar<float, true>>;
+	const RootApprox_Safe<ROOT, float, NewtonSteps> design = RootApprox_Tuned<ROOT, float, NewtonSteps>();
+	const fused reference_fused(design);
+	const double worst_case = design.error_worstCase_certified() + std::numeric_limits<float>::epsilon();
+	
+	std::string label(name);
+	uint64_t failures = 0;
+	auto apply = [&](const float *y, float *x, size_t n) {design.apply(y, x, n);};
+	
+	failures += check_simd_kernel((label + " design").c_str(),
+		[&](const float *y, float *x, size_t n) {for (size_t i = 0; i < n; ++i) x[i] = design(y[i]);}, scalar);
+#if defined(__AVX512F__) || (defined(__AVX2__) && defined(__FMA__))
+	failures += check_simd_kernel((label + " apply").c_str(), apply, reference_fused);
+	failures += check_simd_kernel((label + "_batch").c_str(), batch, reference_fused);
+#else
+	failures += check_simd_kernel((label + " apply").c_str(), apply, scalar);
+	failures += check_simd_kernel((label + "_batch").c_str(), batch, scalar);
+#endif
+	failures += check_safe_domain<ROOT>((label + " domain").c_str(), scalar, worst_case);
+	failures += check_safe_nan((label + " NaN").c_str(),
+		[&](const float *y, float *x, size_t n) {for (size_t i = 0; i < n; ++i) x[i] = scalar(y[i]);});
+	failures += check_safe_nan((label + " apply NaN").c_str(), apply);
+	failures += check_safe_nan((label + "_batch NaN").c_str(), batch);
+	(void) reference_fused;
+	return failures;
+}
+
+/*
+	Each dispatch entry the processor runs must reproduce the scalar kernel
+	with its FMA usage bit for bit, as must Dispatch_Apply.
+*/
+template<int ROOT, unsigned NewtonSteps, ROOT_DOMAIN Domain, typename T_Design>
+static uint64_t check_dispatch_entries(const char *name, const T_Design &design)
+{
+	using table = simd::dispatch_table<Domain, ROOT, float, NewtonSteps>;
+	using scalar = simd::ops_scalar<float, false>;
+	using fused  = simd::ops_scalar<float, true>;
+	using kernel = typename std::conditional<Domain == ROOT_SAFE,
+		simd::safe_kernel<ROOT, NewtonSteps, scalar>, simd::root_kernel<ROOT, NewtonSteps, scalar>>::type;
+	using kernel_fused = typename std::conditional<Domain == ROOT_SAFE,
+		simd::safe_kernel<ROOT, NewtonSteps, fused>, simd::root_kernel<ROOT, NewtonSteps, fused>>::type;
+	const kernel       reference(design);
+	const kernel_fused reference_fused(design);
+	auto expect = [&](const ROOT_ISA isa, const float y)    {return (isa >= ROOT_ISA_AVX2) ? reference_fused(y) : reference(y);};
+	
+	std::string label(name);
+	uint64_t failures = 0;
+	for (int i = ROOT_ISA_SCALAR; i <= Dispatch_Detect(); ++i)
+	{
+		const ROOT_ISA isa = ROOT_ISA(i);
+		const auto entry = table::entry(isa);
+		if (!entry) continue;
+		failures += check_simd_kernel((label + " " + Dispatch_ISA_Name(isa)).c_str(),
+			[&](const float *y, float *x, size_t n) {entry(design, y, x, n);},
+			[&](const float y) {return expect(isa, y);});
+	}
+	ROOT_ISA selected = Dispatch_ISA();
+	while (!table::entry(selected)) selected = ROOT_ISA(selected - 1);
+	failures += check_simd_kernel((label + " dispatched").c_str(),
+		[&](const float *y, float *x, size_t n) {Dispatch_Apply(design, y, x, n);},
+		[&](const float y) {return expect(selected, y);});
+	return failures;
+}
+
+/*
+	Interleaved vectors copied into component arrays, for the SoA entry points.
+*/
+template<typename T_Float, unsigned C>
+struct Vector_Components
+{
+	std::vector<T_Float> c[C];
+
+	Vector_Components(const T_Float *v, const size_t count)
+		{for (unsigned k = 0; k < C; ++k) for (size_t i = 0; i < count; ++i) c[k].push_back(v[i*C + k]);}
+	T_Float *operator[](const unsigned k)    {return c[k].data();}
+	void interleave(T_Float *out) const
+		{for (unsigned k = 0; k < C; ++k) for (size_t i = 0; i < c[k].size(); ++i) out[i*C + k] = c[k][i];}
+};
+
+/*
+	A vector entry point, called on counts that are not multiples of any SIMD
+	width, must give each vector what a call for it alone gives, bit for bit.
+	Zero, tiny and NaN vectors must give the zero-length results.
+	call(v, out, count) reads count interleaved vectors from v and writes one
+	result per vector to out, or C for normalization, also interleaved.
+*/
+template<simd::VECTOR_OP Op, typename T_Float, unsigned C, typename T_Call>
+static uint64_t check_vector_entry(const char *name, const T_Call &call)
+{
+	static const unsigned OUT = (Op == simd::VECTOR_NORMALIZE) ? C : 1;
+	static const size_t COUNTS[] = {1, 3, 7, 13, 37, 67};
+	static const size_t MAX_COUNT = 67;
+	const T_Float tiny = std::numeric_limits<T_Float>::min(), nan = std::numeric_limits<T_Float>::quiet_NaN();
+
+	// Every fifth vector is a zero, tiny or NaN vector, with a component or two set
+	std::vector<T_Float> v(MAX_COUNT * C);
+	std::vector<bool> special(MAX_COUNT);
+	uint32_t seed = 12345;
+	for (size_t i = 0; i < MAX_COUNT; ++i)
+	{
+		special[i] = (i % 5 == 2);
+		for (unsigned k = 0; k < C; ++k)
+		{
+			seed = seed * 1664525u + 1013904223u;
+			const T_Float r = std::ldexp(T_Float(int32_t(seed >> 8) - (1 << 23)), int(seed % 41) - 43);
+			switch (special[i] ? (i / 5) % 5 : 5)
+			{
+			case 0: v[i*C + k] = T_Float(0); break;
+			case 1: v[i*C + k] = (k & 1) ? -T_Float(0) : T_Float(0); break;
+			case 2: v[i*C + k] = (k == 0) ? tiny : T_Float(0); break;
+			case 3: v[i*C + k] = (k & 1) ? -tiny : tiny; break;
+			case 4: v[i*C + k] = (k == C-1) ? nan : r; break;
+			default: v[i*C + k] = r; break;
+			}
+		}
+	}
+
+	std::vector<T_Float> single(MAX_COUNT * OUT);
+	for (size_t i = 0; i < MAX_COUNT; ++i) call(&v[i*C], &single[i*OUT], 1);
+
+	auto same = [](const T_Float a, const T_Float b)
+		{return std::isnan(a) ? std::isnan(b) : (reinterpret_float_int(a) == reinterpret_float_int(b));};
+	uint64_t checked = 0, mismatched = 0;
+	for (size_t i = 0; i < MAX_COUNT; ++i)
+	{
+		if (!special[i]) continue;
+		for (unsigned k = 0; k < OUT; ++k)
+		{
+			const T_Float x = single[i*OUT + k];
+			if ((Op == simd::VECTOR_INVERSE_LENGTH) ? (x == std::numeric_limits<T_Float>::infinity()) : (x == T_Float(0))) continue;
+			if (!mismatched) std::cout << "\t\tvector " << i << " isn't zero-length: " << x << std::endl;
+			++mismatched;
+		}
+	}
+	for (const size_t count : COUNTS)
+	{
+		std::vector<T_Float> batch(count * OUT);
+		call(v.data(), batch.data(), count);
+		for (size_t j = 0; j < count * OUT; ++j)
+		{
+			if (same(batch[j], single[j])) continue;
+			if (!mismatched) std::cout << "\t\tfirst mismatch @ count " << count << ", vector " << j / OUT
+				<< ": " << batch[j] << " != " << single[j] << std::endl;
+			++mismatched;
+		}
+		checked += count;
+	}
+	std::cout << "\t" << std::left << std::setw(32) << name << std::right << std::dec
+		<< checked << " checked, " << mismatched << " mismatched" << std::endl;
+	return mismatched;
+}
+
+template<typename T_Float>
+static uint64_t check_vector_entries(const char *type)
+{
+	using simd::VECTOR_LENGTH;
+	using simd::VECTOR_INVERSE_LENGTH;
+	using simd::VECTOR_NORMALIZE;
+	using V2 = Vector_Components<T_Float, 2>;
+	using V3 = Vector_Components<T_Float, 3>;
+	using V4 = Vector_Components<T_Float, 4>;
+	const std::string t = std::string(" ") + type;
+	uint64_t failures = 0;
+
+	failures += check_vector_entry<VECTOR_LENGTH, T_Float, 2>(("rb_hypot AoS" + t).c_str(),
+		[](const T_Float *v, T_Float *out, size_t n) {rb_hypot(v, out, n);});
+	failures += check_vector_entry<VECTOR_LENGTH, T_Float, 2>(("rb_hypot SoA" + t).c_str(),
+		[](const T_Float *v, T_Float *out, size_t n) {V2 s(v, n); rb_hypot(s[0], s[1], out, n);});
+	failures += check_vector_entry<VECTOR_LENGTH, T_Float, 3>(("rb_length3 AoS" + t).c_str(),
+		[](const T_Float *v, T_Float *out, size_t n) {rb_length3(v, out, n);});
+	failures += check_vector_entry<VECTOR_LENGTH, T_Float, 3>(("rb_length3 SoA" + t).c_str(),
+		[](const T_Float *v, T_Float *out, size_t n) {V3 s(v, n); rb_length3(s[0], s[1], s[2], out, n);});
+	failures += check_vector_entry<VECTOR_LENGTH, T_Float, 4>(("rb_length4 AoS" + t).c_str(),
+		[](const T_Float *v, T_Float *out, size_t n) {rb_length4(v, out, n);});
+	failures += check_vector_entry<VECTOR_LENGTH, T_Float, 4>(("rb_length4 SoA" + t).c_str(),
+		[](const T_Float *v, T_Float *out, size_t n) {V4 s(v, n); rb_length4(s[0], s[1], s[2], s[3], out, n);});
+	failures += check_vector_entry<VECTOR_INVERSE_LENGTH, T_Float, 3>(("rb_inverse_length3 AoS" + t).c_str(),
+		[](const T_Float *v, T_Float *out, size_t n) {rb_inverse_length3(v, out, n);});
+	failures += check_vector_entry<VECTOR_INVERSE_LENGTH, T_Float, 3>(("rb_inverse_length3 SoA" + t).c_str(),
+		[](const T_Float *v, T_Float *out, size_t n) {V3 s(v, n); rb_inverse_length3(s[0], s[1], s[2], out, n);});
+	failures += check_vector_entry<VECTOR_INVERSE_LENGTH, T_Float, 4>(("rb_inverse_length4 AoS" + t).c_str(),
+		[](const T_Float *v, T_Float *out, size_t n) {rb_inverse_length4(v, out, n);});
+	failures += check_vector_entry<VECTOR_INVERSE_LENGTH, T_Float, 4>(("rb_inverse_length4 SoA" + t).c_str(),
+		[](const T_Float *v, T_Float *out, size_t n) {V4 s(v, n); rb_inverse_length4(s[0], s[1], s[2], s[3], out, n);});
+	failures += check_vector_entry<VECTOR_NORMALIZE, T_Float, 3>(("rb_normalize3 AoS" + t).c_str(),
+		[](const T_Float *v, T_Float *out, size_t n) {rb_normalize3(v, out, n);});
+	failures += check_vector_entry<VECTOR_NORMALIZE, T_Float, 3>(("rb_normalize3 SoA" + t).c_str(),
+		[](const T_Float *v, T_Float *out, size_t n) {V3 s(v, n); rb_normalize3(s[0], s[1], s[2], n); s.interleave(out);});
+	failures += check_vector_entry<VECTOR_NORMALIZE, T_Float, 4>(("rb_normalize4 AoS" + t).c_str(),
+		[](const T_Float *v, T_Float *out, size_t n) {rb_normalize4(v, out, n);});
+	failures += check_vector_entry<VECTOR_NORMALIZE, T_Float, 4>(("rb_normalize4 SoA" + t).c_str(),
+		[](const T_Float *v, T_Float *out, size_t n) {V4 s(v, n); rb_normalize4(s[0], s[1], s[2], s[3], n); s.interleave(out);});
+	return failures;
+}
+
+/*
+	An ops struct's div_i<D> over count dividends, a multiple of its width.
+	Defined again for each instruction set, as the dispatch kernels are, so
+	that vectors never pass between functions built for different targets.
+*/
+#define ROOTBEER_DIV_OPS \
+	template<typename Ops, int D> \
+	void div_ops(const typename Ops::int_t *i, typename Ops::int_t *q, const size_t count) \
+		{for (size_t j = 0; j < count; j += Ops::width) Ops::storeu_i(q + j, Ops::template div_i<D>(Ops::loadu_i(i + j)));}
+
+namespace div_native {ROOTBEER_DIV_OPS}
+#if defined(ROOTBEER_HAS_SSE41)
+ROOTBEER_TARGET_BEGIN("sse4.1")
+namespace div_sse41 {ROOTBEER_DIV_OPS}
+ROOTBEER_TARGET_END
+#endif
+#if defined(ROOTBEER_HAS_AVX2)
+ROOTBEER_TARGET_BEGIN("avx2,fma")
+namespace div_avx2 {ROOTBEER_DIV_OPS}
+ROOTBEER_TARGET_END
+#endif
+#if defined(ROOTBEER_HAS_AVX512)
+ROOTBEER_AVX512_BEGIN
+ROOTBEER_TARGET_BEGIN("avx512f")
+namespace div_avx512 {ROOTBEER_DIV_OPS}
+ROOTBEER_TARGET_END
+ROOTBEER_AVX512_END
+#endif
+#undef ROOTBEER_DIV_OPS
+
+template<typename T_Int, int D>
+static void div_detail(const T_Int *i, T_Int *q, const size_t count)    {for (size_t j = 0; j < count; ++j) q[j] = detail::div_i<D>(i[j]);}
+
+template<typename T_Int>
+struct Div_Check_Entry
+{
+	const char *name;
+	void      (*divide)(const T_Int*, T_Int*, size_t);
+};
+
+static const size_t DIV_CHECK_BLOCK = 4096;
+
+/*
+	Compare each entry's quotients by D with those of / over blocks of
+	dividends, on THREADS; fill(b, i) writes the DIV_CHECK_BLOCK dividends
+	of block b.  Returns the mismatch count.
+*/
+template<typename T_Int, int D, typename T_Fill>
+static uint64_t check_div_entries(const char *type, const std::vector<Div_Check_Entry<T_Int>> &entries,
+	const size_t blocks, const T_Fill &fill)
+{
+	std::vector<std::atomic<uint64_t>> mismatched(entries.size());
+	std::vector<int64_t> example(entries.size());
+	THREADS.parallel_for(blocks, [&](const size_t b)
+	{
+		T_Int i[DIV_CHECK_BLOCK], q[DIV_CHECK_BLOCK], expect[DIV_CHECK_BLOCK];
+		fill(b, i);
+		for (size_t j = 0; j < DIV_CHECK_BLOCK; ++j) expect[j] = T_Int(i[j] / D);
+		for (size_t e = 0; e < entries.size(); ++e)
+		{
+			entries[e].divide(i, q, DIV_CHECK_BLOCK);
+			for (size_t j = 0; j < DIV_CHECK_BLOCK; ++j)
+				if (q[j] != expect[j] && mismatched[e].fetch_add(1) == 0) example[e] = int64_t(i[j]);
+		}
+	});
+
+	uint64_t failures = 0;
+	for (size_t e = 0; e < entries.size(); ++e)
+	{
+		const std::string name = std::string("div_i<") + std::to_string(D) + "> " + type + " " + entries[e].name;
+		if (mismatched[e]) std::cout << "\t\tfirst mismatch @ " << example[e] << ": "
+			<< int64_t(detail::div_i<D>(T_Int(example[e]))) << " != " << int64_t(T_Int(example[e]) / D) << std::endl;
+		std::cout << "\t" << std::left << std::setw(40) << name << std::right << std::dec
+			<< blocks * DIV_CHECK_BLOCK << " checked, " << mismatched[e] << " mismatched" << std::endl;
+		failures += mismatched[e];
+	}
+	return failures;
+}
+
+/*
+	detail::div_i<D> and every ops struct's div_i<D> the processor runs must
+	match / for every 16- and 32-bit dividend, and for 2^24 64-bit dividends:
+	random, of random magnitude, beside multiples of D and beside the limits.
+*/
+template<int D>
+static uint64_t check_div_by()
+{
+	using namespace simd;
+	const ROOT_ISA isa = Dispatch_Detect();
+	std::vector<Div_Check_Entry<int16_t>> e16 = {{"detail", div_detail<int16_t, D>},
+		{"ops_scalar", div_native::div_ops<ops_scalar<float16, false>, D>}};
+	std::vector<Div_Check_Entry<int32_t>> e32 = {{"detail", div_detail<int32_t, D>},
+		{"ops_scalar", div_native::div_ops<ops_scalar<float, false>, D>}};
+	std::vector<Div_Check_Entry<int64_t>> e64 = {{"detail", div_detail<int64_t, D>},
+		{"ops_scalar", div_native::div_ops<ops_scalar<double, false>, D>}};
+#if defined(__AVX512FP16__)
+	e16.push_back({"ops_avx512_f16", div_native::div_ops<ops_avx512_f16, D>});
+#endif
+#if defined(ROOTBEER_HAS_SSE41)
+	if (isa >= ROOT_ISA_SSE41)
+	{
+		e32.push_back({"ops_sse41_f32", div_sse41::div_ops<ops_sse41_f32, D>});
+		e64.push_back({"ops_sse41_f64", div_sse41::div_ops<ops_sse41_f64, D>});
+	}
+#endif
+#if defined(ROOTBEER_HAS_AVX2)
+	if (isa >= ROOT_ISA_AVX2)
+	{
+		e32.push_back({"ops_avx2_f32", div_avx2::div_ops<ops_avx2_f32, D>});
+		e64.push_back({"ops_avx2_f64", div_avx2::div_ops<ops_avx2_f64, D>});
+	}
+#endif
+#if defined(ROOTBEER_HAS_AVX512)
+	if (isa >= ROOT_ISA_AVX512)
+	{
+		e32.push_back({"ops_avx512_f32", div_avx512::div_ops<ops_avx512_f32, D>});
+		e64.push_back({"ops_avx512_f64", div_avx512::div_ops<ops_avx512_f64, D>});
+	}
+#endif
+	(void) isa;
+
+	auto mix = [](uint64_t z)
+	{
+		z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9u;
+		z = (z ^ (z >> 27)) * 0x94d049bb133111ebu;
+		return z ^ (z >> 31);
+	};
+	static const uint64_t LIMITS[4] = {uint64_t(INT64_MIN), uint64_t(INT64_MAX), 0, uint64_t(-1)};
+
+	uint64_t failures = 0;
+	failures += check_div_entries<int16_t, D>("int16", e16, 0x10000 / DIV_CHECK_BLOCK,
+		[](const size_t b, int16_t *i) {for (size_t j = 0; j < DIV_CHECK_BLOCK; ++j) i[j] = int16_t(uint16_t(b * DIV_CHECK_BLOCK + j));});
+	failures += check_div_entries<int32_t, D>("int32", e32, size_t(0x100000000u / DIV_CHECK_BLOCK),
+		[](const size_t b, int32_t *i) {for (size_t j = 0; j < DIV_CHECK_BLOCK; ++j) i[j] = int32_t(uint32_t(b * DIV_CHECK_BLOCK + j));});
+	failures += check_div_entries<int64_t, D>("int64", e64, (size_t(1) << 24) / DIV_CHECK_BLOCK,
+		[&](const size_t b, int64_t *i)
+		{
+			for (size_t j = 0; j < DIV_CHECK_BLOCK; ++j)
+			{
+				const uint64_t r = mix(b * DIV_CHECK_BLOCK + j + uint64_t(D) * 0x9e3779b97f4a7c15u);
+				switch (j % 4)
+				{
+				case 0:  i[j] = int64_t(r); break;
+				case 1:  i[j] = int64_t(r) >> (r & 63); break;
+				case 2:  i[j] = int64_t(uint64_t(int64_t(r) / D * D) + (r >> 62) - 1); break;
+				default: i[j] = int64_t(LIMITS[r & 3] + (r >> 56) - 128); break;
+				}
+			}
+		});
+	return failures;
+}
+
+template<int ROOT, unsigned Degree>
+void generate_minimax_functions(const char *prefix)
+{
+	auto best = RootMinimaxApprox_Best<ROOT, float, Degree>(THREADS);
+	
+	std::cout << "/*" << std::endl;
+	std::cout << "\tApproximate x^(1/" << double(ROOT) << ") with a minimax polynomial of degree " << std::dec << Degree << std::endl;
+	auto range = best.test_param_range();
+	auto test = Test_Root_Approx<ROOT>(best, range.first, range.second, THREADS);
+	std::cout
+		<< "\tError:" << std::endl
+		<< "\t\tRMS:  " << std::sqrt(test.mean_sq_error) << std::endl
+		<< "\t\tmean: " << test.mean_error << std::endl
+		<< "\t\tmin:  " << test.min_error << " @ " << test.min_error_arg << std::endl
+		<< "\t\tmax:  " << test.max_error << " @ " << test.max_error_arg << std::endl;
+	std::cout << "\tAnalytic worst-case error, before rounding: " << best.error_worstCase() << std::endl;
+	std::cout << "*/" << std::endl;
+	
+	Print_Generated_Root_Minimax(std::cout, best, prefix) << std::endl << std::endl;
+}
+
+template<unsigned Degree>
+void generate_minimax_family(const char *prefix)
+{
+	generate_minimax_functions< 2, Degree>(prefix);
+	generate_minimax_functions<-2, Degree>(prefix);
+	generate_minimax_functions< 3, Degree>(prefix);
+	generate_minimax_functions<-3, Degree>(prefix);
+	generate_minimax_functions< 4, Degree>(prefix);
+	generate_minimax_functions<-4, Degree>(prefix);
+}
+
+/*
+	Measure a 16-bit design over every input: error of the scalar function and
+	of batches over the test range, which must agree, and whether each batch
+	result matches the scalar tail's.  Returns the number of mismatches, plus
+	one if the scalar and batch errors differ.
+*/
+template<int ROOT, typename T_Float, unsigned NewtonSteps>
+static uint64_t check_half_design(const RootApprox<ROOT, T_Float, NewtonSteps> &design)
+{
+	std::vector<T_Float> y(65536), x(65536), tail(65536);
+	for (size_t i = 0; i < y.size(); ++i) y[i] = detail::bit_cast<T_Float>(uint16_t(i));
+	design.apply(y.data(), x.data(), y.size());
+	
+	uint64_t mismatches = 0;
+	for (size_t i = 0; i < y.size(); ++i)
+	{
+		design.apply(&y[i], &tail[i], 1);
+		if (detail::bit_cast<uint16_t>(tail[i]) != detail::bit_cast<uint16_t>(x[i])) ++mismatches;
+	}
+	
+	const auto range = design.test_param_range();
+	auto scalar = Test_Root_Approx<ROOT>(design, range.first, range.second);
+	auto batch  = Test_Root_Approx<ROOT>([&](const T_Float v) {return x[detail::bit_cast<uint16_t>(v)];}, range.first, range.second);
+	
+	std::cout << "//  " << detail::float_traits<T_Float>::name() << " x^(1/" << std::dec << ROOT << "), "
+		<< NewtonSteps << " steps: k=0x" << std::hex << design.constant << ", m=";
+	for (unsigned s = 0; s < NewtonSteps; ++s) std::cout << (s ? "," : "") << double(design.newton_m[s]);
+	std::cout << std::endl
+		<< "//    scalar worst " << scalar.worst_error() << ", RMS " << std::sqrt(scalar.mean_sq_error)
+		<< "; batch worst " << batch.worst_error() << ", RMS " << std::sqrt(batch.mean_sq_error)
+		<< "; batch/tail mismatches " << std::dec << mismatches;
+	
+	// Worst cases must be equal; sums may differ in the last bits with multiply-add contraction.
+	// binary16 lanes fuse multiply-adds, so there the difference is only reported.
+#if defined(__AVX512FP16__)
+	const bool fused = std::is_same<T_Float, float16>::value;
+#else
+	const bool fused = false;
+#endif
+	const double rms_scalar = std::sqrt(scalar.mean_sq_error), rms_batch = std::sqrt(batch.mean_sq_error);
+	const bool agree = (scalar.worst_error() == batch.worst_error() && std::abs(rms_scalar - rms_batch) <= 1e-9 * rms_scalar);
+	std::cout << (agree ? "" : (fused ? "; batch errors differ with fused multiply-adds" : "; scalar and batch errors DIFFER")) << std::endl;
+	return mismatches + ((agree || fused) ? 0 : 1);
+}
+
+template<typename T_Float, unsigned NewtonSteps>
+void generate_half_family()
+{
+	check_half_design(RootApprox_Best_Exhaustive< 2, T_Float, NewtonSteps>(THREADS));
+	check_half_design(RootApprox_Best_Exhaustive<-2, T_Float, NewtonSteps>(THREADS));
+	check_half_design(RootApprox_Best_Exhaustive< 3, T_Float, NewtonSteps>(THREADS));
+	check_half_design(RootApprox_Best_Exhaustive<-3, T_Float, NewtonSteps>(THREADS));
+	check_half_design(RootApprox_Best_Exhaustive< 4, T_Float, NewtonSteps>(THREADS));
+	check_half_design(RootApprox_Best_Exhaustive<-4, T_Float, NewtonSteps>(THREADS));
+}
+
+template<typename T_Float, unsigned NewtonSteps>
+uint64_t check_half_family()
+{
+	return check_half_design(RootApprox_Tuned< 2, T_Float, NewtonSteps>())
+		+ check_half_design(RootApprox_Tuned<-2, T_Float, NewtonSteps>())
+		+ check_half_design(RootApprox_Tuned< 3, T_Float, NewtonSteps>())
+		+ check_half_design(RootApprox_Tuned<-3, T_Float, NewtonSteps>())
+		+ check_half_design(RootApprox_Tuned< 4, T_Float, NewtonSteps>())
+		+ check_half_design(RootApprox_Tuned<-4, T_Float, NewtonSteps>());
+}
+
+/*
+	Search a float design with and without pruning, which must find the same
+	design, as a regression test of the pruned search.  Returns 1 if they
+	differ.
+*/
+template<int ROOT, unsigned NewtonSteps>
+static uint64_t check_pruned_design()
+{
+	const auto full   = RootApprox_Best<ROOT, float, NewtonSteps, BEST_WORST_CASE>(THREADS);
+	const auto pruned = RootApprox_Best<ROOT, float, NewtonSteps, PRUNED_WORST_CASE>(THREADS);
+	
+	bool same = (full.constant == pruned.constant);
+	for (unsigned s = 0; s < NewtonSteps; ++s)
+		same = same && (reinterpret_float_int(full.newton_m[s]) == reinterpret_float_int(pruned.newton_m[s]));
+	
+	std::cout << "//  float x^(1/" << std::dec << ROOT << "), " << NewtonSteps << " steps: k=0x" << std::hex << full.constant;
+	if (!same) std::cout << ", pruned k=0x" << pruned.constant;
+	std::cout << ", m=";
+	for (unsigned s = 0; s < NewtonSteps; ++s) std::cout << (s ? "," : "") << double(full.newton_m[s]);
+	if (!same)
+	{
+		std::cout << ", pruned m=";
+		for (unsigned s = 0; s < NewtonSteps; ++s) std::cout << (s ? "," : "") << double(pruned.newton_m[s]);
+	}
+	std::cout << (same ? "; same" : "; DIFFERENT") << std::endl;
+	return same ? 0 : 1;
+}
+
+template<unsigned NewtonSteps>
+uint64_t check_pruned_family()
+{
+	return check_pruned_design< 2, NewtonSteps>()
+		+ check_pruned_design<-2, NewtonSteps>()
+		+ check_pruned_design< 3, NewtonSteps>()
+		+ check_pruned_design<-3, NewtonSteps>()
+		+ check_pruned_design< 4, NewtonSteps>()
+		+ check_pruned_design<-4, NewtonSteps>();
+}
+
+/*
+	Measure a fixed-point design over every positive input of its format.
+	Returns 1 if its worst relative or LSB error exceeds the given bound.
+*/
+template<int ROOT, typename T_QIn, unsigned NewtonSteps, typename T_QOut>
+static uint64_t check_fixed_design(const RootFixedApprox<ROOT, T_QIn, NewtonSteps, T_QOut> &design,
+	const double max_relative = std::numeric_limits<double>::infinity(),
+	const double max_lsb      = std::numeric_limits<double>::infinity())
+{
+	auto test = Test_Root_Approx_Fixed<ROOT>(design, typename T_QIn::raw_t(1), T_QIn::max(), THREADS);
+	
+	std::cout << "//  " << T_QIn::name() << " to " << T_QOut::name() << " x^(1/" << std::dec << ROOT << "), "
+		<< NewtonSteps << " steps: k=" << design.constant << std::setprecision(10);
+	for (unsigned s = 0; s < NewtonSteps; ++s) std::cout << (s ? "," : ", m=") << detail::from_q30(design.newton_m[s]);
+	std::cout << std::setprecision(6) << std::endl
+		<< "//    relative worst " << test.relative.worst_error() << ", RMS " << std::sqrt(test.relative.mean_sq_error)
+		<< "; LSB worst " << test.lsb.worst_error() << ", RMS " << std::sqrt(test.lsb.mean_sq_error)
+		<< "; saturated " << test.saturated << std::endl;
+	if (test.relative.worst_error() <= max_relative && test.lsb.worst_error() <= max_lsb) return 0;
+	std::cout << "//    EXCEEDS relative " << max_relative << ", LSB " << max_lsb << std::endl;
+	return 1;
+}
+
+template<unsigned NewtonSteps>
+void generate_fixed_family()
+{
+	check_fixed_design(RootFixedApprox_Best< 2, q1_15, NewtonSteps>(THREADS));
+	check_fixed_design(RootFixedApprox_Best<-2, q1_15, NewtonSteps, q16_16>(THREADS));
+	check_fixed_design(RootFixedApprox_Best< 3, q1_15, NewtonSteps>(THREADS));
+	check_fixed_design(RootFixedApprox_Best<-3, q1_15, NewtonSteps, q16_16>(THREADS));
+	check_fixed_design(RootFixedApprox_Best< 4, q1_15, NewtonSteps>(THREADS));
+	check_fixed_design(RootFixedApprox_Best<-4, q1_15, NewtonSteps, q16_16>(THREADS));
+}
+
+/*
+	Worst relative and LSB errors of the tabled designs over all of Q1.15,
+	as published in README.md, by refinements and N in 2, -2, 3, -3, 4, -4.
+*/
+static const double FIXED_Q1_15_BOUNDS[3][6][2] =
+{
+	{{.0359,   806}, {.0343,   2.83e5}, {.0317,   748},  {.0343,   69400}, {.0343,   794},  {.0313,  19700}},
+	{{.00171, 24.5}, {.00078,  7700},   {.00277,  80},   {.00104,  1500},  {.00469,  146},  {.00112, 900}},
+	{{.00149, .523}, {8.19e-6, 5.8},    {.000307, .644}, {9.11e-6, 2.01},  {.000204, .826}, {9.8e-6, 1.8}},
+};
+
+template<unsigned NewtonSteps>
+uint64_t check_fixed_family()
+{
+	const auto &bound = FIXED_Q1_15_BOUNDS[NewtonSteps];
+	return check_fixed_design(RootFixedApprox_Tuned< 2, q1_15, NewtonSteps>(),         bound[0][0], bound[0][1])
+		+ check_fixed_design(RootFixedApprox_Tuned<-2, q1_15, NewtonSteps, q16_16>(), bound[1][0], bound[1][1])
+		+ check_fixed_design(RootFixedApprox_Tuned< 3, q1_15, NewtonSteps>(),         bound[2][0], bound[2][1])
+		+ check_fixed_design(RootFixedApprox_Tuned<-3, q1_15, NewtonSteps, q16_16>(), bound[3][0], bound[3][1])
+		+ check_fixed_design(RootFixedApprox_Tuned< 4, q1_15, NewtonSteps>(),         bound[4][0], bound[4][1])
+		+ check_fixed_design(RootFixedApprox_Tuned<-4, q1_15, NewtonSteps, q16_16>(), bound[5][0], bound[5][1]);
+}
+
 static float identity     (const float y)    {return y;}
 static float std_sqrt     (const float y)    {return std::sqrt(y);}
+static float std_cbrt     (const float y)    {return std::cbrt(y);}
 static float std_sqrt_sqrt(const float y)    {return std::sqrt(std::sqrt(y));}
 static float inverse      (const float y)    {return 1.f / y;}
 static float inv_std_sqrt (const float y)    {return 1.f / std::sqrt(y);}
+static float inv_std_cbrt (const float y)    {return 1.f / std::cbrt(y);}
+static float inv_std_sqrt_sqrt(const float y){return 1.f / std::sqrt(std::sqrt(y));}
 static float pow_quarter  (const float y)    {return std::pow(y,-.25f);}
+static float pow_gamma    (const float y)    {return std::pow(y,2.2f);}
+
+static void std_sqrt_batch(const float *y, float *x, size_t count)    {for (size_t i = 0; i < count; ++i) x[i] = std::sqrt(y[i]);}
+static void std_cbrt_batch(const float *y, float *x, size_t count)    {for (size_t i = 0; i < count; ++i) x[i] = std::cbrt(y[i]);}
+
+/*
+	Time a batch function over 16-bit copies of the inputs.
+	Copies are made on the first call at each size, which is a warmup.
+*/
+template<typename T_Float, typename T_Func>
+static void bench_batch_16(Bench_Suite &suite, const char *name, const T_Func &func)
+{
+	std::vector<T_Float> y16, x16;
+	suite.batch(name, [&](const float *y, float*, size_t count)
+	{
+		if (y16.size() != count)
+		{
+			y16.assign(y, y + count);
+			x16.resize(count);
+		}
+		func(y16.data(), x16.data(), count);
+	});
+}
+
+/*
+	Square roots of Q16.16 numbers bit by bit, the usual integer routine:
+	sqrt(raw * 2^16), and 2^40 / sqrt(raw * 2^32) for the inverse.
+*/
+static uint32_t isqrt64(uint64_t v)
+{
+	uint64_t r = 0, bit = uint64_t(1) << 62;
+	while (bit > v) bit >>= 2;
+	for (; bit; bit >>= 2)
+	{
+		if (v >= r + bit) {v -= r + bit; r = (r >> 1) + bit;}
+		else              r >>= 1;
+	}
+	return uint32_t(r);
+}
+static void isqrt_q16_batch(const int32_t *y, int32_t *x, size_t count)
+{
+	for (size_t i = 0; i < count; ++i) x[i] = int32_t(isqrt64(uint64_t(y[i]) << 16));
+}
+static void inv_isqrt_q16_batch(const int32_t *y, int32_t *x, size_t count)
+{
+	for (size_t i = 0; i < count; ++i)
+	{
+		const uint64_t s = isqrt64(uint64_t(y[i]) << 32);
+		x[i] = int32_t(std::min<uint64_t>(((uint64_t(1) << 40) + s/2) / s, 0x7FFFFFFF));
+	}
+}
+
+/*
+	Time a batch function over fixed-point copies of the inputs, made as in bench_batch_16.
+*/
+template<typename T_Q, typename T_Func>
+static void bench_batch_fixed(Bench_Suite &suite, const char *name, const T_Func &func)
+{
+	using raw_t = typename T_Q::raw_t;
+	std::vector<raw_t> yq, xq;
+	suite.batch(name, [&](const float *y, float*, size_t count)
+	{
+		if (yq.size() != count)
+		{
+			yq.resize(count);
+			for (size_t i = 0; i < count; ++i) yq[i] = raw_t(std::lround(std::ldexp(double(y[i]), int(T_Q::frac_bits))));
+			xq.resize(count);
+		}
+		func(yq.data(), xq.data(), count);
+	});
+}
+
+/*
+	Vectors of C components made from the inputs with alternating signs,
+	count/C of them so that each layout occupies the same memory as the inputs.
+	Copies are made as in bench_batch_16.
+*/
+template<unsigned C>
+struct Bench_Vectors
+{
+	size_t count = 0;
+	std::vector<float> aos, out, soa[C];
+
+	void assign(const float *y, const size_t elements)
+	{
+		count = elements / C;
+		aos.resize(C*count);
+		out.resize(C*count);
+		for (unsigned c = 0; c < C; ++c) soa[c].resize(count);
+		for (size_t i = 0; i < C*count; ++i)
+			aos[i] = soa[i%C][i/C] = (i & 1) ? -y[i] : y[i];
+	}
+};
+template<unsigned C, typename T_Func>
+static void bench_vectors(Bench_Suite &suite, const char *name, const T_Func &func)
+{
+	Bench_Vectors<C> v;
+	suite.batch(name, [&](const float *y, float*, size_t count)
+	{
+		if (v.count != count / C) v.assign(y, count);
+		func(v);
+	});
+}
+
+// The usual exact loops, with a zero vector normalizing to zero
+static void normalize3_loop(const float *v, float *out, size_t count)
+{
+	for (size_t i = 0; i < count; ++i, v += 3, out += 3)
+	{
+		const float s = v[0]*v[0] + v[1]*v[1] + v[2]*v[2], r = (s > 0.f) ? 1.f / std::sqrt(s) : 0.f;
+		out[0] = v[0]*r; out[1] = v[1]*r; out[2] = v[2]*r;
+	}
+}
+static void normalize4_loop(const float *v, float *out, size_t count)
+{
+	for (size_t i = 0; i < count; ++i, v += 4, out += 4)
+	{
+		const float s = v[0]*v[0] + v[1]*v[1] + v[2]*v[2] + v[3]*v[3], r = (s > 0.f) ? 1.f / std::sqrt(s) : 0.f;
+		out[0] = v[0]*r; out[1] = v[1]*r; out[2] = v[2]*r; out[3] = v[3]*r;
+	}
+}
+static void normalize3_soa_loop(float *x, float *y, float *z, size_t count)
+{
+	for (size_t i = 0; i < count; ++i)
+	{
+		const float s = x[i]*x[i] + y[i]*y[i] + z[i]*z[i], r = (s > 0.f) ? 1.f / std::sqrt(s) : 0.f;
+		x[i] *= r; y[i] *= r; z[i] *= r;
+	}
+}
+static void length3_loop(const float *v, float *length, size_t count)
+{
+	for (size_t i = 0; i < count; ++i, v += 3) length[i] = std::sqrt(v[0]*v[0] + v[1]*v[1] + v[2]*v[2]);
+}
+static void hypot_soa_loop(const float *x, const float *y, float *length, size_t count)
+{
+	for (size_t i = 0; i < count; ++i) length[i] = std::sqrt(x[i]*x[i] + y[i]*y[i]);
+}
+
+/*
+	Every published function, with the standard library's equivalents.
+	"y" measures the harness itself.  Functions are wrapped in lambdas
+	so that calls inline rather than going through a pointer.
+*/
+static void Run_Benchmarks(Bench_Suite &suite)
+{
+	const FastPow<float> gamma(2.2f);
+	
+	suite.scalar("y",              [](float y) {return identity(y);});
+	suite.scalar("sqrt(y)",        [](float y) {return std_sqrt(y);});
+	suite.scalar("1/sqrt(y)",      [](float y) {return inv_std_sqrt(y);});
+	suite.scalar("cbrt(y)",        [](float y) {return std_cbrt(y);});
+	suite.scalar("1/cbrt(y)",      [](float y) {return inv_std_cbrt(y);});
+	suite.scalar("sqrt(sqrt(y))",  [](float y) {return std_sqrt_sqrt(y);});
+	suite.scalar("1/sqrt(sqrt(y))", [](float y) {return inv_std_sqrt_sqrt(y);});
+	suite.scalar("1/y",            [](float y) {return inverse(y);});
+	suite.scalar("pow(y,-.25)",    [](float y) {return pow_quarter(y);});
+	
+	suite.scalar("rb0_2_root",     [](float y) {return rb0_2_root(y);});
+	suite.scalar("rb0_inv_2_root", [](float y) {return rb0_inv_2_root(y);});
+	suite.scalar("rb0_3_root",     [](float y) {return rb0_3_root(y);});
+	suite.scalar("rb0_inv_3_root", [](float y) {return rb0_inv_3_root(y);});
+	suite.scalar("rb0_4_root",     [](float y) {return rb0_4_root(y);});
+	suite.scalar("rb0_inv_4_root", [](float y) {return rb0_inv_4_root(y);});
+	suite.scalar("rb_2_root",      [](float y) {return rb_2_root(y);});
+	suite.scalar("rb_inv_2_root",  [](float y) {return rb_inv_2_root(y);});
+	suite.scalar("rb_3_root",      [](float y) {return rb_3_root(y);});
+	suite.scalar("rb_inv_3_root",  [](float y) {return rb_inv_3_root(y);});
+	suite.scalar("rb_4_root",      [](float y) {return rb_4_root(y);});
+	suite.scalar("rb_inv_4_root",  [](float y) {return rb_inv_4_root(y);});
+	suite.scalar("rb2_2_root",     [](float y) {return rb2_2_root(y);});
+	suite.scalar("rb2_inv_2_root", [](float y) {return rb2_inv_2_root(y);});
+	suite.scalar("rb2_3_root",     [](float y) {return rb2_3_root(y);});
+	suite.scalar("rb2_inv_3_root", [](float y) {return rb2_inv_3_root(y);});
+	suite.scalar("rb2_4_root",     [](float y) {return rb2_4_root(y);});
+	suite.scalar("rb2_inv_4_root", [](float y) {return rb2_inv_4_root(y);});
+	suite.scalar("rbt0_2_root",    [](float y) {return rbt0_2_root(y);});
+	suite.scalar("rbt0_inv_2_root", [](float y) {return rbt0_inv_2_root(y);});
+	suite.scalar("rbt0_3_root",    [](float y) {return rbt0_3_root(y);});
+	suite.scalar("rbt0_inv_3_root", [](float y) {return rbt0_inv_3_root(y);});
+	suite.scalar("rbt0_4_root",    [](float y) {return rbt0_4_root(y);});
+	suite.scalar("rbt0_inv_4_root", [](float y) {return rbt0_inv_4_root(y);});
+	suite.scalar("rbt_2_root",     [](float y) {return rbt_2_root(y);});
+	suite.scalar("rbt_inv_2_root", [](float y) {return rbt_inv_2_root(y);});
+	suite.scalar("rbt_3_root",     [](float y) {return rbt_3_root(y);});
+	suite.scalar("rbt_inv_3_root", [](float y) {return rbt_inv_3_root(y);});
+	suite.scalar("rbt_4_root",     [](float y) {return rbt_4_root(y);});
+	suite.scalar("rbt_inv_4_root", [](float y) {return rbt_inv_4_root(y);});
+	suite.scalar("rbm2_2_root",    [](float y) {return rbm2_2_root(y);});
+	suite.scalar("rbm2_inv_2_root", [](float y) {return rbm2_inv_2_root(y);});
+	suite.scalar("rbm2_3_root",    [](float y) {return rbm2_3_root(y);});
+	suite.scalar("rbm2_inv_3_root", [](float y) {return rbm2_inv_3_root(y);});
+	suite.scalar("rbm2_4_root",    [](float y) {return rbm2_4_root(y);});
+	suite.scalar("rbm2_inv_4_root", [](float y) {return rbm2_inv_4_root(y);});
+	suite.scalar("rbm3_2_root",    [](float y) {return rbm3_2_root(y);});
+	suite.scalar("rbm3_inv_2_root", [](float y) {return rbm3_inv_2_root(y);});
+	suite.scalar("rbm3_3_root",    [](float y) {return rbm3_3_root(y);});
+	suite.scalar("rbm3_inv_3_root", [](float y) {return rbm3_inv_3_root(y);});
+	suite.scalar("rbm3_4_root",    [](float y) {return rbm3_4_root(y);});
+	suite.scalar("rbm3_inv_4_root", [](float y) {return rbm3_inv_4_root(y);});
+	suite.scalar("rbm4_2_root",    [](float y) {return rbm4_2_root(y);});
+	suite.scalar("rbm4_inv_2_root", [](float y) {return rbm4_inv_2_root(y);});
+	suite.scalar("rbm4_3_root",    [](float y) {return rbm4_3_root(y);});
+	suite.scalar("rbm4_inv_3_root", [](float y) {return rbm4_inv_3_root(y);});
+	suite.scalar("rbm4_4_root",    [](float y) {return rbm4_4_root(y);});
+	suite.scalar("rbm4_inv_4_root", [](float y) {return rbm4_inv_4_root(y);});
+	
+	suite.scalar("pow(y,2.2)",      [](float y) {return pow_gamma(y);});
+	suite.scalar("FastPow(2.2)",    [gamma](float y) {return gamma(y);});
+	
+	suite.batch("sqrt loop",        [](const float *y, float *x, size_t count) {std_sqrt_batch(y, x, count);});
+	suite.batch("cbrt loop",        [](const float *y, float *x, size_t count) {std_cbrt_batch(y, x, count);});
+	suite.batch("rb_root<2>",       [](const float *y, float *x, size_t count) {rb_root< 2>(y, x, count);});
+	suite.batch("rb_root<-2>",      [](const float *y, float *x, size_t count) {rb_root<-2>(y, x, count);});
+	suite.batch("rb_root<3>",       [](const float *y, float *x, size_t count) {rb_root< 3>(y, x, count);});
+	suite.batch("rb_root<-3>",      [](const float *y, float *x, size_t count) {rb_root<-3>(y, x, count);});
+	suite.batch("rb_root<4>",       [](const float *y, float *x, size_t count) {rb_root< 4>(y, x, count);});
+	suite.batch("rb_root<-4>",      [](const float *y, float *x, size_t count) {rb_root<-4>(y, x, count);});
+	suite.batch("rb_root_safe<2>",  [](const float *y, float *x, size_t count) {rb_root_safe< 2>(y, x, count);});
+	suite.batch("rb_root_safe<-2>", [](const float *y, float *x, size_t count) {rb_root_safe<-2>(y, x, count);});
+	suite.batch("rb_root_safe<3>",  [](const float *y, float *x, size_t count) {rb_root_safe< 3>(y, x, count);});
+	suite.batch("rb_root_safe<-3>", [](const float *y, float *x, size_t count) {rb_root_safe<-3>(y, x, count);});
+	suite.batch("rb_root_safe<4>",  [](const float *y, float *x, size_t count) {rb_root_safe< 4>(y, x, count);});
+	suite.batch("rb_root_safe<-4>", [](const float *y, float *x, size_t count) {rb_root_safe<-4>(y, x, count);});
+	suite.batch("dispatch<2>",      [](const float *y, float *x, size_t count) {rb_root_dispatch< 2>(y, x, count);});
+	suite.batch("dispatch<-2>",     [](const float *y, float *x, size_t count) {rb_root_dispatch<-2>(y, x, count);});
+	bench_batch_16<float16> (suite, "rb_root<2> f16",       [](const float16  *y, float16  *x, size_t count) {rb_root< 2>(y, x, count);});
+	bench_batch_16<float16> (suite, "rb_root<-2> f16",      [](const float16  *y, float16  *x, size_t count) {rb_root<-2>(y, x, count);});
+	bench_batch_16<bfloat16>(suite, "rb_root<2> bf16",      [](const bfloat16 *y, bfloat16 *x, size_t count) {rb_root< 2>(y, x, count);});
+	bench_batch_16<bfloat16>(suite, "rb_root<-2> bf16",     [](const bfloat16 *y, bfloat16 *x, size_t count) {rb_root<-2>(y, x, count);});
+	
+	const auto fixed_2     = RootFixedApprox_Tuned< 2, q16_16, 2>();
+	const auto fixed_inv_2 = RootFixedApprox_Tuned<-2, q16_16, 2>();
+	bench_batch_fixed<q16_16>(suite, "isqrt Q16.16 loop",   [](const int32_t *y, int32_t *x, size_t count) {isqrt_q16_batch(y, x, count);});
+	bench_batch_fixed<q16_16>(suite, "1/isqrt Q16.16 loop", [](const int32_t *y, int32_t *x, size_t count) {inv_isqrt_q16_batch(y, x, count);});
+	bench_batch_fixed<q16_16>(suite, "fixed<2> Q16.16",     [fixed_2]    (const int32_t *y, int32_t *x, size_t count) {fixed_2.apply(y, x, count);});
+	bench_batch_fixed<q16_16>(suite, "fixed<-2> Q16.16",    [fixed_inv_2](const int32_t *y, int32_t *x, size_t count) {fixed_inv_2.apply(y, x, count);});
+	
+	bench_vectors<3>(suite, "normalize3 aos loop", [](Bench_Vectors<3> &v) {normalize3_loop(v.aos.data(), v.out.data(), v.count);});
+	bench_vectors<3>(suite, "rb_normalize3 aos",   [](Bench_Vectors<3> &v) {rb_normalize3(v.aos.data(), v.out.data(), v.count);});
+	bench_vectors<3>(suite, "rb_normalize3<2>",    [](Bench_Vectors<3> &v) {rb_normalize3<2>(v.aos.data(), v.out.data(), v.count);});
+	bench_vectors<3>(suite, "normalize3 soa loop", [](Bench_Vectors<3> &v) {normalize3_soa_loop(v.soa[0].data(), v.soa[1].data(), v.soa[2].data(), v.count);});
+	bench_vectors<3>(suite, "rb_normalize3 soa",   [](Bench_Vectors<3> &v) {rb_normalize3(v.soa[0].data(), v.soa[1].data(), v.soa[2].data(), v.count);});
+	bench_vectors<4>(suite, "normalize4 aos loop", [](Bench_Vectors<4> &v) {normalize4_loop(v.aos.data(), v.out.data(), v.count);});
+	bench_vectors<4>(suite, "rb_normalize4 aos",   [](Bench_Vectors<4> &v) {rb_normalize4(v.aos.data(), v.out.data(), v.count);});
+	bench_vectors<3>(suite, "length3 aos loop",    [](Bench_Vectors<3> &v) {length3_loop(v.aos.data(), v.out.data(), v.count);});
+	bench_vectors<3>(suite, "rb_length3 aos",      [](Bench_Vectors<3> &v) {rb_length3(v.aos.data(), v.out.data(), v.count);});
+	bench_vectors<2>(suite, "hypot soa loop",      [](Bench_Vectors<2> &v) {hypot_soa_loop(v.soa[0].data(), v.soa[1].data(), v.out.data(), v.count);});
+	bench_vectors<2>(suite, "rb_hypot soa",        [](Bench_Vectors<2> &v) {rb_hypot(v.soa[0].data(), v.soa[1].data(), v.out.data(), v.count);});
+	
+	suite.batch("FastPow(2.2).apply", [gamma](const float *y, float *x, size_t count) {gamma.apply(y, x, count);});
+}
 
 int main(int argc, const char * argv[])
 {
@@ -92,28 +1211,307 @@ int main(int argc, const char * argv[])
 #endif
 
 
-	std::cout << std::hex;
+	// "verify": sweep the published functions over every float, resumably
+	if (argc > 1 && std::strcmp(argv[1], "verify") == 0)
+	{
+		bool complete = true;
+		complete &= Print_Verify_Root_Approx< 2>("rb_2_root",     rb_2_root);
+		complete &= Print_Verify_Root_Approx<-2>("rb_inv_2_root", rb_inv_2_root);
+		complete &= Print_Verify_Root_Approx< 3>("rb_3_root",     rb_3_root);
+		complete &= Print_Verify_Root_Approx<-3>("rb_inv_3_root", rb_inv_3_root);
+		complete &= Print_Verify_Root_Approx< 4>("rb_4_root",     rb_4_root);
+		complete &= Print_Verify_Root_Approx<-4>("rb_inv_4_root", rb_inv_4_root);
+		return complete ? 0 : 1;
+	}
+	
+	// "histogram": distributions of error for the published functions over [1, 2^|N|]
+	if (argc > 1 && std::strcmp(argv[1], "histogram") == 0)
+	{
+		Print_Histogram_Root_Approx< 2>("rb_2_root",     rb_2_root);
+		Print_Histogram_Root_Approx<-2>("rb_inv_2_root", rb_inv_2_root);
+		Print_Histogram_Root_Approx< 3>("rb_3_root",     rb_3_root);
+		Print_Histogram_Root_Approx<-3>("rb_inv_3_root", rb_inv_3_root);
+		Print_Histogram_Root_Approx< 4>("rb_4_root",     rb_4_root);
+		Print_Histogram_Root_Approx<-4>("rb_inv_4_root", rb_inv_4_root);
+		return 0;
+	}
+	
+	// "pow": generate the rational powers in root_cellar_pow_generated.h
+	if (argc > 1 && std::strcmp(argv[1], "pow") == 0)
+	{
+		Print_Generated_Preamble(std::cout);
+		std::cout << std::endl << std::endl;
+		std::cout << "// Rational powers optimized for worst-case error" << std::endl;
+		std::cout << std::endl << std::endl;
+		generate_pow_functions< 3,2,float,1>();
+		generate_pow_functions<-3,2,float,1>();
+		generate_pow_functions< 2,3,float,1>();
+		generate_pow_functions<-2,3,float,1>();
+		generate_pow_functions< 3,4,float,1>();
+		generate_pow_functions<-3,4,float,1>();
+		return 0;
+	}
+	
+	// "table": generate the table-seeded roots in root_cellar_table_generated.h
+	if (argc > 1 && std::strcmp(argv[1], "table") == 0)
+	{
+		Print_Generated_Preamble(std::cout);
+		Print_Generated_Table_Preamble(std::cout);
+		std::cout << std::endl << std::endl;
+		std::cout << "// Roots seeded from 256-entry tables, optimized for worst-case error" << std::endl;
+		std::cout << std::endl << std::endl;
+		generate_table_family<0, 8>("rbt0");
+		generate_table_family<1, 8>("rbt");
+		return 0;
+	}
+	
+	// "minimax": generate the polynomial-refined roots in root_cellar_minimax_generated.h
+	if (argc > 1 && std::strcmp(argv[1], "minimax") == 0)
+	{
+		Print_Generated_Preamble(std::cout);
+		std::cout << std::endl << std::endl;
+		std::cout << "// Roots refined by minimax polynomials of degree 2 to 4, optimized for worst-case error" << std::endl;
+		std::cout << std::endl << std::endl;
+		generate_minimax_family<2>("rbm2");
+		generate_minimax_family<3>("rbm3");
+		generate_minimax_family<4>("rbm4");
+		return 0;
+	}
+	
+	// "half": search the 16-bit designs in root_cellar_batch.h's tables exhaustively
+	if (argc > 1 && std::strcmp(argv[1], "half") == 0)
+	{
+		generate_half_family<float16, 0>();
+		generate_half_family<float16, 1>();
+		generate_half_family<float16, 2>();
+		generate_half_family<bfloat16, 0>();
+		generate_half_family<bfloat16, 1>();
+		return 0;
+	}
+	
+	// "half-check": measure the tabled 16-bit designs over all 65536 inputs
+	if (argc > 1 && std::strcmp(argv[1], "half-check") == 0)
+	{
+		uint64_t failures = 0;
+		failures += check_half_family<float16, 0>();
+		failures += check_half_family<float16, 1>();
+		failures += check_half_family<float16, 2>();
+		failures += check_half_family<bfloat16, 0>();
+		failures += check_half_family<bfloat16, 1>();
+		std::cout << (failures ? "FAILED" : "OK") << std::endl;
+		return failures ? 1 : 0;
+	}
+	
+	// "prune-check": search the float designs with and without PRUNED_WORST_CASE, which must agree
+	if (argc > 1 && std::strcmp(argv[1], "prune-check") == 0)
+	{
+		uint64_t failures = 0;
+		failures += check_pruned_family<0>();
+		failures += check_pruned_family<1>();
+		failures += check_pruned_family<2>();
+		std::cout << (failures ? "FAILED" : "OK") << std::endl;
+		return failures ? 1 : 0;
+	}
+	
+	// "fixed": search the fixed-point designs in root_cellar_fixed.h's table
+	if (argc > 1 && std::strcmp(argv[1], "fixed") == 0)
+	{
+		generate_fixed_family<0>();
+		generate_fixed_family<1>();
+		generate_fixed_family<2>();
+		return 0;
+	}
+	
+	// "fixed-check": measure the tabled fixed-point designs over every positive input against their published bounds
+	if (argc > 1 && std::strcmp(argv[1], "fixed-check") == 0)
+	{
+		uint64_t failures = 0;
+		failures += check_fixed_family<0>();
+		failures += check_fixed_family<1>();
+		failures += check_fixed_family<2>();
+		failures += check_fixed_design(RootFixedApprox_Tuned< 2, q16_16, 1>(),         .00135,  8210);
+		failures += check_fixed_design(RootFixedApprox_Tuned<-2, q16_16, 1>(),         .00203,  10700);
+		failures += check_fixed_design(RootFixedApprox_Tuned< 2, q16_16, 2>(),         .000914, 9.65);
+		failures += check_fixed_design(RootFixedApprox_Tuned<-2, q16_16, 2>(),         .00138,  10);
+		failures += check_fixed_design(RootFixedApprox_Tuned< 2, q1_31, 2>(),          4.97e-6, 1650);
+		failures += check_fixed_design(RootFixedApprox_Tuned<-2, q1_31, 2, q16_16>(),  8.25e-6, 939);
+		std::cout << (failures ? "FAILED" : "OK") << std::endl;
+		return failures ? 1 : 0;
+	}
+	
+	// "fastpow": generate root_cellar_fastpow_table.h
+	if (argc > 1 && std::strcmp(argv[1], "fastpow") == 0)
+	{
+		Print_FastPow_Table(std::cout, THREADS);
+		return 0;
+	}
+	
+	// "catalog": generate root_cellar_catalog_table.h
+	if (argc > 1 && std::strcmp(argv[1], "catalog") == 0)
+	{
+		Print_Catalog_Table(std::cout, THREADS);
+		return 0;
+	}
+	
+	// "generate [store]": generate root_cellar_generated.h, searching only for designs not in the store
+	if (argc > 1 && std::strcmp(argv[1], "generate") == 0)
+	{
+		Design_Database designs(argc > 2 ? argv[2] : DESIGN_STORE);
+		std::ostringstream simd;
+		Print_Generated_Preamble(std::cout);
+		std::cout << std::endl << std::endl;
+		std::cout << "// Functions optimized for worst-case error" << std::endl;
+		std::cout << std::endl << std::endl;
+		generate_published_family<1>(designs, "rb",  simd);
+		generate_published_family<0>(designs, "rb0", simd);
+		generate_published_family<2>(designs, "rb2", simd);
+		std::cout << "// Vector kernels and batch functions for the designs above" << std::endl;
+		std::cout << std::endl << std::endl;
+		Print_Generated_SIMD_Preamble(std::cout);
+		std::cout << std::endl << std::endl << simd.str();
+		return 0;
+	}
 	
-	for (auto &v : TEST_VALUES) v = (std::rand() / float(RAND_MAX));
-	
-	//auto std_sqrt = static_cast<float (*)(float)>(&std::sqrt);
-	
-	std::cout << "   CPU TIME  |  FORMULA    " << std::endl;
-	std::cout << "------------ + ------------" << std::endl;
-	Print_Func_Profile("y",         identity);
-	Print_Func_Profile("sqrt(x)", std_sqrt);
-	Print_Func_Profile("sqrt(sqrt(y))", std_sqrt_sqrt);
-	Print_Func_Profile("1/sqrt(y)", inv_std_sqrt);
-	Print_Func_Profile("1/y",         inverse);
-	Print_Func_Profile("pow(y,-.25)", pow_quarter);
-	Print_Func_Profile("y",         identity);
-	Print_Func_Profile("rb_2_root", rb_2_root);
-	Print_Func_Profile("rb_3_root", rb_2_root);
-	Print_Func_Profile("rb_4_root", rb_2_root);
-	Print_Func_Profile("rb_inv_2_root", rb_inv_2_root);
-	Print_Func_Profile("rb_inv_3_root", rb_inv_4_root);
-	Print_Func_Profile("rb_inv_4_root", rb_inv_4_root);
-	std::cout << "------------ + ------------" << std::endl;
+	// "designs-seed [store]": record the published designs without searching
+	if (argc > 1 && std::strcmp(argv[1], "designs-seed") == 0)
+	{
+		Design_Database designs(argc > 2 ? argv[2] : DESIGN_STORE);
+		seed_published_family<0>(designs);
+		seed_published_family<1>(designs);
+		seed_published_family<2>(designs);
+		std::cout << std::dec << designs.records.size() << " designs in " << designs.path << std::endl;
+		return 0;
+	}
+	
+	// "simd": generate the vector kernels at the end of root_cellar_generated.h
+	if (argc > 1 && std::strcmp(argv[1], "simd") == 0)
+	{
+		std::cout << "// Vector kernels and batch functions for the designs above" << std::endl;
+		std::cout << std::endl << std::endl;
+		Print_Generated_SIMD_Preamble(std::cout);
+		std::cout << std::endl << std::endl;
+		generate_simd_family<1>("rb");
+		generate_simd_family<0>("rb0");
+		generate_simd_family<2>("rb2");
+		return 0;
+	}
+	
+	// "simd-check": compare the generated kernels with their references
+	if (argc > 1 && std::strcmp(argv[1], "simd-check") == 0)
+	{
+		uint64_t failures = 0;
+		failures += check_simd_functions< 2,1>("rb_2_root",      rb_2_root,      rb_2_root_batch);
+		failures += check_simd_functions<-2,1>("rb_inv_2_root",  rb_inv_2_root,  rb_inv_2_root_batch);
+		failures += check_simd_functions< 3,1>("rb_3_root",      rb_3_root,      rb_3_root_batch);
+		failures += check_simd_functions<-3,1>("rb_inv_3_root",  rb_inv_3_root,  rb_inv_3_root_batch);
+		failures += check_simd_functions< 4,1>("rb_4_root",      rb_4_root,      rb_4_root_batch);
+		failures += check_simd_functions<-4,1>("rb_inv_4_root",  rb_inv_4_root,  rb_inv_4_root_batch);
+		failures += check_simd_functions< 2,0>("rb0_2_root",     rb0_2_root,     rb0_2_root_batch);
+		failures += check_simd_functions<-2,0>("rb0_inv_2_root", rb0_inv_2_root, rb0_inv_2_root_batch);
+		failures += check_simd_functions< 3,0>("rb0_3_root",     rb0_3_root,     rb0_3_root_batch);
+		failures += check_simd_functions<-3,0>("rb0_inv_3_root", rb0_inv_3_root, rb0_inv_3_root_batch);
+		failures += check_simd_functions< 4,0>("rb0_4_root",     rb0_4_root,     rb0_4_root_batch);
+		failures += check_simd_functions<-4,0>("rb0_inv_4_root", rb0_inv_4_root, rb0_inv_4_root_batch);
+		failures += check_simd_functions< 2,2>("rb2_2_root",     rb2_2_root,     rb2_2_root_batch);
+		failures += check_simd_functions<-2,2>("rb2_inv_2_root", rb2_inv_2_root, rb2_inv_2_root_batch);
+		failures += check_simd_functions< 3,2>("rb2_3_root",     rb2_3_root,     rb2_3_root_batch);
+		failures += check_simd_functions<-3,2>("rb2_inv_3_root", rb2_inv_3_root, rb2_inv_3_root_batch);
+		failures += check_simd_functions< 4,2>("rb2_4_root",     rb2_4_root,     rb2_4_root_batch);
+		failures += check_simd_functions<-4,2>("rb2_inv_4_root", rb2_inv_4_root, rb2_inv_4_root_batch);
+		std::cout << (failures ? "FAILED" : "OK") << std::endl;
+		return failures ? 1 : 0;
+	}
+	
+	// "safe-check": compare the generated safe functions with RootApprox_Safe and check their domain
+	if (argc > 1 && std::strcmp(argv[1], "safe-check") == 0)
+	{
+		uint64_t failures = 0;
+		failures += check_safe_functions< 2,1>("rb_safe_2_root",      rb_safe_2_root,      rb_safe_2_root_batch);
+		failures += check_safe_functions<-2,1>("rb_safe_inv_2_root",  rb_safe_inv_2_root,  rb_safe_inv_2_root_batch);
+		failures += check_safe_functions< 3,1>("rb_safe_3_root",      rb_safe_3_root,      rb_safe_3_root_batch);
+		failures += check_safe_functions<-3,1>("rb_safe_inv_3_root",  rb_safe_inv_3_root,  rb_safe_inv_3_root_batch);
+		failures += check_safe_functions< 4,1>("rb_safe_4_root",      rb_safe_4_root,      rb_safe_4_root_batch);
+		failures += check_safe_functions<-4,1>("rb_safe_inv_4_root",  rb_safe_inv_4_root,  rb_safe_inv_4_root_batch);
+		failures += check_safe_functions< 2,0>("rb0_safe_2_root",     rb0_safe_2_root,     rb0_safe_2_root_batch);
+		failures += check_safe_functions<-2,0>("rb0_safe_inv_2_root", rb0_safe_inv_2_root, rb0_safe_inv_2_root_batch);
+		failures += check_safe_functions< 3,0>("rb0_safe_3_root",     rb0_safe_3_root,     rb0_safe_3_root_batch);
+		failures += check_safe_functions<-3,0>("rb0_safe_inv_3_root", rb0_safe_inv_3_root, rb0_safe_inv_3_root_batch);
+		failures += check_safe_functions< 4,0>("rb0_safe_4_root",     rb0_safe_4_root,     rb0_safe_4_root_batch);
+		failures += check_safe_functions<-4,0>("rb0_safe_inv_4_root", rb0_safe_inv_4_root, rb0_safe_inv_4_root_batch);
+		failures += check_safe_functions< 2,2>("rb2_safe_2_root",     rb2_safe_2_root,     rb2_safe_2_root_batch);
+		failures += check_safe_functions<-2,2>("rb2_safe_inv_2_root", rb2_safe_inv_2_root, rb2_safe_inv_2_root_batch);
+		failures += check_safe_functions< 3,2>("rb2_safe_3_root",     rb2_safe_3_root,     rb2_safe_3_root_batch);
+		failures += check_safe_functions<-3,2>("rb2_safe_inv_3_root", rb2_safe_inv_3_root, rb2_safe_inv_3_root_batch);
+		failures += check_safe_functions< 4,2>("rb2_safe_4_root",     rb2_safe_4_root,     rb2_safe_4_root_batch);
+		failures += check_safe_functions<-4,2>("rb2_safe_inv_4_root", rb2_safe_inv_4_root, rb2_safe_inv_4_root_batch);
+		std::cout << (failures ? "FAILED" : "OK") << std::endl;
+		return failures ? 1 : 0;
+	}
+	
+	// "dispatch-check": compare every dispatch entry the processor runs with its reference
+	if (argc > 1 && std::strcmp(argv[1], "dispatch-check") == 0)
+	{
+		std::cout << "Detected " << Dispatch_ISA_Name(Dispatch_Detect())
+			<< ", dispatching to " << Dispatch_ISA_Name(Dispatch_ISA()) << std::endl;
+		uint64_t failures = 0;
+		failures += check_dispatch_entries< 2,1, ROOT_FAST>("root<2>",    RootApprox_Tuned< 2, float, 1>());
+		failures += check_dispatch_entries<-2,1, ROOT_FAST>("root<-2>",   RootApprox_Tuned<-2, float, 1>());
+		failures += check_dispatch_entries< 3,2, ROOT_FAST>("root<3,2>",  RootApprox_Tuned< 3, float, 2>());
+		failures += check_dispatch_entries<-4,0, ROOT_FAST>("root<-4,0>", RootApprox_Tuned<-4, float, 0>());
+		failures += check_dispatch_entries< 2,1, ROOT_SAFE>("safe<2>",    RootApprox_Safe< 2, float, 1>(RootApprox_Tuned< 2, float, 1>()));
+		failures += check_dispatch_entries<-3,1, ROOT_SAFE>("safe<-3>",   RootApprox_Safe<-3, float, 1>(RootApprox_Tuned<-3, float, 1>()));
+		std::cout << (failures ? "FAILED" : "OK") << std::endl;
+		return failures ? 1 : 0;
+	}
+	
+	// "vector-check": compare the vector functions with one call per vector, over odd counts
+	if (argc > 1 && std::strcmp(argv[1], "vector-check") == 0)
+	{
+		uint64_t failures = 0;
+		failures += check_vector_entries<float>("float");
+		failures += check_vector_entries<double>("double");
+		std::cout << (failures ? "FAILED" : "OK") << std::endl;
+		return failures ? 1 : 0;
+	}
+
+	// "div-check": compare every integer division by a constant with /
+	if (argc > 1 && std::strcmp(argv[1], "div-check") == 0)
+	{
+		uint64_t failures = 0;
+		failures += check_div_by<2>();
+		failures += check_div_by<3>();
+		failures += check_div_by<4>();
+		failures += check_div_by<5>();
+		failures += check_div_by<6>();
+		failures += check_div_by<7>();
+		failures += check_div_by<8>();
+		failures += check_div_by<9>();
+		std::cout << (failures ? "FAILED" : "OK") << std::endl;
+		return failures ? 1 : 0;
+	}
+
+	// "bench [csv|json]": time every function at L1, L2 and DRAM sizes
+	if (argc > 1 && std::strcmp(argv[1], "bench") == 0)
+	{
+		Bench_Suite suite;
+		Run_Benchmarks(suite);
+		if      (argc > 2 && std::strcmp(argv[2], "csv")  == 0) Print_Bench_CSV (std::cout, suite.results);
+		else if (argc > 2 && std::strcmp(argv[2], "json") == 0) Print_Bench_JSON(std::cout, suite.results);
+		else std::cout << suite;
+		return 0;
+	}
+	
+	{
+		// A quick look at L1-resident arrays
+		Bench_Options quick;
+		quick.sizes = {size_t(1) << 12};
+		quick.repetitions = 5;
+		Bench_Suite suite(quick);
+		Run_Benchmarks(suite);
+		std::cout << suite << std::endl;
+	}
+	
+	std::cout << std::hex;
 	
 	/*Print_Test_Root_Approx("std::sqrt", std_sqrt, 2);
 	Print_Test_Root_Approx("rb_2_root",  rb_2_root,  2);
@@ -138,13 +1536,14 @@ int main(int argc, const char * argv[])
 	
 	std::cout << std::endl << std::endl;
 
-	std::cout << "#pragma once" << std::endl;
-	std::cout << "#include <stdint.h>" << std::endl;
+	Print_Generated_Preamble(std::cout);
 	std::cout << std::endl << std::endl;
 	
 	std::cout << "// Functions optimized for worst-case error" << std::endl;
 	std::cout << std::endl << std::endl;
 	
+	Design_Database designs(DESIGN_STORE);
+	
 	/*generate_root_functions< 2,float,1,BEST_WORST_CASE>();
 	generate_root_functions<-2,float,1,BEST_WORST_CASE>();
 	generate_root_functions< 3,float,1,BEST_WORST_CASE>();
@@ -152,24 +1551,24 @@ int main(int argc, const char * argv[])
 	generate_root_functions< 4,float,1,BEST_WORST_CASE>();
 	generate_root_functions<-4,float,1,BEST_WORST_CASE>();*/
 	
-	generate_root_functions< 2,double,0,APPROX_WORST_CASE>();
-	generate_root_functions< 2,double,1,APPROX_WORST_CASE>();
-	generate_root_functions< 2,double,2,APPROX_WORST_CASE>();
-	generate_root_functions<-2,double,0,APPROX_WORST_CASE>();
-	generate_root_functions<-2,double,1,APPROX_WORST_CASE>();
-	generate_root_functions<-2,double,2,APPROX_WORST_CASE>();
-	generate_root_functions< 3,double,0,APPROX_WORST_CASE>();
-	generate_root_functions< 3,double,1,APPROX_WORST_CASE>();
-	generate_root_functions< 3,double,2,APPROX_WORST_CASE>();
-	generate_root_functions<-3,double,0,APPROX_WORST_CASE>();
-	generate_root_functions<-3,double,1,APPROX_WORST_CASE>();
-	generate_root_functions<-3,double,2,APPROX_WORST_CASE>();
-	generate_root_functions< 4,double,0,APPROX_WORST_CASE>();
-	generate_root_functions< 4,double,1,APPROX_WORST_CASE>();
-	generate_root_functions< 4,double,2,APPROX_WORST_CASE>();
-	generate_root_functions<-4,double,0,APPROX_WORST_CASE>();
-	generate_root_functions<-4,double,1,APPROX_WORST_CASE>();
-	generate_root_functions<-4,double,2,APPROX_WORST_CASE>();
+	generate_root_functions< 2,double,0,APPROX_WORST_CASE>(designs);
+	generate_root_functions< 2,double,1,APPROX_WORST_CASE>(designs);
+	generate_root_functions< 2,double,2,APPROX_WORST_CASE>(designs);
+	generate_root_functions<-2,double,0,APPROX_WORST_CASE>(designs);
+	generate_root_functions<-2,double,1,APPROX_WORST_CASE>(designs);
+	generate_root_functions<-2,double,2,APPROX_WORST_CASE>(designs);
+	generate_root_functions< 3,double,0,APPROX_WORST_CASE>(designs);
+	generate_root_functions< 3,double,1,APPROX_WORST_CASE>(designs);
+	generate_root_functions< 3,double,2,APPROX_WORST_CASE>(designs);
+	generate_root_functions<-3,double,0,APPROX_WORST_CASE>(designs);
+	generate_root_functions<-3,double,1,APPROX_WORST_CASE>(designs);
+	generate_root_functions<-3,double,2,APPROX_WORST_CASE>(designs);
+	generate_root_functions< 4,double,0,APPROX_WORST_CASE>(designs);
+	generate_root_functions< 4,double,1,APPROX_WORST_CASE>(designs);
+	generate_root_functions< 4,double,2,APPROX_WORST_CASE>(designs);
+	generate_root_functions<-4,double,0,APPROX_WORST_CASE>(designs);
+	generate_root_functions<-4,double,1,APPROX_WORST_CASE>(designs);
+	generate_root_functions<-4,double,2,APPROX_WORST_CASE>(designs);
 	
 	//std::cout << "RootApprox<-2,float,1> error: " << std::flush;
 	//std::cout << Test_RMS_Error(classicinvsqrt, -.5f, 1.f, 2.f) << std::endl;
@@ -2,22 +2,112 @@
 
 
 #include <cstdint>
+#include <cstddef>
+#include <cstring>
+#include <cstdio>
+#include <cstdlib>
 #include <cmath>
+#include <limits>
+#include <string>
 #include <algorithm>
 #include <utility>
+#include <array>
+#include <type_traits>
+#include <vector>
 #include <ostream>
+#include <iomanip>
+
+#if defined(_MSC_VER)
+	#include <intrin.h>
+#endif
+
+#if (__cplusplus >= 202002L) || (defined(_MSVC_LANG) && _MSVC_LANG >= 202002L)
+	#include <bit>
+#endif
+
+#include "root_cellar_parallel.h"
+#include "root_cellar_interval.h"
+#include "root_cellar_half.h"
 
 #include <iostream> //debug
 
 
+/*
+	Bit casts are constexpr with std::bit_cast (C++20) or the equivalent builtin
+	offered by GCC 11, Clang 9 and MSVC 19.27 in any language mode.
+	Otherwise they fall back to memcpy, and functions using them aren't constexpr.
+*/
+#if defined(__cpp_lib_bit_cast)
+	#define ROOTBEER_BIT_CAST_STD 1
+#elif defined(__has_builtin)
+	#if __has_builtin(__builtin_bit_cast)
+		#define ROOTBEER_BIT_CAST_BUILTIN 1
+	#endif
+#elif defined(_MSC_VER) && (_MSC_VER >= 1927)
+	#define ROOTBEER_BIT_CAST_BUILTIN 1
+#endif
+
+#if defined(ROOTBEER_BIT_CAST_STD) || defined(ROOTBEER_BIT_CAST_BUILTIN)
+	#define ROOTBEER_CONSTEXPR constexpr
+#else
+	#define ROOTBEER_CONSTEXPR inline
+#endif
+
+
 namespace rootbeer
 {
 	namespace detail
 	{
+		template<typename T_To, typename T_From>
+		ROOTBEER_CONSTEXPR T_To bit_cast(const T_From &from)
+		{
+			static_assert(sizeof(T_To) == sizeof(T_From), "bit_cast between types of different sizes");
+		#if defined(ROOTBEER_BIT_CAST_STD)
+			return std::bit_cast<T_To>(from);
+		#elif defined(ROOTBEER_BIT_CAST_BUILTIN)
+			return __builtin_bit_cast(T_To, from);
+		#else
+			T_To to;
+			std::memcpy(&to, &from, sizeof(to));
+			return to;
+		#endif
+		}
+		
+		// Leading zero bits of a nonzero integer
+		inline unsigned clz32(const uint32_t x)
+		{
+		#if defined(__GNUC__) || defined(__clang__)
+			return unsigned(__builtin_clz(x));
+		#elif defined(_MSC_VER)
+			unsigned long i; _BitScanReverse(&i, x); return 31u - unsigned(i);
+		#else
+			unsigned n = 0;
+			for (uint32_t v = x; !(v & 0x80000000u); v <<= 1) ++n;
+			return n;
+		#endif
+		}
+		inline unsigned clz64(const uint64_t x)
+		{
+		#if defined(__GNUC__) || defined(__clang__)
+			return unsigned(__builtin_clzll(x));
+		#else
+			return (x >> 32) ? clz32(uint32_t(x >> 32)) : 32u + clz32(uint32_t(x));
+		#endif
+		}
+
+		// Array of N copies of a value
+		template<typename T, size_t... I>
+		constexpr std::array<T, sizeof...(I)> fill_array(const T value, std::index_sequence<I...>)
+			{return {{(void(I), value)...}};}
+		template<size_t N, typename T>
+		constexpr std::array<T, N> fill_array(const T value)
+			{return fill_array(value, std::make_index_sequence<N>());}
+		
 		template<typename T_Float> struct float_traits {};
 		template<> struct float_traits<float>
 		{
-			using as_int_t = int32_t;
+			using as_int_t  = int32_t;
+			using compute_t = float;
 			static const as_int_t
 				bits_exponent =  8,
 				bits_mantissa = 23;
@@ -25,7 +115,8 @@ namespace rootbeer
 			static const char *suffix() {return "f";}};
 		template<> struct float_traits<double>
 		{
-			using as_int_t = int64_t;
+			using as_int_t  = int64_t;
+			using compute_t = double;
 			static const as_int_t
 				bits_exponent = 11,
 				bits_mantissa = 52;
@@ -43,22 +134,122 @@ namespace rootbeer
 		struct pow_i_
 		{
 			template<typename X>
-			static X calc(const X x)
+			static constexpr X calc(const X x)
 			{
 				if (EXP_INDEX > 0) return pow_i_<std::max(EXP_INDEX-1,0)>::calc(x) * x;
 				if (EXP_INDEX < 0) return pow_i_<std::min(EXP_INDEX+1,0)>::calc(x) / x;
 				return X(1);
 			}
 		};
-		template<> struct pow_i_<-4> {template<typename X> static X calc(const X x) {return X(1)/((x*x)*(x*x));}};
-		template<> struct pow_i_<-3> {template<typename X> static X calc(const X x) {return X(1)/(x*x*x);}};
-		template<> struct pow_i_<-2> {template<typename X> static X calc(const X x) {return X(1)/(x*x);}};
-		template<> struct pow_i_<-1> {template<typename X> static X calc(const X x) {return X(1)/x;}};
-		template<> struct pow_i_< 0> {template<typename X> static X calc(const X x) {return X(1);}};
-		template<> struct pow_i_< 1> {template<typename X> static X calc(const X x) {return x;}};
-		template<> struct pow_i_< 2> {template<typename X> static X calc(const X x) {return x*x;}};
-		template<> struct pow_i_< 3> {template<typename X> static X calc(const X x) {return x*x*x;}};
-		template<> struct pow_i_< 4> {template<typename X> static X calc(const X x) {return (x*x)*(x*x);}};
+		template<> struct pow_i_<-4> {template<typename X> static constexpr X calc(const X x) {return X(1)/((x*x)*(x*x));}};
+		template<> struct pow_i_<-3> {template<typename X> static constexpr X calc(const X x) {return X(1)/(x*x*x);}};
+		template<> struct pow_i_<-2> {template<typename X> static constexpr X calc(const X x) {return X(1)/(x*x);}};
+		template<> struct pow_i_<-1> {template<typename X> static constexpr X calc(const X x) {return X(1)/x;}};
+		template<> struct pow_i_< 0> {template<typename X> static constexpr X calc(const X)   {return X(1);}};
+		template<> struct pow_i_< 1> {template<typename X> static constexpr X calc(const X x) {return x;}};
+		template<> struct pow_i_< 2> {template<typename X> static constexpr X calc(const X x) {return x*x;}};
+		template<> struct pow_i_< 3> {template<typename X> static constexpr X calc(const X x) {return x*x*x;}};
+		template<> struct pow_i_< 4> {template<typename X> static constexpr X calc(const X x) {return (x*x)*(x*x);}};
+
+	#if defined(__SIZEOF_INT128__)
+		__extension__ typedef unsigned __int128 uint128_t;  // __extension__ keeps -Wpedantic quiet
+	#endif
+
+		// High half of the double-width product of unsigned integers
+		constexpr uint16_t mulhi(const uint16_t a, const uint16_t b)    {return uint16_t((uint32_t(a) * b) >> 16);}
+		constexpr uint32_t mulhi(const uint32_t a, const uint32_t b)    {return uint32_t((uint64_t(a) * b) >> 32);}
+		constexpr uint64_t mulhi(const uint64_t a, const uint64_t b)
+		{
+		#if defined(__SIZEOF_INT128__)
+			return uint64_t((uint128_t(a) * b) >> 64);
+		#else
+			const uint64_t a1 = a >> 32, a0 = a & 0xFFFFFFFFu, b1 = b >> 32, b0 = b & 0xFFFFFFFFu,
+				mid = ((a0*b0) >> 32) + ((a1*b0) & 0xFFFFFFFFu) + ((a0*b1) & 0xFFFFFFFFu);
+			return a1*b1 + ((a1*b0) >> 32) + ((a0*b1) >> 32) + (mid >> 32);
+		#endif
+		}
+
+		template<typename T_Uint>
+		struct div_magic {T_Uint magic; int shift;};
+
+		// Magic reciprocal for dividing W-bit signed integers by d >= 2
+		template<typename T_Uint>
+		constexpr div_magic<T_Uint> find_div_magic(const T_Uint d)
+		{
+			const int bits = 8 * sizeof(T_Uint);
+			const T_Uint two_w1 = T_Uint(1) << (bits-1), anc = two_w1 - 1 - two_w1 % d;
+			T_Uint q1 = two_w1 / anc, r1 = two_w1 - q1*anc,
+				q2 = two_w1 / d,   r2 = two_w1 - q2*d, delta = 0;
+			int p = bits - 1;
+			do
+			{
+				++p;
+				q1 *= 2; r1 *= 2; if (r1 >= anc) {++q1; r1 -= anc;}
+				q2 *= 2; r2 *= 2; if (r2 >= d)   {++q2; r2 -= d;}
+				delta = d - r2;
+			}
+			while (q1 < delta || (q1 == delta && r1 == 0));
+			return {T_Uint(q2 + 1), p - bits};
+		}
+
+		constexpr int floor_log2(const int v)    {return (v > 1) ? 1 + floor_log2(v / 2) : 0;}
+
+		/*
+			Signed division by a positive constant D, truncating toward zero
+			exactly like the / operator, without a divide instruction.
+
+			Powers of two bias negative dividends by D-1 and shift arithmetically.
+			Other divisors take the high half of a product with a magic reciprocal
+			M = ceil(2^(W-1+shift) / D), as in Hacker's Delight section 10-4; the
+			magic is found at compile time for the smallest shift that makes the
+			quotient exact for every W-bit dividend.
+
+			The SIMD kernels and the code generator repeat these steps.
+		*/
+		template<typename T_Int, int D>
+		struct int_divider
+		{
+			static_assert(D >= 1, "divisor must be positive");
+
+			using uint_t = typename std::make_unsigned<T_Int>::type;
+
+			using power_of_two = std::integral_constant<bool, (D & (D-1)) == 0>;
+			using log2         = std::integral_constant<int, floor_log2(D)>;
+
+			// Unused for powers of two
+			using magic = std::integral_constant<uint_t, find_div_magic(uint_t(power_of_two::value ? 3 : D)).magic>;
+			using shift = std::integral_constant<int,    find_div_magic(uint_t(power_of_two::value ? 3 : D)).shift>;
+
+			static constexpr T_Int divide(const T_Int i)
+			{
+				return (D == 1) ? i
+					: power_of_two::value ? T_Int(i + (i < 0 ? T_Int(D-1) : T_Int(0))) >> log2::value
+					: T_Int(T_Int(mulhi(uint_t(i), magic::value) - (i < 0 ? magic::value : uint_t(0))) >> shift::value) + T_Int(i < 0);
+			}
+		};
+
+		template<int D, typename T_Int>
+		constexpr T_Int div_i(const T_Int i)    {return int_divider<T_Int, D>::divide(i);}
+
+		/*
+			Cube root of a float, correctly rounded over the tested ranges.
+			Three Halley iterations in double precision from a magic-constant
+			estimate; the SIMD scanners repeat these exact steps.
+		*/
+		inline float cbrt_float(const float y)
+		{
+			double Y = std::abs(double(y)), r;
+			if (!(Y > 0.0) || !(Y < HUGE_VAL)) return y;
+			int64_t i; std::memcpy(&i, &Y, sizeof(i));
+			i = 0x2a9f76253119d328 + div_i<3>(i);
+			std::memcpy(&r, &i, sizeof(r));
+			for (int step = 0; step < 3; ++step)
+			{
+				double r3 = (r*r)*r;
+				r = (r*(r3 + (Y+Y))) / ((r3+r3) + Y);
+			}
+			return (y < 0.f) ? -float(r) : float(r);
+		}
 		
 		template<int ROOT_INDEX>
 		struct root_i_
@@ -69,15 +260,19 @@ namespace rootbeer
 			static X calc(const X x) {return std::pow(x, X(1)/X(ROOT_INDEX));}
 		};
 		template<> struct root_i_<-4> {template<typename X> static X calc(const X x) {return X(1)/std::sqrt(std::sqrt(x));}};
+		template<> struct root_i_<-3> {template<typename X> static X calc(const X x) {return X(1)/std::cbrt(x);}
+		                               static float calc(const float x) {return 1.f/cbrt_float(x);}};
 		template<> struct root_i_<-2> {template<typename X> static X calc(const X x) {return X(1)/std::sqrt(x);}};
 		template<> struct root_i_<-1> {template<typename X> static X calc(const X x) {return X(1)/x;}};
 		template<> struct root_i_< 1> {template<typename X> static X calc(const X x) {return x;}};
 		template<> struct root_i_< 2> {template<typename X> static X calc(const X x) {return std::sqrt(x);}};
+		template<> struct root_i_< 3> {template<typename X> static X calc(const X x) {return std::cbrt(x);}
+		                               static float calc(const float x) {return cbrt_float(x);}};
 		template<> struct root_i_< 4> {template<typename X> static X calc(const X x) {return std::sqrt(std::sqrt(x));}};
 	}
 	
 	template<int EXP_INDEX, typename T_Num>
-	inline T_Num pow_i(const T_Num n)    {return detail::pow_i_<EXP_INDEX>::calc(n);}
+	constexpr T_Num pow_i(const T_Num n)    {return detail::pow_i_<EXP_INDEX>::calc(n);}
 	
 	template<int ROOT_INDEX, typename T_Num>
 	inline T_Num root_i(const T_Num n)    {return detail::root_i_<ROOT_INDEX>::calc(n);}
@@ -87,10 +282,14 @@ namespace rootbeer
 	template<typename T_Int>
 	using int_as_float_t = typename detail::int_traits<T_Int>::as_real_t;
 	
+	// Type for reference values and error measurement: float for 16-bit formats
+	template<typename T_Float>
+	using float_compute_t = typename detail::float_traits<T_Float>::compute_t;
+	
 	template<typename T_Float>
-	float_as_int_t<T_Float> reinterpret_float_int(const T_Float v)    {return * reinterpret_cast<const float_as_int_t<T_Float>*>(&v);}
+	ROOTBEER_CONSTEXPR float_as_int_t<T_Float> reinterpret_float_int(const T_Float v)    {return detail::bit_cast<float_as_int_t<T_Float>>(v);}
 	template<typename T_Int>
-	int_as_float_t<T_Int>   reinterpret_int_float(const T_Int   v)    {return * reinterpret_cast<const int_as_float_t<T_Int>*>(&v);}
+	ROOTBEER_CONSTEXPR int_as_float_t<T_Int>   reinterpret_int_float(const T_Int   v)    {return detail::bit_cast<int_as_float_t<T_Int>>(v);}
 
 	/*
 		Calculate the root-mean-square error of an exponent approximation.
@@ -105,70 +304,448 @@ namespace rootbeer
 		double worst_error() const    {return std::max(-min_error, max_error);}
 	};
 	
+	/*
+		Running sums behind PowApprox_Stats, kept in double precision.
+		Accumulators over consecutive ranges may be merged in order, giving
+		the earliest argument for ties in the minimum or maximum error.
+	 */
+	struct PowApprox_Accumulator
+	{
+		double   sum_error = 0.0, sum_sq_error = 0.0;
+		uint64_t samples = 0;
+		double   min_error =  1e20, min_error_arg = 0.0;
+		double   max_error = -1e20, max_error_arg = 0.0;
+		
+		void add(const double error, const double arg)
+		{
+			sum_error += error;
+			sum_sq_error += error*error;
+			++samples;
+			if (error < min_error) {min_error = error; min_error_arg = arg;}
+			if (error > max_error) {max_error = error; max_error_arg = arg;}
+		}
+		
+		void merge(const PowApprox_Accumulator &other)
+		{
+			sum_error    += other.sum_error;
+			sum_sq_error += other.sum_sq_error;
+			samples      += other.samples;
+			if (other.min_error < min_error) {min_error = other.min_error; min_error_arg = other.min_error_arg;}
+			if (other.max_error > max_error) {max_error = other.max_error; max_error_arg = other.max_error_arg;}
+		}
+		
+		PowApprox_Stats stats() const
+		{
+			double n = double(std::max<uint64_t>(samples, 1));
+			return {
+				sum_sq_error / n,
+				sum_error / n,
+				min_error, min_error_arg,
+				max_error, max_error_arg};
+		}
+	};
+	
+	/*
+		Distribution of error over a scan, in fixed memory.
+		Results are counted by their distance in units in the last place (ULPs)
+		from the correctly rounded root, exactly up to 15 and by powers of two
+		beyond, and by the power of two of their relative error.  Each binade of
+		input keeps its worst relative error and worst distance in ULPs.
+		Histograms merge in any order to the same result: ties in the worst
+		error keep the argument of least magnitude, and then the positive one.
+	 */
+	template<typename T_Float>
+	struct PowApprox_Histogram
+	{
+		using float_t = T_Float;
+		using int_t   = float_as_int_t<T_Float>;
+		using uint_t  = typename std::make_unsigned<int_t>::type;
+		
+		static const unsigned
+			ulp_exact     = 16,              // then [2^k, 2^(k+1)) for k = 4..63
+			ulp_buckets   = ulp_exact + 60,
+			error_exp_min = 64,              // relative errors below 2^-64 share bucket 0
+			error_buckets = error_exp_min + 2,  // and those of 1 or more, or NaN, the last
+			bits_mantissa = unsigned(detail::float_traits<T_Float>::bits_mantissa),
+			binade_count  = 1u << unsigned(detail::float_traits<T_Float>::bits_exponent);
+		
+		struct Binade
+		{
+			uint64_t samples = 0, worst_ulps = 0;
+			double   worst_error = -1.0, worst_error_arg = 0.0;
+			
+			// Ties keep the argument of least magnitude, then the positive one
+			void add_worst(const double error, const double arg)
+			{
+				if (error > worst_error || (error == worst_error &&
+					(std::abs(arg) < std::abs(worst_error_arg) || (std::abs(arg) == std::abs(worst_error_arg) && arg > worst_error_arg))))
+					{worst_error = error; worst_error_arg = arg;}
+			}
+		};
+		
+		uint64_t samples = 0;
+		uint64_t ulp_counts[ulp_buckets] = {};
+		uint64_t error_counts[error_buckets] = {};
+		Binade   binades[binade_count];
+		
+		static unsigned ulp_bucket(const uint64_t ulps)    {return (ulps < ulp_exact) ? unsigned(ulps) : ulp_exact + 59u - detail::clz64(ulps | 1);}
+		static uint64_t ulp_bucket_max(const unsigned b)
+		{
+			if (b < ulp_exact) return b;
+			return (b + 1 < ulp_buckets) ? (uint64_t(2) << (b - ulp_exact + 4)) - 1 : std::numeric_limits<uint64_t>::max();
+		}
+		static unsigned error_bucket(const double error)    {return error_bucket_bits(detail::bit_cast<uint64_t>(error));}
+		static unsigned error_bucket_bits(const uint64_t bits)
+		{
+			// floor(log2(|error|)) from the exponent field; NaN lands past 1 with infinity
+			const int e = int((bits >> 52) & 0x7FF) - 1023;
+			return unsigned(std::min(std::max(e + int(error_exp_min) + 1, 0), int(error_buckets) - 1));
+		}
+		static double error_bucket_max(const unsigned b)
+		{
+			return (b + 1 < error_buckets) ? std::ldexp(1.0, int(b) - int(error_exp_min)) : std::numeric_limits<double>::infinity();
+		}
+		
+		// Floats in order as integers, with -0 and +0 together
+		static int_t ordinal(const float_t v)
+		{
+			const int_t i = reinterpret_float_int(v), sign = int_t(i >> (8 * sizeof(int_t) - 1));
+			return int_t(((i & std::numeric_limits<int_t>::max()) ^ sign) - sign);
+		}
+		// Arguments ordered as add_worst ranks them, by magnitude and then sign
+		static uint_t argument_key(const float_t v)
+		{
+			const uint_t i = uint_t(reinterpret_float_int(v));
+			return uint_t(uint_t(i << 1) | uint_t(i >> (8 * sizeof(uint_t) - 1)));
+		}
+		static float_t argument_from_key(const uint_t key)
+		{
+			return detail::bit_cast<float_t>(uint_t(uint_t(key >> 1) | uint_t(key << (8 * sizeof(uint_t) - 1))));
+		}
+		static unsigned binade_index(const float_t v)
+		{
+			return unsigned((uint_t(reinterpret_float_int(v)) >> bits_mantissa) & uint_t(binade_count - 1));
+		}
+		
+		// In the float's own width, which holds any distance; without branches,
+		// as results fall either side of the root at random
+		static uint_t ulps_between(const float_t result, const float_t exact)
+		{
+			const int_t  a = ordinal(result), b = ordinal(exact);
+			const uint_t below = uint_t(0u - uint_t(a < b));
+			return uint_t((uint_t(uint_t(a) - uint_t(b)) ^ below) - below);
+		}
+		
+		// Magnitude of relative error, with NaN worst of all; as bits, in the same order
+		static uint64_t magnitude_bits(const double error)
+		{
+			return std::min(detail::bit_cast<uint64_t>(error) & ~(uint64_t(1) << 63), detail::bit_cast<uint64_t>(std::numeric_limits<double>::infinity()));
+		}
+		static double magnitude(const double error)    {return detail::bit_cast<double>(magnitude_bits(error));}
+		
+		void add(const float_t arg, const float_t result, const float_t exact, const double error)
+		{
+			const uint64_t ulps = ulps_between(result, exact);
+			++samples;
+			++ulp_counts[ulp_bucket(ulps)];
+			++error_counts[error_bucket(error)];
+			
+			Binade &binade = binades[binade_index(arg)];
+			++binade.samples;
+			binade.worst_ulps = std::max(binade.worst_ulps, uint64_t(ulps));
+			binade.add_worst(magnitude(error), double(arg));
+		}
+		
+		/*
+			Add count samples at once.  Counting samples as a scan makes them
+			leaves its loads waiting on stores whose addresses are known late, so
+			scans hand over blocks of block_size.  A full block is measured in
+			passes the compiler can vectorize; each bucket it spans is counted
+			by comparing it with the whole block, as neighbouring samples mostly
+			share a few, and its worst cases come from maxima over the binade.
+		*/
+		static const unsigned block_size = 256;
+		
+		void add(const size_t count, const float_t *arg, const float_t *result, const float_t *exact, const double *error)
+		{
+			size_t i = 0;
+			for (; i + block_size <= count; i += block_size) add_block(arg + i, result + i, exact + i, error + i);
+			for (; i < count; ++i) add(arg[i], result[i], exact[i], error[i]);
+		}
+		
+		void add_block(const float_t *arg, const float_t *result, const float_t *exact, const double *error)
+		{
+			uint_t   least_ulps = uint_t(~uint_t(0)), worst_ulps = 0;
+			uint64_t least_bits = ~uint64_t(0), worst_bits = 0;
+			unsigned other_binades = 0;
+			const unsigned index = binade_index(arg[0]);
+			for (unsigned k = 0; k < block_size; ++k)
+			{
+				const uint_t   ulps = ulps_between(result[k], exact[k]);
+				const uint64_t bits = magnitude_bits(error[k]);
+				least_ulps = std::min(least_ulps, ulps); worst_ulps = std::max(worst_ulps, ulps);
+				least_bits = std::min(least_bits, bits); worst_bits = std::max(worst_bits, bits);
+				other_binades |= binade_index(arg[k]) ^ index;
+			}
+			
+			// Buckets rise with their measures, so extremes give each's span
+			samples += block_size;
+			const unsigned ulp_lo = ulp_bucket(least_ulps), ulp_hi = ulp_bucket(worst_ulps);
+			if (ulp_lo == ulp_hi) ulp_counts[ulp_lo] += block_size;
+			else
+			{
+				uint8_t bucket[block_size];
+				for (unsigned k = 0; k < block_size; ++k) bucket[k] = uint8_t(ulp_bucket(ulps_between(result[k], exact[k])));
+				for (unsigned b = ulp_lo; b <= ulp_hi; ++b)
+				{
+					unsigned n = 0;
+					for (unsigned k = 0; k < block_size; ++k) n += (bucket[k] == b);
+					ulp_counts[b] += n;
+				}
+			}
+			const unsigned error_lo = error_bucket_bits(least_bits), error_hi = error_bucket_bits(worst_bits);
+			if (error_lo == error_hi) error_counts[error_lo] += block_size;
+			else
+			{
+				uint8_t bucket[block_size];
+				for (unsigned k = 0; k < block_size; ++k) bucket[k] = uint8_t(error_bucket(error[k]));
+				for (unsigned b = error_lo; b <= error_hi; ++b)
+				{
+					unsigned n = 0;
+					for (unsigned k = 0; k < block_size; ++k) n += (bucket[k] == b);
+					error_counts[b] += n;
+				}
+			}
+			
+			if (other_binades)
+			{
+				// Rarely, the block crosses into another binade
+				for (unsigned k = 0; k < block_size; ++k)
+				{
+					Binade &binade = binades[binade_index(arg[k])];
+					++binade.samples;
+					binade.worst_ulps = std::max(binade.worst_ulps, uint64_t(ulps_between(result[k], exact[k])));
+					binade.add_worst(magnitude(error[k]), double(arg[k]));
+				}
+				return;
+			}
+			
+			Binade &binade = binades[index];
+			const double worst_error = detail::bit_cast<double>(worst_bits);
+			binade.samples   += block_size;
+			binade.worst_ulps = std::max(binade.worst_ulps, uint64_t(worst_ulps));
+			if (worst_error < binade.worst_error) return;
+			
+			// Error often grows through a binade, so the worst's argument comes from a reduction too
+			uint_t least = uint_t(~uint_t(0));
+			for (unsigned k = 0; k < block_size; ++k)
+				least = std::min(least, uint_t(argument_key(arg[k]) | uint_t(0u - uint_t(magnitude_bits(error[k]) != worst_bits))));
+			binade.add_worst(worst_error, double(argument_from_key(least)));
+		}
+		
+		void merge(const PowApprox_Histogram &other)
+		{
+			samples += other.samples;
+			for (unsigned i = 0; i < ulp_buckets;   ++i) ulp_counts[i]   += other.ulp_counts[i];
+			for (unsigned i = 0; i < error_buckets; ++i) error_counts[i] += other.error_counts[i];
+			for (unsigned i = 0; i < binade_count;  ++i)
+			{
+				Binade &binade = binades[i];
+				const Binade &o = other.binades[i];
+				binade.samples   += o.samples;
+				binade.worst_ulps = std::max(binade.worst_ulps, o.worst_ulps);
+				if (o.samples) binade.add_worst(o.worst_error, o.worst_error_arg);
+			}
+		}
+		
+		// Fraction of samples within a distance in ULPs; past 15, a lower bound
+		double fraction_within_ulps(const uint64_t ulps) const
+		{
+			uint64_t n = 0;
+			for (unsigned b = 0; b < ulp_buckets && ulp_bucket_max(b) <= ulps; ++b) n += ulp_counts[b];
+			return samples ? double(n) / double(samples) : 1.0;
+		}
+		
+		// Least distance in ULPs covering a fraction of samples; past 15, an upper bound
+		uint64_t ulps_at_fraction(const double fraction) const
+		{
+			uint64_t n = 0;
+			for (unsigned b = 0; b < ulp_buckets; ++b)
+				if (double(n += ulp_counts[b]) >= fraction * double(samples)) return ulp_bucket_max(b);
+			return ulp_bucket_max(ulp_buckets - 1);
+		}
+		
+		// Upper bound of the relative error covering a fraction of samples
+		double error_at_fraction(const double fraction) const
+		{
+			uint64_t n = 0;
+			for (unsigned b = 0; b < error_buckets; ++b)
+				if (double(n += error_counts[b]) >= fraction * double(samples)) return error_bucket_max(b);
+			return error_bucket_max(error_buckets - 1);
+		}
+		
+		uint64_t worst_ulps() const
+		{
+			uint64_t worst = 0;
+			for (const Binade &binade : binades) worst = std::max(worst, binade.worst_ulps);
+			return worst;
+		}
+	};
+	
+	namespace detail
+	{
+		// Exhaustive scans are split into chunks of this many inputs.
+		// Chunk boundaries don't depend on thread count, so neither do results.
+		static const uint64_t scan_chunk_size = uint64_t(1) << 14;
+		
+		template<typename T_Int>
+		size_t count_chunks(const T_Int ib, const T_Int ie)
+		{
+			return (ie < ib) ? 0 : size_t(((uint64_t(ie) - uint64_t(ib)) / scan_chunk_size) + 1);
+		}
+		
+		// Call task(i) for each integer in chunk c of [ib, ie]
+		template<typename T_Int, typename T_Task>
+		void scan_chunk(const size_t c, const T_Int ib, const T_Int ie, const T_Task &task)
+		{
+			T_Int
+				b = T_Int(uint64_t(ib) + c * scan_chunk_size),
+				e = T_Int(uint64_t(b) + std::min(uint64_t(ie) - uint64_t(b), scan_chunk_size - 1));
+			for (T_Int i = b; ; ++i)
+			{
+				task(i);
+				if (i == e) break;
+			}
+		}
+		
+		// As above, handing the task runs of up to block integers as (first, count)
+		template<typename T_Int, typename T_Task>
+		void scan_chunk_blocks(const size_t c, const T_Int ib, const T_Int ie, const uint64_t block, const T_Task &task)
+		{
+			const T_Int    b = T_Int(uint64_t(ib) + c * scan_chunk_size);
+			const uint64_t count = std::min(uint64_t(ie) - uint64_t(b), scan_chunk_size - 1) + 1;
+			for (uint64_t k = 0; k < count; k += block) task(T_Int(uint64_t(b) + k), size_t(std::min(block, count - k)));
+		}
+	}
+	
+	namespace detail
+	{
+		// A scan with a histogram gives each of at most this many runs of chunks its own.
+		// Counts and worst cases merge exactly, so the runs needn't match the chunks.
+		static const size_t scan_histogram_runs = 64;
+		
+		template<int ROOT_INDEX, typename T_Approx, typename T_Float, typename T_Executor>
+		PowApprox_Stats test_root_approx(
+			const T_Approx &approx,
+			T_Float range_min,
+			T_Float range_max,
+			T_Executor &&executor,
+			PowApprox_Histogram<T_Float> *histogram)
+		{
+			using float_t = T_Float;
+			using int_t = float_as_int_t<float_t>;
+			using compute_t = float_compute_t<float_t>;
+			int_t
+				ib = reinterpret_float_int(range_min),
+				ie = reinterpret_float_int(range_max);
+			
+			// Measurements...
+			using measure_t = double;
+			const size_t
+				chunks = count_chunks(ib, ie),
+				runs   = histogram ? std::min(chunks, scan_histogram_runs) : chunks;
+			std::vector<PowApprox_Accumulator> partial(chunks);
+			std::vector<PowApprox_Histogram<float_t>> partial_histogram(histogram ? runs : 0);
+			executor.parallel_for(runs, [&](const size_t r)
+			{
+				PowApprox_Histogram<float_t> *hist = histogram ? &partial_histogram[r] : nullptr;
+				for (size_t c = chunks * r / runs, end = chunks * (r+1) / runs; c < end; ++c)
+				{
+					PowApprox_Accumulator acc;
+					auto sample = [&](const int_t i, float_t &y, float_t &result, float_t &x) -> measure_t
+					{
+						y = bit_cast<float_t>(i);
+						compute_t exact = root_i<ROOT_INDEX>(compute_t(y));
+						auto      approx_result = approx(y);
+						measure_t error = (measure_t(approx_result) - measure_t(exact)) / measure_t(exact);
+						acc.add(error, measure_t(y));
+						result = float_t(approx_result);
+						x      = float_t(exact);
+						return error;
+					};
+					
+					if (!hist) scan_chunk(c, ib, ie, [&](const int_t i) {float_t y, result, x; sample(i, y, result, x);});
+					else
+					{
+						// Samples go to the histogram in blocks; see PowApprox_Histogram::add
+						const size_t block = PowApprox_Histogram<float_t>::block_size;
+						float_t   y[block], result[block], x[block];
+						measure_t error[block];
+						scan_chunk_blocks(c, ib, ie, block, [&](const int_t first, const size_t count)
+						{
+							for (size_t k = 0; k < count; ++k) error[k] = sample(int_t(uint64_t(first) + k), y[k], result[k], x[k]);
+							hist->add(count, y, result, x, error);
+						});
+					}
+					partial[c] = acc;
+				}
+			});
+			
+			PowApprox_Accumulator total;
+			for (auto &p : partial) total.merge(p);
+			for (auto &h : partial_histogram) histogram->merge(h);
+			return total.stats();
+		}
+	}
+	
+	/*
+		Exhaustively measure error for every float between range_min and range_max.
+		Chunks of the range are distributed over the executor's threads.
+	 */
+	template<int ROOT_INDEX, typename T_Approx, typename T_Float, typename T_Executor>
+	inline PowApprox_Stats Test_Root_Approx(
+		const T_Approx &approx,
+		T_Float range_min,
+		T_Float range_max,
+		T_Executor &&executor)
+	{
+		return detail::test_root_approx<ROOT_INDEX>(approx, range_min, range_max, executor,
+			static_cast<PowApprox_Histogram<T_Float>*>(nullptr));
+	}
+	
+	/*
+		As above, also adding every result to a histogram.
+	 */
+	template<int ROOT_INDEX, typename T_Approx, typename T_Float, typename T_Executor>
+	inline PowApprox_Stats Test_Root_Approx(
+		const T_Approx &approx,
+		T_Float range_min,
+		T_Float range_max,
+		T_Executor &&executor,
+		PowApprox_Histogram<T_Float> &histogram)
+	{
+		return detail::test_root_approx<ROOT_INDEX>(approx, range_min, range_max, executor, &histogram);
+	}
+	
 	template<int ROOT_INDEX, typename T_Approx, typename T_Float>
 	inline PowApprox_Stats Test_Root_Approx(
 		const T_Approx &approx,
 		T_Float range_min,
 		T_Float range_max)
 	{
-		using float_t = T_Float;
-		using int_t = float_as_int_t<float_t>;
-		int_t
-			ib = reinterpret_float_int(range_min),
-			ie = reinterpret_float_int(range_max);
-			
-		// Measurements...
-		using measure_t = float_t;
-		measure_t sum_error = 0.0, sum_sq_error = 0.0,
-			min_error     = 1e20, max_error     = -1e20,
-			min_error_arg = 0.0, max_error_arg = 0.0;
-		for (int i = ib; i <= ie; ++i)
-		{
-			float_t y = reinterpret_int_float(i), x = root_i<ROOT_INDEX>(y);
-			measure_t error = (approx(y) - x) / x;
-			sum_error += error;
-			sum_sq_error += error*error;
-			if (error < min_error) {min_error = error; min_error_arg = y;}
-			if (error > max_error) {max_error = error; max_error_arg = y;}
-		}
-		double samples = double(ie - ib);
-		return {
-			sum_sq_error / samples,
-			sum_error / samples,
-			min_error, min_error_arg,
-			max_error, max_error_arg};
+		return Test_Root_Approx<ROOT_INDEX>(approx, range_min, range_max, SerialExecutor());
 	}
 	
-	/*template<typename T_Approx, typename T_Float>
-	inline PowApprox_Stats Test_Pow_Approx(
+	template<int ROOT_INDEX, typename T_Approx, typename T_Float>
+	inline PowApprox_Stats Test_Root_Approx_Parallel(
 		const T_Approx &approx,
-		T_Float exponent,
 		T_Float range_min,
-		T_Float range_max)
+		T_Float range_max,
+		unsigned threads = 0)
 	{
-		using float_t = T_Float;
-		using int_t = float_as_int_t<float_t>;
-		int_t
-			ib = reinterpret_float_int(range_min),
-			ie = reinterpret_float_int(range_max);
-			
-		// Measurements...
-		using measure_t = float_t;
-		measure_t sum_error = 0.0, sum_sq_error = 0.0, worst_error = 0.0;
-		for (int i = ib; i <= ie; ++i)
-		{
-			float_t x = reinterpret_int_float(i), y = std::pow(x, exponent);
-			measure_t error = (approx(x) - y) / y;
-			sum_error += error;
-			sum_sq_error += error*error;
-			if (std::abs(error) > std::abs(worst_error)) worst_error = error;
-		}
-		double samples = double(ie - ib);
-		return {
-			sum_sq_error / samples,
-			sum_error / samples,
-			worst_error};
-	}*/
+		ThreadPool pool(threads);
+		return Test_Root_Approx<ROOT_INDEX>(approx, range_min, range_max, pool);
+	}
 	
 	template<int ROOT, typename T_Approx, typename T_Float>
 	inline float Test_Root_Approx_WorstCase(
@@ -178,22 +755,23 @@ namespace rootbeer
 	{
 		using float_t = T_Float;
 		using int_t = float_as_int_t<float_t>;
+		using compute_t = float_compute_t<float_t>;
 		int_t
 			ib = reinterpret_float_int(range_min),
 			ie = reinterpret_float_int(range_max);
 		//float_t exponent = float_t(1)/ROOT;
 			
-		union {float_t xf; int_t xi;};
-		union {float_t yf; int_t yi;};
 		/*yf = std::pow(range_min, exponent); ((ROOT > 0) ? --yi : ++yi);
 		float_t xf_lower = detail::pow_i<ROOT>::calc(yf);*/
 			
 		// Measurements...
-		float_t worst_error = 0.0;
-		for (xi = ib; xi <= ie; ++xi)
+		compute_t worst_error = 0.0;
+		for (int_t xi = ib; xi <= ie; ++xi)
 		{
+			float_t xf = detail::bit_cast<float_t>(xi);
+			
 			// Move root-value to closest approximation
-			yf = root_i<ROOT>(xf);
+			compute_t yf = root_i<ROOT>(compute_t(xf));
 			/*while (true)
 			{
 				((ROOT > 0) ? ++yi : --yi);
@@ -206,7 +784,7 @@ namespace rootbeer
 				xf_lower = xf_upper;
 			}*/
 			
-			float_t error = (approx(xf) - yf) / yf;
+			compute_t error = (compute_t(approx(xf)) - yf) / yf;
 			//sum_error += error;
 			//sum_sq_error += error*error;
 			if (std::abs(error) > std::abs(worst_error)) worst_error = error;
@@ -215,17 +793,90 @@ namespace rootbeer
 	}
 	
 	
+	/*
+		Test_Root_Approx_WorstCase, vectorized for float RootApprox designs.
+		Returns the same worst case; see root_cellar_batch.h.
+		Other approximations use the scalar routine.
+	 */
+	template<int ROOT, typename T_Approx, typename T_Float>
+	inline float Test_Root_Approx_WorstCase_SIMD(
+		const T_Approx &approx,
+		T_Float range_min,
+		T_Float range_max)
+	{
+		return Test_Root_Approx_WorstCase<ROOT>(approx, range_min, range_max);
+	}
+	
+	template<int N, typename T_Float, unsigned NewtonSteps> struct RootApprox;
+	
+	template<int ROOT, int N, unsigned NewtonSteps>
+	float Test_Root_Approx_WorstCase_SIMD(
+		const RootApprox<N, float, NewtonSteps> &approx,
+		float range_min,
+		float range_max);
+	
+	
 	/*
 		Newtonian step for refining x toward the Nth root of y
 	 */
 	template<int N, typename T_Real>
-	T_Real newtonian_for_root(const T_Real x, const T_Real y)
+	constexpr T_Real newtonian_for_root(const T_Real x, const T_Real y)
 	{
-		static const T_Real k = T_Real(N-1) / T_Real(N), p = T_Real(1)/T_Real(N);
+		const T_Real k = T_Real(N-1) / T_Real(N), p = T_Real(1)/T_Real(N);
 		if (N > 0) return x *  k + p * y / pow_i<N-1>(x);
 		else       return x * (k + p * y * pow_i<-N>(x));
 	}
 	
+	/*
+		Inputs accepted by a root approximation.
+
+		ROOT_FAST is the formula alone, meaningful for positive normal inputs.
+		ROOT_SAFE selects a result for every other input without branching
+		(see RootApprox_Safe in root_cellar_safe.h):
+			±0          ±0 for N > 0, ±inf for N < 0
+			+inf        +inf for N > 0, +0 for N < 0
+			denormals   scaled into the normal range and back
+			negatives   -root(-y) for odd N, NaN for even N
+			NaN         the input, unchanged
+	 */
+	enum ROOT_DOMAIN
+	{
+		ROOT_FAST = 0,
+		ROOT_SAFE = 1,
+	};
+
+	namespace detail
+	{
+		/*
+			Bit patterns used by ROOT_SAFE.  Denormals are scaled up by 2^(DEG*S)
+			before the root and its result by 2^-S (N > 0) or 2^S (N < 0), with S
+			the least integer making DEG*S exceed the mantissa width.
+		*/
+		template<int N, typename T_Float>
+		struct root_domain
+		{
+			using uint_t = typename std::make_unsigned<float_as_int_t<T_Float>>::type;
+
+			static constexpr int
+				DEG  = ((N>0) ? N : -N),
+				BITS = 8 * sizeof(uint_t),
+				M    = float_traits<T_Float>::bits_mantissa,
+				E    = float_traits<T_Float>::bits_exponent,
+				BIAS = (1 << (E-1)) - 1,
+				S    = (M + DEG) / DEG;
+
+			static constexpr uint_t
+				sign       = uint_t(uint_t(1) << (BITS-1)),
+				min_normal = uint_t(uint_t(1) << M),
+				infinity   = uint_t(((uint_t(1) << E) - 1) << M),
+				quiet_nan  = uint_t(infinity | (uint_t(1) << (M-1))),
+				one        = uint_t(uint_t(BIAS) << M),
+				scale_in   = uint_t(uint_t(BIAS + DEG*S) << M),
+				scale_out  = uint_t(uint_t(BIAS + ((N>0) ? -S : S)) << M);
+		};
+	}
+
+
 	/*
 		A formula for a approximate roots affording fast implementation.
 	 */
@@ -234,66 +885,80 @@ namespace rootbeer
 	{
 		static_assert(N != 0, "0th root is invalid");
 		
-		static const int DEG = ((N>0) ? N : -N);
+		static constexpr int DEG = ((N>0) ? N : -N);
 		
 		using float_t  = T_Float;
 		using range_t  = std::pair<float_t, float_t>;
 		using as_int_t = float_as_int_t<float_t>;
 		
+		using steps_t  = std::array<float_t, NewtonSteps>;
+		
 		as_int_t constant;
-		float_t  newton_m = float_t(1) / float_t(N);
+		steps_t  newton_m;  // Pseudo-newtonian constant for each refinement
 		
-		RootApprox(as_int_t _constant) :
-			constant(_constant) {}
+		constexpr RootApprox(as_int_t _constant) :
+			constant(_constant), newton_m(detail::fill_array<NewtonSteps>(float_t(1) / float_t(N))) {}
+		constexpr RootApprox(as_int_t _constant, float_t _newton_m) :
+			constant(_constant), newton_m(detail::fill_array<NewtonSteps>(_newton_m)) {}
+		constexpr RootApprox(as_int_t _constant, const steps_t &_newton_m) :
+			constant(_constant), newton_m(_newton_m) {}
 		
 		/*
 			Initial estimate based on float-reinterpretation hack.
 		*/
 		//static const as_int_t _rshift = as_int_t(std::ceil(std::log2(std::abs(N))));
 		
-		float_t initialEstimate(const float_t y) const
+		ROOTBEER_CONSTEXPR float_t initialEstimate(const float_t y) const
 		{
 			// Floating-point hack for initial estimate
-			union {float_t x; as_int_t i;}; x = y;
-			i = constant + i / as_int_t(N);
-			/*if (DEG&(DEG-1)) i = constant + i / as_int_t(N);
-			else if (N > 0)  i = constant + (i >> _rshift);
-			else             i = constant - (i >> _rshift);*/
-			return x;
+			as_int_t i = reinterpret_float_int(y);
+			const as_int_t q = detail::div_i<DEG>(i);
+			i = (N > 0) ? (constant + q) : (constant - q);
+			return detail::bit_cast<float_t>(i);
 		}
-		float_t initialEstimate_inverse(const float_t x) const
+		ROOTBEER_CONSTEXPR float_t initialEstimate_inverse(const float_t x) const
 		{
 			// Approximate exponential; the inverse of the initial estimator
-			union {float_t y; as_int_t i;}; y = x;
+			as_int_t i = reinterpret_float_int(x);
 			i = (i - constant) * as_int_t(N);
 			/*if (DEG&(DEG-1)) i = -constant + i * as_int_t(N);
 			else if (N > 0)  i = -constant + (i << _rshift);
 			else             i = -constant - (i << _rshift);*/
-			return y;
+			return detail::bit_cast<float_t>(i);
 		}
 		/*
 			One step of newtonian refinement.
 		*/
-		float_t newtonianRefinement(const float y, const float x) const
+		constexpr float_t newtonianRefinement(const float_t y, const float_t x, const unsigned step) const
 		{
-			if (N > 0) return x *  (float_t(1)-newton_m) + newton_m * y / pow_i<N-1>(x);
-			else       return x * ((float_t(1)-newton_m) + newton_m * y * pow_i<-N>(x));
+			const float_t m = newton_m[step];
+			if (N > 0) return x *  (float_t(1)-m) + m * y / pow_i<N-1>(x);
+			else       return x * ((float_t(1)-m) + m * y * pow_i<-N>(x));
 		}
 		
 		/*
 			Complete calculation.
 		*/
-		float_t operator()(const float_t y) const
+		ROOTBEER_CONSTEXPR float_t operator()(const float_t y) const
 		{
 			float_t x = initialEstimate(y);
 			
 			for (unsigned i = 0; i < NewtonSteps; ++i)
-				x = newtonianRefinement(y, x);
+				x = newtonianRefinement(y, x, i);
 			
 			return x;
 		}
 		
-		// Get the suggested testing range for this root
+		/*
+			Batch calculation over arrays, using SIMD where available.
+			Defined in root_cellar_batch.h.  y and x may be the same array.
+		*/
+		void apply        (const float_t *y, float_t *x, size_t count) const;
+		void apply        (float_t *yx, size_t count) const;
+		void apply_aligned(const float_t *y, float_t *x, size_t count) const;
+		void apply_aligned(float_t *yx, size_t count) const;
+		
+		// Get the suggested testing range for this root
 		static range_t test_param_range()
 		{
 			return std::make_pair(float_t(1), float_t(1<<std::abs(N)));
@@ -361,16 +1026,16 @@ namespace rootbeer
 			
 			return range;
 		}
-		range_t errorRange_refine(range_t prevRange) const
+		range_t errorRange_refine(range_t prevRange, const unsigned step) const
 		{
-			const float_t exponent = float_t(1)/float_t(N);
+			const float_t exponent = float_t(1)/float_t(N), m = newton_m[step];
 			range_t range(float_t(1e20), float_t(-1e20));
 			
 			auto consider = [&](const float_t ratio)
 			{
 				float_t refined
-					= (1 - newton_m) * ratio
-					+ newton_m * pow_i<1-N>(ratio);
+					= (1 - m) * ratio
+					+ m * pow_i<1-N>(ratio);
 				range.first  = std::min(range.first,  refined);
 				range.second = std::max(range.second, refined);
 				//std::cout << "Consider NR(" << ratio << ") = " << refined << std::endl;
@@ -380,8 +1045,8 @@ namespace rootbeer
 			
 			// Consider additional local min/max.
 			float_t extremum = root_i<N>(
-				(newton_m * (exponent - float_t(1))) /
-				(exponent * (newton_m - float_t(1))));
+				(m * (exponent - float_t(1))) /
+				(exponent * (m - float_t(1))));
 			if (extremum > prevRange.first && extremum < prevRange.second)
 				consider(extremum);
 			
@@ -393,7 +1058,7 @@ namespace rootbeer
 			range_t range = errorRange_initial();
 			
 			for (unsigned i = 0; i < NewtonSteps; ++i)
-				range = errorRange_refine(range);
+				range = errorRange_refine(range, i);
 				
 			return range;
 		}
@@ -403,6 +1068,126 @@ namespace rootbeer
 			range_t range = errorRange();
 			return std::max(std::abs(range.first-float_t(1)), std::abs(range.second-float_t(1)));
 		}
+		
+		/*
+			Certified bounds on the ratio x / y^(1/N), for normal inputs whose
+			estimates and intermediate values are normal.
+			
+			Unlike errorRange, these account for truncation in the estimate's integer
+			division and for rounding in every operation of the refinements.
+			Each linear section of the initial estimate is bounded with interval
+			arithmetic at its ends and at its one interior extremum; refinements
+			then map the interval the same way, widened by the rounding error.
+		*/
+		detail::interval errorInterval_initial() const
+		{
+			using detail::interval;
+			const int bits_mantissa = int(detail::float_traits<float_t>::bits_mantissa);
+			const double
+				L = std::ldexp(1.0, bits_mantissa),
+				B = double((as_int_t(1) << (detail::float_traits<float_t>::bits_exponent-1)) - 1),
+				K_hi = double(constant >> bits_mantissa),
+				K_lo = double(constant & ((as_int_t(1) << bits_mantissa) - 1)) / L,
+				period = double(1 << DEG);
+			
+			// Section boundaries: each binade of y, and where the estimate changes binade
+			std::vector<double> cuts;
+			for (int e = 0; e <= DEG; ++e) cuts.push_back(std::ldexp(1.0, e));
+			double ys = initialEstimate_inverse(float_t(1));
+			while (ys < 1.0)     ys *= period;
+			while (ys >= period) ys /= period;
+			cuts.push_back(ys);
+			std::sort(cuts.begin(), cuts.end());
+			
+			interval range(HUGE_VAL, -HUGE_VAL);
+			for (size_t s = 0; s+1 < cuts.size(); ++s)
+			{
+				const double y1 = cuts[s], y2 = cuts[s+1];
+				if (!(y1 < y2)) continue;
+				const int
+					ey = std::ilogb(y1),
+					ex = std::ilogb(initialEstimate(float_t((y1+y2)/2)));
+				
+				// The estimate without truncation is linear here: a + b*y
+				const interval
+					a = interval(std::ldexp(1.0, ex)) *
+						(interval(1.0 - B - ex + K_hi) + interval(K_lo) + interval(B + ey - 1) / interval(N)),
+					b = interval(std::ldexp(1.0, ex - ey)) / interval(N),
+					Y(y1, y2);
+				auto ratio = [&](const interval y)    {return (a + b*y) * detail::root_interval(y, -N);};
+				
+				interval section = interval::hull(ratio(y1), ratio(y2));
+				if (N != 1)
+				{
+					interval yM = a / (interval(N-1) * b);
+					if (yM.intersects(Y)) section = interval::hull(section, ratio(yM.clip(Y)));
+				}
+				
+				// Truncation moves the estimate by less than one ulp
+				const interval
+					trunc = (N > 0) ? interval(-1.0, 0.0) : interval(0.0, 1.0),
+					scale = interval::hull(detail::root_interval(y1, -N), detail::root_interval(y2, -N));
+				section = section + trunc * interval(std::ldexp(1.0, ex - bits_mantissa)) * scale;
+				
+				range = interval::hull(range, section);
+			}
+			return range;
+		}
+		detail::interval errorInterval_refine(const detail::interval prev, const unsigned step) const
+		{
+			using detail::interval;
+			if (!(prev.lo > 0.0)) return interval(-HUGE_VAL, HUGE_VAL);
+			
+			const double
+				u = std::ldexp(1.0, -int(detail::float_traits<float_t>::bits_mantissa) - 1),
+				m = newton_m[step],
+				c = float_t(1) - newton_m[step];
+			auto refine = [&](const interval r)    {return interval(c)*r + interval(m)*detail::pow_interval(r, 1-N);};
+			
+			interval range = interval::hull(refine(prev.lo), refine(prev.hi));
+			if (N != 1)
+			{
+				interval extremum_N = interval(m) * interval(N-1) / interval(c);
+				if (extremum_N.lo > 0.0)
+				{
+					interval extremum = detail::root_interval(extremum_N, N);
+					if (extremum.intersects(prev)) range = interval::hull(range, refine(extremum.clip(prev)));
+				}
+			}
+			
+			// Roundings in each term of newtonianRefinement, then in combining them
+			const unsigned
+				k_c   = (N > 0) ? 1 : 0,
+				k_m   = (N > 0) ? unsigned(std::max(N, 2)) : unsigned(1-N),
+				k_out = (N > 0) ? 1 : 2;
+			const double
+				term_c = interval::up(std::abs(c) * prev.hi),
+				term_m = interval::up(std::abs(m) * std::max(detail::pow_interval(prev.lo, 1-N).hi, detail::pow_interval(prev.hi, 1-N).hi)),
+				slop   = interval::up(interval::up(term_c * detail::gamma_bound(k_c, u)) + interval::up(term_m * detail::gamma_bound(k_m, u))),
+				g_out  = detail::gamma_bound(k_out, u);
+			return (range + interval(-slop, slop)) * interval(interval::down(1.0 - g_out), interval::up(1.0 + g_out));
+		}
+		detail::interval errorInterval() const
+		{
+			detail::interval range = errorInterval_initial();
+			for (unsigned i = 0; i < NewtonSteps; ++i)
+				range = errorInterval_refine(range, i);
+			return range;
+		}
+		
+		range_t errorRange_certified() const
+		{
+			detail::interval range = errorInterval();
+			return range_t(detail::round_down<float_t>(range.lo), detail::round_up<float_t>(range.hi));
+		}
+		
+		float_t error_worstCase_certified() const
+		{
+			detail::interval range = errorInterval();
+			return detail::round_up<float_t>(std::max(
+				detail::interval::up(1.0 - range.lo),
+				detail::interval::up(range.hi - 1.0)));
+		}
 	};
 	
 	template<typename I>
@@ -425,10 +1210,113 @@ namespace rootbeer
 		BEST_WORST_CASE  = 0,
 		BEST_MEAN_SQUARE = 1,
 		APPROX_WORST_CASE = 2,
+		CERTIFIED_WORST_CASE = 3,
+		PRUNED_WORST_CASE = 4,  // scores as BEST_WORST_CASE; RootApprox_Best skips scans the analytic range rules out
 	};
+	
+	/*
+		Score a design on the given basis; lower is better.
+	 */
+	template<BEST_APPROX_BASIS Basis, int N, typename T_Float, unsigned NewtonSteps>
+	T_Float RootApprox_Score(const RootApprox<N, T_Float, NewtonSteps> &candidate)
+	{
+		using float_t = T_Float;
+		
+		// Determine testing range...
+		const auto range = RootApprox<N, T_Float, NewtonSteps>::test_param_range();
+		const float_t test_min = range.first, test_max = range.second;
+		
+		switch (Basis)
+		{
+		default:
+		case BEST_WORST_CASE:
+		case PRUNED_WORST_CASE: return std::abs(Test_Root_Approx_WorstCase_SIMD<N>(candidate, test_min, test_max));
+		case APPROX_WORST_CASE: return candidate.error_worstCase();
+		case CERTIFIED_WORST_CASE: return candidate.error_worstCase_certified();
+		case BEST_MEAN_SQUARE:  return float_t(Test_Root_Approx<N>(candidate, test_min, test_max).mean_sq_error);
+		}
+	}
+	
+	/*
+		Least worst-case error a scan could find for a design: the worst error
+		measured at inputs next to the extremes of its initial estimate's
+		ratio, the ends of each linear section and the point between where the
+		ratio is stationary.  These are scanned inputs measured as the scan
+		measures them, so no scan can report less; the analytic extremes only
+		choose inputs where the measurement comes close to the scan's result.
+	 */
+	template<int N, typename T_Float, unsigned NewtonSteps>
+	T_Float RootApprox_Score_Floor(const RootApprox<N, T_Float, NewtonSteps> &candidate)
+	{
+		using float_t   = T_Float;
+		using int_t     = float_as_int_t<float_t>;
+		using compute_t = float_compute_t<float_t>;
+		const int DEG = RootApprox<N, T_Float, NewtonSteps>::DEG, neighbours = 8;
+		const double P = 1.0 / double(N), period = double(1 << DEG);
+		
+		const auto range = RootApprox<N, T_Float, NewtonSteps>::test_param_range();
+		const int_t ib = reinterpret_float_int(range.first), ie = reinterpret_float_int(range.second);
+		
+		// As Test_Root_Approx_WorstCase measures, on inputs either side of y
+		compute_t worst = 0;
+		auto probe = [&](const double y)
+		{
+			if (!(y >= double(range.first) && y <= double(range.second))) return;
+			const int_t c = reinterpret_float_int(float_t(y));
+			const int_t lo = int_t(std::max<int64_t>(ib, int64_t(c) - neighbours)), hi = int_t(std::min<int64_t>(ie, int64_t(c) + neighbours));
+			for (int_t i = lo; i <= hi; ++i)
+			{
+				const float_t   xf    = detail::bit_cast<float_t>(i);
+				const compute_t exact = root_i<N>(compute_t(xf));
+				const compute_t error = std::abs((compute_t(candidate(xf)) - exact) / exact);
+				if (error > worst) worst = error;
+			}
+		};
+		
+		// Sections as in errorInterval_initial: each binade of y, and where the estimate changes binade
+		std::vector<double> cuts;
+		for (int e = 0; e <= DEG; ++e) cuts.push_back(std::ldexp(1.0, e));
+		double ys = candidate.initialEstimate_inverse(float_t(1));
+		while (ys < 1.0)     ys *= period;
+		while (ys >= period) ys /= period;
+		cuts.push_back(ys);
+		std::sort(cuts.begin(), cuts.end());
+		
+		for (size_t s = 0; s+1 < cuts.size(); ++s)
+		{
+			const double y1 = cuts[s], y2 = cuts[s+1];
+			probe(y1);
+			if (!(y1 < y2)) continue;
+			
+			// The estimate is near linear in y here; its ratio to y^P is stationary where b*y = P*(a + b*y)
+			const float_t y2_in = detail::bit_cast<float_t>(int_t(reinterpret_float_int(float_t(y2)) - 1));
+			const double
+				x1 = double(candidate.initialEstimate(float_t(y1))),
+				x2 = double(candidate.initialEstimate(y2_in)),
+				b  = (x2 - x1) / (double(y2_in) - y1);
+			if (b != 0.0)
+			{
+				const double yM = (P / (1.0 - P)) * (x1 / b - y1);
+				if (yM > y1 && yM < y2) probe(yM);
+			}
+		}
+		probe(cuts.back());
+		return float_t(worst);
+	}
 	 
-	template<int N, typename T_Float, unsigned NewtonSteps = 1, BEST_APPROX_BASIS Basis = BEST_WORST_CASE>
-	RootApprox<N,T_Float,NewtonSteps> RootApprox_Best()
+	/*
+		Search for the best design by successively refined grids over (k, m).
+		The candidates of each grid are scored on the executor's threads;
+		ties go to the earliest candidate, as if scored in order.
+		
+		With PRUNED_WORST_CASE, the candidate of each grid with the best
+		analytic range is scanned first, and the rest only if their
+		RootApprox_Score_Floor doesn't exceed the best scan so far.  A scan
+		never falls below its floor, so those skipped can't beat or tie it, and
+		the result is BEST_WORST_CASE's.
+	 */
+	template<int N, typename T_Float, unsigned NewtonSteps = 1, BEST_APPROX_BASIS Basis = BEST_WORST_CASE, typename T_Executor>
+	RootApprox<N,T_Float,NewtonSteps> RootApprox_Best(T_Executor &&executor)
 	{
 		using float_t = T_Float;
 		using as_int_t = float_as_int_t<float_t>;
@@ -451,24 +1339,11 @@ namespace rootbeer
 			m_max = reinterpret_float_int(p*float_t(1.5));
 		if (m_min > m_max) std::swap(m_min, m_max);
 		if (NewtonSteps == 0) m_max = m_min;
-			
-		// Determine testing range...
-		float_t
-			test_min = float_t(1),
-			test_max = float_t(1 << std::abs(N));
 		
 		auto get_score = [=](as_int_t k, as_int_t m) -> float_t
 		{
-			RootApprox<N, T_Float, NewtonSteps> candidate(k);
-			candidate.newton_m = reinterpret_int_float(m);
-			
-			switch (Basis)
-			{
-			default:
-			case BEST_WORST_CASE:   return std::abs(Test_Root_Approx_WorstCase<N>(candidate, test_min, test_max));
-			case APPROX_WORST_CASE: return candidate.error_worstCase();
-			case BEST_MEAN_SQUARE:  return float_t(Test_Root_Approx<N>(candidate, test_min, test_max).mean_sq_error);
-			}
+			RootApprox<N, T_Float, NewtonSteps> candidate(k, reinterpret_int_float(m));
+			return RootApprox_Score<Basis>(candidate);
 		};
 		
 		std::cout << std::hex << "//Searching k in [0x"
@@ -487,6 +1362,11 @@ namespace rootbeer
 		k_step = nextpow2(k_step);
 		m_step = nextpow2(m_step);
 		k_step = m_step = std::max(k_step, m_step);
+		
+		std::vector<std::pair<as_int_t, as_int_t>> grid;
+		std::vector<float_t> scores, floors;
+		std::vector<size_t>  survivors;
+		size_t scans = 0, pruned = 0;
 			
 		while (k_lo < k_hi || m_lo < m_hi)
 		{
@@ -496,16 +1376,50 @@ namespace rootbeer
 			as_int_t
 				k_start = k_lo + ((k_hi-k_lo)/k_step)/2,
 				m_start = m_lo + ((m_hi-m_lo)/m_step)/2;
+			grid.clear();
 			for (as_int_t k = k_start; k <= k_hi; k += k_step)
 				for (as_int_t m = m_start; m <= m_hi; m += m_step)
+					grid.push_back({k, m});
+			
+			scores.resize(grid.size());
+			if (Basis != PRUNED_WORST_CASE) executor.parallel_for(grid.size(), [&](const size_t i)
 			{
-				float_t score = get_score(k, m);
+				scores[i] = get_score(grid[i].first, grid[i].second);
+			});
+			else
+			{
+				floors.resize(grid.size());
+				executor.parallel_for(grid.size(), [&](const size_t i)
+				{
+					floors[i] = RootApprox_Score_Floor(RootApprox<N, T_Float, NewtonSteps>(grid[i].first, reinterpret_int_float(grid[i].second)));
+				});
 				
-				if (score < best_score)
+				const size_t lead = size_t(std::min_element(floors.begin(), floors.end()) - floors.begin());
+				scores[lead] = get_score(grid[lead].first, grid[lead].second);
+				const float_t bar = std::min(best_score, scores[lead]);
+				
+				survivors.clear();
+				for (size_t i = 0; i < grid.size(); ++i)
 				{
-					best_score = score;
-					best_k = k;
-					best_m = m;
+					if (i == lead) continue;
+					if (floors[i] <= bar) survivors.push_back(i);
+					else                  scores[i] = std::numeric_limits<float_t>::infinity();
+				}
+				executor.parallel_for(survivors.size(), [&](const size_t j)
+				{
+					scores[survivors[j]] = get_score(grid[survivors[j]].first, grid[survivors[j]].second);
+				});
+				scans  += grid.size();
+				pruned += grid.size() - 1 - survivors.size();
+			}
+			
+			for (size_t i = 0; i < grid.size(); ++i)
+			{
+				if (scores[i] < best_score)
+				{
+					best_score = scores[i];
+					best_k = grid[i].first;
+					best_m = grid[i].second;
 				}
 			}
 			
@@ -518,6 +1432,8 @@ namespace rootbeer
 		}
 		
 		std::cout << std::endl;
+		if (Basis == PRUNED_WORST_CASE)
+			std::cout << std::dec << "//  ...analytic ranges ruled out " << pruned << " of " << scans << " scans" << std::hex << std::endl;
 		
 		
 		/*as_int_t l = constant_min, r = constant_max;
@@ -564,15 +1480,385 @@ namespace rootbeer
 				}
 			}
 		}*/
-		RootApprox<N, T_Float, NewtonSteps> result(best_k);
-		result.newton_m = reinterpret_int_float(best_m);
+		RootApprox<N, T_Float, NewtonSteps> result(best_k, reinterpret_int_float(best_m));
 		
 		std::cout << "//  ...best design k=" << best_k
-			<< ", m=" << result.newton_m
+			<< ", m=" << reinterpret_int_float(best_m)
 			<< " with error score " << best_score << std::endl;
 		return result;
 	}
 	
+	template<int N, typename T_Float, unsigned NewtonSteps = 1, BEST_APPROX_BASIS Basis = BEST_WORST_CASE>
+	RootApprox<N,T_Float,NewtonSteps> RootApprox_Best()
+	{
+		return RootApprox_Best<N, T_Float, NewtonSteps, Basis>(SerialExecutor());
+	}
+	
+	template<int N, typename T_Float, unsigned NewtonSteps = 1, BEST_APPROX_BASIS Basis = BEST_WORST_CASE>
+	RootApprox<N,T_Float,NewtonSteps> RootApprox_Best_Parallel(unsigned threads = 0)
+	{
+		ThreadPool pool(threads);
+		return RootApprox_Best<N, T_Float, NewtonSteps, Basis>(pool);
+	}
+	
+	/*
+		Search for the best design with a separate constant for each refinement.
+		
+		Starts from the best shared-constant design under the analytic error range,
+		then runs a pattern search over k and every constant but the last: each
+		moves by -1, 0 or +1 times a common stride, which halves whenever no
+		neighbour improves.  The last constant is fitted to each neighbour by
+		ternary search, which lets the search follow the narrow valleys of
+		worst-case error that a pattern alone gets stuck in.
+		
+		Neighbours are scored on the executor's threads; ties go to the earliest.
+		With analytic bases this takes seconds; other bases scan once per score.
+	 */
+	template<int N, typename T_Float, unsigned NewtonSteps = 2, BEST_APPROX_BASIS Basis = CERTIFIED_WORST_CASE, typename T_Executor>
+	RootApprox<N,T_Float,NewtonSteps> RootApprox_Best_Steps(T_Executor &&executor)
+	{
+		using float_t  = T_Float;
+		using as_int_t = float_as_int_t<float_t>;
+		using design_t = RootApprox<N, T_Float, NewtonSteps>;
+		
+		if (NewtonSteps == 0) return RootApprox_Best<N, T_Float, NewtonSteps, Basis>(executor);
+		
+		// Search coordinates: k, then the bits of every constant but the last
+		static const unsigned DIMS = (NewtonSteps ? NewtonSteps : 1), LAST = DIMS-1;
+		using point_t = std::array<as_int_t, DIMS>;
+		
+		auto make = [](const point_t &p, const as_int_t m_last)
+		{
+			design_t design(p[0]);
+			for (unsigned s = 0; s < LAST; ++s) design.newton_m[s] = reinterpret_int_float(p[s+1]);
+			design.newton_m[LAST] = reinterpret_int_float(m_last);
+			return design;
+		};
+		
+		struct fit_t {float_t score; as_int_t m_last;};
+		auto fit = [&](const point_t &p, const as_int_t m_near) -> fit_t
+		{
+			// Bracket the last constant within 5% of its previous value
+			const float_t m = reinterpret_int_float(m_near);
+			as_int_t
+				lo = reinterpret_float_int(float_t(m * float_t(.95))),
+				hi = reinterpret_float_int(float_t(m * float_t(1.05)));
+			if (lo > hi) std::swap(lo, hi);
+			while (hi - lo > 2)
+			{
+				as_int_t a = lo + (hi-lo)/3, b = hi - (hi-lo)/3;
+				if (RootApprox_Score<Basis>(make(p, a)) < RootApprox_Score<Basis>(make(p, b))) hi = b;
+				else                                                                           lo = a;
+			}
+			fit_t best = {RootApprox_Score<Basis>(make(p, lo)), lo};
+			for (as_int_t m_last = lo+1; m_last <= hi; ++m_last)
+			{
+				float_t score = RootApprox_Score<Basis>(make(p, m_last));
+				if (score < best.score) best = {score, m_last};
+			}
+			return best;
+		};
+		
+		// Seed from the shared-constant optimum
+		const design_t seed = RootApprox_Best<N, T_Float, NewtonSteps, APPROX_WORST_CASE>(executor);
+		point_t p;
+		p[0] = seed.constant;
+		for (unsigned s = 0; s < LAST; ++s) p[s+1] = reinterpret_float_int(seed.newton_m[s]);
+		fit_t best = fit(p, reinterpret_float_int(seed.newton_m[LAST]));
+		
+		// Every combination of -1, 0 and +1 per coordinate, except no move
+		std::vector<point_t> offsets;
+		for (unsigned c = 1, count = unsigned(std::pow(3, DIMS)); c < count; ++c)
+		{
+			point_t o;
+			for (unsigned d = 0, cc = c; d < DIMS; ++d, cc /= 3) o[d] = as_int_t(cc % 3) - 1;
+			offsets.push_back(o);
+		}
+		
+		std::cout << "//Refining " << NewtonSteps << " constants from k=" << std::hex << p[0] << " ";
+		
+		std::vector<point_t> points(offsets.size());
+		std::vector<fit_t>   fits(offsets.size());
+		as_int_t stride = as_int_t(1) << (detail::float_traits<float_t>::bits_mantissa - 6);
+		while (stride > 0)
+		{
+			std::cout << '.' << std::flush;
+			for (size_t i = 0; i < offsets.size(); ++i)
+				for (unsigned d = 0; d < DIMS; ++d) points[i][d] = p[d] + offsets[i][d] * stride;
+			
+			executor.parallel_for(points.size(), [&](const size_t i)
+			{
+				fits[i] = fit(points[i], best.m_last);
+			});
+			
+			size_t pick = points.size();
+			for (size_t i = 0; i < points.size(); ++i)
+				if (fits[i].score < best.score) {best = fits[i]; pick = i;}
+			
+			if (pick < points.size()) p = points[pick];
+			else                      stride /= 2;
+		}
+		std::cout << std::endl;
+		
+		design_t result = make(p, best.m_last);
+		std::cout << "//  ...best design k=" << result.constant << ", m=";
+		for (unsigned s = 0; s < NewtonSteps; ++s) std::cout << (s ? "," : "") << result.newton_m[s];
+		std::cout << " with error score " << best.score << std::endl;
+		return result;
+	}
+	
+	template<int N, typename T_Float, unsigned NewtonSteps = 2, BEST_APPROX_BASIS Basis = CERTIFIED_WORST_CASE>
+	RootApprox<N,T_Float,NewtonSteps> RootApprox_Best_Steps()
+	{
+		return RootApprox_Best_Steps<N, T_Float, NewtonSteps, Basis>(SerialExecutor());
+	}
+	
+	template<int N, typename T_Float, unsigned NewtonSteps = 2, BEST_APPROX_BASIS Basis = CERTIFIED_WORST_CASE>
+	RootApprox<N,T_Float,NewtonSteps> RootApprox_Best_Steps_Parallel(unsigned threads = 0)
+	{
+		ThreadPool pool(threads);
+		return RootApprox_Best_Steps<N, T_Float, NewtonSteps, Basis>(pool);
+	}
+
+	/*
+		Search every design of a 16-bit format: each k in the range that
+		RootApprox_Best considers, with each m between 1/N and 1.5/N shared by
+		all refinements.  Designs are scored by their worst-case error over every
+		input in test_param_range, so unlike the grid searches this finds the
+		true optimum; the formats are small enough to take seconds.
+
+		Constants for each k are scored on the executor's threads; ties go to
+		the smallest k, then the smallest m.
+	 */
+	template<int N, typename T_Float, unsigned NewtonSteps = 1, typename T_Executor>
+	RootApprox<N,T_Float,NewtonSteps> RootApprox_Best_Exhaustive(T_Executor &&executor)
+	{
+		using float_t   = T_Float;
+		using as_int_t  = float_as_int_t<float_t>;
+		using compute_t = float_compute_t<float_t>;
+		using design_t  = RootApprox<N, T_Float, NewtonSteps>;
+		static_assert(sizeof(float_t) <= 2, "exhaustive design search is for 16-bit formats");
+
+		const double
+			L = std::ldexp(1.0, detail::float_traits<float_t>::bits_mantissa),
+			B = std::ldexp(1.0, detail::float_traits<float_t>::bits_exponent-1) - 1.0,
+			one_minus_p = 1.0 - 1.0/N;
+		const as_int_t
+			k_min = as_int_t(std::floor(one_minus_p * L * (B - .08608))),
+			k_max = as_int_t(std::ceil (one_minus_p * L * B));
+		as_int_t
+			m_min = reinterpret_float_int(float_t(1.0/N)),
+			m_max = reinterpret_float_int(float_t(1.5/N));
+		if (m_min > m_max) std::swap(m_min, m_max);
+		if (NewtonSteps == 0) m_max = m_min;
+
+		const auto range = design_t::test_param_range();
+		auto score = [&](const as_int_t k, const as_int_t m) -> compute_t
+		{
+			design_t candidate(k, detail::bit_cast<float_t>(m));
+			return std::abs(Test_Root_Approx_WorstCase<N>(candidate, range.first, range.second));
+		};
+
+		std::cout << std::hex << "//Searching every k in [0x"
+			<< k_min << ",0x" << k_max
+			<< "], m in [" << double(detail::bit_cast<float_t>(m_min))
+			<< "," << double(detail::bit_cast<float_t>(m_max)) << "] ";
+
+		struct best_t {compute_t score; as_int_t m;};
+		std::vector<best_t> best_for_k(size_t(k_max - k_min) + 1);
+		const size_t block = 16;
+		for (size_t b = 0; b < best_for_k.size(); b += block)
+		{
+			std::cout << '.' << std::flush;
+			executor.parallel_for(std::min(block, best_for_k.size() - b), [&](const size_t i)
+			{
+				const as_int_t k = as_int_t(k_min + as_int_t(b + i));
+				best_t best = {std::numeric_limits<compute_t>::infinity(), m_min};
+				for (as_int_t m = m_min; m <= m_max; ++m)
+				{
+					const compute_t s = score(k, m);
+					if (s < best.score) best = {s, m};
+				}
+				best_for_k[b + i] = best;
+			});
+		}
+		std::cout << std::endl;
+
+		size_t pick = 0;
+		for (size_t i = 1; i < best_for_k.size(); ++i)
+			if (best_for_k[i].score < best_for_k[pick].score) pick = i;
+
+		design_t result(as_int_t(k_min + as_int_t(pick)), detail::bit_cast<float_t>(best_for_k[pick].m));
+		std::cout << "//  ...best design k=" << result.constant << ", m=";
+		for (unsigned s = 0; s < NewtonSteps; ++s) std::cout << (s ? "," : "") << double(result.newton_m[s]);
+		std::cout << " with error score " << best_for_k[pick].score << std::endl;
+		return result;
+	}
+
+	template<int N, typename T_Float, unsigned NewtonSteps = 1>
+	RootApprox<N,T_Float,NewtonSteps> RootApprox_Best_Exhaustive()
+	{
+		return RootApprox_Best_Exhaustive<N, T_Float, NewtonSteps>(SerialExecutor());
+	}
+
+	template<int N, typename T_Float, unsigned NewtonSteps = 1>
+	RootApprox<N,T_Float,NewtonSteps> RootApprox_Best_Exhaustive_Parallel(unsigned threads = 0)
+	{
+		ThreadPool pool(threads);
+		return RootApprox_Best_Exhaustive<N, T_Float, NewtonSteps>(pool);
+	}
+
+	namespace detail
+	{
+		/*
+			Emit a declaration of dest = src / D in the steps of int_divider.
+			Uses rb_mulhi from the generated preamble.
+		 */
+		template<typename T_Int, int D>
+		void print_div_i(std::ostream &out, const char *dest, const char *src)
+		{
+			using divider = int_divider<T_Int, D>;
+			const char
+				*int_decl  = int_traits<T_Int>::name(),
+				*uint_decl = int_traits<typename divider::uint_t>::name();
+			
+			out << "\t" << int_decl << " " << dest << " = ";
+			if (D == 1)
+				out << src << ";\n";
+			else if (divider::power_of_two::value)
+				out << "(" << src << " + (" << src << " < 0 ? " << std::dec << (D-1) << " : 0)) >> "
+					<< divider::log2::value << "; // " << src << " / " << D << ", rounding toward zero\n";
+			else
+			{
+				out << "(" << int_decl << ")(rb_mulhi((" << uint_decl << ")" << src << ", 0x" << std::hex << divider::magic::value
+					<< "u) - (" << src << " < 0 ? 0x" << divider::magic::value << "u : 0u))";
+				if (divider::shift::value) out << " >> " << std::dec << divider::shift::value;
+				out << ";\n";
+				out << "\t" << dest << " += (" << src << " < 0); // " << src << " / " << std::dec << D << ", rounding toward zero\n";
+			}
+			out << std::hex;
+		}
+		
+		/*
+			The shortest decimal literal that reads back as exactly the same value,
+			so that generated code reproduces a design bit for bit.
+		 */
+		inline float  read_literal(const char *text, float)     {return std::strtof(text, nullptr);}
+		inline double read_literal(const char *text, double)    {return std::strtod(text, nullptr);}
+		
+		template<typename T_Float>
+		std::string exact_literal(const T_Float value)
+		{
+			char text[48];
+			for (int digits = 6; ; ++digits)
+			{
+				std::snprintf(text, sizeof(text), "%.*g", digits, double(value));
+				if (read_literal(text, T_Float()) == value || digits >= std::numeric_limits<T_Float>::max_digits10) break;
+			}
+			std::string literal(text);
+			if (literal.find_first_of(".e") == std::string::npos) literal += ".0";
+			return literal + float_traits<T_Float>::suffix();
+		}
+		
+		/*
+			x^P in the same order of multiplications as pow_i, for P from 1 to 4.
+		 */
+		inline std::string power_expression(const char *x, const int P)
+		{
+			const std::string v(x);
+			switch (P)
+			{
+			case 1:  return v;
+			case 2:  return "(" + v + "*" + v + ")";
+			case 3:  return "(" + v + "*" + v + "*" + v + ")";
+			case 4:  return "((" + v + "*" + v + ")*(" + v + "*" + v + "))";
+			default:
+			{
+				std::string e = "(" + v;
+				for (int i = 1; i < P; ++i) e += "*" + v;
+				return e + ")";
+			}
+			}
+		}
+		
+		// Name of a generated function, such as rb_inv_2_root
+		inline std::string generated_name(const char *prefix, const int N)
+		{
+			return std::string(prefix) + ((N < 0) ? "_inv_" : "_") + std::to_string((N < 0) ? -N : N) + "_root";
+		}
+		
+		// ROOT_SAFE functions take "_safe" after the prefix, such as rb_safe_inv_2_root
+		inline std::string generated_name(const char *prefix, const int N, const ROOT_DOMAIN domain)
+		{
+			return generated_name((std::string(prefix) + ((domain == ROOT_SAFE) ? "_safe" : "")).c_str(), N);
+		}
+		
+		// Unsigned integer literal in C syntax
+		template<typename T_UInt>
+		std::string uint_literal(const T_UInt value)
+		{
+			char text[32];
+			std::snprintf(text, sizeof(text), "0x%llx%s", (unsigned long long) value, (sizeof(T_UInt) > 4) ? "ull" : "u");
+			return text;
+		}
+	}
+	
+	/*
+		Opening lines of a header of generated functions (see operator<< below).
+		Defines rb_bit_cast and RB_CONSTEXPR, so that the functions are constexpr
+		wherever the compiler can bit_cast at compile time.  Both parts are guarded
+		so that several generated headers may be included together.
+	 */
+	inline std::ostream &Print_Generated_Preamble(std::ostream &out)
+	{
+		return out <<
+			"#pragma once\n"
+			"#include <stdint.h>\n"
+			"#include <string.h>\n"
+			"\n"
+			"#ifndef RB_CONSTEXPR\n"
+			"#if (__cplusplus >= 202002L) || (defined(_MSVC_LANG) && _MSVC_LANG >= 202002L)\n"
+			"\t#include <bit>\n"
+			"#endif\n"
+			"#if defined(__has_builtin)\n"
+			"\t#if __has_builtin(__builtin_bit_cast)\n"
+			"\t\t#define RB_BUILTIN_BIT_CAST 1\n"
+			"\t#endif\n"
+			"#elif defined(_MSC_VER) && (_MSC_VER >= 1927)\n"
+			"\t#define RB_BUILTIN_BIT_CAST 1\n"
+			"#endif\n"
+			"#if defined(__cpp_lib_bit_cast)\n"
+			"\t#define RB_CONSTEXPR constexpr\n"
+			"\ttemplate<typename To, typename From> constexpr To rb_bit_cast(const From &v) {return std::bit_cast<To>(v);}\n"
+			"#elif defined(RB_BUILTIN_BIT_CAST)\n"
+			"\t#define RB_CONSTEXPR constexpr\n"
+			"\ttemplate<typename To, typename From> constexpr To rb_bit_cast(const From &v) {return __builtin_bit_cast(To, v);}\n"
+			"#else\n"
+			"\t#define RB_CONSTEXPR inline\n"
+			"\ttemplate<typename To, typename From> inline To rb_bit_cast(const From &v) {To t; memcpy(&t, &v, sizeof(To)); return t;}\n"
+			"#endif\n"
+			"#endif\n"
+			"\n"
+			"#ifndef RB_MULHI\n"
+			"#define RB_MULHI 1\n"
+			"// High half of a product, for division by a magic reciprocal\n"
+			"#if defined(__SIZEOF_INT128__)\n"
+			"__extension__ typedef unsigned __int128 rb_uint128;\n"
+			"#endif\n"
+			"RB_CONSTEXPR uint32_t rb_mulhi(uint32_t a, uint32_t b) {return (uint32_t)(((uint64_t)a * b) >> 32);}\n"
+			"RB_CONSTEXPR uint64_t rb_mulhi(uint64_t a, uint64_t b)\n"
+			"{\n"
+			"#if defined(__SIZEOF_INT128__)\n"
+			"\treturn (uint64_t)(((rb_uint128)a * b) >> 64);\n"
+			"#else\n"
+			"\tuint64_t a1 = a >> 32, a0 = a & 0xFFFFFFFFu, b1 = b >> 32, b0 = b & 0xFFFFFFFFu;\n"
+			"\tuint64_t mid = ((a0*b0) >> 32) + ((a1*b0) & 0xFFFFFFFFu) + ((a0*b1) & 0xFFFFFFFFu);\n"
+			"\treturn a1*b1 + ((a1*b0) >> 32) + ((a0*b1) >> 32) + (mid >> 32);\n"
+			"#endif\n"
+			"}\n"
+			"#endif\n";
+	}
+	
 	
 	
 	
@@ -584,65 +1870,184 @@ namespace rootbeer
 	 */
 }
 
-template<int N, typename T_Float, unsigned NewtonSteps>
-std::ostream &operator<<(std::ostream &out,
-	const rootbeer::RootApprox<N, T_Float, NewtonSteps> &approx)
+namespace rootbeer
 {
-	static_assert(N != 0, "0th root is invalid");
-	
-	static const int absN = ((N<0)?-N:N);
-
-	using float_t = T_Float;
-	const char *float_decl = rootbeer::detail::float_traits<float_t>::name();
-	const char *float_suff = rootbeer::detail::float_traits<float_t>::suffix();
-	using as_int_t = rootbeer::float_as_int_t<float_t>;
-	const char *int_decl = rootbeer::detail::int_traits<as_int_t>::name();
-	
-	out << std::hex;
-	out << float_decl << " rb_";
-	if (N < 0) out << "inv_";
-	out << absN << "_root(const " << float_decl << " y)\n";
-	out << "{\n";
-	out << "\tunion {" << float_decl << " x; " << int_decl << " i;}; x = y; // interpret float as integer\n";
-	
-	// Magic line
-	out << "\ti = 0x" << approx.constant << ((N>0) ? " + " : " - ")
-		<< "(i";
-	if (absN & (absN-1)) out << " / " << absN;
-	else                 out << " >> " << int(std::log2(absN));
-	out << "); // log-approximation hack\n";
-	
-	// Newtonian lines
-	if (NewtonSteps)
-	{
-		//static const float_t
-		//	newton_m   = approx.newton_m, //float_t(N-1) / float_t(N),
-		//	newton_div = float_t(1)   / float_t(absN);
+	/*
+		Emit a design as a scalar function named <prefix>_<N>_root or
+		<prefix>_inv_<N>_root.  Constants are printed exactly, and powers are
+		multiplied in the order of pow_i, so the function reproduces
+		RootApprox::operator() bit for bit (where the compiler doesn't contract
+		multiply-adds).
+	 */
+	template<int N, typename T_Float, unsigned NewtonSteps>
+	std::ostream &Print_Generated_Root_Safe(std::ostream &out,
+		const RootApprox<N, T_Float, NewtonSteps> &approx, const char *prefix = "rb");
+	
+	template<int N, typename T_Float, unsigned NewtonSteps>
+	std::ostream &Print_Generated_Root(std::ostream &out,
+		const RootApprox<N, T_Float, NewtonSteps> &approx, const char *prefix = "rb", const ROOT_DOMAIN domain = ROOT_FAST)
+	{
+		static_assert(N != 0, "0th root is invalid");
+		if (domain == ROOT_SAFE) return Print_Generated_Root_Safe(out, approx, prefix);
+		
+		static const int absN = ((N<0)?-N:N);
+		
+		using float_t = T_Float;
+		const char *float_decl = detail::float_traits<float_t>::name();
+		using as_int_t = float_as_int_t<float_t>;
+		const char *int_decl = detail::int_traits<as_int_t>::name();
+		
+		out << std::hex;
+		out << "RB_CONSTEXPR " << float_decl << " " << detail::generated_name(prefix, N) << "(const " << float_decl << " y)\n";
+		out << "{\n";
+		out << "\t" << int_decl << " i = rb_bit_cast<" << int_decl << ">(y); // interpret float as integer\n";
+		
+		// Magic line, dividing by |N| with the steps of detail::int_divider
+		const char *q = "i";
+		if (absN > 1)
+		{
+			detail::print_div_i<as_int_t, absN>(out, "q", "i");
+			q = "q";
+		}
+		out << "\ti = 0x" << approx.constant << ((N>0) ? " + " : " - ") << q << "; // log-approximation hack\n";
+		out << "\t" << float_decl << " x = rb_bit_cast<" << float_decl << ">(i);\n";
+		
+		// Newtonian lines
 		const int refine_power = absN - (N>0);
 		for (unsigned i = 0; i < NewtonSteps; ++i)
 		{
+			const float_t m = approx.newton_m[i];
 			out << "\tx" << ((N>0) ? " = " : " *= ")
-				<< (float_t(1)-approx.newton_m) << float_suff << ((N>0) ? " * x" : "")
+				<< detail::exact_literal(float_t(1)-m) << ((N>0) ? " * x" : "")
 				<< ((N>0) ? " + " : " - ")
-				<< ((N>0) ? approx.newton_m : -approx.newton_m) << float_suff << " * y";
+				<< detail::exact_literal((N>0) ? m : -m) << " * y";
 			if (refine_power != 0)
-			{
-				out << ((N>0) ? " / " : " * ");
-				
-				if (refine_power == 1) out << "x";
-				else
-				{
-					out << "(x";
-					for (int i = 1; i < refine_power; ++i) out << "*x";
-					out << ")";
-				}
-				out << "; // newtonian step #" << float(i+1) << "\n";
-			}
+				out << ((N>0) ? " / " : " * ") << detail::power_expression("x", refine_power);
+			out << "; // newtonian step #" << std::dec << (i+1) << std::hex << "\n";
 		}
+		out << "\treturn x;\n";
+		
+		out << "}";
+		
+		return out;
 	}
-	out << "\treturn x;\n";
 	
-	out << "}";
+	/*
+		Emit the ROOT_SAFE function for a design, <prefix>_safe_<N>_root, which
+		calls the function printed by Print_Generated_Root and selects results
+		for other inputs as RootApprox_Safe does.  Conditional expressions on
+		values computed either way compile to selects rather than branches.
+	 */
+	template<int N, typename T_Float, unsigned NewtonSteps>
+	std::ostream &Print_Generated_Root_Safe(std::ostream &out,
+		const RootApprox<N, T_Float, NewtonSteps> &, const char *prefix)
+	{
+		using domain  = detail::root_domain<N, T_Float>;
+		using uint_t  = typename domain::uint_t;
+		const char *float_decl = detail::float_traits<T_Float>::name();
+		const char *uint_decl  = detail::int_traits<uint_t>::name();
+		const std::string
+			cast_f = std::string("rb_bit_cast<") + float_decl + ">",
+			cast_u = std::string("rb_bit_cast<") + uint_decl  + ">",
+			scale_in  = detail::exact_literal(detail::bit_cast<T_Float>(domain::scale_in)),
+			scale_out = detail::exact_literal(detail::bit_cast<T_Float>(domain::scale_out)),
+			one       = detail::exact_literal(T_Float(1));
+		
+		out << "RB_CONSTEXPR " << float_decl << " " << detail::generated_name(prefix, N, ROOT_SAFE) << "(const " << float_decl << " y)\n";
+		out << "{\n";
+		out << "\tconst " << uint_decl << " u = " << cast_u << "(y), sign = u & " << detail::uint_literal(domain::sign) << ", a = u ^ sign;\n";
+		out << "\tconst bool tiny = (a < " << detail::uint_literal(domain::min_normal) << "); // zero or denormal, scaled into normal range\n";
+		out << "\tconst " << float_decl << " x = " << detail::generated_name(prefix, N) << "(" << cast_f << "(a) * (tiny ? " << scale_in << " : " << one << "))"
+			<< " * (tiny ? " << scale_out << " : " << one << ");\n";
+		out << "\t" << uint_decl << " r = (a - 1 < " << detail::uint_literal(uint_t(domain::infinity - 1)) << ") ? " << cast_u << "(x) : "
+			<< ((N > 0) ? std::string("a") : "(a > " + detail::uint_literal(domain::infinity) + ") ? a : " + detail::uint_literal(domain::infinity) + " - a")
+			<< "; // zero, infinity and NaN, which keeps its bits\n";
+		if (domain::DEG % 2)
+		{
+			out << "\treturn " << cast_f << "(r | sign); // odd root of a negative\n";
+		}
+		else
+		{
+			out << "\tr |= sign;\n";
+			out << "\treturn " << cast_f << "((u - " << detail::uint_literal(uint_t(domain::sign + 1)) << " < " << detail::uint_literal(domain::infinity) << ") ? "
+				<< detail::uint_literal(domain::quiet_nan) << " : r); // even root of a negative number\n";
+		}
+		out << "}";
+		return out;
+	}
+}
+
+template<int N, typename T_Float, unsigned NewtonSteps>
+std::ostream &operator<<(std::ostream &out,
+	const rootbeer::RootApprox<N, T_Float, NewtonSteps> &approx)
+{
+	return rootbeer::Print_Generated_Root(out, approx, "rb");
+}
+
+
+/*
+	Print the non-empty rows of each table in a histogram: counts by distance
+	in ULPs, counts by relative error, and the worst cases in each binade.
+*/
+template<typename T_Float>
+std::ostream &operator<<(std::ostream &out, const rootbeer::PowApprox_Histogram<T_Float> &h)
+{
+	using hist_t = rootbeer::PowApprox_Histogram<T_Float>;
+	const double n = double(std::max<uint64_t>(h.samples, 1));
+	const auto flags = out.flags();
+	const auto precision = out.precision();
 	
+	auto print_count = [&](const char *label, const uint64_t count, const uint64_t cumulative)
+	{
+		out << std::setw(18) << label << std::setw(14) << count << std::setprecision(6)
+			<< std::setw(14) << double(count) / n << std::setw(14) << double(cumulative) / n << '\n';
+	};
+	char label[48];
+	
+	out << std::dec << std::right << std::setw(18) << "ULPs" << std::setw(14) << "count"
+		<< std::setw(14) << "fraction" << std::setw(14) << "cumulative" << '\n';
+	uint64_t cumulative = 0;
+	for (unsigned b = 0; b < hist_t::ulp_buckets; ++b)
+	{
+		if (!h.ulp_counts[b]) continue;
+		cumulative += h.ulp_counts[b];
+		if (b < hist_t::ulp_exact) std::snprintf(label, sizeof(label), "%u", b);
+		else std::snprintf(label, sizeof(label), "%llu-%llu",
+			static_cast<unsigned long long>(hist_t::ulp_bucket_max(b-1) + 1), static_cast<unsigned long long>(hist_t::ulp_bucket_max(b)));
+		print_count(label, h.ulp_counts[b], cumulative);
+	}
+	
+	out << std::setw(18) << "|relative error|" << std::setw(14) << "count"
+		<< std::setw(14) << "fraction" << std::setw(14) << "cumulative" << '\n';
+	cumulative = 0;
+	for (unsigned b = 0; b < hist_t::error_buckets; ++b)
+	{
+		if (!h.error_counts[b]) continue;
+		cumulative += h.error_counts[b];
+		const int e = int(b) - int(hist_t::error_exp_min);
+		if (b + 1 < hist_t::error_buckets) std::snprintf(label, sizeof(label), "< 2^%d", e);
+		else                               std::snprintf(label, sizeof(label), ">= 1 or NaN");
+		print_count(label, h.error_counts[b], cumulative);
+	}
+	
+	out << std::setw(18) << "binade" << std::setw(14) << "samples"
+		<< std::setw(14) << "worst ULPs" << std::setw(14) << "worst |err|" << "  @ argument\n";
+	for (unsigned i = 0; i < hist_t::binade_count; ++i)
+	{
+		const auto &binade = h.binades[i];
+		if (!binade.samples) continue;
+		const int bias = int(hist_t::binade_count / 2) - 1;
+		if      (i == 0)                        std::snprintf(label, sizeof(label), "denormal");
+		else if (i + 1 == hist_t::binade_count) std::snprintf(label, sizeof(label), "inf/nan");
+		else                                    std::snprintf(label, sizeof(label), "2^%d", int(i) - bias);
+		out << std::setw(18) << label << std::setw(14) << binade.samples << std::setw(14) << binade.worst_ulps
+			<< std::scientific << std::setprecision(4) << std::setw(14) << binade.worst_error
+			<< "  @ " << std::defaultfloat << std::setprecision(9) << binade.worst_error_arg << '\n';
+	}
+	
+	out.flags(flags);
+	out.precision(precision);
 	return out;
 }
+
+#include "root_cellar_batch.h"
@@ -0,0 +1,1327 @@
+#pragma once
+
+
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+#include <cassert>
+#include <type_traits>
+
+/*
+	With GCC or Clang on x86, the vector ops of every instruction set are
+	compiled, with target pragmas for those the command line doesn't enable,
+	so that root_cellar_dispatch.h can choose among them at runtime.
+	Define ROOTBEER_NO_DISPATCH to compile only the enabled instruction sets.
+*/
+#if !defined(ROOTBEER_NO_DISPATCH) && (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+	#define ROOTBEER_DISPATCH 1
+#endif
+
+#if defined(__SSE4_1__) || defined(__AVX2__) || defined(__AVX512F__) || defined(ROOTBEER_DISPATCH)
+	#include <immintrin.h>
+#endif
+
+#include "root_cellar.h"
+
+#define ROOTBEER_PRAGMA(x) _Pragma(#x)
+#if !defined(ROOTBEER_DISPATCH)
+	#define ROOTBEER_TARGET_BEGIN(isa)
+	#define ROOTBEER_TARGET_END
+#elif defined(__clang__)
+	#define ROOTBEER_TARGET_BEGIN(isa) ROOTBEER_PRAGMA(clang attribute push(__attribute__((target(isa))), apply_to = function))
+	#define ROOTBEER_TARGET_END        ROOTBEER_PRAGMA(clang attribute pop)
+#else
+	#define ROOTBEER_TARGET_BEGIN(isa) ROOTBEER_PRAGMA(GCC push_options) ROOTBEER_PRAGMA(GCC target(isa))
+	#define ROOTBEER_TARGET_END        ROOTBEER_PRAGMA(GCC pop_options)
+#endif
+
+// GCC 12 warns of _mm512_undefined_* within its own AVX-512 intrinsics, as in
+// root_cellar_generated.h; code using them is wrapped in these
+#if defined(__GNUC__) && !defined(__clang__)
+	#define ROOTBEER_AVX512_BEGIN ROOTBEER_PRAGMA(GCC diagnostic push) ROOTBEER_PRAGMA(GCC diagnostic ignored "-Wuninitialized") ROOTBEER_PRAGMA(GCC diagnostic ignored "-Wmaybe-uninitialized")
+	#define ROOTBEER_AVX512_END   ROOTBEER_PRAGMA(GCC diagnostic pop)
+#else
+	#define ROOTBEER_AVX512_BEGIN
+	#define ROOTBEER_AVX512_END
+#endif
+
+#if defined(__SSE4_1__) || defined(ROOTBEER_DISPATCH)
+	#define ROOTBEER_HAS_SSE41 1
+#endif
+#if (defined(__AVX2__) && defined(__FMA__)) || defined(ROOTBEER_DISPATCH)
+	#define ROOTBEER_HAS_AVX2 1
+#endif
+#if defined(__AVX512F__) || defined(ROOTBEER_DISPATCH)
+	#define ROOTBEER_HAS_AVX512 1
+#endif
+
+
+/*
+	Batch evaluation of RootApprox designs.
+
+	Kernels are selected at compile time from the widest instruction set enabled:
+		AVX-512F         16 floats or 8 doubles per vector, with FMA
+		AVX2 + FMA        8 floats or 4 doubles per vector, with FMA
+		SSE4.1            4 floats or 2 doubles per vector
+		(none)            scalar loop
+
+	Every kernel is written once against an "ops" structure, and the scalar tail
+	of each batch runs the same kernel through ops_scalar with matching FMA usage.
+	The tail therefore gives the same results as the vector body, bit for bit.
+	Results may differ from RootApprox::operator() where FMA is used.
+
+	Vector kernels exist for every root index.  None of these instruction sets
+	divides integers, so the initial estimate uses detail::int_divider's steps.
+
+	float16 and bfloat16 arrays are widened to float lanes for refinement, or
+	computed in binary16 lanes with AVX-512 FP16; see root_batch_widened.
+*/
+namespace rootbeer
+{
+	namespace simd
+	{
+		/*
+			Scalar "vector" of width 1.
+		*/
+		template<typename T_Float, bool FUSED>
+		struct ops_scalar
+		{
+			using float_t = T_Float;
+			using int_t   = float_as_int_t<T_Float>;
+			using uint_t  = typename std::make_unsigned<int_t>::type;
+			using vec_t   = float_t;
+			using ivec_t  = int_t;
+
+			static const size_t width = 1;
+			static const bool   fused = FUSED;
+
+			static vec_t  load  (const float_t *p)             {return *p;}
+			static vec_t  loadu (const float_t *p)             {return *p;}
+			static void   store (float_t *p, const vec_t v)    {*p = v;}
+			static void   storeu(float_t *p, const vec_t v)    {*p = v;}
+			static vec_t  set1  (const float_t v)              {return v;}
+			static ivec_t set1_i(const int_t v)                {return v;}
+
+			static vec_t add(const vec_t a, const vec_t b)     {return a + b;}
+			static vec_t sub(const vec_t a, const vec_t b)     {return a - b;}
+			static vec_t mul(const vec_t a, const vec_t b)     {return a * b;}
+			static vec_t div(const vec_t a, const vec_t b)     {return a / b;}
+			static vec_t fmadd(const vec_t a, const vec_t b, const vec_t c)    {return FUSED ? std::fma(a, b, c) : a*b + c;}
+
+			static ivec_t as_int  (const vec_t  v)    {int_t   i; std::memcpy(&i, &v, sizeof(i)); return i;}
+			static vec_t  as_float(const ivec_t i)    {float_t v; std::memcpy(&v, &i, sizeof(v)); return v;}
+			static ivec_t loadu_i (const int_t *p)              {return *p;}
+			static void   storeu_i(int_t *p, const ivec_t i)    {*p = i;}
+
+			static vec_t sqrt(const vec_t a)    {return std::sqrt(a);}
+			static vec_t abs (const vec_t a)    {return std::abs(a);}
+
+			using mask_t = bool;
+			static mask_t cmpgt   (const vec_t  a, const vec_t  b)                   {return a > b;}
+			static mask_t mask_and(const mask_t a, const mask_t b)                   {return a && b;}
+			static bool   all_lt_i(const ivec_t a, const ivec_t b)                   {return a < b;}  // signed, in every lane
+			static vec_t  select  (const mask_t m, const vec_t  a, const vec_t  b)    {return m ? a : b;}
+			static ivec_t select_i(const mask_t m, const ivec_t a, const ivec_t b)    {return m ? a : b;}
+
+			// Integer arithmetic wraps, like its vector counterparts
+			static ivec_t add_i(const ivec_t a, const ivec_t b)    {return int_t(uint_t(a) + uint_t(b));}
+			static ivec_t sub_i(const ivec_t a, const ivec_t b)    {return int_t(uint_t(a) - uint_t(b));}
+
+			// Signed division by a constant, truncating toward zero
+			template<int D> static ivec_t div_i(const ivec_t i)    {return detail::div_i<D>(i);}
+
+			// Bitwise and shifts, conversions between lanes, and ordered min/max (only and/or in double vectors)
+			static ivec_t and_i(const ivec_t a, const ivec_t b)    {return a & b;}
+			static ivec_t or_i (const ivec_t a, const ivec_t b)    {return a | b;}
+			template<int S> static ivec_t srai_i(const ivec_t i)   {return i >> S;}
+			static vec_t  cvt_i (const ivec_t i)                   {return float_t(i);}
+			static ivec_t cvtt_f(const vec_t  v)                   {return int_t(v);}
+			static vec_t  max(const vec_t a, const vec_t b)        {return (a > b) ? a : b;}
+			static vec_t  min(const vec_t a, const vec_t b)        {return (a < b) ? a : b;}
+		};
+
+
+		/*
+			Vector counterparts of ops_scalar.
+
+			div_i<D> matches C++ integer division exactly, following the steps of
+			detail::int_divider: powers of two use a rounding bias and an arithmetic
+			shift, while other divisors use a multiply-high by a magic reciprocal.
+			64-bit multiply-high is assembled from 32-bit partial products.
+		*/
+#if defined(ROOTBEER_HAS_SSE41)
+	#if !defined(__SSE4_1__)
+		ROOTBEER_TARGET_BEGIN("sse4.1")
+	#endif
+		struct ops_sse41_f64;
+		struct ops_sse41_f32
+		{
+			using float_t = float;
+			using int_t   = int32_t;
+			using vec_t   = __m128;
+			using ivec_t  = __m128i;
+
+			static const size_t width = 4;
+			static const bool   fused = false;
+
+			static vec_t  load  (const float_t *p)             {return _mm_load_ps(p);}
+			static vec_t  loadu (const float_t *p)             {return _mm_loadu_ps(p);}
+			static void   store (float_t *p, const vec_t v)    {_mm_store_ps(p, v);}
+			static void   storeu(float_t *p, const vec_t v)    {_mm_storeu_ps(p, v);}
+			static vec_t  set1  (const float_t v)              {return _mm_set1_ps(v);}
+			static ivec_t set1_i(const int_t v)                {return _mm_set1_epi32(v);}
+
+			static vec_t add(const vec_t a, const vec_t b)     {return _mm_add_ps(a, b);}
+			static vec_t sub(const vec_t a, const vec_t b)     {return _mm_sub_ps(a, b);}
+			static vec_t mul(const vec_t a, const vec_t b)     {return _mm_mul_ps(a, b);}
+			static vec_t div(const vec_t a, const vec_t b)     {return _mm_div_ps(a, b);}
+			static vec_t fmadd(const vec_t a, const vec_t b, const vec_t c)    {return _mm_add_ps(_mm_mul_ps(a, b), c);}
+
+			static ivec_t as_int  (const vec_t  v)    {return _mm_castps_si128(v);}
+			static vec_t  as_float(const ivec_t i)    {return _mm_castsi128_ps(i);}
+			static ivec_t loadu_i (const int_t *p)              {return _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));}
+			static void   storeu_i(int_t *p, const ivec_t i)    {_mm_storeu_si128(reinterpret_cast<__m128i*>(p), i);}
+
+			static vec_t sqrt(const vec_t a)    {return _mm_sqrt_ps(a);}
+			static vec_t abs (const vec_t a)    {return _mm_andnot_ps(_mm_set1_ps(-0.f), a);}
+
+			using mask_t = vec_t;
+			static mask_t cmpgt   (const vec_t  a, const vec_t  b)                   {return _mm_cmpgt_ps(a, b);}
+			static mask_t mask_and(const mask_t a, const mask_t b)                   {return _mm_and_ps(a, b);}
+			static bool   all_lt_i(const ivec_t a, const ivec_t b)                   {return _mm_movemask_epi8(_mm_cmpgt_epi32(b, a)) == 0xFFFF;}
+			static vec_t  select  (const mask_t m, const vec_t  a, const vec_t  b)    {return _mm_blendv_ps(b, a, m);}
+			static ivec_t select_i(const mask_t m, const ivec_t a, const ivec_t b)    {return _mm_blendv_epi8(b, a, _mm_castps_si128(m));}
+
+			// Conversion to and from double-precision lanes
+			using wide_ops = ops_sse41_f64;
+			static __m128d wide_lo(const vec_t v)                      {return _mm_cvtps_pd(v);}
+			static __m128d wide_hi(const vec_t v)                      {return _mm_cvtps_pd(_mm_movehl_ps(v, v));}
+			static vec_t   narrow (const __m128d lo, const __m128d hi) {return _mm_movelh_ps(_mm_cvtpd_ps(lo), _mm_cvtpd_ps(hi));}
+
+			static ivec_t add_i(const ivec_t a, const ivec_t b)    {return _mm_add_epi32(a, b);}
+			static ivec_t sub_i(const ivec_t a, const ivec_t b)    {return _mm_sub_epi32(a, b);}
+
+			static ivec_t and_i(const ivec_t a, const ivec_t b)    {return _mm_and_si128(a, b);}
+			static ivec_t or_i (const ivec_t a, const ivec_t b)    {return _mm_or_si128(a, b);}
+			template<int S> static ivec_t srai_i(const ivec_t i)   {return _mm_srai_epi32(i, S);}
+			static vec_t  cvt_i (const ivec_t i)                   {return _mm_cvtepi32_ps(i);}
+			static ivec_t cvtt_f(const vec_t  v)                   {return _mm_cvttps_epi32(v);}
+			static vec_t  max(const vec_t a, const vec_t b)        {return _mm_max_ps(a, b);}
+			static vec_t  min(const vec_t a, const vec_t b)        {return _mm_min_ps(a, b);}
+
+			template<int D> static ivec_t div_i(const ivec_t i)
+			{
+				using divider = detail::int_divider<int_t, D>;
+				if (D == 1) return i;
+				if (!divider::power_of_two::value)
+				{
+					const ivec_t magic = _mm_set1_epi32(int32_t(divider::magic::value));
+					ivec_t
+						even = _mm_srli_epi64(_mm_mul_epi32(i, magic), 32),
+						odd  = _mm_mul_epi32(_mm_srli_epi64(i, 32), magic),
+						q    = _mm_blend_epi16(even, odd, 0xCC);
+					if (int32_t(divider::magic::value) < 0) q = _mm_add_epi32(q, i);
+					return _mm_sub_epi32(_mm_srai_epi32(q, divider::shift::value), _mm_srai_epi32(i, 31));
+				}
+				const int shift = divider::log2::value;
+				ivec_t bias = _mm_srli_epi32(_mm_srai_epi32(i, 31), 32 - shift);
+				return _mm_srai_epi32(_mm_add_epi32(i, bias), shift);
+			}
+		};
+
+		struct ops_sse41_f64
+		{
+			using float_t = double;
+			using int_t   = int64_t;
+			using vec_t   = __m128d;
+			using ivec_t  = __m128i;
+
+			static const size_t width = 2;
+			static const bool   fused = false;
+
+			static vec_t  load  (const float_t *p)             {return _mm_load_pd(p);}
+			static vec_t  loadu (const float_t *p)             {return _mm_loadu_pd(p);}
+			static void   store (float_t *p, const vec_t v)    {_mm_store_pd(p, v);}
+			static void   storeu(float_t *p, const vec_t v)    {_mm_storeu_pd(p, v);}
+			static vec_t  set1  (const float_t v)              {return _mm_set1_pd(v);}
+			static ivec_t set1_i(const int_t v)                {return _mm_set1_epi64x(v);}
+
+			static vec_t add(const vec_t a, const vec_t b)     {return _mm_add_pd(a, b);}
+			static vec_t sub(const vec_t a, const vec_t b)     {return _mm_sub_pd(a, b);}
+			static vec_t mul(const vec_t a, const vec_t b)     {return _mm_mul_pd(a, b);}
+			static vec_t div(const vec_t a, const vec_t b)     {return _mm_div_pd(a, b);}
+			static vec_t fmadd(const vec_t a, const vec_t b, const vec_t c)    {return _mm_add_pd(_mm_mul_pd(a, b), c);}
+
+			static ivec_t as_int  (const vec_t  v)    {return _mm_castpd_si128(v);}
+			static vec_t  as_float(const ivec_t i)    {return _mm_castsi128_pd(i);}
+			static ivec_t loadu_i (const int_t *p)              {return _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));}
+			static void   storeu_i(int_t *p, const ivec_t i)    {_mm_storeu_si128(reinterpret_cast<__m128i*>(p), i);}
+
+			static vec_t sqrt(const vec_t a)    {return _mm_sqrt_pd(a);}
+			static vec_t abs (const vec_t a)    {return _mm_andnot_pd(_mm_set1_pd(-0.0), a);}
+
+			using mask_t = vec_t;
+			static mask_t cmpgt   (const vec_t  a, const vec_t  b)                   {return _mm_cmpgt_pd(a, b);}
+			static mask_t mask_and(const mask_t a, const mask_t b)                   {return _mm_and_pd(a, b);}
+			static bool   all_lt_i(const ivec_t a, const ivec_t b)                   {return (_mm_cvtsi128_si64(a) < _mm_cvtsi128_si64(b)) & (_mm_extract_epi64(a, 1) < _mm_extract_epi64(b, 1));}
+			static vec_t  select  (const mask_t m, const vec_t  a, const vec_t  b)    {return _mm_blendv_pd(b, a, m);}
+			static ivec_t select_i(const mask_t m, const ivec_t a, const ivec_t b)    {return _mm_blendv_epi8(b, a, _mm_castpd_si128(m));}
+
+			static ivec_t add_i(const ivec_t a, const ivec_t b)    {return _mm_add_epi64(a, b);}
+			static ivec_t sub_i(const ivec_t a, const ivec_t b)    {return _mm_sub_epi64(a, b);}
+
+			static ivec_t and_i(const ivec_t a, const ivec_t b)    {return _mm_and_si128(a, b);}
+			static ivec_t or_i (const ivec_t a, const ivec_t b)    {return _mm_or_si128(a, b);}
+
+			// All-ones in negative lanes
+			static ivec_t sign_i(const ivec_t i)    {return _mm_shuffle_epi32(_mm_srai_epi32(i, 31), _MM_SHUFFLE(3,3,1,1));}
+
+			static ivec_t mulhi_u(const ivec_t a, const uint64_t b)
+			{
+				const ivec_t
+					b_lo = _mm_set1_epi64x(int64_t(b & 0xFFFFFFFFu)),
+					b_hi = _mm_set1_epi64x(int64_t(b >> 32)),
+					mask = _mm_set1_epi64x(0xFFFFFFFF),
+					a_hi = _mm_srli_epi64(a, 32),
+					ll = _mm_mul_epu32(a,    b_lo), lh = _mm_mul_epu32(a,    b_hi),
+					hl = _mm_mul_epu32(a_hi, b_lo), hh = _mm_mul_epu32(a_hi, b_hi),
+					mid = _mm_add_epi64(_mm_srli_epi64(ll, 32),
+						_mm_add_epi64(_mm_and_si128(lh, mask), _mm_and_si128(hl, mask)));
+				return _mm_add_epi64(_mm_add_epi64(hh, _mm_srli_epi64(mid, 32)),
+					_mm_add_epi64(_mm_srli_epi64(lh, 32), _mm_srli_epi64(hl, 32)));
+			}
+
+			template<int D> static ivec_t div_i(const ivec_t i)
+			{
+				using divider = detail::int_divider<int_t, D>;
+				if (D == 1) return i;
+				if (!divider::power_of_two::value)
+				{
+					const uint64_t magic = divider::magic::value;
+					const ivec_t sign = sign_i(i);
+					ivec_t q = _mm_sub_epi64(mulhi_u(i, magic), _mm_and_si128(sign, _mm_set1_epi64x(int64_t(magic))));
+					if (divider::shift::value) q = _mm_or_si128(_mm_srli_epi64(q, divider::shift::value), _mm_slli_epi64(sign_i(q), 64 - divider::shift::value));
+					return _mm_sub_epi64(q, sign);
+				}
+				const int shift = divider::log2::value;
+				ivec_t t = _mm_add_epi64(i, _mm_srli_epi64(sign_i(i), 64 - shift));
+				return _mm_or_si128(_mm_srli_epi64(t, shift), _mm_slli_epi64(sign_i(t), 64 - shift));
+			}
+		};
+	#if !defined(__SSE4_1__)
+		ROOTBEER_TARGET_END
+	#endif
+#endif
+
+#if defined(ROOTBEER_HAS_AVX2)
+	#if !(defined(__AVX2__) && defined(__FMA__))
+		ROOTBEER_TARGET_BEGIN("avx2,fma")
+	#endif
+		struct ops_avx2_f64;
+		struct ops_avx2_f32
+		{
+			using float_t = float;
+			using int_t   = int32_t;
+			using vec_t   = __m256;
+			using ivec_t  = __m256i;
+
+			static const size_t width = 8;
+			static const bool   fused = true;
+
+			static vec_t  load  (const float_t *p)             {return _mm256_load_ps(p);}
+			static vec_t  loadu (const float_t *p)             {return _mm256_loadu_ps(p);}
+			static void   store (float_t *p, const vec_t v)    {_mm256_store_ps(p, v);}
+			static void   storeu(float_t *p, const vec_t v)    {_mm256_storeu_ps(p, v);}
+			static vec_t  set1  (const float_t v)              {return _mm256_set1_ps(v);}
+			static ivec_t set1_i(const int_t v)                {return _mm256_set1_epi32(v);}
+
+			static vec_t add(const vec_t a, const vec_t b)     {return _mm256_add_ps(a, b);}
+			static vec_t sub(const vec_t a, const vec_t b)     {return _mm256_sub_ps(a, b);}
+			static vec_t mul(const vec_t a, const vec_t b)     {return _mm256_mul_ps(a, b);}
+			static vec_t div(const vec_t a, const vec_t b)     {return _mm256_div_ps(a, b);}
+			static vec_t fmadd(const vec_t a, const vec_t b, const vec_t c)    {return _mm256_fmadd_ps(a, b, c);}
+
+			static ivec_t as_int  (const vec_t  v)    {return _mm256_castps_si256(v);}
+			static vec_t  as_float(const ivec_t i)    {return _mm256_castsi256_ps(i);}
+			static ivec_t loadu_i (const int_t *p)              {return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p));}
+			static void   storeu_i(int_t *p, const ivec_t i)    {_mm256_storeu_si256(reinterpret_cast<__m256i*>(p), i);}
+
+			static vec_t sqrt(const vec_t a)    {return _mm256_sqrt_ps(a);}
+			static vec_t abs (const vec_t a)    {return _mm256_andnot_ps(_mm256_set1_ps(-0.f), a);}
+
+			using mask_t = vec_t;
+			static mask_t cmpgt   (const vec_t  a, const vec_t  b)                   {return _mm256_cmp_ps(a, b, _CMP_GT_OQ);}
+			static mask_t mask_and(const mask_t a, const mask_t b)                   {return _mm256_and_ps(a, b);}
+			static bool   all_lt_i(const ivec_t a, const ivec_t b)                   {return _mm256_movemask_epi8(_mm256_cmpgt_epi32(b, a)) == -1;}
+			static vec_t  select  (const mask_t m, const vec_t  a, const vec_t  b)    {return _mm256_blendv_ps(b, a, m);}
+			static ivec_t select_i(const mask_t m, const ivec_t a, const ivec_t b)    {return _mm256_blendv_epi8(b, a, _mm256_castps_si256(m));}
+
+			// Conversion to and from double-precision lanes
+			using wide_ops = ops_avx2_f64;
+			static __m256d wide_lo(const vec_t v)                      {return _mm256_cvtps_pd(_mm256_castps256_ps128(v));}
+			static __m256d wide_hi(const vec_t v)                      {return _mm256_cvtps_pd(_mm256_extractf128_ps(v, 1));}
+			static vec_t   narrow (const __m256d lo, const __m256d hi)
+				{return _mm256_insertf128_ps(_mm256_castps128_ps256(_mm256_cvtpd_ps(lo)), _mm256_cvtpd_ps(hi), 1);}
+
+			static ivec_t add_i(const ivec_t a, const ivec_t b)    {return _mm256_add_epi32(a, b);}
+			static ivec_t sub_i(const ivec_t a, const ivec_t b)    {return _mm256_sub_epi32(a, b);}
+
+			static ivec_t and_i(const ivec_t a, const ivec_t b)    {return _mm256_and_si256(a, b);}
+			static ivec_t or_i (const ivec_t a, const ivec_t b)    {return _mm256_or_si256(a, b);}
+			template<int S> static ivec_t srai_i(const ivec_t i)   {return _mm256_srai_epi32(i, S);}
+			static vec_t  cvt_i (const ivec_t i)                   {return _mm256_cvtepi32_ps(i);}
+			static ivec_t cvtt_f(const vec_t  v)                   {return _mm256_cvttps_epi32(v);}
+			static vec_t  max(const vec_t a, const vec_t b)        {return _mm256_max_ps(a, b);}
+			static vec_t  min(const vec_t a, const vec_t b)        {return _mm256_min_ps(a, b);}
+
+			template<int D> static ivec_t div_i(const ivec_t i)
+			{
+				using divider = detail::int_divider<int_t, D>;
+				if (D == 1) return i;
+				if (!divider::power_of_two::value)
+				{
+					const ivec_t magic = _mm256_set1_epi32(int32_t(divider::magic::value));
+					ivec_t
+						even = _mm256_srli_epi64(_mm256_mul_epi32(i, magic), 32),
+						odd  = _mm256_mul_epi32(_mm256_srli_epi64(i, 32), magic),
+						q    = _mm256_blend_epi32(even, odd, 0xAA);
+					if (int32_t(divider::magic::value) < 0) q = _mm256_add_epi32(q, i);
+					return _mm256_sub_epi32(_mm256_srai_epi32(q, divider::shift::value), _mm256_srai_epi32(i, 31));
+				}
+				const int shift = divider::log2::value;
+				ivec_t bias = _mm256_srli_epi32(_mm256_srai_epi32(i, 31), 32 - shift);
+				return _mm256_srai_epi32(_mm256_add_epi32(i, bias), shift);
+			}
+		};
+
+		struct ops_avx2_f64
+		{
+			using float_t = double;
+			using int_t   = int64_t;
+			using vec_t   = __m256d;
+			using ivec_t  = __m256i;
+
+			static const size_t width = 4;
+			static const bool   fused = true;
+
+			static vec_t  load  (const float_t *p)             {return _mm256_load_pd(p);}
+			static vec_t  loadu (const float_t *p)             {return _mm256_loadu_pd(p);}
+			static void   store (float_t *p, const vec_t v)    {_mm256_store_pd(p, v);}
+			static void   storeu(float_t *p, const vec_t v)    {_mm256_storeu_pd(p, v);}
+			static vec_t  set1  (const float_t v)              {return _mm256_set1_pd(v);}
+			static ivec_t set1_i(const int_t v)                {return _mm256_set1_epi64x(v);}
+
+			static vec_t add(const vec_t a, const vec_t b)     {return _mm256_add_pd(a, b);}
+			static vec_t sub(const vec_t a, const vec_t b)     {return _mm256_sub_pd(a, b);}
+			static vec_t mul(const vec_t a, const vec_t b)     {return _mm256_mul_pd(a, b);}
+			static vec_t div(const vec_t a, const vec_t b)     {return _mm256_div_pd(a, b);}
+			static vec_t fmadd(const vec_t a, const vec_t b, const vec_t c)    {return _mm256_fmadd_pd(a, b, c);}
+
+			static ivec_t as_int  (const vec_t  v)    {return _mm256_castpd_si256(v);}
+			static vec_t  as_float(const ivec_t i)    {return _mm256_castsi256_pd(i);}
+			static ivec_t loadu_i (const int_t *p)              {return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p));}
+			static void   storeu_i(int_t *p, const ivec_t i)    {_mm256_storeu_si256(reinterpret_cast<__m256i*>(p), i);}
+
+			static vec_t sqrt(const vec_t a)    {return _mm256_sqrt_pd(a);}
+			static vec_t abs (const vec_t a)    {return _mm256_andnot_pd(_mm256_set1_pd(-0.0), a);}
+
+			using mask_t = vec_t;
+			static mask_t cmpgt   (const vec_t  a, const vec_t  b)                   {return _mm256_cmp_pd(a, b, _CMP_GT_OQ);}
+			static mask_t mask_and(const mask_t a, const mask_t b)                   {return _mm256_and_pd(a, b);}
+			static bool   all_lt_i(const ivec_t a, const ivec_t b)                   {return _mm256_movemask_epi8(_mm256_cmpgt_epi64(b, a)) == -1;}
+			static vec_t  select  (const mask_t m, const vec_t  a, const vec_t  b)    {return _mm256_blendv_pd(b, a, m);}
+			static ivec_t select_i(const mask_t m, const ivec_t a, const ivec_t b)    {return _mm256_blendv_epi8(b, a, _mm256_castpd_si256(m));}
+
+			static ivec_t add_i(const ivec_t a, const ivec_t b)    {return _mm256_add_epi64(a, b);}
+			static ivec_t sub_i(const ivec_t a, const ivec_t b)    {return _mm256_sub_epi64(a, b);}
+
+			static ivec_t and_i(const ivec_t a, const ivec_t b)    {return _mm256_and_si256(a, b);}
+			static ivec_t or_i (const ivec_t a, const ivec_t b)    {return _mm256_or_si256(a, b);}
+
+			static ivec_t sign_i(const ivec_t i)    {return _mm256_cmpgt_epi64(_mm256_setzero_si256(), i);}
+
+			static ivec_t mulhi_u(const ivec_t a, const uint64_t b)
+			{
+				const ivec_t
+					b_lo = _mm256_set1_epi64x(int64_t(b & 0xFFFFFFFFu)),
+					b_hi = _mm256_set1_epi64x(int64_t(b >> 32)),
+					mask = _mm256_set1_epi64x(0xFFFFFFFF),
+					a_hi = _mm256_srli_epi64(a, 32),
+					ll = _mm256_mul_epu32(a,    b_lo), lh = _mm256_mul_epu32(a,    b_hi),
+					hl = _mm256_mul_epu32(a_hi, b_lo), hh = _mm256_mul_epu32(a_hi, b_hi),
+					mid = _mm256_add_epi64(_mm256_srli_epi64(ll, 32),
+						_mm256_add_epi64(_mm256_and_si256(lh, mask), _mm256_and_si256(hl, mask)));
+				return _mm256_add_epi64(_mm256_add_epi64(hh, _mm256_srli_epi64(mid, 32)),
+					_mm256_add_epi64(_mm256_srli_epi64(lh, 32), _mm256_srli_epi64(hl, 32)));
+			}
+
+			template<int D> static ivec_t div_i(const ivec_t i)
+			{
+				using divider = detail::int_divider<int_t, D>;
+				if (D == 1) return i;
+				if (!divider::power_of_two::value)
+				{
+					const uint64_t magic = divider::magic::value;
+					const ivec_t sign = sign_i(i);
+					ivec_t q = _mm256_sub_epi64(mulhi_u(i, magic), _mm256_and_si256(sign, _mm256_set1_epi64x(int64_t(magic))));
+					if (divider::shift::value) q = _mm256_or_si256(_mm256_srli_epi64(q, divider::shift::value), _mm256_slli_epi64(sign_i(q), 64 - divider::shift::value));
+					return _mm256_sub_epi64(q, sign);
+				}
+				const int shift = divider::log2::value;
+				ivec_t t = _mm256_add_epi64(i, _mm256_srli_epi64(sign_i(i), 64 - shift));
+				return _mm256_or_si256(_mm256_srli_epi64(t, shift), _mm256_slli_epi64(sign_i(t), 64 - shift));
+			}
+		};
+	#if !(defined(__AVX2__) && defined(__FMA__))
+		ROOTBEER_TARGET_END
+	#endif
+#endif
+
+#if defined(ROOTBEER_HAS_AVX512)
+		ROOTBEER_AVX512_BEGIN
+	#if !defined(__AVX512F__)
+		ROOTBEER_TARGET_BEGIN("avx512f")
+	#endif
+		struct ops_avx512_f64;
+		struct ops_avx512_f32
+		{
+			using float_t = float;
+			using int_t   = int32_t;
+			using vec_t   = __m512;
+			using ivec_t  = __m512i;
+
+			static const size_t width = 16;
+			static const bool   fused = true;
+
+			static vec_t  load  (const float_t *p)             {return _mm512_load_ps(p);}
+			static vec_t  loadu (const float_t *p)             {return _mm512_loadu_ps(p);}
+			static void   store (float_t *p, const vec_t v)    {_mm512_store_ps(p, v);}
+			static void   storeu(float_t *p, const vec_t v)    {_mm512_storeu_ps(p, v);}
+			static vec_t  set1  (const float_t v)              {return _mm512_set1_ps(v);}
+			static ivec_t set1_i(const int_t v)                {return _mm512_set1_epi32(v);}
+
+			static vec_t add(const vec_t a, const vec_t b)     {return _mm512_add_ps(a, b);}
+			static vec_t sub(const vec_t a, const vec_t b)     {return _mm512_sub_ps(a, b);}
+			static vec_t mul(const vec_t a, const vec_t b)     {return _mm512_mul_ps(a, b);}
+			static vec_t div(const vec_t a, const vec_t b)     {return _mm512_div_ps(a, b);}
+			static vec_t fmadd(const vec_t a, const vec_t b, const vec_t c)    {return _mm512_fmadd_ps(a, b, c);}
+
+			static ivec_t as_int  (const vec_t  v)    {return _mm512_castps_si512(v);}
+			static vec_t  as_float(const ivec_t i)    {return _mm512_castsi512_ps(i);}
+			static ivec_t loadu_i (const int_t *p)              {return _mm512_loadu_si512(p);}
+			static void   storeu_i(int_t *p, const ivec_t i)    {_mm512_storeu_si512(p, i);}
+
+			static vec_t sqrt(const vec_t a)    {return _mm512_sqrt_ps(a);}
+			static vec_t abs (const vec_t a)    {return _mm512_castsi512_ps(_mm512_and_epi32(_mm512_castps_si512(a), _mm512_set1_epi32(0x7FFFFFFF)));}
+
+			using mask_t = __mmask16;
+			static mask_t cmpgt   (const vec_t  a, const vec_t  b)                   {return _mm512_cmp_ps_mask(a, b, _CMP_GT_OQ);}
+			static mask_t mask_and(const mask_t a, const mask_t b)                   {return mask_t(a & b);}
+			static bool   all_lt_i(const ivec_t a, const ivec_t b)                   {return _mm512_cmplt_epi32_mask(a, b) == __mmask16(0xFFFF);}
+			static vec_t  select  (const mask_t m, const vec_t  a, const vec_t  b)    {return _mm512_mask_blend_ps(m, b, a);}
+			static ivec_t select_i(const mask_t m, const ivec_t a, const ivec_t b)    {return _mm512_mask_blend_epi32(m, b, a);}
+
+			// Conversion to and from double-precision lanes
+			using wide_ops = ops_avx512_f64;
+			static __m512d wide_lo(const vec_t v)                      {return _mm512_cvtps_pd(_mm512_castps512_ps256(v));}
+			static __m512d wide_hi(const vec_t v)                      {return _mm512_cvtps_pd(_mm256_castpd_ps(_mm512_extractf64x4_pd(_mm512_castps_pd(v), 1)));}
+			static vec_t   narrow (const __m512d lo, const __m512d hi)
+			{
+				return _mm512_castpd_ps(_mm512_insertf64x4(
+					_mm512_castpd256_pd512(_mm256_castps_pd(_mm512_cvtpd_ps(lo))),
+					_mm256_castps_pd(_mm512_cvtpd_ps(hi)), 1));
+			}
+
+			static ivec_t add_i(const ivec_t a, const ivec_t b)    {return _mm512_add_epi32(a, b);}
+			static ivec_t sub_i(const ivec_t a, const ivec_t b)    {return _mm512_sub_epi32(a, b);}
+
+			static ivec_t and_i(const ivec_t a, const ivec_t b)    {return _mm512_and_si512(a, b);}
+			static ivec_t or_i (const ivec_t a, const ivec_t b)    {return _mm512_or_si512(a, b);}
+			template<int S> static ivec_t srai_i(const ivec_t i)   {return _mm512_srai_epi32(i, S);}
+			static vec_t  cvt_i (const ivec_t i)                   {return _mm512_cvtepi32_ps(i);}
+			static ivec_t cvtt_f(const vec_t  v)                   {return _mm512_cvttps_epi32(v);}
+			static vec_t  max(const vec_t a, const vec_t b)        {return _mm512_max_ps(a, b);}
+			static vec_t  min(const vec_t a, const vec_t b)        {return _mm512_min_ps(a, b);}
+
+			template<int D> static ivec_t div_i(const ivec_t i)
+			{
+				using divider = detail::int_divider<int_t, D>;
+				if (D == 1) return i;
+				if (!divider::power_of_two::value)
+				{
+					const ivec_t magic = _mm512_set1_epi32(int32_t(divider::magic::value));
+					ivec_t
+						even = _mm512_srli_epi64(_mm512_mul_epi32(i, magic), 32),
+						odd  = _mm512_mul_epi32(_mm512_srli_epi64(i, 32), magic),
+						q    = _mm512_mask_blend_epi32(0xAAAA, even, odd);
+					if (int32_t(divider::magic::value) < 0) q = _mm512_add_epi32(q, i);
+					return _mm512_sub_epi32(_mm512_srai_epi32(q, divider::shift::value), _mm512_srai_epi32(i, 31));
+				}
+				const int shift = divider::log2::value;
+				ivec_t bias = _mm512_srli_epi32(_mm512_srai_epi32(i, 31), 32 - shift);
+				return _mm512_srai_epi32(_mm512_add_epi32(i, bias), shift);
+			}
+		};
+
+		struct ops_avx512_f64
+		{
+			using float_t = double;
+			using int_t   = int64_t;
+			using vec_t   = __m512d;
+			using ivec_t  = __m512i;
+
+			static const size_t width = 8;
+			static const bool   fused = true;
+
+			static vec_t  load  (const float_t *p)             {return _mm512_load_pd(p);}
+			static vec_t  loadu (const float_t *p)             {return _mm512_loadu_pd(p);}
+			static void   store (float_t *p, const vec_t v)    {_mm512_store_pd(p, v);}
+			static void   storeu(float_t *p, const vec_t v)    {_mm512_storeu_pd(p, v);}
+			static vec_t  set1  (const float_t v)              {return _mm512_set1_pd(v);}
+			static ivec_t set1_i(const int_t v)                {return _mm512_set1_epi64(v);}
+
+			static vec_t add(const vec_t a, const vec_t b)     {return _mm512_add_pd(a, b);}
+			static vec_t sub(const vec_t a, const vec_t b)     {return _mm512_sub_pd(a, b);}
+			static vec_t mul(const vec_t a, const vec_t b)     {return _mm512_mul_pd(a, b);}
+			static vec_t div(const vec_t a, const vec_t b)     {return _mm512_div_pd(a, b);}
+			static vec_t fmadd(const vec_t a, const vec_t b, const vec_t c)    {return _mm512_fmadd_pd(a, b, c);}
+
+			static ivec_t as_int  (const vec_t  v)    {return _mm512_castpd_si512(v);}
+			static vec_t  as_float(const ivec_t i)    {return _mm512_castsi512_pd(i);}
+			static ivec_t loadu_i (const int_t *p)              {return _mm512_loadu_si512(p);}
+			static void   storeu_i(int_t *p, const ivec_t i)    {_mm512_storeu_si512(p, i);}
+
+			static vec_t sqrt(const vec_t a)    {return _mm512_sqrt_pd(a);}
+			static vec_t abs (const vec_t a)    {return _mm512_castsi512_pd(_mm512_and_epi32(_mm512_castpd_si512(a), _mm512_set1_epi64(0x7FFFFFFFFFFFFFFF)));}
+
+			using mask_t = __mmask8;
+			static mask_t cmpgt   (const vec_t  a, const vec_t  b)                   {return _mm512_cmp_pd_mask(a, b, _CMP_GT_OQ);}
+			static mask_t mask_and(const mask_t a, const mask_t b)                   {return mask_t(a & b);}
+			static bool   all_lt_i(const ivec_t a, const ivec_t b)                   {return _mm512_cmplt_epi64_mask(a, b) == __mmask8(0xFF);}
+			static vec_t  select  (const mask_t m, const vec_t  a, const vec_t  b)    {return _mm512_mask_blend_pd(m, b, a);}
+			static ivec_t select_i(const mask_t m, const ivec_t a, const ivec_t b)    {return _mm512_mask_blend_epi64(m, b, a);}
+
+			static ivec_t add_i(const ivec_t a, const ivec_t b)    {return _mm512_add_epi64(a, b);}
+			static ivec_t sub_i(const ivec_t a, const ivec_t b)    {return _mm512_sub_epi64(a, b);}
+
+			static ivec_t and_i(const ivec_t a, const ivec_t b)    {return _mm512_and_si512(a, b);}
+			static ivec_t or_i (const ivec_t a, const ivec_t b)    {return _mm512_or_si512(a, b);}
+
+			static ivec_t mulhi_u(const ivec_t a, const uint64_t b)
+			{
+				const ivec_t
+					b_lo = _mm512_set1_epi64(int64_t(b & 0xFFFFFFFFu)),
+					b_hi = _mm512_set1_epi64(int64_t(b >> 32)),
+					mask = _mm512_set1_epi64(0xFFFFFFFF),
+					a_hi = _mm512_srli_epi64(a, 32),
+					ll = _mm512_mul_epu32(a,    b_lo), lh = _mm512_mul_epu32(a,    b_hi),
+					hl = _mm512_mul_epu32(a_hi, b_lo), hh = _mm512_mul_epu32(a_hi, b_hi),
+					mid = _mm512_add_epi64(_mm512_srli_epi64(ll, 32),
+						_mm512_add_epi64(_mm512_and_si512(lh, mask), _mm512_and_si512(hl, mask)));
+				return _mm512_add_epi64(_mm512_add_epi64(hh, _mm512_srli_epi64(mid, 32)),
+					_mm512_add_epi64(_mm512_srli_epi64(lh, 32), _mm512_srli_epi64(hl, 32)));
+			}
+
+			template<int D> static ivec_t div_i(const ivec_t i)
+			{
+				using divider = detail::int_divider<int_t, D>;
+				if (D == 1) return i;
+				if (!divider::power_of_two::value)
+				{
+					const uint64_t magic = divider::magic::value;
+					const ivec_t sign = _mm512_srai_epi64(i, 63);
+					ivec_t q = _mm512_sub_epi64(mulhi_u(i, magic), _mm512_and_si512(sign, _mm512_set1_epi64(int64_t(magic))));
+					q = _mm512_srai_epi64(q, divider::shift::value);
+					return _mm512_sub_epi64(q, sign);
+				}
+				const int shift = divider::log2::value;
+				ivec_t bias = _mm512_srli_epi64(_mm512_srai_epi64(i, 63), 64 - shift);
+				return _mm512_srai_epi64(_mm512_add_epi64(i, bias), shift);
+			}
+		};
+	#if !defined(__AVX512F__)
+		ROOTBEER_TARGET_END
+	#endif
+		ROOTBEER_AVX512_END
+#endif
+
+
+		/*
+			Widest available ops for a float type.
+		*/
+		template<typename T_Float> struct native_ops_ {using type = ops_scalar<T_Float, false>;};
+#if defined(__AVX512F__)
+		template<> struct native_ops_<float>  {using type = ops_avx512_f32;};
+		template<> struct native_ops_<double> {using type = ops_avx512_f64;};
+#elif defined(__AVX2__) && defined(__FMA__)
+		template<> struct native_ops_<float>  {using type = ops_avx2_f32;};
+		template<> struct native_ops_<double> {using type = ops_avx2_f64;};
+#elif defined(__SSE4_1__)
+		template<> struct native_ops_<float>  {using type = ops_sse41_f32;};
+		template<> struct native_ops_<double> {using type = ops_sse41_f64;};
+#endif
+
+		template<typename T_Float>
+		using native_ops = typename native_ops_<T_Float>::type;
+
+		// Required alignment for apply_aligned
+		template<typename T_Float>
+		constexpr size_t native_alignment()    {return sizeof(T_Float) * native_ops<T_Float>::width;}
+
+
+#include "root_cellar_kernels.h"
+
+		template<bool ALIGNED, int N, typename T_Float, unsigned NewtonSteps>
+		void root_batch(const RootApprox<N, T_Float, NewtonSteps> &approx,
+			const T_Float *y, T_Float *x, const size_t count)
+		{
+			using ops = native_ops<T_Float>;
+
+			assert(!ALIGNED || (reinterpret_cast<uintptr_t>(y) % (sizeof(T_Float)*ops::width)) == 0);
+			assert(!ALIGNED || (reinterpret_cast<uintptr_t>(x) % (sizeof(T_Float)*ops::width)) == 0);
+
+			domain_batch<ROOT_FAST, ops, ALIGNED>(approx, y, x, count);
+		}
+
+
+		/*
+			Loads, conversions and stores for 16-bit formats in float lanes.
+
+			load16 sign-extends each 16-bit pattern into a 32-bit lane, where
+			the estimate's integer steps leave the same low 16 bits as they would
+			in int16_t.  to_float widens the low 16 bits of each lane, and store16
+			rounds float lanes to nearest even, keeping NaNs quiet.  round16
+			does the same rounding but leaves the result in float lanes.
+			binary16 vectors need F16C or AVX-512F; bfloat16 needs only shifts.
+		*/
+		template<typename T_Format, bool FUSED>
+		struct widen_scalar
+		{
+			using ops = ops_scalar<float, FUSED>;
+
+			static int32_t load16  (const uint16_t *p)             {int16_t b; std::memcpy(&b, p, sizeof(b)); return b;}
+			static float   to_float(const int32_t b)               {return T_Format::decode(uint16_t(b));}
+			static float   round16 (const float v)                 {return T_Format::decode(T_Format::encode(v));}
+			static void    store16 (uint16_t *p, const float v)    {const uint16_t b = T_Format::encode(v); std::memcpy(p, &b, sizeof(b));}
+		};
+
+		template<typename T_Format> struct widen_sse41;
+		template<typename T_Format> struct widen_avx2;
+		template<typename T_Format> struct widen_avx512;
+
+#if defined(__SSE4_1__)
+		struct widen_sse41_base
+		{
+			using ops = ops_sse41_f32;
+
+			static __m128i load16(const uint16_t *p)    {return _mm_cvtepi16_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(p)));}
+			static __m128i pack16(const __m128i b)      {const __m128i lo = _mm_and_si128(b, _mm_set1_epi32(0xFFFF)); return _mm_packus_epi32(lo, lo);}
+		};
+		template<> struct widen_sse41<detail::bfloat16_format> : widen_sse41_base
+		{
+			static __m128 to_float(const __m128i b)    {return _mm_castsi128_ps(_mm_slli_epi32(b, 16));}
+			static __m128 round16(const __m128 v)
+			{
+				const __m128i
+					u = _mm_castps_si128(v),
+					r = _mm_add_epi32(u, _mm_add_epi32(_mm_set1_epi32(0x7FFF), _mm_and_si128(_mm_srli_epi32(u, 16), _mm_set1_epi32(1)))),
+					q = _mm_or_si128(u, _mm_set1_epi32(0x400000));
+				return _mm_castsi128_ps(_mm_and_si128(_mm_blendv_epi8(r, q, _mm_castps_si128(_mm_cmpunord_ps(v, v))), _mm_set1_epi32(int32_t(0xFFFF0000u))));
+			}
+			static void   store16(uint16_t *p, const __m128 v)
+			{
+				const __m128i
+					u = _mm_castps_si128(v), hi = _mm_srli_epi32(u, 16),
+					r = _mm_srli_epi32(_mm_add_epi32(u, _mm_add_epi32(_mm_set1_epi32(0x7FFF), _mm_and_si128(hi, _mm_set1_epi32(1)))), 16),
+					q = _mm_or_si128(hi, _mm_set1_epi32(0x40));
+				_mm_storel_epi64(reinterpret_cast<__m128i*>(p), pack16(_mm_blendv_epi8(r, q, _mm_castps_si128(_mm_cmpunord_ps(v, v)))));
+			}
+		};
+	#if defined(__F16C__)
+		template<> struct widen_sse41<detail::half_format> : widen_sse41_base
+		{
+			static __m128 to_float(const __m128i b)               {return _mm_cvtph_ps(pack16(b));}
+			static __m128 round16 (const __m128 v)                 {return _mm_cvtph_ps(_mm_cvtps_ph(v, _MM_FROUND_TO_NEAREST_INT));}
+			static void   store16 (uint16_t *p, const __m128 v)    {_mm_storel_epi64(reinterpret_cast<__m128i*>(p), _mm_cvtps_ph(v, _MM_FROUND_TO_NEAREST_INT));}
+		};
+	#endif
+#endif
+
+#if defined(__AVX2__) && defined(__FMA__)
+		struct widen_avx2_base
+		{
+			using ops = ops_avx2_f32;
+
+			static __m256i load16(const uint16_t *p)    {return _mm256_cvtepi16_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p)));}
+			static __m128i pack16(const __m256i b)
+			{
+				const __m256i lo = _mm256_and_si256(b, _mm256_set1_epi32(0xFFFF));
+				return _mm256_castsi256_si128(_mm256_permute4x64_epi64(_mm256_packus_epi32(lo, lo), 0x08));
+			}
+		};
+		template<> struct widen_avx2<detail::bfloat16_format> : widen_avx2_base
+		{
+			static __m256 to_float(const __m256i b)    {return _mm256_castsi256_ps(_mm256_slli_epi32(b, 16));}
+			static __m256 round16(const __m256 v)
+			{
+				const __m256i
+					u = _mm256_castps_si256(v),
+					r = _mm256_add_epi32(u, _mm256_add_epi32(_mm256_set1_epi32(0x7FFF), _mm256_and_si256(_mm256_srli_epi32(u, 16), _mm256_set1_epi32(1)))),
+					q = _mm256_or_si256(u, _mm256_set1_epi32(0x400000));
+				return _mm256_castsi256_ps(_mm256_and_si256(_mm256_blendv_epi8(r, q, _mm256_castps_si256(_mm256_cmp_ps(v, v, _CMP_UNORD_Q))), _mm256_set1_epi32(int32_t(0xFFFF0000u))));
+			}
+			static void   store16(uint16_t *p, const __m256 v)
+			{
+				const __m256i
+					u = _mm256_castps_si256(v), hi = _mm256_srli_epi32(u, 16),
+					r = _mm256_srli_epi32(_mm256_add_epi32(u, _mm256_add_epi32(_mm256_set1_epi32(0x7FFF), _mm256_and_si256(hi, _mm256_set1_epi32(1)))), 16),
+					q = _mm256_or_si256(hi, _mm256_set1_epi32(0x40));
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(p), pack16(_mm256_blendv_epi8(r, q, _mm256_castps_si256(_mm256_cmp_ps(v, v, _CMP_UNORD_Q)))));
+			}
+		};
+	#if defined(__F16C__)
+		template<> struct widen_avx2<detail::half_format> : widen_avx2_base
+		{
+			static __m256 to_float(const __m256i b)               {return _mm256_cvtph_ps(pack16(b));}
+			static __m256 round16 (const __m256 v)                 {return _mm256_cvtph_ps(_mm256_cvtps_ph(v, _MM_FROUND_TO_NEAREST_INT));}
+			static void   store16 (uint16_t *p, const __m256 v)    {_mm_storeu_si128(reinterpret_cast<__m128i*>(p), _mm256_cvtps_ph(v, _MM_FROUND_TO_NEAREST_INT));}
+		};
+	#endif
+#endif
+
+#if defined(__AVX512F__)
+		ROOTBEER_AVX512_BEGIN
+		struct widen_avx512_base
+		{
+			using ops = ops_avx512_f32;
+
+			static __m512i load16(const uint16_t *p)    {return _mm512_cvtepi16_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(p)));}
+		};
+		template<> struct widen_avx512<detail::bfloat16_format> : widen_avx512_base
+		{
+			static __m512 to_float(const __m512i b)    {return _mm512_castsi512_ps(_mm512_slli_epi32(b, 16));}
+			static __m512 round16(const __m512 v)
+			{
+				const __m512i
+					u = _mm512_castps_si512(v),
+					r = _mm512_add_epi32(u, _mm512_add_epi32(_mm512_set1_epi32(0x7FFF), _mm512_and_si512(_mm512_srli_epi32(u, 16), _mm512_set1_epi32(1)))),
+					q = _mm512_or_si512(u, _mm512_set1_epi32(0x400000));
+				return _mm512_castsi512_ps(_mm512_and_si512(_mm512_mask_blend_epi32(_mm512_cmp_ps_mask(v, v, _CMP_UNORD_Q), r, q), _mm512_set1_epi32(int32_t(0xFFFF0000u))));
+			}
+			static void   store16(uint16_t *p, const __m512 v)
+			{
+				const __m512i
+					u = _mm512_castps_si512(v), hi = _mm512_srli_epi32(u, 16),
+					r = _mm512_srli_epi32(_mm512_add_epi32(u, _mm512_add_epi32(_mm512_set1_epi32(0x7FFF), _mm512_and_si512(hi, _mm512_set1_epi32(1)))), 16),
+					q = _mm512_or_si512(hi, _mm512_set1_epi32(0x40));
+				_mm256_storeu_si256(reinterpret_cast<__m256i*>(p), _mm512_cvtepi32_epi16(_mm512_mask_blend_epi32(_mm512_cmp_ps_mask(v, v, _CMP_UNORD_Q), r, q)));
+			}
+		};
+		template<> struct widen_avx512<detail::half_format> : widen_avx512_base
+		{
+			static __m512 to_float(const __m512i b)               {return _mm512_cvtph_ps(_mm512_cvtepi32_epi16(b));}
+			static __m512 round16 (const __m512 v)                 {return _mm512_cvtph_ps(_mm512_cvtps_ph(v, _MM_FROUND_TO_NEAREST_INT));}
+			static void   store16 (uint16_t *p, const __m512 v)    {_mm256_storeu_si256(reinterpret_cast<__m256i*>(p), _mm512_cvtps_ph(v, _MM_FROUND_TO_NEAREST_INT));}
+		};
+		ROOTBEER_AVX512_END
+#endif
+
+		/*
+			Widest available widening for a 16-bit format.
+		*/
+		template<typename T_Format> struct native_widen_ {using type = widen_scalar<T_Format, false>;};
+#if defined(__AVX512F__)
+		template<> struct native_widen_<detail::bfloat16_format> {using type = widen_avx512<detail::bfloat16_format>;};
+		template<> struct native_widen_<detail::half_format>     {using type = widen_avx512<detail::half_format>;};
+#elif defined(__AVX2__) && defined(__FMA__)
+		template<> struct native_widen_<detail::bfloat16_format> {using type = widen_avx2<detail::bfloat16_format>;};
+	#if defined(__F16C__)
+		template<> struct native_widen_<detail::half_format>     {using type = widen_avx2<detail::half_format>;};
+	#endif
+#elif defined(__SSE4_1__)
+		template<> struct native_widen_<detail::bfloat16_format> {using type = widen_sse41<detail::bfloat16_format>;};
+	#if defined(__F16C__)
+		template<> struct native_widen_<detail::half_format>     {using type = widen_sse41<detail::half_format>;};
+	#endif
+#endif
+
+		template<typename T_Format>
+		using native_widen = typename native_widen_<T_Format>::type;
+
+
+		/*
+			Float-lane arithmetic rounded to a 16-bit format after each operation,
+			unfused, as RootApprox::operator() does it in 16-bit arithmetic.
+		*/
+		template<typename Wide>
+		struct ops_round16 : Wide::ops
+		{
+			using base    = typename Wide::ops;
+			using float_t = typename base::float_t;
+			using vec_t   = typename base::vec_t;
+
+			static const bool fused = false;
+
+			static vec_t set1(const float_t v)                 {return Wide::round16(base::set1(v));}
+			static vec_t add(const vec_t a, const vec_t b)     {return Wide::round16(base::add(a, b));}
+			static vec_t sub(const vec_t a, const vec_t b)     {return Wide::round16(base::sub(a, b));}
+			static vec_t mul(const vec_t a, const vec_t b)     {return Wide::round16(base::mul(a, b));}
+			static vec_t div(const vec_t a, const vec_t b)     {return Wide::round16(base::div(a, b));}
+			static vec_t fmadd(const vec_t a, const vec_t b, const vec_t c)    {return add(mul(a, b), c);}
+		};
+
+		/*
+			RootApprox calculation for a 16-bit format over one vector of float
+			lanes.  The estimate is the 16-bit design's; refinements are done in
+			float with its constants, rounded to 16 bits after each operation as
+			RootApprox::operator() rounds them.
+		*/
+		template<int N, typename T_Float, unsigned NewtonSteps>
+		RootApprox<N, float, NewtonSteps> widen_design(const RootApprox<N, T_Float, NewtonSteps> &approx)
+		{
+			RootApprox<N, float, NewtonSteps> wide(0);
+			for (unsigned s = 0; s < NewtonSteps; ++s) wide.newton_m[s] = float(approx.newton_m[s]);
+			return wide;
+		}
+
+		template<int N, unsigned NewtonSteps, typename Wide>
+		struct root_kernel_widened
+		{
+			using ops    = typename Wide::ops;
+			using vec_t  = typename ops::vec_t;
+			using ivec_t = typename ops::ivec_t;
+
+			static const int DEG = ((N>0) ? N : -N);
+
+			ivec_t k;
+			root_kernel<N, NewtonSteps, ops_round16<Wide>> refinement;
+
+			template<typename T_Float>
+			explicit root_kernel_widened(const RootApprox<N, T_Float, NewtonSteps> &approx) :
+				k(ops::set1_i(int32_t(approx.constant))), refinement(widen_design(approx)) {}
+
+			// From the sign-extended patterns of y
+			vec_t operator()(const ivec_t y) const
+			{
+				ivec_t i = ops::template div_i<DEG>(y);
+				return refinement.refine(Wide::to_float(y), Wide::to_float((N > 0) ? ops::add_i(k, i) : ops::sub_i(k, i)));
+			}
+		};
+
+		template<int N, unsigned NewtonSteps, typename T_Float>
+		void root_batch_widened(const RootApprox<N, T_Float, NewtonSteps> &approx,
+			const T_Float *y_, T_Float *x_, const size_t count)
+		{
+			using format = typename detail::float_traits<T_Float>::format_t;
+			using wide   = native_widen<format>;
+			using tail   = widen_scalar<format, wide::ops::fused>;
+
+			const root_kernel_widened<N, NewtonSteps, wide> kernel(approx);
+			const root_kernel_widened<N, NewtonSteps, tail> tail_kernel(approx);
+			const uint16_t *y = reinterpret_cast<const uint16_t*>(y_);
+			uint16_t       *x = reinterpret_cast<uint16_t*>(x_);
+			const size_t W = wide::ops::width;
+
+			size_t i = 0;
+			if (W > 1)
+			{
+				for (; i + 2*W <= count; i += 2*W)
+				{
+					auto a = kernel(wide::load16(y + i)), b = kernel(wide::load16(y + i + W));
+					wide::store16(x + i, a);
+					wide::store16(x + i + W, b);
+				}
+				for (; i + W <= count; i += W)
+					wide::store16(x + i, kernel(wide::load16(y + i)));
+			}
+			for (; i < count; ++i)
+				tail::store16(x + i, tail_kernel(tail::load16(y + i)));
+		}
+
+#if defined(__AVX512FP16__)
+		ROOTBEER_AVX512_BEGIN
+		/*
+			binary16 lanes with AVX-512 FP16, 32 to a vector.  Arithmetic is
+			16-bit as in RootApprox::operator(), with fused multiply-adds, and
+			the tail is a masked vector.
+		*/
+		struct ops_avx512_f16
+		{
+			using float_t = float16;
+			using int_t   = int16_t;
+			using vec_t   = __m512h;
+			using ivec_t  = __m512i;
+
+			static const size_t width = 32;
+			static const bool   fused = true;
+
+			static vec_t  load  (const float_t *p)             {return _mm512_load_ph(p);}
+			static vec_t  loadu (const float_t *p)             {return _mm512_loadu_ph(p);}
+			static void   store (float_t *p, const vec_t v)    {_mm512_store_ph(p, v);}
+			static void   storeu(float_t *p, const vec_t v)    {_mm512_storeu_ph(p, v);}
+			static vec_t  set1  (const float_t v)              {return _mm512_set1_ph(v);}
+			static ivec_t set1_i(const int_t v)                {return _mm512_set1_epi16(v);}
+
+			static vec_t add(const vec_t a, const vec_t b)     {return _mm512_add_ph(a, b);}
+			static vec_t sub(const vec_t a, const vec_t b)     {return _mm512_sub_ph(a, b);}
+			static vec_t mul(const vec_t a, const vec_t b)     {return _mm512_mul_ph(a, b);}
+			static vec_t div(const vec_t a, const vec_t b)     {return _mm512_div_ph(a, b);}
+			static vec_t fmadd(const vec_t a, const vec_t b, const vec_t c)    {return _mm512_fmadd_ph(a, b, c);}
+
+			static ivec_t as_int  (const vec_t  v)    {return _mm512_castph_si512(v);}
+			static vec_t  as_float(const ivec_t i)    {return _mm512_castsi512_ph(i);}
+			static ivec_t loadu_i (const int_t *p)              {return _mm512_loadu_si512(p);}
+			static void   storeu_i(int_t *p, const ivec_t i)    {_mm512_storeu_si512(p, i);}
+
+			static ivec_t add_i(const ivec_t a, const ivec_t b)    {return _mm512_add_epi16(a, b);}
+			static ivec_t sub_i(const ivec_t a, const ivec_t b)    {return _mm512_sub_epi16(a, b);}
+
+			template<int D> static ivec_t div_i(const ivec_t i)
+			{
+				using divider = detail::int_divider<int_t, D>;
+				if (D == 1) return i;
+				if (!divider::power_of_two::value)
+				{
+					ivec_t q = _mm512_mulhi_epi16(i, _mm512_set1_epi16(int16_t(divider::magic::value)));
+					if (int16_t(divider::magic::value) < 0) q = _mm512_add_epi16(q, i);
+					return _mm512_sub_epi16(_mm512_srai_epi16(q, divider::shift::value), _mm512_srai_epi16(i, 15));
+				}
+				const int shift = divider::log2::value;
+				ivec_t bias = _mm512_srli_epi16(_mm512_srai_epi16(i, 15), 16 - shift);
+				return _mm512_srai_epi16(_mm512_add_epi16(i, bias), shift);
+			}
+		};
+
+		template<int N, unsigned NewtonSteps>
+		void root_batch_fp16(const RootApprox<N, float16, NewtonSteps> &approx,
+			const float16 *y, float16 *x, const size_t count)
+		{
+			using ops = ops_avx512_f16;
+			const root_kernel<N, NewtonSteps, ops> kernel(approx);
+
+			size_t i = 0;
+			for (; i + ops::width <= count; i += ops::width)
+				ops::storeu(x + i, kernel(ops::loadu(y + i)));
+			if (i < count)
+			{
+				const __mmask32 mask = __mmask32((uint64_t(1) << (count - i)) - 1);
+				const __m512h v = _mm512_castsi512_ph(_mm512_maskz_loadu_epi16(mask, y + i));
+				_mm512_mask_storeu_epi16(x + i, mask, _mm512_castph_si512(kernel(v)));
+			}
+		}
+		ROOTBEER_AVX512_END
+#endif
+
+		/*
+			Batches of 16-bit floats.  Both formats widen to float lanes unless
+			AVX-512 FP16 is enabled, which computes binary16 in its own lanes.
+			These batches need no alignment: apply_aligned behaves like apply.
+		*/
+		template<bool ALIGNED, int N, unsigned NewtonSteps>
+		void root_batch(const RootApprox<N, bfloat16, NewtonSteps> &approx,
+			const bfloat16 *y, bfloat16 *x, const size_t count)
+		{
+			root_batch_widened(approx, y, x, count);
+		}
+		template<bool ALIGNED, int N, unsigned NewtonSteps>
+		void root_batch(const RootApprox<N, float16, NewtonSteps> &approx,
+			const float16 *y, float16 *x, const size_t count)
+		{
+#if defined(__AVX512FP16__)
+			root_batch_fp16(approx, y, x, count);
+#else
+			root_batch_widened(approx, y, x, count);
+#endif
+		}
+
+		/*
+			Ops with multiply-adds left unfused, to reproduce RootApprox::operator().
+		*/
+		template<typename Ops>
+		struct ops_unfused : Ops
+		{
+			static const bool fused = false;
+			static typename Ops::vec_t fmadd(const typename Ops::vec_t a, const typename Ops::vec_t b, const typename Ops::vec_t c)
+				{return Ops::add(Ops::mul(a, b), c);}
+		};
+
+		/*
+			detail::cbrt_float on each lane, step for step, in double-precision lanes.
+		*/
+		template<typename Wide>
+		typename Wide::vec_t cbrt_wide(const typename Wide::vec_t Y)
+		{
+			using vec_t = typename Wide::vec_t;
+			vec_t r = Wide::as_float(Wide::add_i(Wide::set1_i(0x2a9f76253119d328),
+				Wide::template div_i<3>(Wide::as_int(Y))));
+			for (int step = 0; step < 3; ++step)
+			{
+				vec_t r3 = Wide::mul(Wide::mul(r, r), r);
+				r = Wide::div(Wide::mul(r, Wide::add(r3, Wide::add(Y, Y))), Wide::add(Wide::add(r3, r3), Y));
+			}
+			return r;
+		}
+
+		template<typename Ops>
+		typename Ops::vec_t cbrt_v(const typename Ops::vec_t y)
+		{
+			using wide  = typename Ops::wide_ops;
+			using vec_t = typename Ops::vec_t;
+			const vec_t zero = Ops::set1(0.f), ay = Ops::abs(y);
+			vec_t r = Ops::narrow(cbrt_wide<wide>(Ops::wide_lo(ay)), cbrt_wide<wide>(Ops::wide_hi(ay)));
+			r = Ops::select(Ops::cmpgt(zero, y), Ops::sub(zero, r), r);
+			return Ops::select(Ops::mask_and(Ops::cmpgt(ay, zero), Ops::cmpgt(Ops::set1(HUGE_VALF), ay)), r, y);
+		}
+
+		/*
+			root_i on each lane, with identical results.
+		*/
+		template<int ROOT, typename Ops>
+		typename Ops::vec_t root_v(const typename Ops::vec_t y)
+		{
+			static_assert(ROOT != 0 && ROOT >= -4 && ROOT <= 4, "no vector reference for this root index");
+			const typename Ops::vec_t one = Ops::set1(1.f);
+			switch (ROOT)
+			{
+			case -4: return Ops::div(one, Ops::sqrt(Ops::sqrt(y)));
+			case -3: return Ops::div(one, cbrt_v<Ops>(y));
+			case -2: return Ops::div(one, Ops::sqrt(y));
+			case -1: return Ops::div(one, y);
+			default:
+			case  1: return y;
+			case  2: return Ops::sqrt(y);
+			case  3: return cbrt_v<Ops>(y);
+			case  4: return Ops::sqrt(Ops::sqrt(y));
+			}
+		}
+
+		/*
+			Test_Root_Approx_WorstCase with one vector of consecutive inputs per
+			iteration.  Each lane keeps its worst error and the input giving it;
+			lanes are reduced at the end, preferring the earliest input on ties.
+		*/
+		template<int ROOT, int N, unsigned NewtonSteps>
+		float worst_case_scan(const RootApprox<N, float, NewtonSteps> &approx, float range_min, float range_max)
+		{
+			using ops    = ops_unfused<native_ops<float>>;
+			using vec_t  = typename ops::vec_t;
+			using ivec_t = typename ops::ivec_t;
+			using mask_t = typename ops::mask_t;
+			const size_t W = ops::width;
+
+			const int32_t
+				ib = reinterpret_float_int(range_min),
+				ie = reinterpret_float_int(range_max);
+
+			const root_kernel<N, NewtonSteps, ops> kernel(approx);
+
+			int32_t lanes[W];
+			for (size_t l = 0; l < W; ++l) lanes[l] = int32_t(l);
+			const ivec_t step = ops::set1_i(int32_t(W));
+			ivec_t
+				xi      = ops::add_i(ops::set1_i(ib), ops::loadu_i(lanes)),
+				worst_i = ops::set1_i(0);
+			vec_t
+				worst     = ops::set1(0.f),
+				worst_abs = ops::set1(0.f);
+
+			int64_t i = ib;
+			for (; i + int64_t(W) - 1 <= ie; i += W)
+			{
+				vec_t
+					xf = ops::as_float(xi),
+					yf = root_v<ROOT, ops>(xf),
+					error = ops::div(ops::sub(kernel(xf), yf), yf),
+					error_abs = ops::abs(error);
+				mask_t m = ops::cmpgt(error_abs, worst_abs);
+				worst     = ops::select  (m, error,     worst);
+				worst_abs = ops::select  (m, error_abs, worst_abs);
+				worst_i   = ops::select_i(m, xi,        worst_i);
+				xi = ops::add_i(xi, step);
+			}
+
+			float   lane_error[W], lane_abs[W];
+			int32_t lane_arg[W];
+			ops::storeu(lane_error, worst);
+			ops::storeu(lane_abs, worst_abs);
+			ops::storeu_i(lane_arg, worst_i);
+
+			float   worst_error = 0.f;
+			int32_t worst_arg = 0;
+			for (size_t l = 0; l < W; ++l)
+			{
+				float a = lane_abs[l], b = std::abs(worst_error);
+				if (a > b || (a == b && a > 0.f && lane_arg[l] < worst_arg))
+				{
+					worst_error = lane_error[l];
+					worst_arg = lane_arg[l];
+				}
+			}
+
+			// Remaining inputs, as in the scalar routine
+			for (; i <= ie; ++i)
+			{
+				float xf = reinterpret_int_float(int32_t(i)), yf = root_i<ROOT>(xf);
+				float error = (approx(xf) - yf) / yf;
+				if (std::abs(error) > std::abs(worst_error)) worst_error = error;
+			}
+			return worst_error;
+		}
+
+		template<bool VECTOR>
+		struct worst_case_
+		{
+			template<int ROOT, int N, unsigned NewtonSteps>
+			static float run(const RootApprox<N, float, NewtonSteps> &approx, float range_min, float range_max)
+				{return worst_case_scan<ROOT>(approx, range_min, range_max);}
+		};
+		template<>
+		struct worst_case_<false>
+		{
+			template<int ROOT, int N, unsigned NewtonSteps>
+			static float run(const RootApprox<N, float, NewtonSteps> &approx, float range_min, float range_max)
+				{return Test_Root_Approx_WorstCase<ROOT>(approx, range_min, range_max);}
+		};
+	}
+
+	template<int ROOT, int N, unsigned NewtonSteps>
+	float Test_Root_Approx_WorstCase_SIMD(
+		const RootApprox<N, float, NewtonSteps> &approx,
+		float range_min,
+		float range_max)
+	{
+		static const bool vector =
+			(simd::native_ops<float>::width > 1) &&
+			(N >= -4 && N <= 4) &&
+			(ROOT >= -4 && ROOT <= 4);
+		return simd::worst_case_<vector>::template run<ROOT>(approx, range_min, range_max);
+	}
+
+	template<int N, typename T_Float, unsigned NewtonSteps>
+	void RootApprox<N, T_Float, NewtonSteps>::apply(const float_t *y, float_t *x, size_t count) const
+		{simd::root_batch<false>(*this, y, x, count);}
+	template<int N, typename T_Float, unsigned NewtonSteps>
+	void RootApprox<N, T_Float, NewtonSteps>::apply(float_t *yx, size_t count) const
+		{simd::root_batch<false>(*this, yx, yx, count);}
+	template<int N, typename T_Float, unsigned NewtonSteps>
+	void RootApprox<N, T_Float, NewtonSteps>::apply_aligned(const float_t *y, float_t *x, size_t count) const
+		{simd::root_batch<true>(*this, y, x, count);}
+	template<int N, typename T_Float, unsigned NewtonSteps>
+	void RootApprox<N, T_Float, NewtonSteps>::apply_aligned(float_t *yx, size_t count) const
+		{simd::root_batch<true>(*this, yx, yx, count);}
+
+
+	/*
+		The designs published in README.md.  The float designs are those in
+		root_cellar_generated.h; the double designs use the 64-bit table and
+		were searched on APPROX_WORST_CASE, as exhaustive scans are out of reach.
+		The 16-bit designs were found by RootApprox_Best_Exhaustive.
+		Supports N in {±2, ±3, ±4} and 0-2 refinement steps, or 0-1 for
+		bfloat16, where a second step stays within rounding of the first.
+	*/
+	namespace detail
+	{
+		template<typename T_Float> struct tuned_design {float_as_int_t<T_Float> k; T_Float m;};
+
+		inline int tuned_row(const int N)    {return 2*((N<0 ? -N : N) - 2) + (N<0);}
+
+		inline const tuned_design<float> &tuned(const int N, const unsigned steps, float)
+		{
+			static const tuned_design<float> table[6][3] =
+			{
+				{{0x1fbb4f2e, +.5f      }, {0x1fbed49a, +.510929f}, {0x1fbb75ad, +.500122f}},
+				{{0x5f37642f, -.5f      }, {0x5f32a121, -.535102f}, {0x5f3634f9, -.501326f}},
+				{{0x2a510680, +1.f/3.f  }, {0x2a543aa3, +.347252f}, {0x2a4fcd03, +.333818f}},
+				{{0x54a232a3, -1.f/3.f  }, {0x549da7bf, -.364707f}, {0x54a1b99d, -.334677f}},
+				{{0x2f9b374e, +.25f     }, {0x2f9ed7c0, +.266598f}, {0x2f9b8068, +.250534f}},
+				{{0x4f58605b, -.25f     }, {0x4f542107, -.277446f}, {0x4f58020d, -.251282f}},
+			};
+			return table[tuned_row(N)][steps];
+		}
+		inline const tuned_design<double> &tuned(const int N, const unsigned steps, double)
+		{
+			static const tuned_design<double> table[6][3] =
+			{
+				{{0x1ff769e5b00cb024, +.5     }, {0x1ff7da9258189b10, +.51093 }, {0x1ff76e33f8e94831, +.500124}},
+				{{0x5fe6ec85e7de30da, -.5     }, {0x5fe65423e81eece9, -.535103}, {0x5fe6bbf0c11e182d, -.501434}},
+				{{0x2a9f76253119d328, +1./3.  }, {0x2a9fdca8d39b1833, +.347251}, {0x2a9f5317d3f76c27, +.333791}},
+				{{0x553ef0ff289dd794, -1./3.  }, {0x553e5fa2bf4bb94e, -.364707}, {0x553eb1a359e5ec49, -.335169}},
+				{{0x2ff366e9846f3cf9, +.25    }, {0x2ff3daf850a16998, +.266598}, {0x2ff3578de1c1dc42, +.250729}},
+				{{0x4feb0c0b7fa996ad, -.25    }, {0x4fea8420dfe0c1b2, -.277446}, {0x4feaff5406bb3437, -.251281}},
+			};
+			return table[tuned_row(N)][steps];
+		}
+		// The basis tuned() designs of each type were searched on
+		inline BEST_APPROX_BASIS tuned_basis(float)       {return BEST_WORST_CASE;}
+		inline BEST_APPROX_BASIS tuned_basis(double)      {return APPROX_WORST_CASE;}
+		inline BEST_APPROX_BASIS tuned_basis(float16)     {return BEST_WORST_CASE;}
+		inline BEST_APPROX_BASIS tuned_basis(bfloat16)    {return BEST_WORST_CASE;}
+
+		inline const tuned_design<float16> &tuned(const int N, const unsigned steps, float16)
+		{
+			static const tuned_design<float16> table[6][3] =
+			{
+				{{0x1ddb, +.5f      }, {0x1dff, +.511719f }, {0x1dd3, +.5f      }},
+				{{0x59bb, -.5f      }, {0x5997, -.533203f }, {0x59a6, -.5f      }},
+				{{0x27de, +1.f/3.f  }, {0x27fd, +.347168f }, {0x27ea, +.341309f }},
+				{{0x4fbc, -1.f/3.f  }, {0x4f93, -.369629f }, {0x4f96, -.344727f }},
+				{{0x2cda, +.25f     }, {0x2cfb, +.268799f }, {0x2cc5, +.25293f  }},
+				{{0x4ac2, -.25f     }, {0x4aab, -.269043f }, {0x4aa0, -.267578f }},
+			};
+			return table[tuned_row(N)][steps];
+		}
+		inline const tuned_design<bfloat16> &tuned(const int N, const unsigned steps, bfloat16)
+		{
+			static const tuned_design<bfloat16> table[6][2] =
+			{
+				{{0x1fbc, +.5f      }, {0x1fbc, +.5f      }},
+				{{0x5f37, -.5f      }, {0x5f38, -.5f      }},
+				{{0x2a51, +1.f/3.f  }, {0x2a56, +.347656f }},
+				{{0x54a2, -1.f/3.f  }, {0x54a3, -.333984f }},
+				{{0x2f9c, +.25f     }, {0x2f9f, +.261719f }},
+				{{0x4f58, -.25f     }, {0x4f58, -.255859f }},
+			};
+			return table[tuned_row(N)][steps];
+		}
+
+		// The most refinement steps tuned() has designs for
+		template<typename T_Float> struct tuned_steps           {static const unsigned value = 2;};
+		template<>                 struct tuned_steps<bfloat16> {static const unsigned value = 1;};
+	}
+
+	template<int N, typename T_Float, unsigned NewtonSteps = 1>
+	RootApprox<N, T_Float, NewtonSteps> RootApprox_Tuned()
+	{
+		static const int DEG = ((N>0) ? N : -N);
+		static_assert(DEG >= 2 && DEG <= 4, "no published design for this root index");
+		static_assert(NewtonSteps <= detail::tuned_steps<T_Float>::value, "no published design for this many refinements");
+
+		const auto &design = detail::tuned(N, NewtonSteps, T_Float());
+		return RootApprox<N, T_Float, NewtonSteps>(design.k, design.m);
+	}
+
+
+	/*
+		Batch versions of the rb_* functions, using the published designs.
+		For example, rb_root<-2>(y, x, count) is a batch rb_inv_2_root and
+		rb_root<3,2>(y, x, count) is a batch rb2_3_root.
+	*/
+	template<int N, unsigned NewtonSteps = 1, typename T_Float>
+	void rb_root(const T_Float *y, T_Float *x, size_t count)
+	{
+		static const RootApprox<N, T_Float, NewtonSteps> design = RootApprox_Tuned<N, T_Float, NewtonSteps>();
+		design.apply(y, x, count);
+	}
+	template<int N, unsigned NewtonSteps = 1, typename T_Float>
+	void rb_root(T_Float *yx, size_t count)
+	{
+		static const RootApprox<N, T_Float, NewtonSteps> design = RootApprox_Tuned<N, T_Float, NewtonSteps>();
+		design.apply(yx, count);
+	}
+	template<int N, unsigned NewtonSteps = 1, typename T_Float>
+	void rb_root_aligned(const T_Float *y, T_Float *x, size_t count)
+	{
+		static const RootApprox<N, T_Float, NewtonSteps> design = RootApprox_Tuned<N, T_Float, NewtonSteps>();
+		design.apply_aligned(y, x, count);
+	}
+}
@@ -0,0 +1,528 @@
+#pragma once
+
+
+#include <cstdint>
+#include <cstddef>
+#include <cstdio>
+#include <cstring>
+#include <cmath>
+#include <chrono>
+#include <random>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <ostream>
+#include <iomanip>
+
+#if defined(_MSC_VER) && !defined(__clang__)
+	#include <intrin.h>
+#endif
+
+#if defined(__linux__)
+	#include <unistd.h>
+	#include <sys/ioctl.h>
+	#include <sys/syscall.h>
+	#include <linux/perf_event.h>
+	#define ROOTBEER_PERF_EVENTS 1
+#endif
+
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+	#include <cpuid.h>
+#endif
+
+#include "root_cellar.h"
+
+
+/*
+	Microbenchmarks of float functions, in nanoseconds per element.
+
+	Each function is timed in two loops over arrays of several sizes:
+		latency:     each input depends on the previous output, so calls run
+		             one after another, as in a dependent chain of math.
+		throughput:  inputs are independent and outputs go to a second array,
+		             so calls overlap (and may be vectorized by the compiler).
+	Sizes default to arrays that fit in L1, in L2 and in neither.  Batch
+	functions, which take whole arrays, are timed for throughput only.
+
+	Every timing follows untimed warmup passes and is repeated; the median,
+	mean, standard deviation and minimum of the repetitions are reported.
+	Outputs pass through an optimization barrier so the loops can't be deleted.
+
+	On Linux, hardware counters are read with perf_event_open over the timed
+	repetitions: cycles, instructions, branch misses and retired micro-ops
+	(AMD and Intel only), per element.  Counters the kernel refuses --- as in
+	containers without perf permissions --- are reported as unavailable.
+*/
+namespace rootbeer
+{
+	enum BENCH_MODE
+	{
+		BENCH_LATENCY,
+		BENCH_THROUGHPUT,
+	};
+
+	inline const char *Bench_Mode_Name(const BENCH_MODE mode)
+	{
+		return (mode == BENCH_LATENCY) ? "latency" : "throughput";
+	}
+
+	struct Bench_Options
+	{
+		// Array sizes in elements: 16 KiB, 256 KiB and 32 MiB of floats.
+		std::vector<size_t> sizes = {size_t(1) << 12, size_t(1) << 16, size_t(1) << 23};
+
+		unsigned warmup      = 2;    // Untimed repetitions before timing
+		unsigned repetitions = 15;   // Timed repetitions
+
+		// Smaller arrays are passed over repeatedly to make up this many elements per repetition.
+		size_t min_elements = size_t(1) << 20;
+
+		// Inputs are spread log-uniformly over this range.
+		float range_min = 1.f / 16.f, range_max = 16.f;
+
+		// Read hardware performance counters where available.
+		bool counters = true;
+	};
+
+	/*
+		Hardware events per element; NaN where a counter is unavailable.
+	*/
+	struct Bench_Counters
+	{
+		double cycles        = NAN;
+		double instructions  = NAN;
+		double branch_misses = NAN;
+		double uops          = NAN;
+
+		double ipc() const     {return instructions / cycles;}
+		bool   any() const     {return !(std::isnan(cycles) && std::isnan(instructions) && std::isnan(branch_misses) && std::isnan(uops));}
+	};
+
+	struct Bench_Result
+	{
+		std::string    name;
+		BENCH_MODE     mode;
+		size_t         size;          // elements per array
+		unsigned       repetitions;
+		double         median, mean, stddev, min;  // nanoseconds per element
+		Bench_Counters counters;
+	};
+
+	namespace detail
+	{
+		/*
+			Optimization barriers.  do_not_optimize forces a value to be computed
+			and treats it as possibly modified; clobber_memory forces pending stores.
+		*/
+#if defined(__GNUC__) || defined(__clang__)
+		template<typename T>
+		inline void do_not_optimize(T &value)    {asm volatile("" : "+m"(value) : : "memory");}
+		inline void clobber_memory()              {asm volatile("" : : : "memory");}
+#else
+		template<typename T>
+		inline void do_not_optimize(T &value)
+		{
+			volatile T sink = value;
+			value = sink;
+			_ReadWriteBarrier();
+		}
+		inline void clobber_memory()              {_ReadWriteBarrier();}
+#endif
+
+		/*
+			Raw event for retired micro-ops, which perf has no generic name for.
+			Zero if the vendor is not recognized.
+		*/
+		inline uint64_t perf_uops_event()
+		{
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+			unsigned eax, ebx, ecx, edx;
+			if (!__get_cpuid(0, &eax, &ebx, &ecx, &edx)) return 0;
+			if (ebx == 0x68747541) return 0x00c1;  // "Auth"enticAMD: Retired Ops
+			if (ebx == 0x756e6547) return 0x02c2;  // "Genu"ineIntel: UOPS_RETIRED.RETIRE_SLOTS
+#endif
+			return 0;
+		}
+
+		/*
+			Counters for the calling thread, each opened separately so that one
+			missing event doesn't lose the others.  Multiplexed counts are scaled
+			by the fraction of time each counter was running.
+		*/
+		class perf_counters
+		{
+		public:
+			enum {CYCLES, INSTRUCTIONS, BRANCH_MISSES, UOPS, EVENT_COUNT};
+
+			explicit perf_counters(const bool enable)
+			{
+				for (int &f : fd) f = -1;
+#if ROOTBEER_PERF_EVENTS
+				if (!enable) return;
+				fd[CYCLES]        = open(PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES);
+				fd[INSTRUCTIONS]  = open(PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS);
+				fd[BRANCH_MISSES] = open(PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES);
+				if (uint64_t uops = perf_uops_event()) fd[UOPS] = open(PERF_TYPE_RAW, uops);
+#else
+				(void) enable;
+#endif
+			}
+			~perf_counters()
+			{
+#if ROOTBEER_PERF_EVENTS
+				for (int f : fd) if (f >= 0) ::close(f);
+#endif
+			}
+			perf_counters(const perf_counters&) = delete;
+			perf_counters &operator=(const perf_counters&) = delete;
+
+			bool available() const    {for (int f : fd) if (f >= 0) return true; return false;}
+
+			void start()
+			{
+#if ROOTBEER_PERF_EVENTS
+				for (int f : fd) if (f >= 0) {ioctl(f, PERF_EVENT_IOC_RESET, 0); ioctl(f, PERF_EVENT_IOC_ENABLE, 0);}
+#endif
+			}
+			void stop()
+			{
+#if ROOTBEER_PERF_EVENTS
+				for (int f : fd) if (f >= 0) ioctl(f, PERF_EVENT_IOC_DISABLE, 0);
+#endif
+			}
+
+			// Counts since start(), divided by the number of elements processed
+			Bench_Counters read(const double elements) const
+			{
+				Bench_Counters c;
+				c.cycles        = per_element(fd[CYCLES],        elements);
+				c.instructions  = per_element(fd[INSTRUCTIONS],  elements);
+				c.branch_misses = per_element(fd[BRANCH_MISSES], elements);
+				c.uops          = per_element(fd[UOPS],          elements);
+				return c;
+			}
+
+		private:
+			int fd[EVENT_COUNT];
+
+#if ROOTBEER_PERF_EVENTS
+			static int open(const uint32_t type, const uint64_t config)
+			{
+				perf_event_attr attr;
+				std::memset(&attr, 0, sizeof(attr));
+				attr.size           = sizeof(attr);
+				attr.type           = type;
+				attr.config         = config;
+				attr.disabled       = 1;
+				attr.exclude_kernel = 1;
+				attr.exclude_hv     = 1;
+				attr.read_format    = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+				return int(syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0));
+			}
+#endif
+
+			static double per_element(const int f, const double elements)
+			{
+#if ROOTBEER_PERF_EVENTS
+				uint64_t value[3];  // count, time enabled, time running
+				if (f < 0 || ::read(f, value, sizeof(value)) != ssize_t(sizeof(value)) || !value[2]) return NAN;
+				return double(value[0]) * (double(value[1]) / double(value[2])) / elements;
+#else
+				(void) f; (void) elements;
+				return NAN;
+#endif
+			}
+		};
+
+		inline Bench_Result bench_summarize(std::string name, const BENCH_MODE mode, const size_t size, std::vector<double> samples)
+		{
+			Bench_Result r{std::move(name), mode, size, unsigned(samples.size()), 0.0, 0.0, 0.0, 0.0, Bench_Counters()};
+			if (samples.empty()) return r;
+
+			std::sort(samples.begin(), samples.end());
+			const size_t n = samples.size();
+			r.median = (n & 1) ? samples[n/2] : .5 * (samples[n/2 - 1] + samples[n/2]);
+			r.min = samples[0];
+			for (double s : samples) r.mean += s;
+			r.mean /= double(n);
+			double sum_sq = 0.0;
+			for (double s : samples) sum_sq += (s - r.mean) * (s - r.mean);
+			r.stddev = (n > 1) ? std::sqrt(sum_sq / double(n - 1)) : 0.0;
+			return r;
+		}
+	}
+
+
+	/*
+		Runs benchmarks and collects their results.  Inputs for each size are
+		generated once, from a fixed seed, and shared by every function.
+	*/
+	class Bench_Suite
+	{
+	public:
+		Bench_Options             options;
+		std::vector<Bench_Result> results;
+
+		explicit Bench_Suite(const Bench_Options &_options = Bench_Options()) :
+			options(_options), counters(_options.counters)
+		{
+			std::mt19937 random(0x5eed);
+			std::uniform_real_distribution<float> log_y(std::log2(options.range_min), std::log2(options.range_max));
+
+			size_t largest = 0;
+			for (size_t size : options.sizes) largest = std::max(largest, size);
+
+			inputs.resize(largest);
+			outputs.resize(largest);
+			for (auto &y : inputs) y = std::exp2(log_y(random));
+		}
+
+		/*
+			Time a float -> float function in latency and throughput loops at every size.
+		*/
+		template<typename T_Func>
+		void scalar(const char *name, const T_Func &func)
+		{
+			// Each output feeds the next input through a mask which is zero
+			//   but unknown to the compiler, leaving the input's value unchanged.
+			auto chain = [&](const float *y, float*, const size_t n)
+			{
+				int32_t chain_mask = 0;
+				detail::do_not_optimize(chain_mask);
+				float x = 0.f;
+				for (size_t i = 0; i < n; ++i)
+				{
+					const int32_t bits = reinterpret_float_int(y[i]) | (reinterpret_float_int(x) & chain_mask);
+					x = func(reinterpret_int_float(bits));
+				}
+				detail::do_not_optimize(x);
+			};
+			auto independent = [&](const float *y, float *x, const size_t n)
+			{
+				for (size_t i = 0; i < n; ++i) x[i] = func(y[i]);
+				detail::clobber_memory();
+			};
+
+			for (size_t size : options.sizes) results.push_back(time(name, BENCH_LATENCY,    size, chain));
+			for (size_t size : options.sizes) results.push_back(time(name, BENCH_THROUGHPUT, size, independent));
+		}
+
+		/*
+			Time a batch function (y, x, count) at every size.
+		*/
+		template<typename T_Func>
+		void batch(const char *name, const T_Func &func)
+		{
+			auto whole = [&](const float *y, float *x, const size_t n)
+			{
+				func(y, x, n);
+				detail::clobber_memory();
+			};
+
+			for (size_t size : options.sizes) results.push_back(time(name, BENCH_THROUGHPUT, size, whole));
+		}
+
+		// Whether any hardware counter could be opened
+		bool counters_available() const    {return counters.available();}
+
+	private:
+		std::vector<float>    inputs, outputs;
+		detail::perf_counters counters;
+
+		template<typename T_Loop>
+		Bench_Result time(const char *name, const BENCH_MODE mode, const size_t size, const T_Loop &loop)
+		{
+			using clock = std::chrono::steady_clock;
+
+			const size_t passes = std::max<size_t>(1, options.min_elements / size);
+			const float *y = inputs.data();
+			float *x = outputs.data();
+
+			auto repetition = [&]()
+			{
+				for (size_t p = 0; p < passes; ++p)
+				{
+					detail::do_not_optimize(y);
+					loop(y, x, size);
+				}
+			};
+
+			for (unsigned i = 0; i < options.warmup; ++i) repetition();
+
+			std::vector<double> samples;
+			counters.start();
+			for (unsigned i = 0; i < options.repetitions; ++i)
+			{
+				const auto start = clock::now();
+				repetition();
+				const auto end = clock::now();
+				samples.push_back(std::chrono::duration<double, std::nano>(end - start).count() / double(passes * size));
+			}
+			counters.stop();
+
+			Bench_Result result = detail::bench_summarize(name, mode, size, std::move(samples));
+			result.counters = counters.read(double(options.repetitions) * double(passes * size));
+			return result;
+		}
+	};
+
+
+	namespace detail
+	{
+		// Write a number, or a placeholder if it is NaN
+		inline void bench_number(std::ostream &out, const double value, const char *missing)
+		{
+			if (std::isnan(value)) out << missing;
+			else                   out << value;
+		}
+
+		// Write a string as a quoted CSV field, doubling quotes (RFC 4180)
+		inline void bench_csv_string(std::ostream &out, const std::string &value)
+		{
+			out << '"';
+			for (char ch : value)
+			{
+				if (ch == '"') out << '"';
+				out << ch;
+			}
+			out << '"';
+		}
+
+		// Write a string as a quoted JSON string, escaping quotes, backslashes and control characters
+		inline void bench_json_string(std::ostream &out, const std::string &value)
+		{
+			out << '"';
+			for (char ch : value)
+			{
+				const unsigned char u = static_cast<unsigned char>(ch);
+				if      (ch == '"')  out << "\\\"";
+				else if (ch == '\\') out << "\\\\";
+				else if (ch == '\n') out << "\\n";
+				else if (ch == '\t') out << "\\t";
+				else if (u < 0x20)
+				{
+					char code[8];
+					std::snprintf(code, sizeof(code), "\\u%04x", unsigned(u));
+					out << code;
+				}
+				else out << ch;
+			}
+			out << '"';
+		}
+	}
+
+	/*
+		Machine-readable output: one row or object per result.
+		Counters are per element; unavailable ones are empty or null.
+	*/
+	inline std::ostream &Print_Bench_CSV(std::ostream &out, const std::vector<Bench_Result> &results)
+	{
+		out << "name,mode,elements,repetitions,median_ns,mean_ns,stddev_ns,min_ns,cycles,instructions,ipc,branch_misses,uops\n";
+		for (auto &r : results)
+		{
+			const Bench_Counters &c = r.counters;
+			detail::bench_csv_string(out, r.name);
+			out << ',' << Bench_Mode_Name(r.mode) << ',' << std::dec << r.size << ',' << r.repetitions
+				<< std::setprecision(6) << ',' << r.median << ',' << r.mean << ',' << r.stddev << ',' << r.min;
+			for (double v : {c.cycles, c.instructions, c.ipc(), c.branch_misses, c.uops})
+			{
+				out << ',';
+				detail::bench_number(out, v, "");
+			}
+			out << '\n';
+		}
+		return out;
+	}
+
+	inline std::ostream &Print_Bench_JSON(std::ostream &out, const std::vector<Bench_Result> &results)
+	{
+		out << "[\n";
+		for (size_t i = 0; i < results.size(); ++i)
+		{
+			const Bench_Result &r = results[i];
+			const Bench_Counters &c = r.counters;
+			out << "\t{\"name\": ";
+			detail::bench_json_string(out, r.name);
+			out << ", \"mode\": \"" << Bench_Mode_Name(r.mode)
+				<< "\", \"elements\": " << std::dec << r.size << ", \"repetitions\": " << r.repetitions
+				<< std::setprecision(6)
+				<< ", \"median_ns\": " << r.median << ", \"mean_ns\": " << r.mean
+				<< ", \"stddev_ns\": " << r.stddev << ", \"min_ns\": " << r.min;
+			out << ", \"cycles\": ";        detail::bench_number(out, c.cycles,        "null");
+			out << ", \"instructions\": ";  detail::bench_number(out, c.instructions,  "null");
+			out << ", \"ipc\": ";           detail::bench_number(out, c.ipc(),         "null");
+			out << ", \"branch_misses\": "; detail::bench_number(out, c.branch_misses, "null");
+			out << ", \"uops\": ";          detail::bench_number(out, c.uops,          "null");
+			out << "}" << ((i + 1 < results.size()) ? "," : "") << "\n";
+		}
+		out << "]\n";
+		return out;
+	}
+}
+
+
+/*
+	Print a table with one row per function and mode, and the median time
+	(with standard deviation) for each size in columns.
+*/
+inline std::ostream &operator<<(std::ostream &out, const rootbeer::Bench_Suite &suite)
+{
+	using rootbeer::Bench_Result;
+	const std::vector<Bench_Result> &results = suite.results;
+	char cell[32];
+
+	out << std::dec << std::left << std::setw(20) << "function" << std::setw(12) << "mode" << std::right;
+	for (size_t size : suite.options.sizes)
+	{
+		std::snprintf(cell, sizeof(cell), "n=%zu", size);
+		out << std::setw(20) << cell;
+	}
+	out << "    (ns per element, median +- stddev)\n";
+
+	for (size_t i = 0, j; i < results.size(); i = j)
+	{
+		// Results for one function and mode are consecutive
+		for (j = i + 1; j < results.size() && results[j].name == results[i].name && results[j].mode == results[i].mode; ++j) {}
+
+		out << std::left << std::setw(20) << results[i].name << std::setw(12) << rootbeer::Bench_Mode_Name(results[i].mode) << std::right;
+		for (size_t size : suite.options.sizes)
+		{
+			std::snprintf(cell, sizeof(cell), "-");
+			for (size_t k = i; k < j; ++k)
+				if (results[k].size == size) std::snprintf(cell, sizeof(cell), "%8.3f +- %-7.3f", results[k].median, results[k].stddev);
+			out << std::setw(20) << cell;
+		}
+		out << '\n';
+	}
+
+	// Hardware counters, if any could be read
+	bool any_counters = false;
+	for (auto &r : results) any_counters = any_counters || r.counters.any();
+	if (!any_counters)
+	{
+		if (suite.options.counters) out << "(hardware counters unavailable)\n";
+		return out;
+	}
+
+	out << '\n' << std::left << std::setw(20) << "function" << std::setw(12) << "mode" << std::right << std::setw(10) << "n"
+		<< std::setw(10) << "cycles" << std::setw(10) << "instrs" << std::setw(8) << "IPC"
+		<< std::setw(12) << "br. misses" << std::setw(10) << "uops" << "    (per element)\n";
+	for (auto &r : results)
+	{
+		const rootbeer::Bench_Counters &c = r.counters;
+		out << std::left << std::setw(20) << r.name << std::setw(12) << rootbeer::Bench_Mode_Name(r.mode) << std::right << std::setw(10) << r.size;
+		auto column = [&](const int width, const char *format, const double value)
+		{
+			if (std::isnan(value)) std::snprintf(cell, sizeof(cell), "-");
+			else                   std::snprintf(cell, sizeof(cell), format, value);
+			out << std::setw(width) << cell;
+		};
+		column(10, "%.2f", c.cycles);
+		column(10, "%.2f", c.instructions);
+		column( 8, "%.2f", c.ipc());
+		column(12, "%.4f", c.branch_misses);
+		column(10, "%.2f", c.uops);
+		out << '\n';
+	}
+	return out;
+}
@@ -0,0 +1,365 @@
+#pragma once
+
+
+#include <cstdint>
+#include <cstddef>
+#include <cmath>
+#include <algorithm>
+#include <cstdlib>
+#include <array>
+#include <utility>
+#include <string>
+#include <vector>
+#include <ostream>
+#include <sstream>
+#include <iomanip>
+
+#include "root_cellar_batch.h"
+
+
+/*
+	A compile-time catalog of the published designs with their error, and
+	fast_root, which picks the cheapest design meeting an accuracy bound.
+
+		fast_root<-2, float, max_rel_error_e<1,-3>> inv_sqrt;   // 1e-3: rb_inv_2_root's design
+		x = inv_sqrt(y);
+		inv_sqrt.apply(y, x, count);
+
+	With C++20, max_rel_error<1e-3> is the same bound.  Designs are ranked by
+	their number of refinements, so a bound that one refinement meets never
+	gets a second.  If no design meets the bound, fast_root fails to compile.
+
+	The published designs' constants are those of RootApprox_Tuned.  After
+	them come two-refinement designs with a constant per refinement, from
+	RootApprox_Best_Steps; among designs with as many refinements the first
+	listed that meets the bound is picked, so these serve bounds that the
+	published designs miss.  Each design's worst-case error is certified by
+	RootApprox::error_worstCase_certified, and bounds are checked against
+	that.  The measured maximum, RMS and mean error are exhaustive over
+	test_param_range for float, against roots rounded to float as in
+	README.md, so the measured maximum may exceed the certified bound by
+	that rounding; double designs are sampled at 2^24 values.
+*/
+namespace rootbeer
+{
+	// The most refinements of any catalogued design
+	static const unsigned CATALOG_MAX_STEPS = 2;
+
+	struct Catalog_Design
+	{
+		int      root;
+		unsigned steps;
+		int      basis;      // BEST_APPROX_BASIS the design was searched for
+		uint64_t constant;
+		double   newton_m[CATALOG_MAX_STEPS];   // for each refinement, then 0
+
+		double   certified;  // bound on the magnitude of relative error
+		double   max_error;  // measured magnitude
+		double   rms_error;
+		double   mean_error;
+	};
+}
+
+// Generated by Print_Catalog_Table
+#include "root_cellar_catalog_table.h"
+
+namespace rootbeer
+{
+	/*
+		Catalogued designs of a float type, by index.
+	*/
+	template<typename T_Float>
+	constexpr size_t Catalog_Size()                  {return detail::catalog_table<T_Float>::size;}
+	template<typename T_Float>
+	constexpr Catalog_Design Catalog_Get(size_t i)   {return detail::catalog_table<T_Float>::design(i);}
+
+	/*
+		Find the design for a root and number of refinements,
+		returning Catalog_Size<T_Float>() if there is none.
+	*/
+	template<typename T_Float>
+	constexpr size_t Catalog_Find(const int N, const unsigned steps)
+	{
+		for (size_t i = 0; i < Catalog_Size<T_Float>(); ++i)
+		{
+			const Catalog_Design design = Catalog_Get<T_Float>(i);
+			if (design.root == N && design.steps == steps) return i;
+		}
+		return Catalog_Size<T_Float>();
+	}
+
+	/*
+		Find the design for a root with the fewest refinements that T_Requirement
+		accepts, returning Catalog_Size<T_Float>() if there is none.
+	*/
+	template<typename T_Float, typename T_Requirement>
+	constexpr size_t Catalog_Select(const int N)
+	{
+		size_t best = Catalog_Size<T_Float>();
+		for (size_t i = 0; i < Catalog_Size<T_Float>(); ++i)
+		{
+			const Catalog_Design design = Catalog_Get<T_Float>(i);
+			if (design.root != N || !T_Requirement::accepts(design)) continue;
+			if (best == Catalog_Size<T_Float>() || design.steps < Catalog_Get<T_Float>(best).steps) best = i;
+		}
+		return best;
+	}
+
+
+	/*
+		Requirements for Catalog_Select and fast_root.  Each accepts designs
+		whose error is at most DIGITS * 10^EXPONENT; max_rel_error bounds the
+		certified worst case and max_rms_error the measured RMS.
+		Other requirements need only a constexpr static accepts(Catalog_Design).
+	*/
+	namespace detail
+	{
+		constexpr double catalog_bound(const unsigned digits, const int exponent)
+		{
+			double scale = 1.0;
+			for (int e = (exponent < 0 ? -exponent : exponent); e > 0; --e) scale *= 10.0;
+			return (exponent < 0) ? double(digits) / scale : double(digits) * scale;
+		}
+	}
+
+	template<unsigned DIGITS, int EXPONENT>
+	struct max_rel_error_e
+	{
+		static constexpr double bound() {return detail::catalog_bound(DIGITS, EXPONENT);}
+		static constexpr bool accepts(const Catalog_Design &design) {return design.certified <= bound();}
+	};
+
+	template<unsigned DIGITS, int EXPONENT>
+	struct max_rms_error_e
+	{
+		static constexpr double bound() {return detail::catalog_bound(DIGITS, EXPONENT);}
+		static constexpr bool accepts(const Catalog_Design &design) {return design.rms_error <= bound();}
+	};
+
+#if defined(__cpp_nontype_template_args) && (__cpp_nontype_template_args >= 201911L)
+	template<double BOUND>
+	struct max_rel_error
+	{
+		static constexpr double bound() {return BOUND;}
+		static constexpr bool accepts(const Catalog_Design &design) {return design.certified <= bound();}
+	};
+
+	template<double BOUND>
+	struct max_rms_error
+	{
+		static constexpr double bound() {return BOUND;}
+		static constexpr bool accepts(const Catalog_Design &design) {return design.rms_error <= bound();}
+	};
+#endif
+
+
+	namespace detail
+	{
+		template<typename T_Float>
+		constexpr unsigned catalog_steps(const size_t index)
+		{
+			return (index < Catalog_Size<T_Float>()) ? Catalog_Get<T_Float>(index).steps : 0u;
+		}
+
+		template<typename T_Float, size_t... I>
+		constexpr std::array<T_Float, sizeof...(I)> catalog_newton_m(const Catalog_Design &design, std::index_sequence<I...>)
+		{
+			return {{T_Float(design.newton_m[I])...}};
+		}
+	}
+
+	/*
+		A catalogued design as a RootApprox, constructed with its constants.
+	*/
+	template<int N, typename T_Float, size_t INDEX>
+	struct RootApprox_Catalog : RootApprox<N, T_Float, detail::catalog_steps<T_Float>(INDEX)>
+	{
+		static_assert(INDEX < Catalog_Size<T_Float>(), "no catalogued design meets the requirement");
+
+		using base_t   = RootApprox<N, T_Float, detail::catalog_steps<T_Float>(INDEX)>;
+		using float_t  = typename base_t::float_t;
+		using as_int_t = typename base_t::as_int_t;
+
+		static constexpr Catalog_Design catalog()    {return Catalog_Get<T_Float>(INDEX);}
+
+		constexpr RootApprox_Catalog() : base_t(as_int_t(catalog().constant),
+			detail::catalog_newton_m<float_t>(catalog(), std::make_index_sequence<detail::catalog_steps<T_Float>(INDEX)>())) {}
+	};
+
+	/*
+		The cheapest catalogued design for x = y^(1/N) meeting T_Requirement.
+	*/
+	template<int N, typename T_Float, typename T_Requirement>
+	using fast_root = RootApprox_Catalog<N, T_Float, Catalog_Select<T_Float, T_Requirement>(N)>;
+
+
+	namespace detail
+	{
+		/*
+			Measure a double design at evenly spaced representations in a range,
+			against roots in double precision.
+		*/
+		template<int N, typename T_Approx>
+		PowApprox_Stats catalog_sample(const T_Approx &approx, const double range_min, const double range_max,
+			const uint64_t samples = uint64_t(1) << 24)
+		{
+			const uint64_t
+				ib = uint64_t(reinterpret_float_int(range_min)),
+				ie = uint64_t(reinterpret_float_int(range_max)),
+				stride = std::max<uint64_t>((ie - ib) / samples, 1);
+			PowApprox_Accumulator acc;
+			for (uint64_t i = ib; i < ie; i += stride)
+			{
+				const double y = reinterpret_int_float(int64_t(i)), exact = root_i<N>(y);
+				acc.add((double(approx(y)) - exact) / exact, y);
+			}
+			return acc.stats();
+		}
+	}
+
+	/*
+		Measure a design for the catalog, recording the basis it was searched for.
+		Float measurements run on the executor's threads.
+	 */
+	template<int N, typename T_Float, unsigned NewtonSteps, typename T_Executor>
+	Catalog_Design Catalog_Measure(const RootApprox<N, T_Float, NewtonSteps> &design, const BEST_APPROX_BASIS basis,
+		T_Executor &&executor)
+	{
+		static_assert(NewtonSteps <= CATALOG_MAX_STEPS, "too many refinements for the catalog");
+		const auto range = design.test_param_range();
+		const PowApprox_Stats stats = (sizeof(T_Float) <= 4)
+			? Test_Root_Approx<N>(design, range.first, range.second, executor)
+			: detail::catalog_sample<N>(design, double(range.first), double(range.second));
+
+		Catalog_Design entry = {};
+		entry.root       = N;
+		entry.steps      = NewtonSteps;
+		entry.basis      = int(basis);
+		entry.constant   = uint64_t(design.constant);
+		for (unsigned s = 0; s < NewtonSteps; ++s) entry.newton_m[s] = double(design.newton_m[s]);
+		entry.certified  = double(design.error_worstCase_certified());
+		entry.max_error  = std::max(-stats.min_error, stats.max_error);
+		entry.rms_error  = std::sqrt(stats.mean_sq_error);
+		entry.mean_error = stats.mean_error;
+		return entry;
+	}
+
+	/*
+		Measure a published design for the catalog.
+	 */
+	template<typename T_Float, int N, unsigned NewtonSteps, typename T_Executor>
+	Catalog_Design Catalog_Measure(T_Executor &&executor)
+	{
+		return Catalog_Measure(RootApprox_Tuned<N, T_Float, NewtonSteps>(), detail::tuned_basis(T_Float()), executor);
+	}
+
+	namespace detail
+	{
+		template<typename T_Float, unsigned NewtonSteps, typename T_Executor>
+		void catalog_measure_family(std::vector<Catalog_Design> &designs, T_Executor &&executor)
+		{
+			designs.push_back(Catalog_Measure<T_Float,  2, NewtonSteps>(executor));
+			designs.push_back(Catalog_Measure<T_Float, -2, NewtonSteps>(executor));
+			designs.push_back(Catalog_Measure<T_Float,  3, NewtonSteps>(executor));
+			designs.push_back(Catalog_Measure<T_Float, -3, NewtonSteps>(executor));
+			designs.push_back(Catalog_Measure<T_Float,  4, NewtonSteps>(executor));
+			designs.push_back(Catalog_Measure<T_Float, -4, NewtonSteps>(executor));
+		}
+
+		// Search and measure the designs with a constant per refinement
+		template<typename T_Float, unsigned NewtonSteps, typename T_Executor>
+		void catalog_search_family(std::vector<Catalog_Design> &designs, T_Executor &&executor)
+		{
+			designs.push_back(Catalog_Measure(RootApprox_Best_Steps< 2, T_Float, NewtonSteps>(executor), CERTIFIED_WORST_CASE, executor));
+			designs.push_back(Catalog_Measure(RootApprox_Best_Steps<-2, T_Float, NewtonSteps>(executor), CERTIFIED_WORST_CASE, executor));
+			designs.push_back(Catalog_Measure(RootApprox_Best_Steps< 3, T_Float, NewtonSteps>(executor), CERTIFIED_WORST_CASE, executor));
+			designs.push_back(Catalog_Measure(RootApprox_Best_Steps<-3, T_Float, NewtonSteps>(executor), CERTIFIED_WORST_CASE, executor));
+			designs.push_back(Catalog_Measure(RootApprox_Best_Steps< 4, T_Float, NewtonSteps>(executor), CERTIFIED_WORST_CASE, executor));
+			designs.push_back(Catalog_Measure(RootApprox_Best_Steps<-4, T_Float, NewtonSteps>(executor), CERTIFIED_WORST_CASE, executor));
+		}
+
+		// Round up to 6 significant digits, as printed, so that bounds stay bounds
+		inline double catalog_round_up(const double v)
+		{
+			if (!(v > 0.0)) return v;
+			const double scale = std::pow(10.0, 5.0 - std::floor(std::log10(v)));
+			return std::ceil(v * scale * (1.0 + 1e-15)) / scale;
+		}
+
+		// Fewest significant digits that read back as the same T_Float
+		template<typename T_Float>
+		std::string catalog_shortest(const double v)
+		{
+			std::ostringstream text;
+			for (int digits = 6; ; ++digits)
+			{
+				text.str("");
+				text << std::setprecision(digits) << v;
+				if (digits >= 17 || T_Float(std::strtod(text.str().c_str(), nullptr)) == T_Float(v)) return text.str();
+			}
+		}
+
+		template<typename T_Float, typename T_Executor>
+		void print_catalog_table(std::ostream &out, T_Executor &&executor)
+		{
+			std::vector<Catalog_Design> designs;
+			catalog_measure_family<T_Float, 0>(designs, executor);
+			catalog_measure_family<T_Float, 1>(designs, executor);
+			catalog_measure_family<T_Float, 2>(designs, executor);
+			catalog_search_family <T_Float, 2>(designs, executor);
+
+			const int hex_digits = int(2 * sizeof(T_Float));
+			out << std::dec << "\n"
+				"\t\ttemplate<> struct catalog_table<" << float_traits<T_Float>::name() << ">\n"
+				"\t\t{\n"
+				"\t\t\tstatic const size_t size = " << designs.size() << ";\n"
+				"\t\t\tstatic constexpr Catalog_Design design(const size_t i)\n"
+				"\t\t\t{\n"
+				"\t\t\t\t// root, steps, basis, k, m per refinement, certified, max, RMS, mean\n"
+				"\t\t\t\tconst Catalog_Design table[" << designs.size() << "] =\n"
+				"\t\t\t\t{\n";
+			for (auto &d : designs)
+			{
+				out << "\t\t\t\t\t{" << std::dec << std::setw(2) << d.root << ", " << d.steps << ", " << d.basis
+					<< ", 0x" << std::hex << std::setfill('0') << std::setw(hex_digits) << d.constant
+					<< std::dec << std::setfill(' ') << ", {";
+				for (unsigned s = 0; s < CATALOG_MAX_STEPS; ++s) out << (s ? ", " : "") << catalog_shortest<T_Float>(d.newton_m[s]);
+				out << "}" << std::setprecision(6) << ", " << catalog_round_up(d.certified) << ", " << d.max_error << ", " << d.rms_error << ", " << d.mean_error << "},\n";
+			}
+			out << "\t\t\t\t};\n"
+				"\t\t\t\treturn table[i];\n"
+				"\t\t\t}\n"
+				"\t\t};\n";
+		}
+	}
+
+	/*
+		Emit root_cellar_catalog_table.h, measuring the published designs.
+	 */
+	template<typename T_Executor>
+	std::ostream &Print_Catalog_Table(std::ostream &out, T_Executor &&executor)
+	{
+		out << "#pragma once\n"
+			"#include <stddef.h>\n"
+			"\n"
+			"/*\n"
+			"\tThe published designs for rootbeer::fast_root, generated by Print_Catalog_Table.\n"
+			"\tErrors are relative; certified bounds are rounded up and measurements to 6 digits.\n"
+			"*/\n"
+			"namespace rootbeer\n"
+			"{\n"
+			"\tnamespace detail\n"
+			"\t{\n"
+			"\t\ttemplate<typename T_Float> struct catalog_table {};\n";
+		detail::print_catalog_table<float>(out, executor);
+		detail::print_catalog_table<double>(out, executor);
+		out << "\t}\n"
+			"}\n";
+		return out;
+	}
+
+	inline std::ostream &Print_Catalog_Table(std::ostream &out)
+	{
+		return Print_Catalog_Table(out, SerialExecutor());
+	}
+}
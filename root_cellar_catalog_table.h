@@ -0,0 +1,88 @@
+#pragma once
+#include <stddef.h>
+
+/*
+	The published designs for rootbeer::fast_root, generated by Print_Catalog_Table.
+	Errors are relative; certified bounds are rounded up and measurements to 6 digits.
+*/
+namespace rootbeer
+{
+	namespace detail
+	{
+		template<typename T_Float> struct catalog_table {};
+
+		template<> struct catalog_table<float>
+		{
+			static const size_t size = 24;
+			static constexpr Catalog_Design design(const size_t i)
+			{
+				// root, steps, basis, k, m per refinement, certified, max, RMS, mean
+				const Catalog_Design table[24] =
+				{
+					{ 2, 0, 0, 0x1fbb4f2e, {0, 0}, 0.0347475, 0.0347475, 0.0189205, -0.00536095},
+					{-2, 0, 0, 0x5f37642f, {0, 0}, 0.034213, 0.0342129, 0.0252809, 0.0132797},
+					{ 3, 0, 0, 0x2a510680, {0, 0}, 0.0315548, 0.0315547, 0.0186464, 0.00332532},
+					{-3, 0, 0, 0x54a232a3, {0, 0}, 0.0342406, 0.0342406, 0.020435, 0.00730808},
+					{ 4, 0, 0, 0x2f9b374e, {0, 0}, 0.0342323, 0.0342323, 0.0186813, 0.00405848},
+					{-4, 0, 0, 0x4f58605b, {0, 0}, 0.0312108, 0.0312108, 0.0203653, 0.00857312},
+					{ 2, 1, 0, 0x1fbed49a, {0.510929, 0}, 0.00023919, 0.000239141, 0.000151795, -4.5947e-05},
+					{-2, 1, 0, 0x5f32a121, {-0.535102, 0}, 0.000773586, 0.000773447, 0.000502813, -2.5526e-05},
+					{ 3, 1, 0, 0x2a543aa3, {0.347252, 0}, 0.000430174, 0.000430155, 0.000250799, -0.000100652},
+					{-3, 1, 0, 0x549da7bf, {-0.364707, 0}, 0.00102722, 0.00102721, 0.00076144, 0.000275908},
+					{ 4, 1, 0, 0x2f9ed7c0, {0.266598, 0}, 0.000714133, 0.00071407, 0.000441487, -0.000217297},
+					{-4, 1, 0, 0x4f542107, {-0.277446, 0}, 0.00110853, 0.00110853, 0.000781442, 0.000170876},
+					{ 2, 2, 0, 0x1fbb75ad, {0.500122, 0.500122}, 1.83552e-07, 1.75185e-07, 4.87296e-08, -1.42089e-08},
+					{-2, 2, 0, 0x5f3634f9, {-0.501326, -0.501326}, 1.43788e-06, 1.46471e-06, 9.49438e-07, 7.19818e-07},
+					{ 3, 2, 0, 0x2a4fcd03, {0.333818, 0.333818}, 6.74598e-07, 6.86705e-07, 2.89488e-07, -2.18865e-07},
+					{-3, 2, 0, 0x54a1b99d, {-0.334677, -0.334677}, 2.24974e-06, 2.20181e-06, 1.06531e-06, 6.16197e-07},
+					{ 4, 2, 0, 0x2f9b8068, {0.250534, 0.250534}, 9.91959e-07, 9.49043e-07, 5.51017e-07, -4.55329e-07},
+					{-4, 2, 0, 0x4f58020d, {-0.251282, -0.251282}, 2.78326e-06, 2.83147e-06, 1.38912e-06, 6.46654e-07},
+					{ 2, 2, 3, 0x1fbd5ea6, {0.50623715, 0.5000941}, 1.66751e-07, 1.6856e-07, 4.6552e-08, -3.45596e-09},
+					{-2, 2, 3, 0x5f34c90d, {-0.5191046, -0.5008508}, 6.93025e-07, 7.15358e-07, 3.29135e-07, 4.76427e-08},
+					{ 3, 2, 3, 0x2a527cc7, {0.33968106, 0.33357733}, 2.92946e-07, 2.89263e-07, 1.04734e-07, -6.49407e-08},
+					{-3, 2, 3, 0x54a2260d, {-0.33313528, -0.3346389}, 2.06391e-06, 2.07228e-06, 1.08146e-06, 4.87247e-07},
+					{ 4, 2, 3, 0x2f9d728e, {0.25972015, 0.25040302}, 6.26724e-07, 6.26919e-07, 3.0523e-07, -1.26389e-07},
+					{-4, 2, 3, 0x4f589a0f, {-0.24795547, -0.251277}, 2.76288e-06, 2.80293e-06, 1.43916e-06, 5.08768e-07},
+				};
+				return table[i];
+			}
+		};
+
+		template<> struct catalog_table<double>
+		{
+			static const size_t size = 24;
+			static constexpr Catalog_Design design(const size_t i)
+			{
+				// root, steps, basis, k, m per refinement, certified, max, RMS, mean
+				const Catalog_Design table[24] =
+				{
+					{ 2, 0, 2, 0x1ff769e5b00cb024, {0, 0}, 0.0347475, 0.0347474, 0.0189205, -0.00536097},
+					{-2, 0, 2, 0x5fe6ec85e7de30da, {0, 0}, 0.0342129, 0.0342128, 0.0252809, 0.0132797},
+					{ 3, 0, 2, 0x2a9f76253119d328, {0, 0}, 0.0315547, 0.0315546, 0.0186464, 0.00332526},
+					{-3, 0, 2, 0x553ef0ff289dd794, {0, 0}, 0.0342405, 0.0342405, 0.020435, 0.00730813},
+					{ 4, 0, 2, 0x2ff366e9846f3cf9, {0, 0}, 0.0342321, 0.0342321, 0.0186813, 0.00405836},
+					{-4, 0, 2, 0x4feb0c0b7fa996ad, {0, 0}, 0.0312107, 0.0312107, 0.0203653, 0.00857318},
+					{ 2, 1, 2, 0x1ff7da9258189b10, {0.51093, 0}, 0.000238959, 0.000238958, 0.000151818, -4.59695e-05},
+					{-2, 1, 2, 0x5fe65423e81eece9, {-0.535103, 0}, 0.000773281, 0.000773281, 0.000502815, -2.54973e-05},
+					{ 3, 1, 2, 0x2a9fdca8d39b1833, {0.347251, 0}, 0.000430022, 0.000430021, 0.000250765, -0.00010059},
+					{-3, 1, 2, 0x553e5fa2bf4bb94e, {-0.364707, 0}, 0.00102701, 0.001027, 0.00076144, 0.000275906},
+					{ 4, 1, 2, 0x2ff3daf850a16998, {0.266598, 0}, 0.000713962, 0.000713962, 0.000441483, -0.000217297},
+					{-4, 1, 2, 0x4fea8420dfe0c1b2, {-0.277446, 0}, 0.00110832, 0.00110831, 0.000781435, 0.000170847},
+					{ 2, 2, 2, 0x1ff76e33f8e94831, {0.500124, 0.500124}, 3.10501e-08, 3.105e-08, 1.99437e-08, -1.49023e-08},
+					{-2, 2, 2, 0x5fe6bbf0c11e182d, {-0.501434, -0.501434}, 1.36821e-06, 1.3682e-06, 1.02121e-06, 7.38925e-07},
+					{ 3, 2, 2, 0x2a9f5317d3f76c27, {0.333791, 0.333791}, 4.71067e-07, 4.71067e-07, 2.86e-07, -2.3138e-07},
+					{-3, 2, 2, 0x553eb1a359e5ec49, {-0.335169, -0.335169}, 3.78077e-06, 3.78077e-06, 2.01265e-06, 1.06863e-06},
+					{ 4, 2, 2, 0x2ff3578de1c1dc42, {0.250729, 0.250729}, 1.41535e-06, 1.41534e-06, 8.66523e-07, -7.14973e-07},
+					{-4, 2, 2, 0x4feaff5406bb3437, {-0.251281, -0.251281}, 2.61483e-06, 2.61482e-06, 1.40296e-06, 6.92673e-07},
+					{ 2, 2, 3, 0x1ff7abd6af094831, {0.5062402862530504, 0.5000940196285553}, 1.76794e-08, 1.76794e-08, 1.30453e-08, -3.42439e-09},
+					{-2, 2, 3, 0x5fe6993a977c082d, {-0.5190820138982459, -0.5008516262478447}, 4.82781e-07, 4.82781e-07, 3.23566e-07, 4.84834e-08},
+					{ 3, 2, 3, 0x2a9fb14660e8ec27, {0.34108362270975284, 0.3335514162660822}, 1.06988e-07, 1.06987e-07, 7.90828e-08, -3.84904e-08},
+					{-3, 2, 3, 0x553ef1a359e61a45, {-0.3326826511316709, -0.3346304538469513}, 1.88672e-06, 1.88672e-06, 1.1126e-06, 5.22058e-07},
+					{ 4, 2, 3, 0x2ff3abf3e663dc42, {0.2593750172045511, 0.2504178699941138}, 4.65296e-07, 4.65295e-07, 3.03383e-07, -1.26516e-07},
+					{-4, 2, 3, 0x4feaff5406bb3437, {-0.2519629179914801, -0.25123779699058624}, 2.44176e-06, 2.44176e-06, 1.38443e-06, 4.5162e-07},
+				};
+				return table[i];
+			}
+		};
+	}
+}
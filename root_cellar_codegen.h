@@ -0,0 +1,452 @@
+#pragma once
+
+
+#include <cstdint>
+#include <cstddef>
+#include <string>
+#include <ostream>
+
+#include "root_cellar.h"
+
+
+/*
+	Code generation of SIMD kernels for RootApprox designs.
+
+	Alongside the scalar function printed by Print_Generated_Root, each design
+	may be emitted as intrinsic kernels for SSE4.1, AVX2 + FMA and AVX-512F,
+	and as a batch function over arrays using the widest of these enabled.
+	Each kernel is guarded by the macros of its instruction set, so a header
+	of generated kernels compiles for any target.
+
+	The kernels follow the steps of simd::root_kernel exactly: the SSE4.1
+	kernel reproduces the scalar function bit for bit, while the AVX2 and
+	AVX-512 kernels fuse each refinement's multiply-add, reproducing
+	simd::root_kernel over ops_scalar<T, true>.
+*/
+namespace rootbeer
+{
+	enum GENERATED_ISA
+	{
+		GENERATED_SSE41,
+		GENERATED_AVX2,
+		GENERATED_AVX512,
+	};
+
+	namespace detail
+	{
+		/*
+			Names of types and intrinsics for one instruction set and float type.
+		*/
+		struct generated_isa
+		{
+			const char *suffix;   // appended to function names
+			const char *guard;    // preprocessor condition
+			const char *pfx;      // intrinsic prefix
+			const char *si;       // integer vector suffix
+			unsigned    bits;
+			bool        fused;
+
+			static generated_isa get(const GENERATED_ISA isa)
+			{
+				switch (isa)
+				{
+				default:
+				case GENERATED_SSE41:  return {"sse41",  "defined(__SSE4_1__)",                  "_mm",    "si128", 128, false};
+				case GENERATED_AVX2:   return {"avx2",   "defined(__AVX2__) && defined(__FMA__)", "_mm256", "si256", 256, true};
+				case GENERATED_AVX512: return {"avx512", "defined(__AVX512F__)",                 "_mm512", "si512", 512, true};
+				}
+			}
+
+			std::string vec (const bool f64) const    {return "__m" + std::to_string(bits) + (f64 ? "d" : "");}
+			std::string ivec()               const    {return "__m" + std::to_string(bits) + "i";}
+			std::string fp  (const bool f64) const    {return f64 ? "pd" : "ps";}
+			std::string op  (const char *name, const std::string &type) const    {return std::string(pfx) + "_" + name + "_" + type;}
+			std::string set1_64()            const    {return std::string(pfx) + ((bits == 512) ? "_set1_epi64" : "_set1_epi64x");}
+			unsigned    width(const bool f64) const   {return bits / (f64 ? 64 : 32);}
+		};
+
+		/*
+			Emit a declaration of q = i / D with vector intrinsics, following
+			the steps of ops_*::div_i.
+		*/
+		template<typename T_Int, int D>
+		void print_div_v(std::ostream &out, const generated_isa &isa)
+		{
+			using divider = int_divider<T_Int, D>;
+			const bool f64 = (sizeof(T_Int) == 8);
+			const std::string
+				ivec = isa.ivec(),
+				epi  = f64 ? "epi64" : "epi32",
+				sfx  = std::string("_") + isa.suffix,
+				and_ = std::string(isa.pfx) + "_and_" + isa.si,
+				or_  = std::string(isa.pfx) + "_or_"  + isa.si;
+			const int B = f64 ? 64 : 32;
+
+			out << std::dec;
+			if (D == 1)
+			{
+				out << "\t" << ivec << " q = i;\n";
+			}
+			else if (divider::power_of_two::value)
+			{
+				const int s = divider::log2::value;
+				if (!f64)
+				{
+					out << "\t" << ivec << " q = " << isa.op("srai", epi) << "(" << isa.op("add", epi) << "(i, "
+						<< isa.op("srli", epi) << "(" << isa.op("srai", epi) << "(i, 31), " << (32-s) << ")), " << s << ");";
+				}
+				else if (isa.bits == 512)
+				{
+					out << "\t" << ivec << " q = " << isa.op("srai", epi) << "(" << isa.op("add", epi) << "(i, "
+						<< isa.op("srli", epi) << "(" << isa.op("srai", epi) << "(i, 63), " << (64-s) << ")), " << s << ");";
+				}
+				else
+				{
+					out << "\t" << ivec << " t = " << isa.op("add", epi) << "(i, " << isa.op("srli", epi) << "(rb_sign_epi64" << sfx << "(i), " << (64-s) << "));\n";
+					out << "\t" << ivec << " q = " << or_ << "(" << isa.op("srli", epi) << "(t, " << s << "), "
+						<< isa.op("slli", epi) << "(rb_sign_epi64" << sfx << "(t), " << (64-s) << "));";
+				}
+				out << " // i / " << D << ", rounding toward zero\n";
+			}
+			else if (!f64)
+			{
+				out << "\t" << ivec << " q = rb_mulhi_epi32" << sfx << "(i, " << isa.op("set1", "epi32")
+					<< "((int32_t)0x" << std::hex << uint32_t(divider::magic::value) << "u));\n" << std::dec;
+				if (int32_t(divider::magic::value) < 0)
+					out << "\tq = " << isa.op("add", epi) << "(q, i);\n";
+				out << "\tq = " << isa.op("sub", epi) << "(";
+				if (divider::shift::value) out << isa.op("srai", epi) << "(q, " << divider::shift::value << ")";
+				else                       out << "q";
+				out << ", " << isa.op("srai", epi) << "(i, 31)); // i / " << D << ", rounding toward zero\n";
+			}
+			else
+			{
+				const std::string magic = "0x" + [](uint64_t v) {char t[24]; std::snprintf(t, sizeof(t), "%llx", (unsigned long long) v); return std::string(t);}(uint64_t(divider::magic::value));
+				out << "\t" << ivec << " sign = rb_sign_epi64" << sfx << "(i);\n";
+				out << "\t" << ivec << " q = " << isa.op("sub", epi) << "(rb_mulhi_epu64" << sfx << "(i, " << magic << "ull), "
+					<< and_ << "(sign, " << isa.set1_64() << "((long long)" << magic << "ull)));\n";
+				if (divider::shift::value)
+				{
+					const int s = divider::shift::value;
+					if (isa.bits == 512) out << "\tq = " << isa.op("srai", epi) << "(q, " << s << ");\n";
+					else out << "\tq = " << or_ << "(" << isa.op("srli", epi) << "(q, " << s << "), "
+						<< isa.op("slli", epi) << "(rb_sign_epi64" << sfx << "(q), " << (B-s) << "));\n";
+				}
+				out << "\tq = " << isa.op("sub", epi) << "(q, sign); // i / " << D << ", rounding toward zero\n";
+			}
+		}
+
+		/*
+			x^P with vector multiplies in the order of pow_v, for P from 1 to 4.
+		*/
+		inline std::string power_v(const generated_isa &isa, const bool f64, const int P)
+		{
+			const std::string mul = isa.op("mul", isa.fp(f64));
+			std::string x2 = mul + "(x, x)";
+			switch (P)
+			{
+			case 1:  return "x";
+			case 2:  return x2;
+			case 4:  return mul + "(" + x2 + ", " + x2 + ")";
+			default:
+			{
+				std::string e = "x";
+				for (int i = 1; i < P; ++i) e = mul + "(" + e + ", x)";
+				return e;
+			}
+			}
+		}
+
+		inline std::string fmadd_v(const generated_isa &isa, const bool f64, const std::string &a, const std::string &b, const std::string &c)
+		{
+			const std::string fp = isa.fp(f64);
+			if (isa.fused) return isa.op("fmadd", fp) + "(" + a + ", " + b + ", " + c + ")";
+			return isa.op("add", fp) + "(" + isa.op("mul", fp) + "(" + a + ", " + b + "), " + c + ")";
+		}
+	}
+
+
+	/*
+		Helpers shared by generated kernels: signed 32-bit and unsigned 64-bit
+		multiply-high, and the sign mask of 64-bit lanes.  Guarded so that
+		several generated headers may be included together.
+	 */
+	inline std::ostream &Print_Generated_SIMD_Preamble(std::ostream &out)
+	{
+		out <<
+			"#ifndef RB_SIMD\n"
+			"#define RB_SIMD 1\n"
+			"#include <stddef.h>\n"
+			"#include <string.h>\n"
+			"#if defined(__SSE4_1__) || defined(__AVX2__) || defined(__AVX512F__)\n"
+			"\t#include <immintrin.h>\n"
+			"#endif\n"
+			"// GCC 12 warns of _mm512_undefined_* within its own AVX-512 intrinsics\n"
+			"#if defined(__GNUC__) && !defined(__clang__)\n"
+			"\t#define RB_AVX512_BEGIN _Pragma(\"GCC diagnostic push\") _Pragma(\"GCC diagnostic ignored \\\"-Wuninitialized\\\"\") _Pragma(\"GCC diagnostic ignored \\\"-Wmaybe-uninitialized\\\"\")\n"
+			"\t#define RB_AVX512_END   _Pragma(\"GCC diagnostic pop\")\n"
+			"#else\n"
+			"\t#define RB_AVX512_BEGIN\n"
+			"\t#define RB_AVX512_END\n"
+			"#endif\n";
+
+		for (GENERATED_ISA id : {GENERATED_SSE41, GENERATED_AVX2, GENERATED_AVX512})
+		{
+			const detail::generated_isa isa = detail::generated_isa::get(id);
+			const std::string
+				ivec = isa.ivec(),
+				sfx  = std::string("_") + isa.suffix,
+				and_ = std::string(isa.pfx) + "_and_" + isa.si;
+
+			out << "\n#if " << isa.guard << "\n";
+			if (id == GENERATED_AVX512) out << "RB_AVX512_BEGIN\n";
+			out << "inline " << ivec << " rb_mulhi_epi32" << sfx << "(const " << ivec << " a, const " << ivec << " b)\n{\n";
+			out << "\t" << ivec << " even = " << isa.op("srli", "epi64") << "(" << isa.op("mul", "epi32") << "(a, b), 32),\n"
+				<< "\t\todd = " << isa.op("mul", "epi32") << "(" << isa.op("srli", "epi64") << "(a, 32), b);\n";
+			switch (id)
+			{
+			case GENERATED_SSE41:  out << "\treturn _mm_blend_epi16(even, odd, 0xCC);\n"; break;
+			case GENERATED_AVX2:   out << "\treturn _mm256_blend_epi32(even, odd, 0xAA);\n"; break;
+			case GENERATED_AVX512: out << "\treturn _mm512_mask_blend_epi32(0xAAAA, even, odd);\n"; break;
+			}
+			out << "}\n";
+
+			out << "inline " << ivec << " rb_sign_epi64" << sfx << "(const " << ivec << " a)\n{\n";
+			switch (id)
+			{
+			case GENERATED_SSE41:  out << "\treturn _mm_shuffle_epi32(_mm_srai_epi32(a, 31), _MM_SHUFFLE(3,3,1,1));\n"; break;
+			case GENERATED_AVX2:   out << "\treturn _mm256_cmpgt_epi64(_mm256_setzero_si256(), a);\n"; break;
+			case GENERATED_AVX512: out << "\treturn _mm512_srai_epi64(a, 63);\n"; break;
+			}
+			out << "}\n";
+
+			out << "inline " << ivec << " rb_mulhi_epu64" << sfx << "(const " << ivec << " a, const unsigned long long b)\n{\n"
+				<< "\tconst " << ivec << "\n"
+				<< "\t\tb_lo = " << isa.set1_64() << "((long long)(b & 0xFFFFFFFFu)),\n"
+				<< "\t\tb_hi = " << isa.set1_64() << "((long long)(b >> 32)),\n"
+				<< "\t\tmask = " << isa.set1_64() << "(0xFFFFFFFF),\n"
+				<< "\t\ta_hi = " << isa.op("srli", "epi64") << "(a, 32),\n"
+				<< "\t\tll = " << isa.op("mul", "epu32") << "(a, b_lo), lh = " << isa.op("mul", "epu32") << "(a, b_hi),\n"
+				<< "\t\thl = " << isa.op("mul", "epu32") << "(a_hi, b_lo), hh = " << isa.op("mul", "epu32") << "(a_hi, b_hi),\n"
+				<< "\t\tmid = " << isa.op("add", "epi64") << "(" << isa.op("srli", "epi64") << "(ll, 32), "
+					<< isa.op("add", "epi64") << "(" << and_ << "(lh, mask), " << and_ << "(hl, mask)));\n"
+				<< "\treturn " << isa.op("add", "epi64") << "(" << isa.op("add", "epi64") << "(hh, " << isa.op("srli", "epi64") << "(mid, 32)), "
+					<< isa.op("add", "epi64") << "(" << isa.op("srli", "epi64") << "(lh, 32), " << isa.op("srli", "epi64") << "(hl, 32)));\n"
+				<< "}\n";
+			if (id == GENERATED_AVX512) out << "RB_AVX512_END\n";
+			out << "#endif\n";
+		}
+
+		out << "\n"
+			"// Apply a kernel W lanes at a time, padding the last partial vector\n"
+			"template<size_t W, typename T, typename F>\n"
+			"inline void rb_simd_batch(const T *y, T *x, const size_t count, const F &vector)\n"
+			"{\n"
+			"\tsize_t i = 0;\n"
+			"\tfor (; i + W <= count; i += W) vector(y + i, x + i);\n"
+			"\tif (i < count)\n"
+			"\t{\n"
+			"\t\tT pad[W] = {};\n"
+			"\t\tmemcpy(pad, y + i, (count - i) * sizeof(T));\n"
+			"\t\tvector(pad, pad);\n"
+			"\t\tmemcpy(x + i, pad, (count - i) * sizeof(T));\n"
+			"\t}\n"
+			"}\n"
+			"#endif\n";
+		return out;
+	}
+
+
+	/*
+		Emit a design as a kernel for one instruction set, named after the
+		scalar function with the instruction set appended (rb_inv_2_root_avx2).
+	 */
+	template<int N, typename T_Float, unsigned NewtonSteps>
+	std::ostream &Print_Generated_SIMD_Safe(std::ostream &out,
+		const RootApprox<N, T_Float, NewtonSteps> &approx, const GENERATED_ISA id, const char *prefix = "rb");
+
+	template<int N, typename T_Float, unsigned NewtonSteps>
+	std::ostream &Print_Generated_SIMD(std::ostream &out,
+		const RootApprox<N, T_Float, NewtonSteps> &approx, const GENERATED_ISA id, const char *prefix = "rb",
+		const ROOT_DOMAIN domain = ROOT_FAST)
+	{
+		static_assert(N != 0, "0th root is invalid");
+		if (domain == ROOT_SAFE) return Print_Generated_SIMD_Safe(out, approx, id, prefix);
+		static const int absN = ((N<0)?-N:N);
+
+		using as_int_t = float_as_int_t<T_Float>;
+		const bool f64 = (sizeof(T_Float) == 8);
+		const detail::generated_isa isa = detail::generated_isa::get(id);
+		const std::string
+			vec  = isa.vec(f64),
+			ivec = isa.ivec(),
+			fp   = isa.fp(f64),
+			epi  = f64 ? "epi64" : "epi32",
+			set1 = isa.op("set1", fp);
+
+		out << "#if " << isa.guard << "\n";
+		if (id == GENERATED_AVX512) out << "RB_AVX512_BEGIN\n";
+		out << "inline " << vec << " " << detail::generated_name(prefix, N) << "_" << isa.suffix << "(const " << vec << " y)\n";
+		out << "{\n";
+		out << "\t" << ivec << " i = " << isa.pfx << "_cast" << fp << "_" << isa.si << "(y); // interpret float as integer\n";
+		detail::print_div_v<as_int_t, absN>(out, isa);
+
+		out << "\ti = " << isa.op((N>0) ? "add" : "sub", epi) << "(" << (f64 ? isa.set1_64() : isa.op("set1", "epi32")) << "(0x" << std::hex << approx.constant
+			<< (f64 ? "ll" : "") << "), q); // log-approximation hack\n" << std::dec;
+		out << "\t" << vec << " x = " << isa.pfx << "_cast" << isa.si << "_" << fp << "(i);\n";
+
+		// Newtonian lines, as in simd::root_kernel
+		const int refine_power = absN - (N>0);
+		for (unsigned s = 0; s < NewtonSteps; ++s)
+		{
+			const T_Float m = approx.newton_m[s];
+			const std::string
+				my = isa.op("mul", fp) + "(" + set1 + "(" + detail::exact_literal(m) + "), y)",
+				c1 = set1 + "(" + detail::exact_literal(T_Float(1) - m) + ")";
+			out << "\tx = ";
+			if (N > 0) out << detail::fmadd_v(isa, f64, "x", c1, refine_power ? isa.op("div", fp) + "(" + my + ", " + detail::power_v(isa, f64, refine_power) + ")" : my);
+			else       out << isa.op("mul", fp) << "(x, " << detail::fmadd_v(isa, f64, my, detail::power_v(isa, f64, refine_power), c1) << ")";
+			out << "; // newtonian step #" << (s+1) << "\n";
+		}
+		out << "\treturn x;\n";
+		out << "}\n";
+		if (id == GENERATED_AVX512) out << "RB_AVX512_END\n";
+		out << "#endif";
+		return out;
+	}
+
+	/*
+		Emit the ROOT_SAFE kernel for one instruction set (rb_safe_inv_2_root_avx2),
+		which calls the kernel printed by Print_Generated_SIMD and blends results
+		for other inputs in the steps of simd::safe_kernel, unless every lane
+		is a positive normal.
+	 */
+	template<int N, typename T_Float, unsigned NewtonSteps>
+	std::ostream &Print_Generated_SIMD_Safe(std::ostream &out,
+		const RootApprox<N, T_Float, NewtonSteps> &, const GENERATED_ISA id, const char *prefix)
+	{
+		using domain = detail::root_domain<N, T_Float>;
+		const bool f64 = (sizeof(T_Float) == 8);
+		const detail::generated_isa isa = detail::generated_isa::get(id);
+		const std::string
+			vec  = isa.vec(f64),
+			ivec = isa.ivec(),
+			fp   = isa.fp(f64),
+			epi  = f64 ? "epi64" : "epi32",
+			mask = (id == GENERATED_AVX512) ? (f64 ? "__mmask8" : "__mmask16") : vec,
+			to_f = std::string(isa.pfx) + "_cast" + isa.si + "_" + fp,
+			to_i = std::string(isa.pfx) + "_cast" + fp + "_" + isa.si;
+
+		// Constants by bit pattern, comparisons and blends as in ops_*
+		auto bits = [&](const typename domain::uint_t v)
+		{
+			return f64 ? isa.set1_64() + "((long long)" + detail::uint_literal(v) + ")"
+			           : isa.op("set1", "epi32") + "((int32_t)" + detail::uint_literal(v) + ")";
+		};
+		auto cmpgt = [&](const std::string &a, const std::string &b)
+		{
+			if (id == GENERATED_SSE41) return isa.op("cmpgt", fp) + "(" + a + ", " + b + ")";
+			return isa.op("cmp", fp) + ((id == GENERATED_AVX512) ? "_mask(" : "(") + a + ", " + b + ", _CMP_GT_OQ)";
+		};
+		auto blend = [&](const std::string &m, const std::string &a, const std::string &b)
+		{
+			if (id == GENERATED_AVX512) return isa.op("mask_blend", fp) + "(" + m + ", " + b + ", " + a + ")";
+			return isa.op("blendv", fp) + "(" + b + ", " + a + ", " + m + ")";
+		};
+		const std::string
+			zero  = isa.op("setzero", fp) + "()",
+			one   = isa.op("set1", fp) + "(" + detail::exact_literal(T_Float(1)) + ")",
+			and_m = (id == GENERATED_AVX512) ? std::string("") : isa.op("and", fp),
+			name  = detail::generated_name(prefix, N);
+
+		out << "#if " << isa.guard << "\n";
+		if (id == GENERATED_AVX512) out << "RB_AVX512_BEGIN\n";
+		out << "inline " << vec << " " << detail::generated_name(prefix, N, ROOT_SAFE) << "_" << isa.suffix << "(const " << vec << " y)\n";
+		out << "{\n";
+		{
+			// Positive normal inputs throughout need none of the blends: their bits,
+			// offset by the sign bit less min_normal, are below this bound as signed
+			const std::string bound = bits(domain::sign + (domain::infinity - domain::min_normal));
+			out << "\tconst " << ivec << " ordinary = " << isa.op("add", epi) << "(" << to_i << "(y), " << bits(domain::sign - domain::min_normal) << ");\n";
+			out << "\tif (";
+			if (id == GENERATED_AVX512)
+				out << isa.op("cmplt", epi) << "_mask(ordinary, " << bound << ") == (" << mask << ")0x" << std::hex << ((1u << isa.width(f64)) - 1) << std::dec;
+			else if (!f64 || id == GENERATED_AVX2)
+				out << isa.pfx << "_movemask_epi8(" << isa.op("cmpgt", epi) << "(" << bound << ", ordinary)) == " << ((id == GENERATED_AVX2) ? "-1" : "0xffff");
+			else
+				out << "_mm_cvtsi128_si64(ordinary) < (long long)" << detail::uint_literal(domain::sign + (domain::infinity - domain::min_normal))
+					<< " && _mm_extract_epi64(ordinary, 1) < (long long)" << detail::uint_literal(domain::sign + (domain::infinity - domain::min_normal));
+			out << ") return " << name << "_" << isa.suffix << "(y);\n";
+		}
+		out << "\tconst " << ivec << " u = " << to_i << "(y), sign = " << isa.pfx << "_and_" << isa.si << "(u, " << bits(domain::sign) << ");\n";
+		out << "\tconst " << vec << " a = " << to_f << "(" << isa.pfx << "_xor_" << isa.si << "(u, sign));\n";
+		out << "\tconst " << mask << " tiny = " << cmpgt(to_f + "(" + bits(domain::min_normal) + ")", "a") << "; // zero or denormal, scaled into normal range\n";
+		out << "\tconst " << mask << " finite = ";
+		if (id == GENERATED_AVX512) out << "(" << mask << ")(" << cmpgt("a", zero) << " & " << cmpgt(to_f + "(" + bits(domain::infinity) + ")", "a") << ");\n";
+		else                        out << and_m << "(" << cmpgt("a", zero) << ", " << cmpgt(to_f + "(" + bits(domain::infinity) + ")", "a") << ");\n";
+		if (N < 0) out << "\tconst " << mask << " number = " << cmpgt("a", isa.op("set1", fp) + "(" + detail::exact_literal(T_Float(-1)) + ")") << "; // all but NaN, which keeps its bits\n";
+		out << "\t" << vec << " x = " << name << "_" << isa.suffix << "(" << isa.op("mul", fp) << "(a, " << blend("tiny", to_f + "(" + bits(domain::scale_in) + ")", one) << "));\n";
+		out << "\tx = " << isa.op("mul", fp) << "(x, " << blend("tiny", to_f + "(" + bits(domain::scale_out) + ")", one) << ");\n";
+		out << "\tx = " << blend("finite", "x", (N > 0) ? std::string("a") : blend("number", to_f + "(" + isa.op("sub", epi) + "(" + bits(domain::infinity) + ", " + to_i + "(a)))", "a"))
+			<< "; // zero, infinity and NaN\n";
+		out << "\tx = " << to_f << "(" << isa.pfx << "_or_" << isa.si << "(" << to_i << "(x), sign));\n";
+		if (domain::DEG % 2 == 0)
+			out << "\tx = " << blend(cmpgt(zero, "y"), to_f + "(" + bits(domain::quiet_nan) + ")", "x") << "; // even root of a negative\n";
+		out << "\treturn x;\n";
+		out << "}\n";
+		if (id == GENERATED_AVX512) out << "RB_AVX512_END\n";
+		out << "#endif";
+		return out;
+	}
+
+	/*
+		Emit a batch function over arrays (rb_inv_2_root_batch), using the widest
+		kernel enabled or else the scalar function.  y and x may be the same array.
+	 */
+	template<int N, typename T_Float, unsigned NewtonSteps>
+	std::ostream &Print_Generated_Batch(std::ostream &out,
+		const RootApprox<N, T_Float, NewtonSteps> &, const char *prefix = "rb", const ROOT_DOMAIN domain = ROOT_FAST)
+	{
+		const bool f64 = (sizeof(T_Float) == 8);
+		const char *float_decl = detail::float_traits<T_Float>::name();
+		const std::string name = detail::generated_name(prefix, N, domain);
+
+		out << "inline void " << name << "_batch(const " << float_decl << " *y, " << float_decl << " *x, const size_t count)\n";
+		out << "{\n";
+		bool first = true;
+		for (GENERATED_ISA id : {GENERATED_AVX512, GENERATED_AVX2, GENERATED_SSE41})
+		{
+			const detail::generated_isa isa = detail::generated_isa::get(id);
+			out << (first ? "#if " : "#elif ") << isa.guard << "\n";
+			out << "\trb_simd_batch<" << std::dec << isa.width(f64) << ">(y, x, count, [](const " << float_decl << " *in, " << float_decl << " *out)\n"
+				<< "\t\t{" << isa.op("storeu", isa.fp(f64)) << "(out, " << name << "_" << isa.suffix << "(" << isa.op("loadu", isa.fp(f64)) << "(in)));});\n";
+			first = false;
+		}
+		out << "#else\n";
+		out << "\tfor (size_t i = 0; i < count; ++i) x[i] = " << name << "(y[i]);\n";
+		out << "#endif\n";
+		out << "}";
+		return out;
+	}
+
+	/*
+		The scalar function, every kernel and the batch function for a design.
+		With ROOT_SAFE, the safe functions follow the fast ones they call.
+	 */
+	template<int N, typename T_Float, unsigned NewtonSteps>
+	std::ostream &Print_Generated_Root_All(std::ostream &out,
+		const RootApprox<N, T_Float, NewtonSteps> &approx, const char *prefix = "rb", const ROOT_DOMAIN domain = ROOT_FAST)
+	{
+		Print_Generated_Root(out, approx, prefix) << "\n\n";
+		for (GENERATED_ISA id : {GENERATED_SSE41, GENERATED_AVX2, GENERATED_AVX512})
+			Print_Generated_SIMD(out, approx, id, prefix) << "\n\n";
+		Print_Generated_Batch(out, approx, prefix);
+		if (domain != ROOT_SAFE) return out;
+		
+		out << "\n\n";
+		Print_Generated_Root(out, approx, prefix, ROOT_SAFE) << "\n\n";
+		for (GENERATED_ISA id : {GENERATED_SSE41, GENERATED_AVX2, GENERATED_AVX512})
+			Print_Generated_SIMD(out, approx, id, prefix, ROOT_SAFE) << "\n\n";
+		return Print_Generated_Batch(out, approx, prefix, ROOT_SAFE);
+	}
+}
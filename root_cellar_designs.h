@@ -0,0 +1,255 @@
+#pragma once
+
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <cinttypes>
+#include <cmath>
+#include <chrono>
+#include <limits>
+#include <string>
+#include <vector>
+
+#include "root_cellar.h"
+
+
+/*
+	A store of searched designs, so that generating code doesn't repeat searches.
+
+	Each record holds a design's constant and pseudo-newtonian constants with
+	its error score, measured error and the time its search took, keyed by the
+	root index, float type, number of refinements, scoring basis and search
+	method.  RootApprox_Stored returns a stored design when one is present and
+	still valid, or searches and records a new one.
+
+	The store is a text file of one record per line.  Floating-point values
+	are written in hexadecimal so that they are read back exactly.
+*/
+namespace rootbeer
+{
+	/*
+		Identifies the search behind a record.  Bump the revision whenever
+		RootApprox_Best or RootApprox_Score changes what they would find,
+		so that stored designs are searched again.
+	*/
+	static const char *const DESIGN_SEARCH_GRID = "grid.1";
+
+	struct Design_Record
+	{
+		// Key
+		int         root  = 0;
+		std::string type;        // "float" or "double"
+		unsigned    steps = 0;
+		int         basis = 0;   // BEST_APPROX_BASIS
+		std::string search;      // search method and revision
+
+		// Design
+		uint64_t            constant = 0;
+		std::vector<double> newton_m;
+
+		// Measurements
+		double          score = 0.0;        // by basis, as minimized by the search
+		double          certified = std::numeric_limits<double>::quiet_NaN();
+		bool            tested = false;     // error measured exhaustively (float only)
+		PowApprox_Stats error;              // over test_param_range
+		double          search_seconds = 0.0;
+
+		bool same_key(const Design_Record &o) const
+		{
+			return root == o.root && type == o.type && steps == o.steps
+				&& basis == o.basis && search == o.search;
+		}
+
+		template<int N, typename T_Float, unsigned NewtonSteps>
+		RootApprox<N, T_Float, NewtonSteps> design() const
+		{
+			typename RootApprox<N, T_Float, NewtonSteps>::steps_t m;
+			for (unsigned s = 0; s < NewtonSteps; ++s) m[s] = T_Float(newton_m[s]);
+			return RootApprox<N, T_Float, NewtonSteps>(float_as_int_t<T_Float>(constant), m);
+		}
+
+		template<int N, typename T_Float, unsigned NewtonSteps, BEST_APPROX_BASIS Basis>
+		static Design_Record key(const char *search = DESIGN_SEARCH_GRID)
+		{
+			Design_Record r;
+			r.root   = N;
+			r.type   = detail::float_traits<T_Float>::name();
+			r.steps  = NewtonSteps;
+			r.basis  = int(Basis);
+			r.search = search;
+			return r;
+		}
+	};
+
+	class Design_Database
+	{
+	public:
+		std::vector<Design_Record> records;
+		std::string                path;   // saved after each change, if not empty
+
+		Design_Database() {}
+		explicit Design_Database(const char *_path) : path(_path ? _path : "")    {if (_path) load(_path);}
+
+		/*
+			Read records from a file, replacing those with the same keys.
+			Lines that can't be parsed are skipped.  Returns false if the file
+			can't be opened.
+		*/
+		bool load(const char *file_path)
+		{
+			std::FILE *f = std::fopen(file_path, "r");
+			if (!f) return false;
+			char line[1024];
+			while (std::fgets(line, sizeof(line), f))
+			{
+				Design_Record r;
+				if (parse(line, r)) put(r);
+			}
+			std::fclose(f);
+			return true;
+		}
+
+		bool save(const char *file_path) const
+		{
+			std::FILE *f = std::fopen(file_path, "w");
+			if (!f) return false;
+			std::fputs("# rootbeer designs: root type steps basis search constant score certified tested"
+				" rms mean min min_arg max max_arg seconds m...\n", f);
+			for (auto &r : records) write(f, r);
+			return std::fclose(f) == 0;
+		}
+
+		const Design_Record *find(const Design_Record &key) const
+		{
+			for (auto &r : records) if (r.same_key(key)) return &r;
+			return nullptr;
+		}
+
+		void store(const Design_Record &record)
+		{
+			put(record);
+			if (!path.empty()) save(path.c_str());
+		}
+
+		bool erase(const Design_Record &key)
+		{
+			for (auto i = records.begin(); i != records.end(); ++i)
+				if (i->same_key(key)) {records.erase(i); if (!path.empty()) save(path.c_str()); return true;}
+			return false;
+		}
+
+	private:
+		void put(const Design_Record &record)
+		{
+			for (auto &r : records) if (r.same_key(record)) {r = record; return;}
+			records.push_back(record);
+		}
+
+		static void write(std::FILE *f, const Design_Record &r)
+		{
+			const PowApprox_Stats &e = r.error;
+			std::fprintf(f, "design %d %s %u %d %s %" PRIx64 " %a %a %d %a %a %a %a %a %a %a",
+				r.root, r.type.c_str(), r.steps, r.basis, r.search.c_str(), r.constant,
+				r.score, r.certified, int(r.tested),
+				std::sqrt(e.mean_sq_error), e.mean_error, e.min_error, e.min_error_arg, e.max_error, e.max_error_arg,
+				r.search_seconds);
+			for (double m : r.newton_m) std::fprintf(f, " %a", m);
+			std::fputc('\n', f);
+		}
+
+		static bool parse(const char *line, Design_Record &r)
+		{
+			char type[16], search[64];
+			int tested = 0, used = 0;
+			double rms = 0.0;
+			PowApprox_Stats &e = r.error;
+			if (std::sscanf(line, "design %d %15s %u %d %63s %" SCNx64 " %la %la %d %la %la %la %la %la %la %la%n",
+				&r.root, type, &r.steps, &r.basis, search, &r.constant,
+				&r.score, &r.certified, &tested,
+				&rms, &e.mean_error, &e.min_error, &e.min_error_arg, &e.max_error, &e.max_error_arg,
+				&r.search_seconds, &used) != 16)
+				return false;
+			r.type = type;
+			r.search = search;
+			r.tested = (tested != 0);
+			e.mean_sq_error = rms * rms;
+
+			const char *p = line + used;
+			r.newton_m.clear();
+			for (unsigned s = 0; s < r.steps; ++s)
+			{
+				double m;
+				int n = 0;
+				if (std::sscanf(p, " %la%n", &m, &n) != 1) return false;
+				r.newton_m.push_back(m);
+				p += n;
+			}
+			return true;
+		}
+	};
+
+
+	/*
+		Score and measure a design for the store, as if found by the given search.
+		Designs found elsewhere may be recorded with no search time.
+	*/
+	template<BEST_APPROX_BASIS Basis, int N, typename T_Float, unsigned NewtonSteps, typename T_Executor>
+	Design_Record Design_Record_Measure(
+		const RootApprox<N, T_Float, NewtonSteps> &design,
+		T_Executor &&executor,
+		const double search_seconds = 0.0,
+		const char *search = DESIGN_SEARCH_GRID)
+	{
+		Design_Record record = Design_Record::key<N, T_Float, NewtonSteps, Basis>(search);
+		record.constant = uint64_t(design.constant);
+		for (unsigned s = 0; s < NewtonSteps; ++s) record.newton_m.push_back(double(design.newton_m[s]));
+		record.score = double(RootApprox_Score<Basis>(design));
+		record.certified = double(design.error_worstCase_certified());
+		if (sizeof(T_Float) <= 4)
+		{
+			const auto range = RootApprox<N, T_Float, NewtonSteps>::test_param_range();
+			record.error = Test_Root_Approx<N>(design, range.first, range.second, executor);
+			record.tested = true;
+		}
+		record.search_seconds = search_seconds;
+		return record;
+	}
+
+	/*
+		Find the best design as RootApprox_Best does, unless the database holds
+		one for the same search.  A stored design is used only if it scores as
+		recorded, so that changes to scoring invalidate old records even when
+		the search revision wasn't bumped.  New designs are measured and stored.
+	*/
+	template<int N, typename T_Float, unsigned NewtonSteps = 1, BEST_APPROX_BASIS Basis = BEST_WORST_CASE, typename T_Executor>
+	RootApprox<N,T_Float,NewtonSteps> RootApprox_Stored(Design_Database &database, T_Executor &&executor)
+	{
+		using design_t = RootApprox<N, T_Float, NewtonSteps>;
+		const Design_Record key = Design_Record::key<N, T_Float, NewtonSteps, Basis>();
+
+		if (const Design_Record *found = database.find(key))
+		{
+			if (found->newton_m.size() == NewtonSteps)
+			{
+				const design_t design = found->template design<N, T_Float, NewtonSteps>();
+				const double score = double(RootApprox_Score<Basis>(design));
+				if (std::abs(score - found->score) <= 1e-4 * std::abs(found->score))
+					return design;
+			}
+		}
+
+		const auto start = std::chrono::steady_clock::now();
+		const design_t design = RootApprox_Best<N, T_Float, NewtonSteps, Basis>(executor);
+		const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+		database.store(Design_Record_Measure<Basis>(design, executor, elapsed.count()));
+		return design;
+	}
+
+	template<int N, typename T_Float, unsigned NewtonSteps = 1, BEST_APPROX_BASIS Basis = BEST_WORST_CASE>
+	RootApprox<N,T_Float,NewtonSteps> RootApprox_Stored(Design_Database &database)
+	{
+		return RootApprox_Stored<N, T_Float, NewtonSteps, Basis>(database, SerialExecutor());
+	}
+}
@@ -0,0 +1,282 @@
+#pragma once
+
+
+#include <cstdint>
+#include <cstddef>
+#include <cstdlib>
+#include <cstring>
+#include <type_traits>
+
+#include "root_cellar_batch.h"
+#include "root_cellar_safe.h"
+
+
+/*
+	Batch kernels chosen at runtime from the instruction sets of the processor,
+	for binaries that can't be built for one machine with -march=native.
+
+		rootbeer::rb_root_dispatch<-2>(y, x, count);    // as rb_root, on the widest kernel the CPU runs
+		rootbeer::Dispatch_Apply(design, y, x, count);  // any float or double design; RootApprox_Safe too
+
+	Dispatch_ISA detects the processor's instruction sets once, with cpuid
+	(through __builtin_cpu_supports), and each batch function caches its entry
+	point in a table on first use; later calls cost an indirect call.
+	The environment variable ROOTBEER_ISA, read at detection, lowers the choice
+	to "scalar", "sse41", "avx2" or "avx512" for testing and benchmarking;
+	instruction sets the processor lacks are never chosen.
+
+	Each kernel gives the results of the batch functions built for its
+	instruction set; the scalar and SSE4.1 kernels don't fuse multiply-adds,
+	so results may differ from the others in the last bit.  Only GCC and Clang
+	on x86 compile kernels beyond the command line's (see ROOTBEER_DISPATCH in
+	root_cellar_batch.h); elsewhere the choice is among those enabled.
+	16-bit formats aren't dispatched.
+*/
+namespace rootbeer
+{
+	enum ROOT_ISA
+	{
+		ROOT_ISA_SCALAR = 0,
+		ROOT_ISA_SSE41  = 1,
+		ROOT_ISA_AVX2   = 2,   // with FMA
+		ROOT_ISA_AVX512 = 3,   // AVX-512F
+		ROOT_ISA_COUNT
+	};
+
+	inline const char *Dispatch_ISA_Name(const ROOT_ISA isa)
+	{
+		switch (isa)
+		{
+		case ROOT_ISA_SSE41:  return "sse41";
+		case ROOT_ISA_AVX2:   return "avx2";
+		case ROOT_ISA_AVX512: return "avx512";
+		default:              return "scalar";
+		}
+	}
+
+	/*
+		The widest instruction set the processor and operating system support,
+		among those with kernels.
+	*/
+	inline ROOT_ISA Dispatch_Detect()
+	{
+#if defined(ROOTBEER_DISPATCH)
+		__builtin_cpu_init();
+		if (__builtin_cpu_supports("avx512f"))                                  return ROOT_ISA_AVX512;
+		if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma"))    return ROOT_ISA_AVX2;
+		if (__builtin_cpu_supports("sse4.1"))                                   return ROOT_ISA_SSE41;
+		return ROOT_ISA_SCALAR;
+#elif defined(__AVX512F__)
+		return ROOT_ISA_AVX512;
+#elif defined(__AVX2__) && defined(__FMA__)
+		return ROOT_ISA_AVX2;
+#elif defined(__SSE4_1__)
+		return ROOT_ISA_SSE41;
+#else
+		return ROOT_ISA_SCALAR;
+#endif
+	}
+
+	namespace detail
+	{
+		// Lower a detected instruction set to the one named by an override, if any
+		inline ROOT_ISA dispatch_choose(const ROOT_ISA detected, const char *override_name)
+		{
+			if (!override_name) return detected;
+			for (int i = ROOT_ISA_SCALAR; i < ROOT_ISA_COUNT; ++i)
+			{
+				if (std::strcmp(override_name, Dispatch_ISA_Name(ROOT_ISA(i))) == 0)
+					return (ROOT_ISA(i) < detected) ? ROOT_ISA(i) : detected;
+			}
+			return detected;
+		}
+	}
+
+	/*
+		The instruction set batches are dispatched to, detected on first call.
+	*/
+	inline ROOT_ISA Dispatch_ISA()
+	{
+		static const ROOT_ISA isa = detail::dispatch_choose(Dispatch_Detect(), std::getenv("ROOTBEER_ISA"));
+		return isa;
+	}
+
+
+	namespace simd
+	{
+		template<int N, typename T_Float, unsigned NewtonSteps>
+		using dispatch_batch_t = void (*)(const RootApprox<N, T_Float, NewtonSteps>&, const T_Float*, T_Float*, size_t);
+
+		/*
+			Entry points for each instruction set.  The kernels are included
+			again in a namespace per instruction set, compiled for it with all
+			they call; get() is null for those not compiled.
+		*/
+		template<ROOT_ISA ISA>
+		struct dispatch_entry
+		{
+			template<ROOT_DOMAIN Domain, int N, typename T_Float, unsigned NewtonSteps>
+			static dispatch_batch_t<N, T_Float, NewtonSteps> get()    {return nullptr;}
+		};
+
+		template<>
+		struct dispatch_entry<ROOT_ISA_SCALAR>
+		{
+			template<ROOT_DOMAIN Domain, int N, typename T_Float, unsigned NewtonSteps>
+			static void batch(const RootApprox<N, T_Float, NewtonSteps> &approx, const T_Float *y, T_Float *x, const size_t count)
+				{domain_batch<Domain, ops_scalar<T_Float, false>, false>(approx, y, x, count);}
+
+			template<ROOT_DOMAIN Domain, int N, typename T_Float, unsigned NewtonSteps>
+			static dispatch_batch_t<N, T_Float, NewtonSteps> get()    {return &batch<Domain, N, T_Float, NewtonSteps>;}
+		};
+
+#if defined(ROOTBEER_HAS_SSE41)
+		ROOTBEER_TARGET_BEGIN("sse4.1")
+		namespace sse41
+		{
+#include "root_cellar_kernels.h"
+		}
+
+		template<>
+		struct dispatch_entry<ROOT_ISA_SSE41>
+		{
+			template<typename T_Float> using ops = typename std::conditional<sizeof(T_Float) == 4, ops_sse41_f32, ops_sse41_f64>::type;
+
+			template<ROOT_DOMAIN Domain, int N, typename T_Float, unsigned NewtonSteps>
+			static void batch(const RootApprox<N, T_Float, NewtonSteps> &approx, const T_Float *y, T_Float *x, const size_t count)
+				{sse41::domain_batch<Domain, ops<T_Float>, false>(approx, y, x, count);}
+
+			template<ROOT_DOMAIN Domain, int N, typename T_Float, unsigned NewtonSteps>
+			static dispatch_batch_t<N, T_Float, NewtonSteps> get()    {return &batch<Domain, N, T_Float, NewtonSteps>;}
+		};
+		ROOTBEER_TARGET_END
+#endif
+
+#if defined(ROOTBEER_HAS_AVX2)
+		ROOTBEER_TARGET_BEGIN("avx2,fma")
+		namespace avx2
+		{
+#include "root_cellar_kernels.h"
+		}
+
+		template<>
+		struct dispatch_entry<ROOT_ISA_AVX2>
+		{
+			template<typename T_Float> using ops = typename std::conditional<sizeof(T_Float) == 4, ops_avx2_f32, ops_avx2_f64>::type;
+
+			template<ROOT_DOMAIN Domain, int N, typename T_Float, unsigned NewtonSteps>
+			static void batch(const RootApprox<N, T_Float, NewtonSteps> &approx, const T_Float *y, T_Float *x, const size_t count)
+				{avx2::domain_batch<Domain, ops<T_Float>, false>(approx, y, x, count);}
+
+			template<ROOT_DOMAIN Domain, int N, typename T_Float, unsigned NewtonSteps>
+			static dispatch_batch_t<N, T_Float, NewtonSteps> get()    {return &batch<Domain, N, T_Float, NewtonSteps>;}
+		};
+		ROOTBEER_TARGET_END
+#endif
+
+#if defined(ROOTBEER_HAS_AVX512)
+		ROOTBEER_AVX512_BEGIN
+		ROOTBEER_TARGET_BEGIN("avx512f")
+		namespace avx512
+		{
+#include "root_cellar_kernels.h"
+		}
+
+		template<>
+		struct dispatch_entry<ROOT_ISA_AVX512>
+		{
+			template<typename T_Float> using ops = typename std::conditional<sizeof(T_Float) == 4, ops_avx512_f32, ops_avx512_f64>::type;
+
+			template<ROOT_DOMAIN Domain, int N, typename T_Float, unsigned NewtonSteps>
+			static void batch(const RootApprox<N, T_Float, NewtonSteps> &approx, const T_Float *y, T_Float *x, const size_t count)
+				{avx512::domain_batch<Domain, ops<T_Float>, false>(approx, y, x, count);}
+
+			template<ROOT_DOMAIN Domain, int N, typename T_Float, unsigned NewtonSteps>
+			static dispatch_batch_t<N, T_Float, NewtonSteps> get()    {return &batch<Domain, N, T_Float, NewtonSteps>;}
+		};
+		ROOTBEER_TARGET_END
+		ROOTBEER_AVX512_END
+#endif
+
+		/*
+			Entry points of a domain by instruction set, and the one dispatched to.
+		*/
+		template<ROOT_DOMAIN Domain, int N, typename T_Float, unsigned NewtonSteps>
+		struct dispatch_table
+		{
+			static_assert(std::is_same<T_Float, float>::value || std::is_same<T_Float, double>::value,
+				"only float and double batches are dispatched");
+
+			using batch_t = dispatch_batch_t<N, T_Float, NewtonSteps>;
+
+			static batch_t entry(const ROOT_ISA isa)
+			{
+				static const batch_t table[ROOT_ISA_COUNT] =
+				{
+					dispatch_entry<ROOT_ISA_SCALAR>::template get<Domain, N, T_Float, NewtonSteps>(),
+					dispatch_entry<ROOT_ISA_SSE41 >::template get<Domain, N, T_Float, NewtonSteps>(),
+					dispatch_entry<ROOT_ISA_AVX2  >::template get<Domain, N, T_Float, NewtonSteps>(),
+					dispatch_entry<ROOT_ISA_AVX512>::template get<Domain, N, T_Float, NewtonSteps>(),
+				};
+				return table[isa];
+			}
+
+			// The widest entry compiled, up to Dispatch_ISA()
+			static batch_t selected()
+			{
+				static const batch_t batch = [] {
+					int isa = Dispatch_ISA();
+					while (!entry(ROOT_ISA(isa))) --isa;
+					return entry(ROOT_ISA(isa));
+				}();
+				return batch;
+			}
+		};
+	}
+
+
+	/*
+		Batch calculation on the dispatched kernel.  y and x may be the same array.
+	*/
+	template<int N, typename T_Float, unsigned NewtonSteps>
+	void Dispatch_Apply(const RootApprox<N, T_Float, NewtonSteps> &approx, const T_Float *y, T_Float *x, size_t count)
+		{simd::dispatch_table<ROOT_FAST, N, T_Float, NewtonSteps>::selected()(approx, y, x, count);}
+	template<int N, typename T_Float, unsigned NewtonSteps>
+	void Dispatch_Apply(const RootApprox<N, T_Float, NewtonSteps> &approx, T_Float *yx, size_t count)
+		{simd::dispatch_table<ROOT_FAST, N, T_Float, NewtonSteps>::selected()(approx, yx, yx, count);}
+	template<int N, typename T_Float, unsigned NewtonSteps>
+	void Dispatch_Apply(const RootApprox_Safe<N, T_Float, NewtonSteps> &approx, const T_Float *y, T_Float *x, size_t count)
+		{simd::dispatch_table<ROOT_SAFE, N, T_Float, NewtonSteps>::selected()(approx, y, x, count);}
+	template<int N, typename T_Float, unsigned NewtonSteps>
+	void Dispatch_Apply(const RootApprox_Safe<N, T_Float, NewtonSteps> &approx, T_Float *yx, size_t count)
+		{simd::dispatch_table<ROOT_SAFE, N, T_Float, NewtonSteps>::selected()(approx, yx, yx, count);}
+
+
+	/*
+		Dispatched versions of rb_root and rb_root_safe, using the published designs.
+	*/
+	template<int N, unsigned NewtonSteps = 1, typename T_Float>
+	void rb_root_dispatch(const T_Float *y, T_Float *x, size_t count)
+	{
+		static const RootApprox<N, T_Float, NewtonSteps> design = RootApprox_Tuned<N, T_Float, NewtonSteps>();
+		Dispatch_Apply(design, y, x, count);
+	}
+	template<int N, unsigned NewtonSteps = 1, typename T_Float>
+	void rb_root_dispatch(T_Float *yx, size_t count)
+	{
+		static const RootApprox<N, T_Float, NewtonSteps> design = RootApprox_Tuned<N, T_Float, NewtonSteps>();
+		Dispatch_Apply(design, yx, count);
+	}
+	template<int N, unsigned NewtonSteps = 1, typename T_Float>
+	void rb_root_safe_dispatch(const T_Float *y, T_Float *x, size_t count)
+	{
+		static const RootApprox_Safe<N, T_Float, NewtonSteps> design = RootApprox_Tuned<N, T_Float, NewtonSteps>();
+		Dispatch_Apply(design, y, x, count);
+	}
+	template<int N, unsigned NewtonSteps = 1, typename T_Float>
+	void rb_root_safe_dispatch(T_Float *yx, size_t count)
+	{
+		static const RootApprox_Safe<N, T_Float, NewtonSteps> design = RootApprox_Tuned<N, T_Float, NewtonSteps>();
+		Dispatch_Apply(design, yx, count);
+	}
+}
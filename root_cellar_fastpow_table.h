@@ -0,0 +1,246 @@
+#pragma once
+#include <stddef.h>
+
+/*
+	Constants for rootbeer::FastPow, generated by Print_FastPow_Table.
+	Each row holds the offset followed by the pseudo-newtonian constant of each refinement,
+	for exponents from -4 to 4 in steps of 1/8.
+*/
+namespace rootbeer
+{
+	namespace detail
+	{
+		template<unsigned NewtonSteps> struct fastpow_table {};
+
+		template<> struct fastpow_table<0>
+		{
+			static const int exponent_min = -4, rows_per_unit = 8, rows = 65;
+			static const double *row(const size_t j)
+			{
+				static const double table[65][1] =
+				{
+					{0.2311910134}, // e = -4
+					{0.2250242197},
+					{0.218877069},
+					{0.2127495842},
+					{0.2066417835},
+					{0.2005536898},
+					{0.1944853204},
+					{0.1884366939},
+					{0.1824078303}, // e = -3
+					{0.1763987459},
+					{0.1704094582},
+					{0.164439984},
+					{0.1584903408},
+					{0.1525605421},
+					{0.1466506041},
+					{0.1407605417},
+					{0.1348903686}, // e = -2
+					{0.1290400982},
+					{0.1232097436},
+					{0.1173993171},
+					{0.1116088311},
+					{0.1058382971},
+					{0.1000877246},
+					{0.09435712447},
+					{0.08864650702}, // e = -1
+					{0.08295588101},
+					{0.07728525507},
+					{0.07163463723},
+					{0.06600403456},
+					{0.06039345495},
+					{0.0548029042},
+					{0.04923238799},
+					{0.04368191206}, // e = 0
+					{0.038472388},
+					{0.03328290399},
+					{0.02811345478},
+					{0.02296403461},
+					{0.0178346368},
+					{0.0127252552},
+					{0.007635880961},
+					{0.002566507185}, // e = 1
+					{-0.002482875367},
+					{-0.007512275838},
+					{-0.01252170334},
+					{-0.01751116836},
+					{-0.02248068268},
+					{-0.02743025602},
+					{-0.03235990134},
+					{-0.03726963139}, // e = 2
+					{-0.04215945826},
+					{-0.04702939563},
+					{-0.05187945799},
+					{-0.05670965978},
+					{-0.06152001594},
+					{-0.06631054149},
+					{-0.07108125399},
+					{-0.07583216961}, // e = 3
+					{-0.08056330623},
+					{-0.08527467989},
+					{-0.08996630956},
+					{-0.09463821602},
+					{-0.09929041589},
+					{-0.1039229305},
+					{-0.1085357803},
+					{-0.1131289853}, // e = 4
+				};
+				return table[j];
+			}
+		};
+
+		template<> struct fastpow_table<1>
+		{
+			static const int exponent_min = -4, rows_per_unit = 8, rows = 65;
+			static const double *row(const size_t j)
+			{
+				static const double table[65][2] =
+				{
+					{0.06864604265, 0.6250260627}, // e = -4
+					{0.06678658494, 0.6266111957},
+					{0.06493480561, 0.628202185},
+					{0.06309067448, 0.6297990452},
+					{0.0612541698, 0.6314017928},
+					{0.05942526134, 0.6330104417},
+					{0.05760392474, 0.6346250076},
+					{0.05579013422, 0.636245506},
+					{0.05398386295, 0.6378719513}, // e = -3
+					{0.05218508543, 0.6395043595},
+					{0.05039377449, 0.6411427446},
+					{0.04860990602, 0.6427871223},
+					{0.04683345258, 0.6444375074},
+					{0.04506438886, 0.6460939151},
+					{0.04330268827, 0.6477563598},
+					{0.04154832659, 0.6494248568},
+					{0.03980127812, 0.6510994215}, // e = -2
+					{0.03806151528, 0.6527800676},
+					{0.0363290144, 0.6544668109},
+					{0.03460374823, 0.6561596655},
+					{0.03288569264, 0.6578586467},
+					{0.03117482229, 0.659563769},
+					{0.02947111104, 0.6612750468},
+					{0.02777453372, 0.6629924953},
+					{0.02608506606, 0.6647161287}, // e = -1
+					{0.02440268158, 0.6664459619},
+					{0.02272735591, 0.6681820091},
+					{0.02105906338, 0.6699242848},
+					{0.01939777951, 0.6716728036},
+					{0.0177434793, 0.6734275799},
+					{0.01609613737, 0.6751886278},
+					{0.01445572916, 0.6769559619},
+					{0.0128222296, 0.6787295962}, // e = 0
+					{0.003695729134, 0.6769559619},
+					{-0.005423862709, 0.6751886278},
+					{-0.0145365215, 0.6734275795},
+					{-0.02364222041, 0.6716728036},
+					{-0.03274093656, 0.6699242848},
+					{-0.04183264412, 0.6681820091},
+					{-0.05091731865, 0.6664459619},
+					{-0.05999493426, 0.6647161287}, // e = 1
+					{-0.06906546611, 0.6629924953},
+					{-0.07812888926, 0.661275047},
+					{-0.08718517763, 0.659563769},
+					{-0.0962343076, 0.6578586467},
+					{-0.1052762516, 0.6561596655},
+					{-0.1143109858, 0.6544668109},
+					{-0.1233384846, 0.6527800676},
+					{-0.1323587219, 0.6510994215}, // e = 2
+					{-0.1413716729, 0.649424857},
+					{-0.1503773111, 0.6477563598},
+					{-0.1593756114, 0.6460939149},
+					{-0.1683665473, 0.6444375074},
+					{-0.1773500942, 0.6427871221},
+					{-0.186326225, 0.6411427445},
+					{-0.1952949143, 0.6395043595},
+					{-0.2042561365, 0.6378719517}, // e = 3
+					{-0.2132098659, 0.6362455059},
+					{-0.2221560754, 0.6346250077},
+					{-0.2310947388, 0.6330104417},
+					{-0.2400258308, 0.6314017926},
+					{-0.2489493249, 0.6297990455},
+					{-0.2578651948, 0.6282021847},
+					{-0.2667734143, 0.6266111957},
+					{-0.2756739567, 0.6250260631}, // e = 4
+				};
+				return table[j];
+			}
+		};
+
+		template<> struct fastpow_table<2>
+		{
+			static const int exponent_min = -4, rows_per_unit = 8, rows = 65;
+			static const double *row(const size_t j)
+			{
+				static const double table[65][3] =
+				{
+					{0.1421437218, 0.6551209879, 0.6958773226}, // e = -4
+					{0.1383598289, 0.656033371, 0.695742345},
+					{0.1345879093, 0.6569477432, 0.6956108023},
+					{0.1308279743, 0.6578641118, 0.6954826931},
+					{0.1270799742, 0.6587824591, 0.6953580157},
+					{0.1233439593, 0.6597028114, 0.6952367697},
+					{0.1196198494, 0.6606251367, 0.695118953},
+					{0.1159076359, 0.6615494349, 0.6950045644},
+					{0.1122073604, 0.6624757267, 0.6948936034}, // e = -3
+					{0.1085189836, 0.6634040021, 0.6947860686},
+					{0.1048424787, 0.6643342488, 0.6946819585},
+					{0.1011778005, 0.6652664529, 0.694581272},
+					{0.09752501026, 0.6662006442, 0.6944840087},
+					{0.09388404572, 0.6671367994, 0.6943901671},
+					{0.09025490844, 0.6680749227, 0.6942997463},
+					{0.08663757116, 0.669015005, 0.6942127453},
+					{0.0830320486, 0.6699570575, 0.6941291635}, // e = -2
+					{0.07943829114, 0.6709010614, 0.6940489998},
+					{0.0758563183, 0.6718470321, 0.6939722538},
+					{0.07228610812, 0.6727949545, 0.6938989238},
+					{0.06872759449, 0.6737448116, 0.6938290096},
+					{0.06518084272, 0.6746966339, 0.6937625107},
+					{0.06164576256, 0.6756503833, 0.6936994257},
+					{0.05812245333, 0.6766061112, 0.6936397551},
+					{0.0546107432, 0.6775637385, 0.693583497}, // e = -1
+					{0.05111073877, 0.678523322, 0.6935306516},
+					{0.04762238561, 0.6794848392, 0.6934812181},
+					{0.04414563386, 0.6804482705, 0.6934351959},
+					{0.0406805459, 0.6814136583, 0.6933925852},
+					{0.0372270539, 0.6823809476, 0.6933533843},
+					{0.03378510417, 0.6833501446, 0.6933175937},
+					{0.03035482241, 0.6843213036, 0.6932852132},
+					{0.02693602334, 0.6852943405, 0.6932562417}, // e = 0
+					{0.01959482225, 0.6843213036, 0.6932852132},
+					{0.01226510437, 0.6833501446, 0.6933175937},
+					{0.004947054192, 0.6823809478, 0.6933533843},
+					{-0.0023593947, 0.6814136786, 0.6933925852},
+					{-0.00965436654, 0.6804482704, 0.6934351959},
+					{-0.01693761437, 0.6794848392, 0.6934812181},
+					{-0.02420926107, 0.678523322, 0.6935306516},
+					{-0.03146925686, 0.6775637385, 0.693583497}, // e = 1
+					{-0.03871754695, 0.6766061112, 0.6936397551},
+					{-0.04595416479, 0.6756504178, 0.6936994263},
+					{-0.05317915635, 0.6746966339, 0.6937625107},
+					{-0.06039240502, 0.6737448116, 0.6938290096},
+					{-0.06759389093, 0.6727949549, 0.6938989238},
+					{-0.07478368556, 0.6718470278, 0.6939722536},
+					{-0.08196170933, 0.6709010612, 0.6940489998},
+					{-0.0891279514, 0.6699570575, 0.6941291635}, // e = 2
+					{-0.09628242876, 0.6690150052, 0.6942127453},
+					{-0.1034250916, 0.6680749227, 0.6942997463},
+					{-0.1105559591, 0.6671367981, 0.6943901671},
+					{-0.1176749897, 0.6662006442, 0.6944840087},
+					{-0.1247822003, 0.6652664526, 0.694581272},
+					{-0.1318775219, 0.6643342486, 0.6946819585},
+					{-0.1389610158, 0.663404002, 0.6947860686},
+					{-0.1460326386, 0.6624757274, 0.6948936034}, // e = 3
+					{-0.1530923639, 0.6615494344, 0.6950045644},
+					{-0.1601401501, 0.6606251371, 0.695118953},
+					{-0.1671760409, 0.6597028111, 0.6952367697},
+					{-0.1742000264, 0.6587824586, 0.6953580157},
+					{-0.1812120507, 0.6578641007, 0.6954826927},
+					{-0.1882120898, 0.6569477435, 0.6956108023},
+					{-0.1952001708, 0.6560333712, 0.695742345},
+					{-0.2021762774, 0.6551209881, 0.6958773226}, // e = 4
+				};
+				return table[j];
+			}
+		};
+	}
+}
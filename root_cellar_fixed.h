@@ -0,0 +1,524 @@
+#pragma once
+
+
+#include <cstdint>
+#include <cmath>
+#include <array>
+#include <limits>
+#include <string>
+#include <vector>
+#include <iostream>
+#include <iomanip>
+
+#include "root_cellar.h"
+
+
+/*
+	Roots of fixed-point numbers, for code without an FPU.
+
+	A Q-format number is an integer standing for raw * 2^-FracBits:
+	Q16.16 is q_format<int32_t, 16> and Q1.31 is q_format<int32_t, 31>.
+
+	The float hack reads a float's bits as a piecewise-linear logarithm.  An
+	integer has no exponent field, but counting its leading zeros gives one:
+	shifting y = 2^e (1+f) to normalize it, e + f approximates log2(y) just
+	as a float's bits do.  The estimate divides this pseudo-logarithm by N,
+	adds a constant and decodes the result the same way.
+
+	Intermediate values are pseudo-floats, a normalized 32-bit mantissa with
+	an exponent, so precision doesn't depend on the magnitude of y or on the
+	formats.  Refinements use only integer multiplies.  They refine the
+	inverse root z ~ y^(-1/|N|) as RootApprox does,
+		z' = z ((1-m) + m y z^|N|)
+	and a positive root avoids the division in its usual refinement: before
+	the last step it forms x = y z^(|N|-1), and the last step becomes
+		x' = x ((1-m) + m y z^|N|)
+	with m near 1/N - 1.
+
+	Constants are independent of the formats, so one design serves them all.
+*/
+namespace rootbeer
+{
+	namespace detail
+	{
+		/*
+			A positive number mant * 2^(exp-31), with mant normalized to [2^31, 2^32).
+		*/
+		struct fixed_real
+		{
+			uint32_t mant;
+			int32_t  exp;
+
+			double value() const    {return std::ldexp(double(mant), int(exp) - 31);}
+		};
+
+		// Q2.30 representation of a constant, rounded to nearest
+		constexpr int32_t to_q30(const double v)    {return int32_t(v * 1073741824.0 + (v < 0 ? -.5 : .5));}
+		constexpr double  from_q30(const int32_t v) {return double(v) / 1073741824.0;}
+	}
+
+
+	/*
+		A fixed-point format: T_Raw with FracBits fraction bits.
+		Signed formats count the sign among their integer bits.
+	*/
+	template<typename T_Raw, unsigned FracBits>
+	struct q_format
+	{
+		static_assert(std::is_integral<T_Raw>::value && sizeof(T_Raw) <= 4, "Q formats are integers of up to 32 bits");
+		static_assert(FracBits < 8*sizeof(T_Raw), "a Q format needs an integer bit");
+
+		using raw_t = T_Raw;
+		static const unsigned frac_bits = FracBits, int_bits = unsigned(8*sizeof(T_Raw)) - FracBits;
+
+		static constexpr raw_t max()                 {return std::numeric_limits<raw_t>::max();}
+		static double          value(const raw_t r)  {return std::ldexp(double(r), -int(FracBits));}
+		static std::string     name()
+		{
+			return std::string(std::is_signed<raw_t>::value ? "Q" : "UQ")
+				+ std::to_string(int_bits) + "." + std::to_string(frac_bits);
+		}
+	};
+
+	using q1_15  = q_format<int16_t, 15>;
+	using q16_16 = q_format<int32_t, 16>;
+	using q1_31  = q_format<int32_t, 31>;
+
+
+	/*
+		Approximate roots of fixed-point numbers from T_QIn to T_QOut.
+		Non-positive inputs give 0, or the largest output for inverse roots;
+		results too large for T_QOut saturate.
+	*/
+	template<int N, typename T_QIn, unsigned NewtonSteps = 1, typename T_QOut = T_QIn>
+	struct RootFixedApprox
+	{
+		static_assert(N != 0, "0th root is invalid");
+
+		static constexpr int DEG = ((N>0) ? N : -N);
+		static_assert(DEG <= 4, "residuals multiply at most five 32-bit mantissas");
+
+		using in_format  = T_QIn;
+		using out_format = T_QOut;
+		using in_t       = typename T_QIn::raw_t;
+		using out_t      = typename T_QOut::raw_t;
+		using real_t     = detail::fixed_real;
+
+		using steps_t    = std::array<int32_t, NewtonSteps>;
+
+		// Fraction bits of the pseudo-logarithm, and of the Q2.30 refinement factors
+		static const int LOG_BITS = 24, M_BITS = 30;
+
+		// The estimate is of the inverse root unless a positive root has no refinements
+		static constexpr bool ESTIMATE_INVERSE = (N < 0 || NewtonSteps > 0);
+
+		int32_t constant;   // Added to the pseudo-logarithm, in units of 2^-24
+		steps_t newton_m;   // Pseudo-newtonian constant for each refinement, in Q2.30
+
+		// Newton's constant: 1/N, or 1/N - 1 for the last step of a positive root
+		static constexpr double nominal_m(const unsigned step)
+		{
+			return (N > 0 && step+1 == NewtonSteps) ? 1.0/double(N) - 1.0 : -1.0/double(DEG);
+		}
+
+		explicit RootFixedApprox(int32_t _constant) : constant(_constant)
+		{
+			for (unsigned i = 0; i < NewtonSteps; ++i) newton_m[i] = detail::to_q30(nominal_m(i));
+		}
+		constexpr RootFixedApprox(int32_t _constant, const steps_t &_newton_m) :
+			constant(_constant), newton_m(_newton_m) {}
+
+		// Normalize a positive input
+		static real_t normalize(const in_t y)
+		{
+			const uint32_t u = uint32_t(y);
+			const unsigned s = detail::clz32(u);
+			return {u << s, int32_t(31 - s) - int32_t(T_QIn::frac_bits)};
+		}
+
+		/*
+			Initial estimate from the pseudo-logarithm.
+		*/
+		real_t initialEstimate(const real_t y) const
+		{
+			const int32_t
+				lg = y.exp * (int32_t(1) << LOG_BITS) + int32_t((y.mant << 1) >> (32 - LOG_BITS)),
+				q  = detail::div_i<DEG>(lg),
+				lx = ESTIMATE_INVERSE ? (constant - q) : (constant + q);
+			return {0x80000000u | ((uint32_t(lx) << (32 - LOG_BITS)) >> 1), lx >> LOG_BITS};
+		}
+
+		/*
+			The residual t = y z^|N| in Q2.30, which is 1 for an exact inverse root.
+			Products lose a bit of precision apiece; t saturates below 2.
+		*/
+		static uint32_t residual(const real_t y, const real_t z)
+		{
+			uint32_t acc = y.mant;
+			for (int j = 0; j < DEG; ++j) acc = detail::mulhi(acc, z.mant);
+
+			// Shift by the exponent, clamped where the result saturates or vanishes anyway
+			const int32_t shift = std::max(-31, std::min(31, y.exp + DEG * z.exp + DEG - 1));
+			const uint64_t t = (uint64_t(acc) << 32) >> (32 - shift);
+			return uint32_t(std::min<uint64_t>(t, 0x7FFFFFFFu));
+		}
+
+		/*
+			One refinement: x ((1-m) + m t), with m and t in Q2.30.
+		*/
+		static real_t newtonianRefinement(const real_t x, const uint32_t t, const int32_t m)
+		{
+			int64_t r = (int64_t(1) << M_BITS) - m + ((int64_t(m) * int64_t(t)) >> M_BITS);
+			r = std::max<int64_t>(1, std::min<int64_t>(r, 0x7FFFFFFF));
+
+			const uint64_t prod = uint64_t(x.mant) * uint64_t(r);
+			const unsigned n = detail::clz64(prod);
+			return {uint32_t((prod << n) >> 32), x.exp + 2 - int32_t(n)};
+		}
+
+		/*
+			The root of a normalized input, before rounding to the output format.
+		*/
+		real_t core(const real_t y) const
+		{
+			real_t z = initialEstimate(y);
+			if (N < 0 || NewtonSteps == 0)
+			{
+				for (unsigned i = 0; i < NewtonSteps; ++i)
+					z = newtonianRefinement(z, residual(y, z), newton_m[i]);
+				return z;
+			}
+
+			for (unsigned i = 0; i+1 < NewtonSteps; ++i)
+				z = newtonianRefinement(z, residual(y, z), newton_m[i]);
+
+			// x = y z^(N-1), refined with the residual of z
+			uint32_t acc = y.mant;
+			for (int j = 1; j < DEG; ++j) acc = detail::mulhi(acc, z.mant);
+			const unsigned n = detail::clz32(acc);
+			const real_t x = {acc << n, y.exp + (DEG-1) * z.exp + (DEG-1) - int32_t(n)};
+			return newtonianRefinement(x, residual(y, z), newton_m[NewtonSteps-1]);
+		}
+
+		// Round to the output format, saturating
+		static out_t round(const real_t x)
+		{
+			const uint64_t top = uint64_t(T_QOut::max());
+			const int32_t shift = x.exp - 31 + int32_t(T_QOut::frac_bits), down = std::max(0, std::min(63, -shift));
+			const uint64_t v = (shift > 0) ? top : ((uint64_t(x.mant) + ((uint64_t(1) << down) >> 1)) >> down);
+			return out_t(std::min(v, top));
+		}
+
+		/*
+			Complete calculation.
+		*/
+		out_t operator()(const in_t y) const
+		{
+			if (!(y > 0)) return (N > 0) ? out_t(0) : T_QOut::max();
+			return round(core(normalize(y)));
+		}
+
+		/*
+			Batch calculation over arrays.  y and x may be the same array
+			if the formats have the same size.
+		*/
+		void apply(const in_t *y, out_t *x, size_t count) const
+		{
+			for (size_t i = 0; i < count; ++i) x[i] = (*this)(y[i]);
+		}
+	};
+
+
+	/*
+		Measure every positive input of a fixed-point approximation.
+		Errors are relative and in units of the output's last place, against
+		the exact root; inputs whose exact root the output can't hold are
+		counted as saturated and left out.
+	*/
+	struct FixedApprox_Stats
+	{
+		PowApprox_Stats relative, lsb;
+		uint64_t        saturated = 0;
+	};
+
+	template<int ROOT_INDEX, typename T_Approx, typename T_Executor>
+	inline FixedApprox_Stats Test_Root_Approx_Fixed(
+		const T_Approx &approx,
+		typename T_Approx::in_t range_min,
+		typename T_Approx::in_t range_max,
+		T_Executor &&executor)
+	{
+		using in_format  = typename T_Approx::in_format;
+		using out_format = typename T_Approx::out_format;
+		using in_t       = typename T_Approx::in_t;
+
+		const double
+			out_scale = std::ldexp(1.0, int(out_format::frac_bits)),
+			out_top   = double(out_format::max()) + .5;
+
+		struct partial_t {PowApprox_Accumulator relative, lsb; uint64_t saturated = 0;};
+		std::vector<partial_t> partial(detail::count_chunks(range_min, range_max));
+		executor.parallel_for(partial.size(), [&](const size_t c)
+		{
+			partial_t &acc = partial[c];
+			detail::scan_chunk(c, range_min, range_max, [&](const in_t i)
+			{
+				const double
+					y     = in_format::value(i),
+					exact = root_i<ROOT_INDEX>(y) * out_scale;
+				if (!(exact < out_top)) {++acc.saturated; return;}
+				const double error = double(approx(i)) - exact;
+				acc.relative.add(error / exact, y);
+				acc.lsb.add(error, y);
+			});
+		});
+
+		partial_t total;
+		for (auto &p : partial)
+		{
+			total.relative.merge(p.relative);
+			total.lsb.merge(p.lsb);
+			total.saturated += p.saturated;
+		}
+		FixedApprox_Stats stats;
+		stats.relative  = total.relative.stats();
+		stats.lsb       = total.lsb.stats();
+		stats.saturated = total.saturated;
+		return stats;
+	}
+
+	template<int ROOT_INDEX, typename T_Approx>
+	inline FixedApprox_Stats Test_Root_Approx_Fixed(const T_Approx &approx,
+		typename T_Approx::in_t range_min = 1, typename T_Approx::in_t range_max = T_Approx::in_format::max())
+	{
+		return Test_Root_Approx_Fixed<ROOT_INDEX>(approx, range_min, range_max, SerialExecutor());
+	}
+
+	template<int ROOT_INDEX, typename T_Approx>
+	inline FixedApprox_Stats Test_Root_Approx_Fixed_Parallel(const T_Approx &approx,
+		typename T_Approx::in_t range_min = 1, typename T_Approx::in_t range_max = T_Approx::in_format::max(),
+		unsigned threads = 0)
+	{
+		ThreadPool pool(threads);
+		return Test_Root_Approx_Fixed<ROOT_INDEX>(approx, range_min, range_max, pool);
+	}
+
+
+	namespace detail
+	{
+		/*
+			Inputs for scoring fixed-point designs, with their exact roots:
+			evenly spaced mantissas over 2|N| binades around 1.  The estimate
+			repeats every |N| binades, and the binades below 1 show the
+			rounding of negative pseudo-logarithms.
+		*/
+		struct fixed_sample {fixed_real y; double root;};
+
+		template<int N>
+		std::vector<fixed_sample> fixed_samples(const unsigned per_binade_log2 = 12)
+		{
+			static const int DEG = ((N>0) ? N : -N);
+			std::vector<fixed_sample> samples;
+			for (int e = -DEG; e < DEG; ++e)
+				for (uint32_t j = 0; j < (uint32_t(1) << per_binade_log2); ++j)
+				{
+					const fixed_real y = {0x80000000u | (j << (31 - per_binade_log2)), e};
+					samples.push_back({y, root_i<N>(y.value())});
+				}
+			return samples;
+		}
+
+		// Worst relative error of a design's unrounded results over the samples
+		template<typename T_Design>
+		double fixed_score(const T_Design &design, const std::vector<fixed_sample> &samples)
+		{
+			double worst = 0.0;
+			for (auto &s : samples)
+				worst = std::max(worst, std::abs(design.core(s.y).value() / s.root - 1.0));
+			return worst;
+		}
+	}
+
+	/*
+		Search for the best fixed-point design, scored by worst relative error
+		over fixed_samples.
+
+		The constant is scanned coarsely and refined by a halving stride, as in
+		RootTableApprox_Best, with the last refinement's m fitted to each by
+		ternary search and the others at Newton's value.  With two or more
+		refinements, a pattern search then moves the constant and every m but
+		the last together, as in RootApprox_Best_Steps.
+
+		Fits are run on the executor's threads; ties go to the earliest.
+	*/
+	template<int N, typename T_QIn = q16_16, unsigned NewtonSteps = 1, typename T_QOut = T_QIn, typename T_Executor>
+	RootFixedApprox<N, T_QIn, NewtonSteps, T_QOut> RootFixedApprox_Best(T_Executor &&executor)
+	{
+		using design_t = RootFixedApprox<N, T_QIn, NewtonSteps, T_QOut>;
+		const auto samples = detail::fixed_samples<N>();
+
+		// Search coordinates: the constant, then every m but the last
+		static const unsigned DIMS = (NewtonSteps ? NewtonSteps : 1), LAST = DIMS-1;
+		using point_t = std::array<int32_t, DIMS>;
+
+		auto make = [](const point_t &p, const int32_t m_last)
+		{
+			design_t design(p[0]);
+			for (unsigned s = 0; s < LAST; ++s) design.newton_m[s] = p[s+1];
+			if (NewtonSteps) design.newton_m[LAST] = m_last;
+			return design;
+		};
+
+		// Fit the last m by ternary search within a fraction of m_near, finishing exhaustively
+		struct fit_t {double score; int32_t m_last;};
+		auto fit = [&](const point_t &p, const int32_t m_near, const double bracket) -> fit_t
+		{
+			auto get_score = [&](const int32_t m)    {return detail::fixed_score(make(p, m), samples);};
+			if (NewtonSteps == 0) return {get_score(0), 0};
+
+			const int32_t width = int32_t(std::abs(double(m_near)) * bracket);
+			int32_t lo = m_near - width, hi = m_near + width;
+			while (hi - lo > 2)
+			{
+				int32_t a = lo + (hi-lo)/3, b = hi - (hi-lo)/3;
+				if (get_score(a) < get_score(b)) hi = b;
+				else                             lo = a;
+			}
+			fit_t best = {get_score(lo), lo};
+			for (int32_t m = lo+1; m <= hi; ++m)
+			{
+				double score = get_score(m);
+				if (score < best.score) best = {score, m};
+			}
+			return best;
+		};
+
+		point_t p = {};
+		for (unsigned s = 0; s < LAST; ++s) p[s+1] = detail::to_q30(design_t::nominal_m(s));
+		const int32_t m_nominal = NewtonSteps ? detail::to_q30(design_t::nominal_m(LAST)) : 0;
+
+		// The pseudo-logarithm errs by at most .0861 in either direction
+		static const int32_t K_RANGE = int32_t(1) << (design_t::LOG_BITS - 2), COARSE = 32;
+		std::cout << std::dec << "//Searching fixed-point k in [" << -K_RANGE << "," << K_RANGE << "] ";
+
+		std::vector<int32_t> ks;
+		for (int32_t i = 0; i <= COARSE; ++i) ks.push_back(-K_RANGE + 2 * K_RANGE / COARSE * i);
+		int32_t stride = 2 * K_RANGE / COARSE;
+
+		fit_t best = {1e20, m_nominal};
+		std::vector<fit_t> fits;
+		while (ks.size())
+		{
+			std::cout << '.' << std::flush;
+			fits.resize(ks.size());
+			executor.parallel_for(ks.size(), [&](const size_t i)
+			{
+				point_t q = p;
+				q[0] = ks[i];
+				fits[i] = fit(q, m_nominal, .2);
+			});
+			size_t pick = ks.size();
+			for (size_t i = 0; i < ks.size(); ++i)
+				if (fits[i].score < best.score) {best = fits[i]; pick = i;}
+
+			if (pick < ks.size()) p[0] = ks[pick];
+			else                  stride /= 2;
+			ks.clear();
+			if (stride > 0) ks = {p[0] - stride, p[0] + stride};
+		}
+
+		if (DIMS > 1)
+		{
+			// Every combination of -1, 0 and +1 per coordinate, except no move
+			std::vector<point_t> offsets;
+			for (unsigned c = 1, count = unsigned(std::pow(3, DIMS)); c < count; ++c)
+			{
+				point_t o;
+				for (unsigned d = 0, cc = c; d < DIMS; ++d, cc /= 3) o[d] = int32_t(cc % 3) - 1;
+				offsets.push_back(o);
+			}
+
+			// A step of the constant moves log2 by 2^-24; a step of m moves it by 2^-30
+			std::vector<point_t> points(offsets.size());
+			fits.resize(offsets.size());
+			for (stride = int32_t(1) << 12; stride > 0; )
+			{
+				std::cout << '.' << std::flush;
+				for (size_t i = 0; i < offsets.size(); ++i)
+					for (unsigned d = 0; d < DIMS; ++d) points[i][d] = p[d] + offsets[i][d] * (d ? stride << 6 : stride);
+
+				executor.parallel_for(points.size(), [&](const size_t i)
+				{
+					fits[i] = fit(points[i], best.m_last, .05);
+				});
+
+				size_t pick = points.size();
+				for (size_t i = 0; i < points.size(); ++i)
+					if (fits[i].score < best.score) {best = fits[i]; pick = i;}
+
+				if (pick < points.size()) p = points[pick];
+				else                      stride /= 2;
+			}
+		}
+		std::cout << std::endl;
+
+		design_t result = make(p, best.m_last);
+		std::cout << "//  ...best design k=" << result.constant << std::setprecision(10);
+		for (unsigned s = 0; s < NewtonSteps; ++s) std::cout << (s ? "," : ", m=") << detail::from_q30(result.newton_m[s]);
+		std::cout << std::setprecision(6) << " with error score " << best.score << std::endl;
+		return result;
+	}
+
+	template<int N, typename T_QIn = q16_16, unsigned NewtonSteps = 1, typename T_QOut = T_QIn>
+	RootFixedApprox<N, T_QIn, NewtonSteps, T_QOut> RootFixedApprox_Best()
+	{
+		return RootFixedApprox_Best<N, T_QIn, NewtonSteps, T_QOut>(SerialExecutor());
+	}
+
+	template<int N, typename T_QIn = q16_16, unsigned NewtonSteps = 1, typename T_QOut = T_QIn>
+	RootFixedApprox<N, T_QIn, NewtonSteps, T_QOut> RootFixedApprox_Best_Parallel(unsigned threads = 0)
+	{
+		ThreadPool pool(threads);
+		return RootFixedApprox_Best<N, T_QIn, NewtonSteps, T_QOut>(pool);
+	}
+
+
+	/*
+		The designs published in README.md, found by RootFixedApprox_Best.
+		Supports N in {±2, ±3, ±4} and 0-2 refinement steps.
+		README.md also tables their worst errors over every positive input
+		after rounding, which `main fixed-check` holds them to.
+	*/
+	namespace detail
+	{
+		struct tuned_fixed_design {int32_t k; double m[2];};
+
+		inline const tuned_fixed_design &tuned_fixed(const int N, const unsigned steps)
+		{
+			static const tuned_fixed_design table[6][3] =
+			{
+				{{ -614885, {}}, {-1752533, {-.5351000549}}, {-1133392, {-.5,          -.5010899305}}},
+				{{-1128377, {}}, {-1752533, {-.5351000549}}, {-1133366, {-.4999998808, -.5010898402}}},
+				{{ -564683, {}}, {-1709354, {-.7462466611}}, {-1120546, {-.3333332138, -.6699015861}}},
+				{{-1110030, {}}, {-1705431, {-.3647065926}}, {-1120530, {-.333333333,  -.3346266784}}},
+				{{ -627098, {}}, {-1563020, {-.8684688695}}, {-1011519, {-.2499923706, -.7552853357}}},
+				{{ -999284, {}}, {-1555966, {-.2774444288}}, {-1011618, {-.2499980927, -.2512570508}}},
+			};
+			return table[2*((N<0 ? -N : N) - 2) + (N<0)][steps];
+		}
+	}
+
+	template<int N, typename T_QIn, unsigned NewtonSteps = 1, typename T_QOut = T_QIn>
+	RootFixedApprox<N, T_QIn, NewtonSteps, T_QOut> RootFixedApprox_Tuned()
+	{
+		static const int DEG = ((N>0) ? N : -N);
+		static_assert(DEG >= 2 && DEG <= 4, "no published design for this root index");
+		static_assert(NewtonSteps <= 2, "no published design for this many refinements");
+
+		using design_t = RootFixedApprox<N, T_QIn, NewtonSteps, T_QOut>;
+		const auto &design = detail::tuned_fixed(N, NewtonSteps);
+		typename design_t::steps_t m;
+		for (unsigned i = 0; i < NewtonSteps; ++i) m[i] = detail::to_q30(design.m[i]);
+		return design_t(design.k, m);
+	}
+}
@@ -1,333 +1,2998 @@
-#pragma once
-#include <stdint.h>
-
-
-// Functions optimized for worst-case error
-
-
-//Searching k in [0x1fba7da0,0x1fc00000], m in [0.5,0.75] ...........
-//  ...best design k=1fbed49a, m=0.510929 with error score 0.000239058
-/*
-	Approximate x^(1/2) with 1 newtonian steps
-	Error:
-		RMS:  0.000148007
-		mean: -4.54788e-05
-		min:  -0.000239056 @ 1.62077
-		max:  0.000239058 @ 1.99997
-*/
-float rb_2_root(const float y)
-{
-	union {float x; int32_t i;}; x = y; // interpret float as integer
-	i = 0x1fbed49a + (i >> 1); // log-approximation hack
-	x = 0.489071f * x + 0.510929f * y / x; // newtonian step #1
-	return x;
-}
-
-//Searching k in [0x5f2f7900,0x5f400000], m in [-0.5,-0.75] ...........
-//  ...best design k=5f32a121, m=-0.535102 with error score 0.000773445
-/*
-	Approximate x^(1/-2) with 1 newtonian steps
-	Error:
-		RMS:  0.000494072
-		mean: -2.5526e-05
-		min:  -0.000773442 @ 3.58223
-		max:  0.000773445 @ 3.22659
-*/
-float rb_inv_2_root(const float y)
-{
-	union {float x; int32_t i;}; x = y; // interpret float as integer
-	i = 0x5f32a121 - (i >> 1); // log-approximation hack
-	x *= 1.5351f - 0.535102f * y * (x*x); // newtonian step #1
-	return x;
-}
-
-//Searching k in [0x2a4dfcc0,0x2a555540], m in [0.333333,0.5] ...........
-//  ...best design k=2a543aa3, m=0.347252 with error score 0.000430098
-/*
-	Approximate x^(1/3) with 1 newtonian steps
-	Error:
-		RMS:  0.000237859
-		mean: -9.77778e-05
-		min:  -0.000430098 @ 1.63107
-		max:  0.000430033 @ 1.99999
-*/
-float rb_3_root(const float y)
-{
-	union {float x; int32_t i;}; x = y; // interpret float as integer
-	i = 0x2a543aa3 + (i / 3); // log-approximation hack
-	x = 0.652748f * x + 0.347252f * y / (x*x); // newtonian step #1
-	return x;
-}
-
-//Searching k in [0x549bfa00,0x54aaab00], m in [-0.333333,-0.5] ...........
-//  ...best design k=549da7bf, m=-0.364707 with error score 0.00102717
-/*
-	Approximate x^(1/-3) with 1 newtonian steps
-	Error:
-		RMS:  0.000742809
-		mean: 0.000277928
-		min:  -0.00102717 @ 6.78018
-		max:  0.00102716 @ 5.40931
-*/
-float rb_inv_3_root(const float y)
-{
-	union {float x; int32_t i;}; x = y; // interpret float as integer
-	i = 0x549da7bf - (i / 3); // log-approximation hack
-	x *= 1.36471f - 0.364707f * y * (x*x*x); // newtonian step #1
-	return x;
-}
-
-//Searching k in [0x2f97bc80,0x2fa00000], m in [0.25,0.375] ...........
-//  ...best design k=2f9ed7c0, m=0.266598 with error score 0.000714053
-/*
-	Approximate x^(1/4) with 1 newtonian steps
-	Error:
-		RMS:  0.000444122
-		mean: -0.000195135
-		min:  -0.000714043 @ 1.71143
-		max:  0.000714053 @ 3.99998
-*/
-float rb_4_root(const float y)
-{
-	union {float x; int32_t i;}; x = y; // interpret float as integer
-	i = 0x2f9ed7c0 + (i >> 2); // log-approximation hack
-	x = 0.733402f * x + 0.266598f * y / (x*x*x); // newtonian step #1
-	return x;
-}
-
-//Searching k in [0x4f523a00,0x4f600000], m in [-0.25,-0.375] ...........
-//  ...best design k=4f542107, m=-0.277446 with error score 0.00110848
-/*
-	Approximate x^(1/-4) with 1 newtonian steps
-	Error:
-		RMS:  0.000733642
-		mean: 0.000175304
-		min:  -0.00110848 @ 13.0323
-		max:  0.00110847 @ 1.3249
-*/
-float rb_inv_4_root(const float y)
-{
-	union {float x; int32_t i;}; x = y; // interpret float as integer
-	i = 0x4f542107 - (i >> 2); // log-approximation hack
-	x *= 1.27745f - 0.277446f * y * (x*x*x*x); // newtonian step #1
-	return x;
-}
-
-
-//Searching k in [0x1fba7da0,0x1fc00000], m in [0.5,0.5] .........
-//  ...best design k=1fbb4f2e, m=0.5 with error score 0.0347475
-/*
-	Approximate x^(1/2) with 0 newtonian steps
-	Error:
-		RMS:  0.0190506
-		mean: -0.005133
-		min:  -0.0347474 @ 1.07329
-		max:  0.0347475 @ 2
-*/
-float rb0_2_root(const float y)
-{
-	union {float x; int32_t i;}; x = y; // interpret float as integer
-	i = 0x1fbb4f2e + (i >> 1); // log-approximation hack
-	return x;
-}
-
-//Searching k in [0x5f2f7900,0x5f400000], m in [-0.5,-0.5] ..........
-//  ...best design k=5f37642f, m=-0.5 with error score 0.0342129
-/*
-	Approximate x^(1/-2) with 0 newtonian steps
-	Error:
-		RMS:  0.0244769
-		mean: 0.01338
-		min:  -0.0342129 @ 3.73098
-		max:  0.0342129 @ 2.57689
-*/
-float rb0_inv_2_root(const float y)
-{
-	union {float x; int32_t i;}; x = y; // interpret float as integer
-	i = 0x5f37642f - (i >> 1); // log-approximation hack
-	return x;
-}
-
-//Searching k in [0x2a4dfcc0,0x2a555540], m in [0.333333,0.333333] .........
-//  ...best design k=2a510680, m=0.333333 with error score 0.0315547
-/*
-	Approximate x^(1/3) with 0 newtonian steps
-	Error:
-		RMS:  0.0180422
-		mean: 0.00321401
-		min:  -0.0315546 @ 1.10097
-		max:  0.0315547 @ 2
-*/
-float rb0_3_root(const float y)
-{
-	union {float x; int32_t i;}; x = y; // interpret float as integer
-	i = 0x2a510680 + (i / 3); // log-approximation hack
-	return x;
-}
-
-//Searching k in [0x549bfa00,0x54aaab00], m in [-0.333333,-0.333333] ..........
-//  ...best design k=54a232a3, m=-0.333333 with error score 0.0342405
-/*
-	Approximate x^(1/-3) with 0 newtonian steps
-	Error:
-		RMS:  0.0195931
-		mean: 0.0068072
-		min:  -0.0342405 @ 7.20605
-		max:  0.0342405 @ 2.90059
-*/
-float rb0_inv_3_root(const float y)
-{
-	union {float x; int32_t i;}; x = y; // interpret float as integer
-	i = 0x54a232a3 - (i / 3); // log-approximation hack
-	return x;
-}
-
-//Searching k in [0x2f97bc80,0x2fa00000], m in [0.25,0.25] .........
-//  ...best design k=2f9b374e, m=0.25 with error score 0.0342323
-/*
-	Approximate x^(1/4) with 0 newtonian steps
-	Error:
-		RMS:  0.015625
-		mean: 0.00425431
-		min:  -0.034232 @ 1.1495
-		max:  0.0342323 @ 4
-*/
-float rb0_4_root(const float y)
-{
-	union {float x; int32_t i;}; x = y; // interpret float as integer
-	i = 0x2f9b374e + (i >> 2); // log-approximation hack
-	return x;
-}
-
-//Searching k in [0x4f523a00,0x4f600000], m in [-0.25,-0.25] ..........
-//  ...best design k=4f58605b, m=-0.25 with error score 0.0312108
-/*
-	Approximate x^(1/-4) with 0 newtonian steps
-	Error:
-		RMS:  0.020528
-		mean: 0.00879536
-		min:  -0.0312108 @ 14.0941
-		max:  0.0312107 @ 5.40988
-*/
-float rb0_inv_4_root(const float y)
-{
-	union {float x; int32_t i;}; x = y; // interpret float as integer
-	i = 0x4f58605b - (i >> 2); // log-approximation hack
-	return x;
-}
-
-
-
-//Searching k in [0x1fba7da0,0x1fc00000], m in [0.5,0.75] ...........
-//  ...best design k=1fbb75ad, m=0.500122 with error score 1.68567e-07
-/*
-	Approximate x^(1/2) with 2 newtonian steps
-	Error:
-		RMS:  4.7967e-08
-		mean: -1.41369e-08
-		min:  -1.64985e-07 @ 2.08829
-		max:  1.68567e-07 @ 2.00049
-*/
-float rb2_2_root(const float y)
-{
-	union {float x; int32_t i;}; x = y; // interpret float as integer
-	i = 0x1fbb75ad + (i >> 1); // log-approximation hack
-	x = 0.499878f * x + 0.500122f * y / x; // newtonian step #1
-	x = 0.499878f * x + 0.500122f * y / x; // newtonian step #2
-	return x;
-}
-
-//Searching k in [0x5f2f7900,0x5f400000], m in [-0.5,-0.75] ...........
-//  ...best design k=5f3634f9, m=-0.501326 with error score 1.40452e-06
-/*
-	Approximate x^(1/-2) with 2 newtonian steps
-	Error:
-		RMS:  8.95917e-07
-		mean: 6.21959e-07
-		min:  -1.38048e-06 @ 3.7251
-		max:  1.40452e-06 @ 2.83293
-*/
-float rb2_inv_2_root(const float y)
-{
-	union {float x; int32_t i;}; x = y; // interpret float as integer
-	i = 0x5f3634f9 - (i >> 1); // log-approximation hack
-	x *= 1.50133f - 0.501326f * y * (x*x); // newtonian step #1
-	x *= 1.50133f - 0.501326f * y * (x*x); // newtonian step #2
-	return x;
-}
-
-//Searching k in [0x2a4dfcc0,0x2a555540], m in [0.333333,0.5] ...........
-//  ...best design k=2a4fcd03, m=0.333818 with error score 6.45394e-07
-/*
-	Approximate x^(1/3) with 2 newtonian steps
-	Error:
-		RMS:  2.90881e-07
-		mean: -2.40255e-07
-		min:  -6.45394e-07 @ 1.36116
-		max:  5.73198e-07 @ 1.12441
-*/
-float rb2_3_root(const float y)
-{
-	union {float x; int32_t i;}; x = y; // interpret float as integer
-	i = 0x2a4fcd03 + (i / 3); // log-approximation hack
-	x = 0.666182f * x + 0.333818f * y / (x*x); // newtonian step #1
-	x = 0.666182f * x + 0.333818f * y / (x*x); // newtonian step #2
-	return x;
-}
-
-//Searching k in [0x549bfa00,0x54aaab00], m in [-0.333333,-0.5] ...........
-//  ...best design k=54a1b99d, m=-0.334677 with error score 2.18458e-06
-/*
-	Approximate x^(1/-3) with 2 newtonian steps
-	Error:
-		RMS:  1.04454e-06
-		mean: 6.17437e-07
-		min:  -2.18455e-06 @ 7.17768
-		max:  2.18458e-06 @ 3.56147
-*/
-float rb2_inv_3_root(const float y)
-{
-	union {float x; int32_t i;}; x = y; // interpret float as integer
-	i = 0x54a1b99d - (i / 3); // log-approximation hack
-	x *= 1.33468f - 0.334677f * y * (x*x*x); // newtonian step #1
-	x *= 1.33468f - 0.334677f * y * (x*x*x); // newtonian step #2
-	return x;
-}
-
-//Searching k in [0x2f97bc80,0x2fa00000], m in [0.25,0.375] ...........
-//  ...best design k=2f9b8068, m=0.250534 with error score 9.49041e-07
-/*
-	Approximate x^(1/4) with 2 newtonian steps
-	Error:
-		RMS:  5.28477e-07
-		mean: -4.76837e-07
-		min:  -9.49041e-07 @ 1.01967
-		max:  9.27656e-07 @ 3.99267
-*/
-float rb2_4_root(const float y)
-{
-	union {float x; int32_t i;}; x = y; // interpret float as integer
-	i = 0x2f9b8068 + (i >> 2); // log-approximation hack
-	x = 0.749466f * x + 0.250534f * y / (x*x*x); // newtonian step #1
-	x = 0.749466f * x + 0.250534f * y / (x*x*x); // newtonian step #2
-	return x;
-}
-
-//Searching k in [0x4f523a00,0x4f600000], m in [-0.25,-0.375] ...........
-//  ...best design k=4f58020d, m=-0.251282 with error score 2.76944e-06
-/*
-	Approximate x^(1/-4) with 2 newtonian steps
-	Error:
-		RMS:  1.3487e-06
-		mean: 5.97779e-07
-		min:  -2.65373e-06 @ 14.041
-		max:  2.76944e-06 @ 3.93
-*/
-float rb2_inv_4_root(const float y)
-{
-	union {float x; int32_t i;}; x = y; // interpret float as integer
-	i = 0x4f58020d - (i >> 2); // log-approximation hack
-	x *= 1.25128f - 0.251282f * y * (x*x*x*x); // newtonian step #1
-	x *= 1.25128f - 0.251282f * y * (x*x*x*x); // newtonian step #2
-	return x;
-}
+#pragma once
+#include <stdint.h>
+#include <string.h>
+
+#ifndef RB_CONSTEXPR
+#if (__cplusplus >= 202002L) || (defined(_MSVC_LANG) && _MSVC_LANG >= 202002L)
+	#include <bit>
+#endif
+#if defined(__has_builtin)
+	#if __has_builtin(__builtin_bit_cast)
+		#define RB_BUILTIN_BIT_CAST 1
+	#endif
+#elif defined(_MSC_VER) && (_MSC_VER >= 1927)
+	#define RB_BUILTIN_BIT_CAST 1
+#endif
+#if defined(__cpp_lib_bit_cast)
+	#define RB_CONSTEXPR constexpr
+	template<typename To, typename From> constexpr To rb_bit_cast(const From &v) {return std::bit_cast<To>(v);}
+#elif defined(RB_BUILTIN_BIT_CAST)
+	#define RB_CONSTEXPR constexpr
+	template<typename To, typename From> constexpr To rb_bit_cast(const From &v) {return __builtin_bit_cast(To, v);}
+#else
+	#define RB_CONSTEXPR inline
+	template<typename To, typename From> inline To rb_bit_cast(const From &v) {To t; memcpy(&t, &v, sizeof(To)); return t;}
+#endif
+#endif
+
+#ifndef RB_MULHI
+#define RB_MULHI 1
+// High half of a product, for division by a magic reciprocal
+#if defined(__SIZEOF_INT128__)
+__extension__ typedef unsigned __int128 rb_uint128;
+#endif
+RB_CONSTEXPR uint32_t rb_mulhi(uint32_t a, uint32_t b) {return (uint32_t)(((uint64_t)a * b) >> 32);}
+RB_CONSTEXPR uint64_t rb_mulhi(uint64_t a, uint64_t b)
+{
+#if defined(__SIZEOF_INT128__)
+	return (uint64_t)(((rb_uint128)a * b) >> 64);
+#else
+	uint64_t a1 = a >> 32, a0 = a & 0xFFFFFFFFu, b1 = b >> 32, b0 = b & 0xFFFFFFFFu;
+	uint64_t mid = ((a0*b0) >> 32) + ((a1*b0) & 0xFFFFFFFFu) + ((a0*b1) & 0xFFFFFFFFu);
+	return a1*b1 + ((a1*b0) >> 32) + ((a0*b1) >> 32) + (mid >> 32);
+#endif
+}
+#endif
+
+
+// Functions optimized for worst-case error
+
+
+//  design k=1fbed49a, m=0.510929 with error score 0.000239141
+/*
+	Approximate x^(1/2) with 1 newtonian steps
+	Error:
+		RMS:  0.000151795
+		mean: -4.5947e-05
+		min:  -0.000239046 @ 1.61964
+		max:  0.000239141 @ 2
+	Certified worst-case error: 0.00023919
+*/
+RB_CONSTEXPR float rb_2_root(const float y)
+{
+	int32_t i = rb_bit_cast<int32_t>(y); // interpret float as integer
+	int32_t q = (i + (i < 0 ? 1 : 0)) >> 1; // i / 2, rounding toward zero
+	i = 0x1fbed49a + q; // log-approximation hack
+	float x = rb_bit_cast<float>(i);
+	x = 0.489071f * x + 0.510929f * y / x; // newtonian step #1
+	return x;
+}
+
+RB_CONSTEXPR float rb_safe_2_root(const float y)
+{
+	const uint32_t u = rb_bit_cast<uint32_t>(y), sign = u & 0x80000000u, a = u ^ sign;
+	const bool tiny = (a < 0x800000u); // zero or denormal, scaled into normal range
+	const float x = rb_2_root(rb_bit_cast<float>(a) * (tiny ? 16777216.0f : 1.0f)) * (tiny ? 0.00024414062f : 1.0f);
+	uint32_t r = (a - 1 < 0x7f7fffffu) ? rb_bit_cast<uint32_t>(x) : a; // zero, infinity and NaN, which keeps its bits
+	r |= sign;
+	return rb_bit_cast<float>((u - 0x80000001u < 0x7f800000u) ? 0x7fc00000u : r); // even root of a negative number
+}
+
+//  design k=5f32a121, m=-0.535102 with error score 0.000773447
+/*
+	Approximate x^(1/-2) with 1 newtonian steps
+	Error:
+		RMS:  0.000502813
+		mean: -2.5526e-05
+		min:  -0.000773444 @ 3.58225
+		max:  0.000773447 @ 3.22749
+	Certified worst-case error: 0.000773585
+*/
+RB_CONSTEXPR float rb_inv_2_root(const float y)
+{
+	int32_t i = rb_bit_cast<int32_t>(y); // interpret float as integer
+	int32_t q = (i + (i < 0 ? 1 : 0)) >> 1; // i / 2, rounding toward zero
+	i = 0x5f32a121 - q; // log-approximation hack
+	float x = rb_bit_cast<float>(i);
+	x *= 1.535102f - 0.535102f * y * (x*x); // newtonian step #1
+	return x;
+}
+
+RB_CONSTEXPR float rb_safe_inv_2_root(const float y)
+{
+	const uint32_t u = rb_bit_cast<uint32_t>(y), sign = u & 0x80000000u, a = u ^ sign;
+	const bool tiny = (a < 0x800000u); // zero or denormal, scaled into normal range
+	const float x = rb_inv_2_root(rb_bit_cast<float>(a) * (tiny ? 16777216.0f : 1.0f)) * (tiny ? 4096.0f : 1.0f);
+	uint32_t r = (a - 1 < 0x7f7fffffu) ? rb_bit_cast<uint32_t>(x) : (a > 0x7f800000u) ? a : 0x7f800000u - a; // zero, infinity and NaN, which keeps its bits
+	r |= sign;
+	return rb_bit_cast<float>((u - 0x80000001u < 0x7f800000u) ? 0x7fc00000u : r); // even root of a negative number
+}
+
+//  design k=2a543aa3, m=0.347252 with error score 0.000430155
+/*
+	Approximate x^(1/3) with 1 newtonian steps
+	Error:
+		RMS:  0.000250799
+		mean: -0.000100652
+		min:  -0.000430155 @ 1.63158
+		max:  0.000430006 @ 1.02587
+	Certified worst-case error: 0.000430173
+*/
+RB_CONSTEXPR float rb_3_root(const float y)
+{
+	int32_t i = rb_bit_cast<int32_t>(y); // interpret float as integer
+	int32_t q = (int32_t)(rb_mulhi((uint32_t)i, 0x55555556u) - (i < 0 ? 0x55555556u : 0u));
+	q += (i < 0); // i / 3, rounding toward zero
+	i = 0x2a543aa3 + q; // log-approximation hack
+	float x = rb_bit_cast<float>(i);
+	x = 0.652748f * x + 0.347252f * y / (x*x); // newtonian step #1
+	return x;
+}
+
+RB_CONSTEXPR float rb_safe_3_root(const float y)
+{
+	const uint32_t u = rb_bit_cast<uint32_t>(y), sign = u & 0x80000000u, a = u ^ sign;
+	const bool tiny = (a < 0x800000u); // zero or denormal, scaled into normal range
+	const float x = rb_3_root(rb_bit_cast<float>(a) * (tiny ? 16777216.0f : 1.0f)) * (tiny ? 0.00390625f : 1.0f);
+	uint32_t r = (a - 1 < 0x7f7fffffu) ? rb_bit_cast<uint32_t>(x) : a; // zero, infinity and NaN, which keeps its bits
+	return rb_bit_cast<float>(r | sign); // odd root of a negative
+}
+
+//  design k=549da7bf, m=-0.364707 with error score 0.00102721
+/*
+	Approximate x^(1/-3) with 1 newtonian steps
+	Error:
+		RMS:  0.00076144
+		mean: 0.000275908
+		min:  -0.00102717 @ 6.78019
+		max:  0.00102721 @ 5.40847
+	Certified worst-case error: 0.00102721
+*/
+RB_CONSTEXPR float rb_inv_3_root(const float y)
+{
+	int32_t i = rb_bit_cast<int32_t>(y); // interpret float as integer
+	int32_t q = (int32_t)(rb_mulhi((uint32_t)i, 0x55555556u) - (i < 0 ? 0x55555556u : 0u));
+	q += (i < 0); // i / 3, rounding toward zero
+	i = 0x549da7bf - q; // log-approximation hack
+	float x = rb_bit_cast<float>(i);
+	x *= 1.364707f - 0.364707f * y * (x*x*x); // newtonian step #1
+	return x;
+}
+
+RB_CONSTEXPR float rb_safe_inv_3_root(const float y)
+{
+	const uint32_t u = rb_bit_cast<uint32_t>(y), sign = u & 0x80000000u, a = u ^ sign;
+	const bool tiny = (a < 0x800000u); // zero or denormal, scaled into normal range
+	const float x = rb_inv_3_root(rb_bit_cast<float>(a) * (tiny ? 16777216.0f : 1.0f)) * (tiny ? 256.0f : 1.0f);
+	uint32_t r = (a - 1 < 0x7f7fffffu) ? rb_bit_cast<uint32_t>(x) : (a > 0x7f800000u) ? a : 0x7f800000u - a; // zero, infinity and NaN, which keeps its bits
+	return rb_bit_cast<float>(r | sign); // odd root of a negative
+}
+
+//  design k=2f9ed7c0, m=0.266598 with error score 0.00071407
+/*
+	Approximate x^(1/4) with 1 newtonian steps
+	Error:
+		RMS:  0.000441487
+		mean: -0.000217297
+		min:  -0.00071407 @ 1.71117
+		max:  0.000714053 @ 3.99999
+	Certified worst-case error: 0.000714133
+*/
+RB_CONSTEXPR float rb_4_root(const float y)
+{
+	int32_t i = rb_bit_cast<int32_t>(y); // interpret float as integer
+	int32_t q = (i + (i < 0 ? 3 : 0)) >> 2; // i / 4, rounding toward zero
+	i = 0x2f9ed7c0 + q; // log-approximation hack
+	float x = rb_bit_cast<float>(i);
+	x = 0.733402f * x + 0.266598f * y / (x*x*x); // newtonian step #1
+	return x;
+}
+
+RB_CONSTEXPR float rb_safe_4_root(const float y)
+{
+	const uint32_t u = rb_bit_cast<uint32_t>(y), sign = u & 0x80000000u, a = u ^ sign;
+	const bool tiny = (a < 0x800000u); // zero or denormal, scaled into normal range
+	const float x = rb_4_root(rb_bit_cast<float>(a) * (tiny ? 16777216.0f : 1.0f)) * (tiny ? 0.015625f : 1.0f);
+	uint32_t r = (a - 1 < 0x7f7fffffu) ? rb_bit_cast<uint32_t>(x) : a; // zero, infinity and NaN, which keeps its bits
+	r |= sign;
+	return rb_bit_cast<float>((u - 0x80000001u < 0x7f800000u) ? 0x7fc00000u : r); // even root of a negative number
+}
+
+//  design k=4f542107, m=-0.277446 with error score 0.00110853
+/*
+	Approximate x^(1/-4) with 1 newtonian steps
+	Error:
+		RMS:  0.000781442
+		mean: 0.000170876
+		min:  -0.00110844 @ 3.0518
+		max:  0.00110853 @ 7.69344
+	Certified worst-case error: 0.00110852
+*/
+RB_CONSTEXPR float rb_inv_4_root(const float y)
+{
+	int32_t i = rb_bit_cast<int32_t>(y); // interpret float as integer
+	int32_t q = (i + (i < 0 ? 3 : 0)) >> 2; // i / 4, rounding toward zero
+	i = 0x4f542107 - q; // log-approximation hack
+	float x = rb_bit_cast<float>(i);
+	x *= 1.277446f - 0.277446f * y * ((x*x)*(x*x)); // newtonian step #1
+	return x;
+}
+
+RB_CONSTEXPR float rb_safe_inv_4_root(const float y)
+{
+	const uint32_t u = rb_bit_cast<uint32_t>(y), sign = u & 0x80000000u, a = u ^ sign;
+	const bool tiny = (a < 0x800000u); // zero or denormal, scaled into normal range
+	const float x = rb_inv_4_root(rb_bit_cast<float>(a) * (tiny ? 16777216.0f : 1.0f)) * (tiny ? 64.0f : 1.0f);
+	uint32_t r = (a - 1 < 0x7f7fffffu) ? rb_bit_cast<uint32_t>(x) : (a > 0x7f800000u) ? a : 0x7f800000u - a; // zero, infinity and NaN, which keeps its bits
+	r |= sign;
+	return rb_bit_cast<float>((u - 0x80000001u < 0x7f800000u) ? 0x7fc00000u : r); // even root of a negative number
+}
+
+//  design k=1fbb4f2e with error score 0.0347475
+/*
+	Approximate x^(1/2) with 0 newtonian steps
+	Error:
+		RMS:  0.0189205
+		mean: -0.00536095
+		min:  -0.0347474 @ 1.07329
+		max:  0.0347475 @ 2
+	Certified worst-case error: 0.0347475
+*/
+RB_CONSTEXPR float rb0_2_root(const float y)
+{
+	int32_t i = rb_bit_cast<int32_t>(y); // interpret float as integer
+	int32_t q = (i + (i < 0 ? 1 : 0)) >> 1; // i / 2, rounding toward zero
+	i = 0x1fbb4f2e + q; // log-approximation hack
+	float x = rb_bit_cast<float>(i);
+	return x;
+}
+
+RB_CONSTEXPR float rb0_safe_2_root(const float y)
+{
+	const uint32_t u = rb_bit_cast<uint32_t>(y), sign = u & 0x80000000u, a = u ^ sign;
+	const bool tiny = (a < 0x800000u); // zero or denormal, scaled into normal range
+	const float x = rb0_2_root(rb_bit_cast<float>(a) * (tiny ? 16777216.0f : 1.0f)) * (tiny ? 0.00024414062f : 1.0f);
+	uint32_t r = (a - 1 < 0x7f7fffffu) ? rb_bit_cast<uint32_t>(x) : a; // zero, infinity and NaN, which keeps its bits
+	r |= sign;
+	return rb_bit_cast<float>((u - 0x80000001u < 0x7f800000u) ? 0x7fc00000u : r); // even root of a negative number
+}
+
+//  design k=5f37642f with error score 0.0342129
+/*
+	Approximate x^(1/-2) with 0 newtonian steps
+	Error:
+		RMS:  0.0252809
+		mean: 0.0132797
+		min:  -0.0342129 @ 3.73098
+		max:  0.0342129 @ 2.57689
+	Certified worst-case error: 0.0342129
+*/
+RB_CONSTEXPR float rb0_inv_2_root(const float y)
+{
+	int32_t i = rb_bit_cast<int32_t>(y); // interpret float as integer
+	int32_t q = (i + (i < 0 ? 1 : 0)) >> 1; // i / 2, rounding toward zero
+	i = 0x5f37642f - q; // log-approximation hack
+	float x = rb_bit_cast<float>(i);
+	return x;
+}
+
+RB_CONSTEXPR float rb0_safe_inv_2_root(const float y)
+{
+	const uint32_t u = rb_bit_cast<uint32_t>(y), sign = u & 0x80000000u, a = u ^ sign;
+	const bool tiny = (a < 0x800000u); // zero or denormal, scaled into normal range
+	const float x = rb0_inv_2_root(rb_bit_cast<float>(a) * (tiny ? 16777216.0f : 1.0f)) * (tiny ? 4096.0f : 1.0f);
+	uint32_t r = (a - 1 < 0x7f7fffffu) ? rb_bit_cast<uint32_t>(x) : (a > 0x7f800000u) ? a : 0x7f800000u - a; // zero, infinity and NaN, which keeps its bits
+	r |= sign;
+	return rb_bit_cast<float>((u - 0x80000001u < 0x7f800000u) ? 0x7fc00000u : r); // even root of a negative number
+}
+
+//  design k=2a510680 with error score 0.0315547
+/*
+	Approximate x^(1/3) with 0 newtonian steps
+	Error:
+		RMS:  0.0186464
+		mean: 0.00332532
+		min:  -0.0315546 @ 1.10097
+		max:  0.0315547 @ 2
+	Certified worst-case error: 0.0315547
+*/
+RB_CONSTEXPR float rb0_3_root(const float y)
+{
+	int32_t i = rb_bit_cast<int32_t>(y); // interpret float as integer
+	int32_t q = (int32_t)(rb_mulhi((uint32_t)i, 0x55555556u) - (i < 0 ? 0x55555556u : 0u));
+	q += (i < 0); // i / 3, rounding toward zero
+	i = 0x2a510680 + q; // log-approximation hack
+	float x = rb_bit_cast<float>(i);
+	return x;
+}
+
+RB_CONSTEXPR float rb0_safe_3_root(const float y)
+{
+	const uint32_t u = rb_bit_cast<uint32_t>(y), sign = u & 0x80000000u, a = u ^ sign;
+	const bool tiny = (a < 0x800000u); // zero or denormal, scaled into normal range
+	const float x = rb0_3_root(rb_bit_cast<float>(a) * (tiny ? 16777216.0f : 1.0f)) * (tiny ? 0.00390625f : 1.0f);
+	uint32_t r = (a - 1 < 0x7f7fffffu) ? rb_bit_cast<uint32_t>(x) : a; // zero, infinity and NaN, which keeps its bits
+	return rb_bit_cast<float>(r | sign); // odd root of a negative
+}
+
+//  design k=54a232a3 with error score 0.0342406
+/*
+	Approximate x^(1/-3) with 0 newtonian steps
+	Error:
+		RMS:  0.020435
+		mean: 0.00730808
+		min:  -0.0342406 @ 7.20605
+		max:  0.0342405 @ 2.90139
+	Certified worst-case error: 0.0342405
+*/
+RB_CONSTEXPR float rb0_inv_3_root(const float y)
+{
+	int32_t i = rb_bit_cast<int32_t>(y); // interpret float as integer
+	int32_t q = (int32_t)(rb_mulhi((uint32_t)i, 0x55555556u) - (i < 0 ? 0x55555556u : 0u));
+	q += (i < 0); // i / 3, rounding toward zero
+	i = 0x54a232a3 - q; // log-approximation hack
+	float x = rb_bit_cast<float>(i);
+	return x;
+}
+
+RB_CONSTEXPR float rb0_safe_inv_3_root(const float y)
+{
+	const uint32_t u = rb_bit_cast<uint32_t>(y), sign = u & 0x80000000u, a = u ^ sign;
+	const bool tiny = (a < 0x800000u); // zero or denormal, scaled into normal range
+	const float x = rb0_inv_3_root(rb_bit_cast<float>(a) * (tiny ? 16777216.0f : 1.0f)) * (tiny ? 256.0f : 1.0f);
+	uint32_t r = (a - 1 < 0x7f7fffffu) ? rb_bit_cast<uint32_t>(x) : (a > 0x7f800000u) ? a : 0x7f800000u - a; // zero, infinity and NaN, which keeps its bits
+	return rb_bit_cast<float>(r | sign); // odd root of a negative
+}
+
+//  design k=2f9b374e with error score 0.0342323
+/*
+	Approximate x^(1/4) with 0 newtonian steps
+	Error:
+		RMS:  0.0186813
+		mean: 0.00405848
+		min:  -0.034232 @ 1.1495
+		max:  0.0342323 @ 4
+	Certified worst-case error: 0.0342322
+*/
+RB_CONSTEXPR float rb0_4_root(const float y)
+{
+	int32_t i = rb_bit_cast<int32_t>(y); // interpret float as integer
+	int32_t q = (i + (i < 0 ? 3 : 0)) >> 2; // i / 4, rounding toward zero
+	i = 0x2f9b374e + q; // log-approximation hack
+	float x = rb_bit_cast<float>(i);
+	return x;
+}
+
+RB_CONSTEXPR float rb0_safe_4_root(const float y)
+{
+	const uint32_t u = rb_bit_cast<uint32_t>(y), sign = u & 0x80000000u, a = u ^ sign;
+	const bool tiny = (a < 0x800000u); // zero or denormal, scaled into normal range
+	const float x = rb0_4_root(rb_bit_cast<float>(a) * (tiny ? 16777216.0f : 1.0f)) * (tiny ? 0.015625f : 1.0f);
+	uint32_t r = (a - 1 < 0x7f7fffffu) ? rb_bit_cast<uint32_t>(x) : a; // zero, infinity and NaN, which keeps its bits
+	r |= sign;
+	return rb_bit_cast<float>((u - 0x80000001u < 0x7f800000u) ? 0x7fc00000u : r); // even root of a negative number
+}
+
+//  design k=4f58605b with error score 0.0312108
+/*
+	Approximate x^(1/-4) with 0 newtonian steps
+	Error:
+		RMS:  0.0203653
+		mean: 0.00857312
+		min:  -0.0312108 @ 14.0941
+		max:  0.0312107 @ 5.40988
+	Certified worst-case error: 0.0312107
+*/
+RB_CONSTEXPR float rb0_inv_4_root(const float y)
+{
+	int32_t i = rb_bit_cast<int32_t>(y); // interpret float as integer
+	int32_t q = (i + (i < 0 ? 3 : 0)) >> 2; // i / 4, rounding toward zero
+	i = 0x4f58605b - q; // log-approximation hack
+	float x = rb_bit_cast<float>(i);
+	return x;
+}
+
+RB_CONSTEXPR float rb0_safe_inv_4_root(const float y)
+{
+	const uint32_t u = rb_bit_cast<uint32_t>(y), sign = u & 0x80000000u, a = u ^ sign;
+	const bool tiny = (a < 0x800000u); // zero or denormal, scaled into normal range
+	const float x = rb0_inv_4_root(rb_bit_cast<float>(a) * (tiny ? 16777216.0f : 1.0f)) * (tiny ? 64.0f : 1.0f);
+	uint32_t r = (a - 1 < 0x7f7fffffu) ? rb_bit_cast<uint32_t>(x) : (a > 0x7f800000u) ? a : 0x7f800000u - a; // zero, infinity and NaN, which keeps its bits
+	r |= sign;
+	return rb_bit_cast<float>((u - 0x80000001u < 0x7f800000u) ? 0x7fc00000u : r); // even root of a negative number
+}
+
+//  design k=1fbb75ad, m=0.500122 with error score 1.75185e-07
+/*
+	Approximate x^(1/2) with 2 newtonian steps
+	Error:
+		RMS:  4.87296e-08
+		mean: -1.42089e-08
+		min:  -1.75185e-07 @ 1.8522
+		max:  1.68608e-07 @ 1.99951
+	Certified worst-case error: 1.83552e-07
+*/
+RB_CONSTEXPR float rb2_2_root(const float y)
+{
+	int32_t i = rb_bit_cast<int32_t>(y); // interpret float as integer
+	int32_t q = (i + (i < 0 ? 1 : 0)) >> 1; // i / 2, rounding toward zero
+	i = 0x1fbb75ad + q; // log-approximation hack
+	float x = rb_bit_cast<float>(i);
+	x = 0.499878f * x + 0.500122f * y / x; // newtonian step #1
+	x = 0.499878f * x + 0.500122f * y / x; // newtonian step #2
+	return x;
+}
+
+RB_CONSTEXPR float rb2_safe_2_root(const float y)
+{
+	const uint32_t u = rb_bit_cast<uint32_t>(y), sign = u & 0x80000000u, a = u ^ sign;
+	const bool tiny = (a < 0x800000u); // zero or denormal, scaled into normal range
+	const float x = rb2_2_root(rb_bit_cast<float>(a) * (tiny ? 16777216.0f : 1.0f)) * (tiny ? 0.00024414062f : 1.0f);
+	uint32_t r = (a - 1 < 0x7f7fffffu) ? rb_bit_cast<uint32_t>(x) : a; // zero, infinity and NaN, which keeps its bits
+	r |= sign;
+	return rb_bit_cast<float>((u - 0x80000001u < 0x7f800000u) ? 0x7fc00000u : r); // even root of a negative number
+}
+
+//  design k=5f3634f9, m=-0.501326 with error score 1.46471e-06
+/*
+	Approximate x^(1/-2) with 2 newtonian steps
+	Error:
+		RMS:  9.49438e-07
+		mean: 7.19818e-07
+		min:  -1.37707e-06 @ 3.70673
+		max:  1.46471e-06 @ 3.57319
+	Certified worst-case error: 1.43788e-06
+*/
+RB_CONSTEXPR float rb2_inv_2_root(const float y)
+{
+	int32_t i = rb_bit_cast<int32_t>(y); // interpret float as integer
+	int32_t q = (i + (i < 0 ? 1 : 0)) >> 1; // i / 2, rounding toward zero
+	i = 0x5f3634f9 - q; // log-approximation hack
+	float x = rb_bit_cast<float>(i);
+	x *= 1.5013261f - 0.501326f * y * (x*x); // newtonian step #1
+	x *= 1.5013261f - 0.501326f * y * (x*x); // newtonian step #2
+	return x;
+}
+
+RB_CONSTEXPR float rb2_safe_inv_2_root(const float y)
+{
+	const uint32_t u = rb_bit_cast<uint32_t>(y), sign = u & 0x80000000u, a = u ^ sign;
+	const bool tiny = (a < 0x800000u); // zero or denormal, scaled into normal range
+	const float x = rb2_inv_2_root(rb_bit_cast<float>(a) * (tiny ? 16777216.0f : 1.0f)) * (tiny ? 4096.0f : 1.0f);
+	uint32_t r = (a - 1 < 0x7f7fffffu) ? rb_bit_cast<uint32_t>(x) : (a > 0x7f800000u) ? a : 0x7f800000u - a; // zero, infinity and NaN, which keeps its bits
+	r |= sign;
+	return rb_bit_cast<float>((u - 0x80000001u < 0x7f800000u) ? 0x7fc00000u : r); // even root of a negative number
+}
+
+//  design k=2a4fcd03, m=0.333818 with error score 6.86705e-07
+/*
+	Approximate x^(1/3) with 2 newtonian steps
+	Error:
+		RMS:  2.89488e-07
+		mean: -2.18865e-07
+		min:  -6.45394e-07 @ 1.36116
+		max:  6.86705e-07 @ 1.12999
+	Certified worst-case error: 6.74597e-07
+*/
+RB_CONSTEXPR float rb2_3_root(const float y)
+{
+	int32_t i = rb_bit_cast<int32_t>(y); // interpret float as integer
+	int32_t q = (int32_t)(rb_mulhi((uint32_t)i, 0x55555556u) - (i < 0 ? 0x55555556u : 0u));
+	q += (i < 0); // i / 3, rounding toward zero
+	i = 0x2a4fcd03 + q; // log-approximation hack
+	float x = rb_bit_cast<float>(i);
+	x = 0.66618204f * x + 0.333818f * y / (x*x); // newtonian step #1
+	x = 0.66618204f * x + 0.333818f * y / (x*x); // newtonian step #2
+	return x;
+}
+
+RB_CONSTEXPR float rb2_safe_3_root(const float y)
+{
+	const uint32_t u = rb_bit_cast<uint32_t>(y), sign = u & 0x80000000u, a = u ^ sign;
+	const bool tiny = (a < 0x800000u); // zero or denormal, scaled into normal range
+	const float x = rb2_3_root(rb_bit_cast<float>(a) * (tiny ? 16777216.0f : 1.0f)) * (tiny ? 0.00390625f : 1.0f);
+	uint32_t r = (a - 1 < 0x7f7fffffu) ? rb_bit_cast<uint32_t>(x) : a; // zero, infinity and NaN, which keeps its bits
+	return rb_bit_cast<float>(r | sign); // odd root of a negative
+}
+
+//  design k=54a1b99d, m=-0.334677 with error score 2.20181e-06
+/*
+	Approximate x^(1/-3) with 2 newtonian steps
+	Error:
+		RMS:  1.06531e-06
+		mean: 6.16197e-07
+		min:  -2.18616e-06 @ 7.19353
+		max:  2.20181e-06 @ 1.08041
+	Certified worst-case error: 2.24973e-06
+*/
+RB_CONSTEXPR float rb2_inv_3_root(const float y)
+{
+	int32_t i = rb_bit_cast<int32_t>(y); // interpret float as integer
+	int32_t q = (int32_t)(rb_mulhi((uint32_t)i, 0x55555556u) - (i < 0 ? 0x55555556u : 0u));
+	q += (i < 0); // i / 3, rounding toward zero
+	i = 0x54a1b99d - q; // log-approximation hack
+	float x = rb_bit_cast<float>(i);
+	x *= 1.334677f - 0.334677f * y * (x*x*x); // newtonian step #1
+	x *= 1.334677f - 0.334677f * y * (x*x*x); // newtonian step #2
+	return x;
+}
+
+RB_CONSTEXPR float rb2_safe_inv_3_root(const float y)
+{
+	const uint32_t u = rb_bit_cast<uint32_t>(y), sign = u & 0x80000000u, a = u ^ sign;
+	const bool tiny = (a < 0x800000u); // zero or denormal, scaled into normal range
+	const float x = rb2_inv_3_root(rb_bit_cast<float>(a) * (tiny ? 16777216.0f : 1.0f)) * (tiny ? 256.0f : 1.0f);
+	uint32_t r = (a - 1 < 0x7f7fffffu) ? rb_bit_cast<uint32_t>(x) : (a > 0x7f800000u) ? a : 0x7f800000u - a; // zero, infinity and NaN, which keeps its bits
+	return rb_bit_cast<float>(r | sign); // odd root of a negative
+}
+
+//  design k=2f9b8068, m=0.250534 with error score 9.49043e-07
+/*
+	Approximate x^(1/4) with 2 newtonian steps
+	Error:
+		RMS:  5.51017e-07
+		mean: -4.55329e-07
+		min:  -9.49043e-07 @ 1.01966
+		max:  9.27703e-07 @ 3.99186
+	Certified worst-case error: 9.91958e-07
+*/
+RB_CONSTEXPR float rb2_4_root(const float y)
+{
+	int32_t i = rb_bit_cast<int32_t>(y); // interpret float as integer
+	int32_t q = (i + (i < 0 ? 3 : 0)) >> 2; // i / 4, rounding toward zero
+	i = 0x2f9b8068 + q; // log-approximation hack
+	float x = rb_bit_cast<float>(i);
+	x = 0.749466f * x + 0.250534f * y / (x*x*x); // newtonian step #1
+	x = 0.749466f * x + 0.250534f * y / (x*x*x); // newtonian step #2
+	return x;
+}
+
+RB_CONSTEXPR float rb2_safe_4_root(const float y)
+{
+	const uint32_t u = rb_bit_cast<uint32_t>(y), sign = u & 0x80000000u, a = u ^ sign;
+	const bool tiny = (a < 0x800000u); // zero or denormal, scaled into normal range
+	const float x = rb2_4_root(rb_bit_cast<float>(a) * (tiny ? 16777216.0f : 1.0f)) * (tiny ? 0.015625f : 1.0f);
+	uint32_t r = (a - 1 < 0x7f7fffffu) ? rb_bit_cast<uint32_t>(x) : a; // zero, infinity and NaN, which keeps its bits
+	r |= sign;
+	return rb_bit_cast<float>((u - 0x80000001u < 0x7f800000u) ? 0x7fc00000u : r); // even root of a negative number
+}
+
+//  design k=4f58020d, m=-0.251282 with error score 2.83147e-06
+/*
+	Approximate x^(1/-4) with 2 newtonian steps
+	Error:
+		RMS:  1.38912e-06
+		mean: 6.46654e-07
+		min:  -2.65312e-06 @ 14.0281
+		max:  2.83147e-06 @ 13.0368
+	Certified worst-case error: 2.78325e-06
+*/
+RB_CONSTEXPR float rb2_inv_4_root(const float y)
+{
+	int32_t i = rb_bit_cast<int32_t>(y); // interpret float as integer
+	int32_t q = (i + (i < 0 ? 3 : 0)) >> 2; // i / 4, rounding toward zero
+	i = 0x4f58020d - q; // log-approximation hack
+	float x = rb_bit_cast<float>(i);
+	x *= 1.251282f - 0.251282f * y * ((x*x)*(x*x)); // newtonian step #1
+	x *= 1.251282f - 0.251282f * y * ((x*x)*(x*x)); // newtonian step #2
+	return x;
+}
+
+RB_CONSTEXPR float rb2_safe_inv_4_root(const float y)
+{
+	const uint32_t u = rb_bit_cast<uint32_t>(y), sign = u & 0x80000000u, a = u ^ sign;
+	const bool tiny = (a < 0x800000u); // zero or denormal, scaled into normal range
+	const float x = rb2_inv_4_root(rb_bit_cast<float>(a) * (tiny ? 16777216.0f : 1.0f)) * (tiny ? 64.0f : 1.0f);
+	uint32_t r = (a - 1 < 0x7f7fffffu) ? rb_bit_cast<uint32_t>(x) : (a > 0x7f800000u) ? a : 0x7f800000u - a; // zero, infinity and NaN, which keeps its bits
+	r |= sign;
+	return rb_bit_cast<float>((u - 0x80000001u < 0x7f800000u) ? 0x7fc00000u : r); // even root of a negative number
+}
+
+// Vector kernels and batch functions for the designs above
+
+
+#ifndef RB_SIMD
+#define RB_SIMD 1
+#include <stddef.h>
+#include <string.h>
+#if defined(__SSE4_1__) || defined(__AVX2__) || defined(__AVX512F__)
+	#include <immintrin.h>
+#endif
+// GCC 12 warns of _mm512_undefined_* within its own AVX-512 intrinsics
+#if defined(__GNUC__) && !defined(__clang__)
+	#define RB_AVX512_BEGIN _Pragma("GCC diagnostic push") _Pragma("GCC diagnostic ignored \"-Wuninitialized\"") _Pragma("GCC diagnostic ignored \"-Wmaybe-uninitialized\"")
+	#define RB_AVX512_END   _Pragma("GCC diagnostic pop")
+#else
+	#define RB_AVX512_BEGIN
+	#define RB_AVX512_END
+#endif
+
+#if defined(__SSE4_1__)
+inline __m128i rb_mulhi_epi32_sse41(const __m128i a, const __m128i b)
+{
+	__m128i even = _mm_srli_epi64(_mm_mul_epi32(a, b), 32),
+		odd = _mm_mul_epi32(_mm_srli_epi64(a, 32), b);
+	return _mm_blend_epi16(even, odd, 0xCC);
+}
+inline __m128i rb_sign_epi64_sse41(const __m128i a)
+{
+	return _mm_shuffle_epi32(_mm_srai_epi32(a, 31), _MM_SHUFFLE(3,3,1,1));
+}
+inline __m128i rb_mulhi_epu64_sse41(const __m128i a, const unsigned long long b)
+{
+	const __m128i
+		b_lo = _mm_set1_epi64x((long long)(b & 0xFFFFFFFFu)),
+		b_hi = _mm_set1_epi64x((long long)(b >> 32)),
+		mask = _mm_set1_epi64x(0xFFFFFFFF),
+		a_hi = _mm_srli_epi64(a, 32),
+		ll = _mm_mul_epu32(a, b_lo), lh = _mm_mul_epu32(a, b_hi),
+		hl = _mm_mul_epu32(a_hi, b_lo), hh = _mm_mul_epu32(a_hi, b_hi),
+		mid = _mm_add_epi64(_mm_srli_epi64(ll, 32), _mm_add_epi64(_mm_and_si128(lh, mask), _mm_and_si128(hl, mask)));
+	return _mm_add_epi64(_mm_add_epi64(hh, _mm_srli_epi64(mid, 32)), _mm_add_epi64(_mm_srli_epi64(lh, 32), _mm_srli_epi64(hl, 32)));
+}
+#endif
+
+#if defined(__AVX2__) && defined(__FMA__)
+inline __m256i rb_mulhi_epi32_avx2(const __m256i a, const __m256i b)
+{
+	__m256i even = _mm256_srli_epi64(_mm256_mul_epi32(a, b), 32),
+		odd = _mm256_mul_epi32(_mm256_srli_epi64(a, 32), b);
+	return _mm256_blend_epi32(even, odd, 0xAA);
+}
+inline __m256i rb_sign_epi64_avx2(const __m256i a)
+{
+	return _mm256_cmpgt_epi64(_mm256_setzero_si256(), a);
+}
+inline __m256i rb_mulhi_epu64_avx2(const __m256i a, const unsigned long long b)
+{
+	const __m256i
+		b_lo = _mm256_set1_epi64x((long long)(b & 0xFFFFFFFFu)),
+		b_hi = _mm256_set1_epi64x((long long)(b >> 32)),
+		mask = _mm256_set1_epi64x(0xFFFFFFFF),
+		a_hi = _mm256_srli_epi64(a, 32),
+		ll = _mm256_mul_epu32(a, b_lo), lh = _mm256_mul_epu32(a, b_hi),
+		hl = _mm256_mul_epu32(a_hi, b_lo), hh = _mm256_mul_epu32(a_hi, b_hi),
+		mid = _mm256_add_epi64(_mm256_srli_epi64(ll, 32), _mm256_add_epi64(_mm256_and_si256(lh, mask), _mm256_and_si256(hl, mask)));
+	return _mm256_add_epi64(_mm256_add_epi64(hh, _mm256_srli_epi64(mid, 32)), _mm256_add_epi64(_mm256_srli_epi64(lh, 32), _mm256_srli_epi64(hl, 32)));
+}
+#endif
+
+#if defined(__AVX512F__)
+RB_AVX512_BEGIN
+inline __m512i rb_mulhi_epi32_avx512(const __m512i a, const __m512i b)
+{
+	__m512i even = _mm512_srli_epi64(_mm512_mul_epi32(a, b), 32),
+		odd = _mm512_mul_epi32(_mm512_srli_epi64(a, 32), b);
+	return _mm512_mask_blend_epi32(0xAAAA, even, odd);
+}
+inline __m512i rb_sign_epi64_avx512(const __m512i a)
+{
+	return _mm512_srai_epi64(a, 63);
+}
+inline __m512i rb_mulhi_epu64_avx512(const __m512i a, const unsigned long long b)
+{
+	const __m512i
+		b_lo = _mm512_set1_epi64((long long)(b & 0xFFFFFFFFu)),
+		b_hi = _mm512_set1_epi64((long long)(b >> 32)),
+		mask = _mm512_set1_epi64(0xFFFFFFFF),
+		a_hi = _mm512_srli_epi64(a, 32),
+		ll = _mm512_mul_epu32(a, b_lo), lh = _mm512_mul_epu32(a, b_hi),
+		hl = _mm512_mul_epu32(a_hi, b_lo), hh = _mm512_mul_epu32(a_hi, b_hi),
+		mid = _mm512_add_epi64(_mm512_srli_epi64(ll, 32), _mm512_add_epi64(_mm512_and_si512(lh, mask), _mm512_and_si512(hl, mask)));
+	return _mm512_add_epi64(_mm512_add_epi64(hh, _mm512_srli_epi64(mid, 32)), _mm512_add_epi64(_mm512_srli_epi64(lh, 32), _mm512_srli_epi64(hl, 32)));
+}
+RB_AVX512_END
+#endif
+
+// Apply a kernel W lanes at a time, padding the last partial vector
+template<size_t W, typename T, typename F>
+inline void rb_simd_batch(const T *y, T *x, const size_t count, const F &vector)
+{
+	size_t i = 0;
+	for (; i + W <= count; i += W) vector(y + i, x + i);
+	if (i < count)
+	{
+		T pad[W] = {};
+		memcpy(pad, y + i, (count - i) * sizeof(T));
+		vector(pad, pad);
+		memcpy(x + i, pad, (count - i) * sizeof(T));
+	}
+}
+#endif
+
+
+#if defined(__SSE4_1__)
+inline __m128 rb_2_root_sse41(const __m128 y)
+{
+	__m128i i = _mm_castps_si128(y); // interpret float as integer
+	__m128i q = _mm_srai_epi32(_mm_add_epi32(i, _mm_srli_epi32(_mm_srai_epi32(i, 31), 31)), 1); // i / 2, rounding toward zero
+	i = _mm_add_epi32(_mm_set1_epi32(0x1fbed49a), q); // log-approximation hack
+	__m128 x = _mm_castsi128_ps(i);
+	x = _mm_add_ps(_mm_mul_ps(x, _mm_set1_ps(0.489071f)), _mm_div_ps(_mm_mul_ps(_mm_set1_ps(0.510929f), y), x)); // newtonian step #1
+	return x;
+}
+#endif
+
+#if defined(__AVX2__) && defined(__FMA__)
+inline __m256 rb_2_root_avx2(const __m256 y)
+{
+	__m256i i = _mm256_castps_si256(y); // interpret float as integer
+	__m256i q = _mm256_srai_epi32(_mm256_add_epi32(i, _mm256_srli_epi32(_mm256_srai_epi32(i, 31), 31)), 1); // i / 2, rounding toward zero
+	i = _mm256_add_epi32(_mm256_set1_epi32(0x1fbed49a), q); // log-approximation hack
+	__m256 x = _mm256_castsi256_ps(i);
+	x = _mm256_fmadd_ps(x, _mm256_set1_ps(0.489071f), _mm256_div_ps(_mm256_mul_ps(_mm256_set1_ps(0.510929f), y), x)); // newtonian step #1
+	return x;
+}
+#endif
+
+#if defined(__AVX512F__)
+RB_AVX512_BEGIN
+inline __m512 rb_2_root_avx512(const __m512 y)
+{
+	__m512i i = _mm512_castps_si512(y); // interpret float as integer
+	__m512i q = _mm512_srai_epi32(_mm512_add_epi32(i, _mm512_srli_epi32(_mm512_srai_epi32(i, 31), 31)), 1); // i / 2, rounding toward zero
+	i = _mm512_add_epi32(_mm512_set1_epi32(0x1fbed49a), q); // log-approximation hack
+	__m512 x = _mm512_castsi512_ps(i);
+	x = _mm512_fmadd_ps(x, _mm512_set1_ps(0.489071f), _mm512_div_ps(_mm512_mul_ps(_mm512_set1_ps(0.510929f), y), x)); // newtonian step #1
+	return x;
+}
+RB_AVX512_END
+#endif
+
+inline void rb_2_root_batch(const float *y, float *x, const size_t count)
+{
+#if defined(__AVX512F__)
+	rb_simd_batch<16>(y, x, count, [](const float *in, float *out)
+		{_mm512_storeu_ps(out, rb_2_root_avx512(_mm512_loadu_ps(in)));});
+#elif defined(__AVX2__) && defined(__FMA__)
+	rb_simd_batch<8>(y, x, count, [](const float *in, float *out)
+		{_mm256_storeu_ps(out, rb_2_root_avx2(_mm256_loadu_ps(in)));});
+#elif defined(__SSE4_1__)
+	rb_simd_batch<4>(y, x, count, [](const float *in, float *out)
+		{_mm_storeu_ps(out, rb_2_root_sse41(_mm_loadu_ps(in)));});
+#else
+	for (size_t i = 0; i < count; ++i) x[i] = rb_2_root(y[i]);
+#endif
+}
+
+#if defined(__SSE4_1__)
+inline __m128 rb_safe_2_root_sse41(const __m128 y)
+{
+	const __m128i ordinary = _mm_add_epi32(_mm_castps_si128(y), _mm_set1_epi32((int32_t)0x7f800000u));
+	if (_mm_movemask_epi8(_mm_cmpgt_epi32(_mm_set1_epi32((int32_t)0xff000000u), ordinary)) == 0xffff) return rb_2_root_sse41(y);
+	const __m128i u = _mm_castps_si128(y), sign = _mm_and_si128(u, _mm_set1_epi32((int32_t)0x80000000u));
+	const __m128 a = _mm_castsi128_ps(_mm_xor_si128(u, sign));
+	const __m128 tiny = _mm_cmpgt_ps(_mm_castsi128_ps(_mm_set1_epi32((int32_t)0x800000u)), a); // zero or denormal, scaled into normal range
+	const __m128 finite = _mm_and_ps(_mm_cmpgt_ps(a, _mm_setzero_ps()), _mm_cmpgt_ps(_mm_castsi128_ps(_mm_set1_epi32((int32_t)0x7f800000u)), a));
+	__m128 x = rb_2_root_sse41(_mm_mul_ps(a, _mm_blendv_ps(_mm_set1_ps(1.0f), _mm_castsi128_ps(_mm_set1_epi32((int32_t)0x4b800000u)), tiny)));
+	x = _mm_mul_ps(x, _mm_blendv_ps(_mm_set1_ps(1.0f), _mm_castsi128_ps(_mm_set1_epi32((int32_t)0x39800000u)), tiny));
+	x = _mm_blendv_ps(a, x, finite); // zero, infinity and NaN
+	x = _mm_castsi128_ps(_mm_or_si128(_mm_castps_si128(x), sign));
+	x = _mm_blendv_ps(x, _mm_castsi128_ps(_mm_set1_epi32((int32_t)0x7fc00000u)), _mm_cmpgt_ps(_mm_setzero_ps(), y)); // even root of a negative
+	return x;
+}
+#endif
+
+#if defined(__AVX2__) && defined(__FMA__)
+inline __m256 rb_safe_2_root_avx2(const __m256 y)
+{
+	const __m256i ordinary = _mm256_add_epi32(_mm256_castps_si256(y), _mm256_set1_epi32((int32_t)0x7f800000u));
+	if (_mm256_movemask_epi8(_mm256_cmpgt_epi32(_mm256_set1_epi32((int32_t)0xff000000u), ordinary)) == -1) return rb_2_root_avx2(y);
+	const __m256i u = _mm256_castps_si256(y), sign = _mm256_and_si256(u, _mm256_set1_epi32((int32_t)0x80000000u));
+	const __m256 a = _mm256_castsi256_ps(_mm256_xor_si256(u, sign));
+	const __m256 tiny = _mm256_cmp_ps(_mm256_castsi256_ps(_mm256_set1_epi32((int32_t)0x800000u)), a, _CMP_GT_OQ); // zero or denormal, scaled into normal range
+	const __m256 finite = _mm256_and_ps(_mm256_cmp_ps(a, _mm256_setzero_ps(), _CMP_GT_OQ), _mm256_cmp_ps(_mm256_castsi256_ps(_mm256_set1_epi32((int32_t)0x7f800000u)), a, _CMP_GT_OQ));
+	__m256 x = rb_2_root_avx2(_mm256_mul_ps(a, _mm256_blendv_ps(_mm256_set1_ps(1.0f), _mm256_castsi256_ps(_mm256_set1_epi32((int32_t)0x4b800000u)), tiny)));
+	x = _mm256_mul_ps(x, _mm256_blendv_ps(_mm256_set1_ps(1.0f), _mm256_castsi256_ps(_mm256_set1_epi32((int32_t)0x39800000u)), tiny));
+	x = _mm256_blendv_ps(a, x, finite); // zero, infinity and NaN
+	x = _mm256_castsi256_ps(_mm256_or_si256(_mm256_castps_si256(x), sign));
+	x = _mm256_blendv_ps(x, _mm256_castsi256_ps(_mm256_set1_epi32((int32_t)0x7fc00000u)), _mm256_cmp_ps(_mm256_setzero_ps(), y, _CMP_GT_OQ)); // even root of a negative
+	return x;
+}
+#endif
+
+#if defined(__AVX512F__)
+RB_AVX512_BEGIN
+inline __m512 rb_safe_2_root_avx512(const __m512 y)
+{
+	const __m512i ordinary = _mm512_add_epi32(_mm512_castps_si512(y), _mm512_set1_epi32((int32_t)0x7f800000u));
+	if (_mm512_cmplt_epi32_mask(ordinary, _mm512_set1_epi32((int32_t)0xff000000u)) == (__mmask16)0xffff) return rb_2_root_avx512(y);
+	const __m512i u = _mm512_castps_si512(y), sign = _mm512_and_si512(u, _mm512_set1_epi32((int32_t)0x80000000u));
+	const __m512 a = _mm512_castsi512_ps(_mm512_xor_si512(u, sign));
+	const __mmask16 tiny = _mm512_cmp_ps_mask(_mm512_castsi512_ps(_mm512_set1_epi32((int32_t)0x800000u)), a, _CMP_GT_OQ); // zero or denormal, scaled into normal range
+	const __mmask16 finite = (__mmask16)(_mm512_cmp_ps_mask(a, _mm512_setzero_ps(), _CMP_GT_OQ) & _mm512_cmp_ps_mask(_mm512_castsi512_ps(_mm512_set1_epi32((int32_t)0x7f800000u)), a, _CMP_GT_OQ));
+	__m512 x = rb_2_root_avx512(_mm512_mul_ps(a, _mm512_mask_blend_ps(tiny, _mm512_set1_ps(1.0f), _mm512_castsi512_ps(_mm512_set1_epi32((int32_t)0x4b800000u)))));
+	x = _mm512_mul_ps(x, _mm512_mask_blend_ps(tiny, _mm512_set1_ps(1.0f), _mm512_castsi512_ps(_mm512_set1_epi32((int32_t)0x39800000u))));
+	x = _mm512_mask_blend_ps(finite, a, x); // zero, infinity and NaN
+	x = _mm512_castsi512_ps(_mm512_or_si512(_mm512_castps_si512(x), sign));
+	x = _mm512_mask_blend_ps(_mm512_cmp_ps_mask(_mm512_setzero_ps(), y, _CMP_GT_OQ), x, _mm512_castsi512_ps(_mm512_set1_epi32((int32_t)0x7fc00000u))); // even root of a negative
+	return x;
+}
+RB_AVX512_END
+#endif
+
+inline void rb_safe_2_root_batch(const float *y, float *x, const size_t count)
+{
+#if defined(__AVX512F__)
+	rb_simd_batch<16>(y, x, count, [](const float *in, float *out)
+		{_mm512_storeu_ps(out, rb_safe_2_root_avx512(_mm512_loadu_ps(in)));});
+#elif defined(__AVX2__) && defined(__FMA__)
+	rb_simd_batch<8>(y, x, count, [](const float *in, float *out)
+		{_mm256_storeu_ps(out, rb_safe_2_root_avx2(_mm256_loadu_ps(in)));});
+#elif defined(__SSE4_1__)
+	rb_simd_batch<4>(y, x, count, [](const float *in, float *out)
+		{_mm_storeu_ps(out, rb_safe_2_root_sse41(_mm_loadu_ps(in)));});
+#else
+	for (size_t i = 0; i < count; ++i) x[i] = rb_safe_2_root(y[i]);
+#endif
+}
+
+#if defined(__SSE4_1__)
+inline __m128 rb_inv_2_root_sse41(const __m128 y)
+{
+	__m128i i = _mm_castps_si128(y); // interpret float as integer
+	__m128i q = _mm_srai_epi32(_mm_add_epi32(i, _mm_srli_epi32(_mm_srai_epi32(i, 31), 31)), 1); // i / 2, rounding toward zero
+	i = _mm_sub_epi32(_mm_set1_epi32(0x5f32a121), q); // log-approximation hack
+	__m128 x = _mm_castsi128_ps(i);
+	x = _mm_mul_ps(x, _mm_add_ps(_mm_mul_ps(_mm_mul_ps(_mm_set1_ps(-0.535102f), y), _mm_mul_ps(x, x)), _mm_set1_ps(1.535102f))); // newtonian step #1
+	return x;
+}
+#endif
+
+#if defined(__AVX2__) && defined(__FMA__)
+inline __m256 rb_inv_2_root_avx2(const __m256 y)
+{
+	__m256i i = _mm256_castps_si256(y); // interpret float as integer
+	__m256i q = _mm256_srai_epi32(_mm256_add_epi32(i, _mm256_srli_epi32(_mm256_srai_epi32(i, 31), 31)), 1); // i / 2, rounding toward zero
+	i = _mm256_sub_epi32(_mm256_set1_epi32(0x5f32a121), q); // log-approximation hack
+	__m256 x = _mm256_castsi256_ps(i);
+	x = _mm256_mul_ps(x, _mm256_fmadd_ps(_mm256_mul_ps(_mm256_set1_ps(-0.535102f), y), _mm256_mul_ps(x, x), _mm256_set1_ps(1.535102f))); // newtonian step #1
+	return x;
+}
+#endif
+
+#if defined(__AVX512F__)
+RB_AVX512_BEGIN
+inline __m512 rb_inv_2_root_avx512(const __m512 y)
+{
+	__m512i i = _mm512_castps_si512(y); // interpret float as integer
+	__m512i q = _mm512_srai_epi32(_mm512_add_epi32(i, _mm512_srli_epi32(_mm512_srai_epi32(i, 31), 31)), 1); // i / 2, rounding toward zero
+	i = _mm512_sub_epi32(_mm512_set1_epi32(0x5f32a121), q); // log-approximation hack
+	__m512 x = _mm512_castsi512_ps(i);
+	x = _mm512_mul_ps(x, _mm512_fmadd_ps(_mm512_mul_ps(_mm512_set1_ps(-0.535102f), y), _mm512_mul_ps(x, x), _mm512_set1_ps(1.535102f))); // newtonian step #1
+	return x;
+}
+RB_AVX512_END
+#endif
+
+inline void rb_inv_2_root_batch(const float *y, float *x, const size_t count)
+{
+#if defined(__AVX512F__)
+	rb_simd_batch<16>(y, x, count, [](const float *in, float *out)
+		{_mm512_storeu_ps(out, rb_inv_2_root_avx512(_mm512_loadu_ps(in)));});
+#elif defined(__AVX2__) && defined(__FMA__)
+	rb_simd_batch<8>(y, x, count, [](const float *in, float *out)
+		{_mm256_storeu_ps(out, rb_inv_2_root_avx2(_mm256_loadu_ps(in)));});
+#elif defined(__SSE4_1__)
+	rb_simd_batch<4>(y, x, count, [](const float *in, float *out)
+		{_mm_storeu_ps(out, rb_inv_2_root_sse41(_mm_loadu_ps(in)));});
+#else
+	for (size_t i = 0; i < count; ++i) x[i] = rb_inv_2_root(y[i]);
+#endif
+}
+
+#if defined(__SSE4_1__)
+inline __m128 rb_safe_inv_2_root_sse41(const __m128 y)
+{
+	const __m128i ordinary = _mm_add_epi32(_mm_castps_si128(y), _mm_set1_epi32((int32_t)0x7f800000u));
+	if (_mm_movemask_epi8(_mm_cmpgt_epi32(_mm_set1_epi32((int32_t)0xff000000u), ordinary)) == 0xffff) return rb_inv_2_root_sse41(y);
+	const __m128i u = _mm_castps_si128(y), sign = _mm_and_si128(u, _mm_set1_epi32((int32_t)0x80000000u));
+	const __m128 a = _mm_castsi128_ps(_mm_xor_si128(u, sign));
+	const __m128 tiny = _mm_cmpgt_ps(_mm_castsi128_ps(_mm_set1_epi32((int32_t)0x800000u)), a); // zero or denormal, scaled into normal range
+	const __m128 finite = _mm_and_ps(_mm_cmpgt_ps(a, _mm_setzero_ps()), _mm_cmpgt_ps(_mm_castsi128_ps(_mm_set1_epi32((int32_t)0x7f800000u)), a));
+	const __m128 number = _mm_cmpgt_ps(a, _mm_set1_ps(-1.0f)); // all but NaN, which keeps its bits
+	__m128 x = rb_inv_2_root_sse41(_mm_mul_ps(a, _mm_blendv_ps(_mm_set1_ps(1.0f), _mm_castsi128_ps(_mm_set1_epi32((int32_t)0x4b800000u)), tiny)));
+	x = _mm_mul_ps(x, _mm_blendv_ps(_mm_set1_ps(1.0f), _mm_castsi128_ps(_mm_set1_epi32((int32_t)0x45800000u)), tiny));
+	x = _mm_blendv_ps(_mm_blendv_ps(a, _mm_castsi128_ps(_mm_sub_epi32(_mm_set1_epi32((int32_t)0x7f800000u), _mm_castps_si128(a))), number), x, finite); // zero, infinity and NaN
+	x = _mm_castsi128_ps(_mm_or_si128(_mm_castps_si128(x), sign));
+	x = _mm_blendv_ps(x, _mm_castsi128_ps(_mm_set1_epi32((int32_t)0x7fc00000u)), _mm_cmpgt_ps(_mm_setzero_ps(), y)); // even root of a negative
+	return x;
+}
+#endif
+
+#if defined(__AVX2__) && defined(__FMA__)
+inline __m256 rb_safe_inv_2_root_avx2(const __m256 y)
+{
+	const __m256i ordinary = _mm256_add_epi32(_mm256_castps_si256(y), _mm256_set1_epi32((int32_t)0x7f800000u));
+	if (_mm256_movemask_epi8(_mm256_cmpgt_epi32(_mm256_set1_epi32((int32_t)0xff000000u), ordinary)) == -1) return rb_inv_2_root_avx2(y);
+	const __m256i u = _mm256_castps_si256(y), sign = _mm256_and_si256(u, _mm256_set1_epi32((int32_t)0x80000000u));
+	const __m256 a = _mm256_castsi256_ps(_mm256_xor_si256(u, sign));
+	const __m256 tiny = _mm256_cmp_ps(_mm256_castsi256_ps(_mm256_set1_epi32((int32_t)0x800000u)), a, _CMP_GT_OQ); // zero or denormal, scaled into normal range
+	const __m256 finite = _mm256_and_ps(_mm256_cmp_ps(a, _mm256_setzero_ps(), _CMP_GT_OQ), _mm256_cmp_ps(_mm256_castsi256_ps(_mm256_set1_epi32((int32_t)0x7f800000u)), a, _CMP_GT_OQ));
+	const __m256 number = _mm256_cmp_ps(a, _mm256_set1_ps(-1.0f), _CMP_GT_OQ); // all but NaN, which keeps its bits
+	__m256 x = rb_inv_2_root_avx2(_mm256_mul_ps(a, _mm256_blendv_ps(_mm256_set1_ps(1.0f), _mm256_castsi256_ps(_mm256_set1_epi32((int32_t)0x4b800000u)), tiny)));
+	x = _mm256_mul_ps(x, _mm256_blendv_ps(_mm256_set1_ps(1.0f), _mm256_castsi256_ps(_mm256_set1_epi32((int32_t)0x45800000u)), tiny));
+	x = _mm256_blendv_ps(_mm256_blendv_ps(a, _mm256_castsi256_ps(_mm256_sub_epi32(_mm256_set1_epi32((int32_t)0x7f800000u), _mm256_castps_si256(a))), number), x, finite); // zero, infinity and NaN
+	x = _mm256_castsi256_ps(_mm256_or_si256(_mm256_castps_si256(x), sign));
+	x = _mm256_blendv_ps(x, _mm256_castsi256_ps(_mm256_set1_epi32((int32_t)0x7fc00000u)), _mm256_cmp_ps(_mm256_setzero_ps(), y, _CMP_GT_OQ)); // even root of a negative
+	return x;
+}
+#endif
+
+#if defined(__AVX512F__)
+RB_AVX512_BEGIN
+inline __m512 rb_safe_inv_2_root_avx512(const __m512 y)
+{
+	const __m512i ordinary = _mm512_add_epi32(_mm512_castps_si512(y), _mm512_set1_epi32((int32_t)0x7f800000u));
+	if (_mm512_cmplt_epi32_mask(ordinary, _mm512_set1_epi32((int32_t)0xff000000u)) == (__mmask16)0xffff) return rb_inv_2_root_avx512(y);
+	const __m512i u = _mm512_castps_si512(y), sign = _mm512_and_si512(u, _mm512_set1_epi32((int32_t)0x80000000u));
+	const __m512 a = _mm512_castsi512_ps(_mm512_xor_si512(u, sign));
+	const __mmask16 tiny = _mm512_cmp_ps_mask(_mm512_castsi512_ps(_mm512_set1_epi32((int32_t)0x800000u)), a, _CMP_GT_OQ); // zero or denormal, scaled into normal range
+	const __mmask16 finite = (__mmask16)(_mm512_cmp_ps_mask(a, _mm512_setzero_ps(), _CMP_GT_OQ) & _mm512_cmp_ps_mask(_mm512_castsi512_ps(_mm512_set1_epi32((int32_t)0x7f800000u)), a, _CMP_GT_OQ));
+	const __mmask16 number = _mm512_cmp_ps_mask(a, _mm512_set1_ps(-1.0f), _CMP_GT_OQ); // all but NaN, which keeps its bits
+	__m512 x = rb_inv_2_root_avx512(_mm512_mul_ps(a, _mm512_mask_blend_ps(tiny, _mm512_set1_ps(1.0f), _mm512_castsi512_ps(_mm512_set1_epi32((int32_t)0x4b800000u)))));
+	x = _mm512_mul_ps(x, _mm512_mask_blend_ps(tiny, _mm512_set1_ps(1.0f), _mm512_castsi512_ps(_mm512_set1_epi32((int32_t)0x45800000u))));
+	x = _mm512_mask_blend_ps(finite, _mm512_mask_blend_ps(number, a, _mm512_castsi512_ps(_mm512_sub_epi32(_mm512_set1_epi32((int32_t)0x7f800000u), _mm512_castps_si512(a)))), x); // zero, infinity and NaN
+	x = _mm512_castsi512_ps(_mm512_or_si512(_mm512_castps_si512(x), sign));
+	x = _mm512_mask_blend_ps(_mm512_cmp_ps_mask(_mm512_setzero_ps(), y, _CMP_GT_OQ), x, _mm512_castsi512_ps(_mm512_set1_epi32((int32_t)0x7fc00000u))); // even root of a negative
+	return x;
+}
+RB_AVX512_END
+#endif
+
+inline void rb_safe_inv_2_root_batch(const float *y, float *x, const size_t count)
+{
+#if defined(__AVX512F__)
+	rb_simd_batch<16>(y, x, count, [](const float *in, float *out)
+		{_mm512_storeu_ps(out, rb_safe_inv_2_root_avx512(_mm512_loadu_ps(in)));});
+#elif defined(__AVX2__) && defined(__FMA__)
+	rb_simd_batch<8>(y, x, count, [](const float *in, float *out)
+		{_mm256_storeu_ps(out, rb_safe_inv_2_root_avx2(_mm256_loadu_ps(in)));});
+#elif defined(__SSE4_1__)
+	rb_simd_batch<4>(y, x, count, [](const float *in, float *out)
+		{_mm_storeu_ps(out, rb_safe_inv_2_root_sse41(_mm_loadu_ps(in)));});
+#else
+	for (size_t i = 0; i < count; ++i) x[i] = rb_safe_inv_2_root(y[i]);
+#endif
+}
+
+#if defined(__SSE4_1__)
+inline __m128 rb_3_root_sse41(const __m128 y)
+{
+	__m128i i = _mm_castps_si128(y); // interpret float as integer
+	__m128i q = rb_mulhi_epi32_sse41(i, _mm_set1_epi32((int32_t)0x55555556u));
+	q = _mm_sub_epi32(q, _mm_srai_epi32(i, 31)); // i / 3, rounding toward zero
+	i = _mm_add_epi32(_mm_set1_epi32(0x2a543aa3), q); // log-approximation hack
+	__m128 x = _mm_castsi128_ps(i);
+	x = _mm_add_ps(_mm_mul_ps(x, _mm_set1_ps(0.652748f)), _mm_div_ps(_mm_mul_ps(_mm_set1_ps(0.347252f), y), _mm_mul_ps(x, x))); // newtonian step #1
+	return x;
+}
+#endif
+
+#if defined(__AVX2__) && defined(__FMA__)
+inline __m256 rb_3_root_avx2(const __m256 y)
+{
+	__m256i i = _mm256_castps_si256(y); // interpret float as integer
+	__m256i q = rb_mulhi_epi32_avx2(i, _mm256_set1_epi32((int32_t)0x55555556u));
+	q = _mm256_sub_epi32(q, _mm256_srai_epi32(i, 31)); // i / 3, rounding toward zero
+	i = _mm256_add_epi32(_mm256_set1_epi32(0x2a543aa3), q); // log-approximation hack
+	__m256 x = _mm256_castsi256_ps(i);
+	x = _mm256_fmadd_ps(x, _mm256_set1_ps(0.652748f), _mm256_div_ps(_mm256_mul_ps(_mm256_set1_ps(0.347252f), y), _mm256_mul_ps(x, x))); // newtonian step #1
+	return x;
+}
+#endif
+
+#if defined(__AVX512F__)
+RB_AVX512_BEGIN
+inline __m512 rb_3_root_avx512(const __m512 y)
+{
+	__m512i i = _mm512_castps_si512(y); // interpret float as integer
+	__m512i q = rb_mulhi_epi32_avx512(i, _mm512_set1_epi32((int32_t)0x55555556u));
+	q = _mm512_sub_epi32(q, _mm512_srai_epi32(i, 31)); // i / 3, rounding toward zero
+	i = _mm512_add_epi32(_mm512_set1_epi32(0x2a543aa3), q); // log-approximation hack
+	__m512 x = _mm512_castsi512_ps(i);
+	x = _mm512_fmadd_ps(x, _mm512_set1_ps(0.652748f), _mm512_div_ps(_mm512_mul_ps(_mm512_set1_ps(0.347252f), y), _mm512_mul_ps(x, x))); // newtonian step #1
+	return x;
+}
+RB_AVX512_END
+#endif
+
+inline void rb_3_root_batch(const float *y, float *x, const size_t count)
+{
+#if defined(__AVX512F__)
+	rb_simd_batch<16>(y, x, count, [](const float *in, float *out)
+		{_mm512_storeu_ps(out, rb_3_root_avx512(_mm512_loadu_ps(in)));});
+#elif defined(__AVX2__) && defined(__FMA__)
+	rb_simd_batch<8>(y, x, count, [](const float *in, float *out)
+		{_mm256_storeu_ps(out, rb_3_root_avx2(_mm256_loadu_ps(in)));});
+#elif defined(__SSE4_1__)
+	rb_simd_batch<4>(y, x, count, [](const float *in, float *out)
+		{_mm_storeu_ps(out, rb_3_root_sse41(_mm_loadu_ps(in)));});
+#else
+	for (size_t i = 0; i < count; ++i) x[i] = rb_3_root(y[i]);
+#endif
+}
+
+#if defined(__SSE4_1__)
+inline __m128 rb_safe_3_root_sse41(const __m128 y)
+{
+	const __m128i ordinary = _mm_add_epi32(_mm_castps_si128(y), _mm_set1_epi32((int32_t)0x7f800000u));
+	if (_mm_movemask_epi8(_mm_cmpgt_epi32(_mm_set1_epi32((int32_t)0xff000000u), ordinary)) == 0xffff) return rb_3_root_sse41(y);
+	const __m128i u = _mm_castps_si128(y), sign = _mm_and_si128(u, _mm_set1_epi32((int32_t)0x80000000u));
+	const __m128 a = _mm_castsi128_ps(_mm_xor_si128(u, sign));
+	const __m128 tiny = _mm_cmpgt_ps(_mm_castsi128_ps(_mm_set1_epi32((int32_t)0x800000u)), a); // zero or denormal, scaled into normal range
+	const __m128 finite = _mm_and_ps(_mm_cmpgt_ps(a, _mm_setzero_ps()), _mm_cmpgt_ps(_mm_castsi128_ps(_mm_set1_epi32((int32_t)0x7f800000u)), a));
+	__m128 x = rb_3_root_sse41(_mm_mul_ps(a, _mm_blendv_ps(_mm_set1_ps(1.0f), _mm_castsi128_ps(_mm_set1_epi32((int32_t)0x4b800000u)), tiny)));
+	x = _mm_mul_ps(x, _mm_blendv_ps(_mm_set1_ps(1.0f), _mm_castsi128_ps(_mm_set1_epi32((int32_t)0x3b800000u)), tiny));
+	x = _mm_blendv_ps(a, x, finite); // zero, infinity and NaN
+	x = _mm_castsi128_ps(_mm_or_si128(_mm_castps_si128(x), sign));
+	return x;
+}
+#endif
+
+#if defined(__AVX2__) && defined(__FMA__)
+inline __m256 rb_safe_3_root_avx2(const __m256 y)
+{
+	const __m256i ordinary = _mm256_add_epi32(_mm256_castps_si256(y), _mm256_set1_epi32((int32_t)0x7f800000u));
+	if (_mm256_movemask_epi8(_mm256_cmpgt_epi32(_mm256_set1_epi32((int32_t)0xff000000u), ordinary)) == -1) return rb_3_root_avx2(y);
+	const __m256i u = _mm256_castps_si256(y), sign = _mm256_and_si256(u, _mm256_set1_epi32((int32_t)0x80000000u));
+	const __m256 a = _mm256_castsi256_ps(_mm256_xor_si256(u, sign));
+	const __m256 tiny = _mm256_cmp_ps(_mm256_castsi256_ps(_mm256_set1_epi32((int32_t)0x800000u)), a, _CMP_GT_OQ); // zero or denormal, scaled into normal range
+	const __m256 finite = _mm256_and_ps(_mm256_cmp_ps(a, _mm256_setzero_ps(), _CMP_GT_OQ), _mm256_cmp_ps(_mm256_castsi256_ps(_mm256_set1_epi32((int32_t)0x7f800000u)), a, _CMP_GT_OQ));
+	__m256 x = rb_3_root_avx2(_mm256_mul_ps(a, _mm256_blendv_ps(_mm256_set1_ps(1.0f), _mm256_castsi256_ps(_mm256_set1_epi32((int32_t)0x4b800000u)), tiny)));
+	x = _mm256_mul_ps(x, _mm256_blendv_ps(_mm256_set1_ps(1.0f), _mm256_castsi256_ps(_mm256_set1_epi32((int32_t)0x3b800000u)), tiny));
+	x = _mm256_blendv_ps(a, x, finite); // zero, infinity and NaN
+	x = _mm256_castsi256_ps(_mm256_or_si256(_mm256_castps_si256(x), sign));
+	return x;
+}
+#endif
+
+#if defined(__AVX512F__)
+RB_AVX512_BEGIN
+inline __m512 rb_safe_3_root_avx512(const __m512 y)
+{
+	const __m512i ordinary = _mm512_add_epi32(_mm512_castps_si512(y), _mm512_set1_epi32((int32_t)0x7f800000u));
+	if (_mm512_cmplt_epi32_mask(ordinary, _mm512_set1_epi32((int32_t)0xff000000u)) == (__mmask16)0xffff) return rb_3_root_avx512(y);
+	const __m512i u = _mm512_castps_si512(y), sign = _mm512_and_si512(u, _mm512_set1_epi32((int32_t)0x80000000u));
+	const __m512 a = _mm512_castsi512_ps(_mm512_xor_si512(u, sign));
+	const __mmask16 tiny = _mm512_cmp_ps_mask(_mm512_castsi512_ps(_mm512_set1_epi32((int32_t)0x800000u)), a, _CMP_GT_OQ); // zero or denormal, scaled into normal range
+	const __mmask16 finite = (__mmask16)(_mm512_cmp_ps_mask(a, _mm512_setzero_ps(), _CMP_GT_OQ) & _mm512_cmp_ps_mask(_mm512_castsi512_ps(_mm512_set1_epi32((int32_t)0x7f800000u)), a, _CMP_GT_OQ));
+	__m512 x = rb_3_root_avx512(_mm512_mul_ps(a, _mm512_mask_blend_ps(tiny, _mm512_set1_ps(1.0f), _mm512_castsi512_ps(_mm512_set1_epi32((int32_t)0x4b800000u)))));
+	x = _mm512_mul_ps(x, _mm512_mask_blend_ps(tiny, _mm512_set1_ps(1.0f), _mm512_castsi512_ps(_mm512_set1_epi32((int32_t)0x3b800000u))));
+	x = _mm512_mask_blend_ps(finite, a, x); // zero, infinity and NaN
+	x = _mm512_castsi512_ps(_mm512_or_si512(_mm512_castps_si512(x), sign));
+	return x;
+}
+RB_AVX512_END
+#endif
+
+inline void rb_safe_3_root_batch(const float *y, float *x, const size_t count)
+{
+#if defined(__AVX512F__)
+	rb_simd_batch<16>(y, x, count, [](const float *in, float *out)
+		{_mm512_storeu_ps(out, rb_safe_3_root_avx512(_mm512_loadu_ps(in)));});
+#elif defined(__AVX2__) && defined(__FMA__)
+	rb_simd_batch<8>(y, x, count, [](const float *in, float *out)
+		{_mm256_storeu_ps(out, rb_safe_3_root_avx2(_mm256_loadu_ps(in)));});
+#elif defined(__SSE4_1__)
+	rb_simd_batch<4>(y, x, count, [](const float *in, float *out)
+		{_mm_storeu_ps(out, rb_safe_3_root_sse41(_mm_loadu_ps(in)));});
+#else
+	for (size_t i = 0; i < count; ++i) x[i] = rb_safe_3_root(y[i]);
+#endif
+}
+
+#if defined(__SSE4_1__)
+inline __m128 rb_inv_3_root_sse41(const __m128 y)
+{
+	__m128i i = _mm_castps_si128(y); // interpret float as integer
+	__m128i q = rb_mulhi_epi32_sse41(i, _mm_set1_epi32((int32_t)0x55555556u));
+	q = _mm_sub_epi32(q, _mm_srai_epi32(i, 31)); // i / 3, rounding toward zero
+	i = _mm_sub_epi32(_mm_set1_epi32(0x549da7bf), q); // log-approximation hack
+	__m128 x = _mm_castsi128_ps(i);
+	x = _mm_mul_ps(x, _mm_add_ps(_mm_mul_ps(_mm_mul_ps(_mm_set1_ps(-0.364707f), y), _mm_mul_ps(_mm_mul_ps(x, x), x)), _mm_set1_ps(1.364707f))); // newtonian step #1
+	return x;
+}
+#endif
+
+#if defined(__AVX2__) && defined(__FMA__)
+inline __m256 rb_inv_3_root_avx2(const __m256 y)
+{
+	__m256i i = _mm256_castps_si256(y); // interpret float as integer
+	__m256i q = rb_mulhi_epi32_avx2(i, _mm256_set1_epi32((int32_t)0x55555556u));
+	q = _mm256_sub_epi32(q, _mm256_srai_epi32(i, 31)); // i / 3, rounding toward zero
+	i = _mm256_sub_epi32(_mm256_set1_epi32(0x549da7bf), q); // log-approximation hack
+	__m256 x = _mm256_castsi256_ps(i);
+	x = _mm256_mul_ps(x, _mm256_fmadd_ps(_mm256_mul_ps(_mm256_set1_ps(-0.364707f), y), _mm256_mul_ps(_mm256_mul_ps(x, x), x), _mm256_set1_ps(1.364707f))); // newtonian step #1
+	return x;
+}
+#endif
+
+#if defined(__AVX512F__)
+RB_AVX512_BEGIN
+inline __m512 rb_inv_3_root_avx512(const __m512 y)
+{
+	__m512i i = _mm512_castps_si512(y); // interpret float as integer
+	__m512i q = rb_mulhi_epi32_avx512(i, _mm512_set1_epi32((int32_t)0x55555556u));
+	q = _mm512_sub_epi32(q, _mm512_srai_epi32(i, 31)); // i / 3, rounding toward zero
+	i = _mm512_sub_epi32(_mm512_set1_epi32(0x549da7bf), q); // log-approximation hack
+	__m512 x = _mm512_castsi512_ps(i);
+	x = _mm512_mul_ps(x, _mm512_fmadd_ps(_mm512_mul_ps(_mm512_set1_ps(-0.364707f), y), _mm512_mul_ps(_mm512_mul_ps(x, x), x), _mm512_set1_ps(1.364707f))); // newtonian step #1
+	return x;
+}
+RB_AVX512_END
+#endif
+
+inline void rb_inv_3_root_batch(const float *y, float *x, const size_t count)
+{
+#if defined(__AVX512F__)
+	rb_simd_batch<16>(y, x, count, [](const float *in, float *out)
+		{_mm512_storeu_ps(out, rb_inv_3_root_avx512(_mm512_loadu_ps(in)));});
+#elif defined(__AVX2__) && defined(__FMA__)
+	rb_simd_batch<8>(y, x, count, [](const float *in, float *out)
+		{_mm256_storeu_ps(out, rb_inv_3_root_avx2(_mm256_loadu_ps(in)));});
+#elif defined(__SSE4_1__)
+	rb_simd_batch<4>(y, x, count, [](const float *in, float *out)
+		{_mm_storeu_ps(out, rb_inv_3_root_sse41(_mm_loadu_ps(in)));});
+#else
+	for (size_t i = 0; i < count; ++i) x[i] = rb_inv_3_root(y[i]);
+#endif
+}
+
+#if defined(__SSE4_1__)
+inline __m128 rb_safe_inv_3_root_sse41(const __m128 y)
+{
+	const __m128i ordinary = _mm_add_epi32(_mm_castps_si128(y), _mm_set1_epi32((int32_t)0x7f800000u));
+	if (_mm_movemask_epi8(_mm_cmpgt_epi32(_mm_set1_epi32((int32_t)0xff000000u), ordinary)) == 0xffff) return rb_inv_3_root_sse41(y);
+	const __m128i u = _mm_castps_si128(y), sign = _mm_and_si128(u, _mm_set1_epi32((int32_t)0x80000000u));
+	const __m128 a = _mm_castsi128_ps(_mm_xor_si128(u, sign));
+	const __m128 tiny = _mm_cmpgt_ps(_mm_castsi128_ps(_mm_set1_epi32((int32_t)0x800000u)), a); // zero or denormal, scaled into normal range
+	const __m128 finite = _mm_and_ps(_mm_cmpgt_ps(a, _mm_setzero_ps()), _mm_cmpgt_ps(_mm_castsi128_ps(_mm_set1_epi32((int32_t)0x7f800000u)), a));
+	const __m128 number = _mm_cmpgt_ps(a, _mm_set1_ps(-1.0f)); // all but NaN, which keeps its bits
+	__m128 x = rb_inv_3_root_sse41(_mm_mul_ps(a, _mm_blendv_ps(_mm_set1_ps(1.0f), _mm_castsi128_ps(_mm_set1_epi32((int32_t)0x4b800000u)), tiny)));
+	x = _mm_mul_ps(x, _mm_blendv_ps(_mm_set1_ps(1.0f), _mm_castsi128_ps(_mm_set1_epi32((int32_t)0x43800000u)), tiny));
+	x = _mm_blendv_ps(_mm_blendv_ps(a, _mm_castsi128_ps(_mm_sub_epi32(_mm_set1_epi32((int32_t)0x7f800000u), _mm_castps_si128(a))), number), x, finite); // zero, infinity and NaN
+	x = _mm_castsi128_ps(_mm_or_si128(_mm_castps_si128(x), sign));
+	return x;
+}
+#endif
+
+#if defined(__AVX2__) && defined(__FMA__)
+inline __m256 rb_safe_inv_3_root_avx2(const __m256 y)
+{
+	const __m256i ordinary = _mm256_add_epi32(_mm256_castps_si256(y), _mm256_set1_epi32((int32_t)0x7f800000u));
+	if (_mm256_movemask_epi8(_mm256_cmpgt_epi32(_mm256_set1_epi32((int32_t)0xff000000u), ordinary)) == -1) return rb_inv_3_root_avx2(y);
+	const __m256i u = _mm256_castps_si256(y), sign = _mm256_and_si256(u, _mm256_set1_epi32((int32_t)0x80000000u));
+	const __m256 a = _mm256_castsi256_ps(_mm256_xor_si256(u, sign));
+	const __m256 tiny = _mm256_cmp_ps(_mm256_castsi256_ps(_mm256_set1_epi32((int32_t)0x800000u)), a, _CMP_GT_OQ); // zero or denormal, scaled into normal range
+	const __m256 finite = _mm256_and_ps(_mm256_cmp_ps(a, _mm256_setzero_ps(), _CMP_GT_OQ), _mm256_cmp_ps(_mm256_castsi256_ps(_mm256_set1_epi32((int32_t)0x7f800000u)), a, _CMP_GT_OQ));
+	const __m256 number = _mm256_cmp_ps(a, _mm256_set1_ps(-1.0f), _CMP_GT_OQ); // all but NaN, which keeps its bits
+	__m256 x = rb_inv_3_root_avx2(_mm256_mul_ps(a, _mm256_blendv_ps(_mm256_set1_ps(1.0f), _mm256_castsi256_ps(_mm256_set1_epi32((int32_t)0x4b800000u)), tiny)));
+	x = _mm256_mul_ps(x, _mm256_blendv_ps(_mm256_set1_ps(1.0f), _mm256_castsi256_ps(_mm256_set1_epi32((int32_t)0x43800000u)), tiny));
+	x = _mm256_blendv_ps(_mm256_blendv_ps(a, _mm256_castsi256_ps(_mm256_sub_epi32(_mm256_set1_epi32((int32_t)0x7f800000u), _mm256_castps_si256(a))), number), x, finite); // zero, infinity and NaN
+	x = _mm256_castsi256_ps(_mm256_or_si256(_mm256_castps_si256(x), sign));
+	return x;
+}
+#endif
+
+#if defined(__AVX512F__)
+RB_AVX512_BEGIN
+inline __m512 rb_safe_inv_3_root_avx512(const __m512 y)
+{
+	const __m512i ordinary = _mm512_add_epi32(_mm512_castps_si512(y), _mm512_set1_epi32((int32_t)0x7f800000u));
+	if (_mm512_cmplt_epi32_mask(ordinary, _mm512_set1_epi32((int32_t)0xff000000u)) == (__mmask16)0xffff) return rb_inv_3_root_avx512(y);
+	const __m512i u = _mm512_castps_si512(y), sign = _mm512_and_si512(u, _mm512_set1_epi32((int32_t)0x80000000u));
+	const __m512 a = _mm512_castsi512_ps(_mm512_xor_si512(u, sign));
+	const __mmask16 tiny = _mm512_cmp_ps_mask(_mm512_castsi512_ps(_mm512_set1_epi32((int32_t)0x800000u)), a, _CMP_GT_OQ); // zero or denormal, scaled into normal range
+	const __mmask16 finite = (__mmask16)(_mm512_cmp_ps_mask(a, _mm512_setzero_ps(), _CMP_GT_OQ) & _mm512_cmp_ps_mask(_mm512_castsi512_ps(_mm512_set1_epi32((int32_t)0x7f800000u)), a, _CMP_GT_OQ));
+	const __mmask16 number = _mm512_cmp_ps_mask(a, _mm512_set1_ps(-1.0f), _CMP_GT_OQ); // all but NaN, which keeps its bits
+	__m512 x = rb_inv_3_root_avx512(_mm512_mul_ps(a, _mm512_mask_blend_ps(tiny, _mm512_set1_ps(1.0f), _mm512_castsi512_ps(_mm512_set1_epi32((int32_t)0x4b800000u)))));
+	x = _mm512_mul_ps(x, _mm512_mask_blend_ps(tiny, _mm512_set1_ps(1.0f), _mm512_castsi512_ps(_mm512_set1_epi32((int32_t)0x43800000u))));
+	x = _mm512_mask_blend_ps(finite, _mm512_mask_blend_ps(number, a, _mm512_castsi512_ps(_mm512_sub_epi32(_mm512_set1_epi32((int32_t)0x7f800000u), _mm512_castps_si512(a)))), x); // zero, infinity and NaN
+	x = _mm512_castsi512_ps(_mm512_or_si512(_mm512_castps_si512(x), sign));
+	return x;
+}
+RB_AVX512_END
+#endif
+
+inline void rb_safe_inv_3_root_batch(const float *y, float *x, const size_t count)
+{
+#if defined(__AVX512F__)
+	rb_simd_batch<16>(y, x, count, [](const float *in, float *out)
+		{_mm512_storeu_ps(out, rb_safe_inv_3_root_avx512(_mm512_loadu_ps(in)));});
+#elif defined(__AVX2__) && defined(__FMA__)
+	rb_simd_batch<8>(y, x, count, [](const float *in, float *out)
+		{_mm256_storeu_ps(out, rb_safe_inv_3_root_avx2(_mm256_loadu_ps(in)));});
+#elif defined(__SSE4_1__)
+	rb_simd_batch<4>(y, x, count, [](const float *in, float *out)
+		{_mm_storeu_ps(out, rb_safe_inv_3_root_sse41(_mm_loadu_ps(in)));});
+#else
+	for (size_t i = 0; i < count; ++i) x[i] = rb_safe_inv_3_root(y[i]);
+#endif
+}
+
+#if defined(__SSE4_1__)
+inline __m128 rb_4_root_sse41(const __m128 y)
+{
+	__m128i i = _mm_castps_si128(y); // interpret float as integer
+	__m128i q = _mm_srai_epi32(_mm_add_epi32(i, _mm_srli_epi32(_mm_srai_epi32(i, 31), 30)), 2); // i / 4, rounding toward zero
+	i = _mm_add_epi32(_mm_set1_epi32(0x2f9ed7c0), q); // log-approximation hack
+	__m128 x = _mm_castsi128_ps(i);
+	x = _mm_add_ps(_mm_mul_ps(x, _mm_set1_ps(0.733402f)), _mm_div_ps(_mm_mul_ps(_mm_set1_ps(0.266598f), y), _mm_mul_ps(_mm_mul_ps(x, x), x))); // newtonian step #1
+	return x;
+}
+#endif
+
+#if defined(__AVX2__) && defined(__FMA__)
+inline __m256 rb_4_root_avx2(const __m256 y)
+{
+	__m256i i = _mm256_castps_si256(y); // interpret float as integer
+	__m256i q = _mm256_srai_epi32(_mm256_add_epi32(i, _mm256_srli_epi32(_mm256_srai_epi32(i, 31), 30)), 2); // i / 4, rounding toward zero
+	i = _mm256_add_epi32(_mm256_set1_epi32(0x2f9ed7c0), q); // log-approximation hack
+	__m256 x = _mm256_castsi256_ps(i);
+	x = _mm256_fmadd_ps(x, _mm256_set1_ps(0.733402f), _mm256_div_ps(_mm256_mul_ps(_mm256_set1_ps(0.266598f), y), _mm256_mul_ps(_mm256_mul_ps(x, x), x))); // newtonian step #1
+	return x;
+}
+#endif
+
+#if defined(__AVX512F__)
+RB_AVX512_BEGIN
+inline __m512 rb_4_root_avx512(const __m512 y)
+{
+	__m512i i = _mm512_castps_si512(y); // interpret float as integer
+	__m512i q = _mm512_srai_epi32(_mm512_add_epi32(i, _mm512_srli_epi32(_mm512_srai_epi32(i, 31), 30)), 2); // i / 4, rounding toward zero
+	i = _mm512_add_epi32(_mm512_set1_epi32(0x2f9ed7c0), q); // log-approximation hack
+	__m512 x = _mm512_castsi512_ps(i);
+	x = _mm512_fmadd_ps(x, _mm512_set1_ps(0.733402f), _mm512_div_ps(_mm512_mul_ps(_mm512_set1_ps(0.266598f), y), _mm512_mul_ps(_mm512_mul_ps(x, x), x))); // newtonian step #1
+	return x;
+}
+RB_AVX512_END
+#endif
+
+inline void rb_4_root_batch(const float *y, float *x, const size_t count)
+{
+#if defined(__AVX512F__)
+	rb_simd_batch<16>(y, x, count, [](const float *in, float *out)
+		{_mm512_storeu_ps(out, rb_4_root_avx512(_mm512_loadu_ps(in)));});
+#elif defined(__AVX2__) && defined(__FMA__)
+	rb_simd_batch<8>(y, x, count, [](const float *in, float *out)
+		{_mm256_storeu_ps(out, rb_4_root_avx2(_mm256_loadu_ps(in)));});
+#elif defined(__SSE4_1__)
+	rb_simd_batch<4>(y, x, count, [](const float *in, float *out)
+		{_mm_storeu_ps(out, rb_4_root_sse41(_mm_loadu_ps(in)));});
+#else
+	for (size_t i = 0; i < count; ++i) x[i] = rb_4_root(y[i]);
+#endif
+}
+
+#if defined(__SSE4_1__)
+inline __m128 rb_safe_4_root_sse41(const __m128 y)
+{
+	const __m128i ordinary = _mm_add_epi32(_mm_castps_si128(y), _mm_set1_epi32((int32_t)0x7f800000u));
+	if (_mm_movemask_epi8(_mm_cmpgt_epi32(_mm_set1_epi32((int32_t)0xff000000u), ordinary)) == 0xffff) return rb_4_root_sse41(y);
+	const __m128i u = _mm_castps_si128(y), sign = _mm_and_si128(u, _mm_set1_epi32((int32_t)0x80000000u));
+	const __m128 a = _mm_castsi128_ps(_mm_xor_si128(u, sign));
+	const __m128 tiny = _mm_cmpgt_ps(_mm_castsi128_ps(_mm_set1_epi32((int32_t)0x800000u)), a); // zero or denormal, scaled into normal range
+	const __m128 finite = _mm_and_ps(_mm_cmpgt_ps(a, _mm_setzero_ps()), _mm_cmpgt_ps(_mm_castsi128_ps(_mm_set1_epi32((int32_t)0x7f800000u)), a));
+	__m128 x = rb_4_root_sse41(_mm_mul_ps(a, _mm_blendv_ps(_mm_set1_ps(1.0f), _mm_castsi128_ps(_mm_set1_epi32((int32_t)0x4b800000u)), tiny)));
+	x = _mm_mul_ps(x, _mm_blendv_ps(_mm_set1_ps(1.0f), _mm_castsi128_ps(_mm_set1_epi32((int32_t)0x3c800000u)), tiny));
+	x = _mm_blendv_ps(a, x, finite); // zero, infinity and NaN
+	x = _mm_castsi128_ps(_mm_or_si128(_mm_castps_si128(x), sign));
+	x = _mm_blendv_ps(x, _mm_castsi128_ps(_mm_set1_epi32((int32_t)0x7fc00000u)), _mm_cmpgt_ps(_mm_setzero_ps(), y)); // even root of a negative
+	return x;
+}
+#endif
+
+#if defined(__AVX2__) && defined(__FMA__)
+inline __m256 rb_safe_4_root_avx2(const __m256 y)
+{
+	const __m256i ordinary = _mm256_add_epi32(_mm256_castps_si256(y), _mm256_set1_epi32((int32_t)0x7f800000u));
+	if (_mm256_movemask_epi8(_mm256_cmpgt_epi32(_mm256_set1_epi32((int32_t)0xff000000u), ordinary)) == -1) return rb_4_root_avx2(y);
+	const __m256i u = _mm256_castps_si256(y), sign = _mm256_and_si256(u, _mm256_set1_epi32((int32_t)0x80000000u));
+	const __m256 a = _mm256_castsi256_ps(_mm256_xor_si256(u, sign));
+	const __m256 tiny = _mm256_cmp_ps(_mm256_castsi256_ps(_mm256_set1_epi32((int32_t)0x800000u)), a, _CMP_GT_OQ); // zero or denormal, scaled into normal range
+	const __m256 finite = _mm256_and_ps(_mm256_cmp_ps(a, _mm256_setzero_ps(), _CMP_GT_OQ), _mm256_cmp_ps(_mm256_castsi256_ps(_mm256_set1_epi32((int32_t)0x7f800000u)), a, _CMP_GT_OQ));
+	__m256 x = rb_4_root_avx2(_mm256_mul_ps(a, _mm256_blendv_ps(_mm256_set1_ps(1.0f), _mm256_castsi256_ps(_mm256_set1_epi32((int32_t)0x4b800000u)), tiny)));
+	x = _mm256_mul_ps(x, _mm256_blendv_ps(_mm256_set1_ps(1.0f), _mm256_castsi256_ps(_mm256_set1_epi32((int32_t)0x3c800000u)), tiny));
+	x = _mm256_blendv_ps(a, x, finite); // zero, infinity and NaN
+	x = _mm256_castsi256_ps(_mm256_or_si256(_mm256_castps_si256(x), sign));
+	x = _mm256_blendv_ps(x, _mm256_castsi256_ps(_mm256_set1_epi32((int32_t)0x7fc00000u)), _mm256_cmp_ps(_mm256_setzero_ps(), y, _CMP_GT_OQ)); // even root of a negative
+	return x;
+}
+#endif
+
+#if defined(__AVX512F__)
+RB_AVX512_BEGIN
+inline __m512 rb_safe_4_root_avx512(const __m512 y)
+{
+	const __m512i ordinary = _mm512_add_epi32(_mm512_castps_si512(y), _mm512_set1_epi32((int32_t)0x7f800000u));
+	if (_mm512_cmplt_epi32_mask(ordinary, _mm512_set1_epi32((int32_t)0xff000000u)) == (__mmask16)0xffff) return rb_4_root_avx512(y);
+	const __m512i u = _mm512_castps_si512(y), sign = _mm512_and_si512(u, _mm512_set1_epi32((int32_t)0x80000000u));
+	const __m512 a = _mm512_castsi512_ps(_mm512_xor_si512(u, sign));
+	const __mmask16 tiny = _mm512_cmp_ps_mask(_mm512_castsi512_ps(_mm512_set1_epi32((int32_t)0x800000u)), a, _CMP_GT_OQ); // zero or denormal, scaled into normal range
+	const __mmask16 finite = (__mmask16)(_mm512_cmp_ps_mask(a, _mm512_setzero_ps(), _CMP_GT_OQ) & _mm512_cmp_ps_mask(_mm512_castsi512_ps(_mm512_set1_epi32((int32_t)0x7f800000u)), a, _CMP_GT_OQ));
+	__m512 x = rb_4_root_avx512(_mm512_mul_ps(a, _mm512_mask_blend_ps(tiny, _mm512_set1_ps(1.0f), _mm512_castsi512_ps(_mm512_set1_epi32((int32_t)0x4b800000u)))));
+	x = _mm512_mul_ps(x, _mm512_mask_blend_ps(tiny, _mm512_set1_ps(1.0f), _mm512_castsi512_ps(_mm512_set1_epi32((int32_t)0x3c800000u))));
+	x = _mm512_mask_blend_ps(finite, a, x); // zero, infinity and NaN
+	x = _mm512_castsi512_ps(_mm512_or_si512(_mm512_castps_si512(x), sign));
+	x = _mm512_mask_blend_ps(_mm512_cmp_ps_mask(_mm512_setzero_ps(), y, _CMP_GT_OQ), x, _mm512_castsi512_ps(_mm512_set1_epi32((int32_t)0x7fc00000u))); // even root of a negative
+	return x;
+}
+RB_AVX512_END
+#endif
+
+inline void rb_safe_4_root_batch(const float *y, float *x, const size_t count)
+{
+#if defined(__AVX512F__)
+	rb_simd_batch<16>(y, x, count, [](const float *in, float *out)
+		{_mm512_storeu_ps(out, rb_safe_4_root_avx512(_mm512_loadu_ps(in)));});
+#elif defined(__AVX2__) && defined(__FMA__)
+	rb_simd_batch<8>(y, x, count, [](const float *in, float *out)
+		{_mm256_storeu_ps(out, rb_safe_4_root_avx2(_mm256_loadu_ps(in)));});
+#elif defined(__SSE4_1__)
+	rb_simd_batch<4>(y, x, count, [](const float *in, float *out)
+		{_mm_storeu_ps(out, rb_safe_4_root_sse41(_mm_loadu_ps(in)));});
+#else
+	for (size_t i = 0; i < count; ++i) x[i] = rb_safe_4_root(y[i]);
+#endif
+}
+
+#if defined(__SSE4_1__)
+inline __m128 rb_inv_4_root_sse41(const __m128 y)
+{
+	__m128i i = _mm_castps_si128(y); // interpret float as integer
+	__m128i q = _mm_srai_epi32(_mm_add_epi32(i, _mm_srli_epi32(_mm_srai_epi32(i, 31), 30)), 2); // i / 4, rounding toward zero
+	i = _mm_sub_epi32(_mm_set1_epi32(0x4f542107), q); // log-approximation hack
+	__m128 x = _mm_castsi128_ps(i);
+	x = _mm_mul_ps(x, _mm_add_ps(_mm_mul_ps(_mm_mul_ps(_mm_set1_ps(-0.277446f), y), _mm_mul_ps(_mm_mul_ps(x, x), _mm_mul_ps(x, x))), _mm_set1_ps(1.277446f))); // newtonian step #1
+	return x;
+}
+#endif
+
+#if defined(__AVX2__) && defined(__FMA__)
+inline __m256 rb_inv_4_root_avx2(const __m256 y)
+{
+	__m256i i = _mm256_castps_si256(y); // interpret float as integer
+	__m256i q = _mm256_srai_epi32(_mm256_add_epi32(i, _mm256_srli_epi32(_mm256_srai_epi32(i, 31), 30)), 2); // i / 4, rounding toward zero
+	i = _mm256_sub_epi32(_mm256_set1_epi32(0x4f542107), q); // log-approximation hack
+	__m256 x = _mm256_castsi256_ps(i);
+	x = _mm256_mul_ps(x, _mm256_fmadd_ps(_mm256_mul_ps(_mm256_set1_ps(-0.277446f), y), _mm256_mul_ps(_mm256_mul_ps(x, x), _mm256_mul_ps(x, x)), _mm256_set1_ps(1.277446f))); // newtonian step #1
+	return x;
+}
+#endif
+
+#if defined(__AVX512F__)
+RB_AVX512_BEGIN
+inline __m512 rb_inv_4_root_avx512(const __m512 y)
+{
+	__m512i i = _mm512_castps_si512(y); // interpret float as integer
+	__m512i q = _mm512_srai_epi32(_mm512_add_epi32(i, _mm512_srli_epi32(_mm512_srai_epi32(i, 31), 30)), 2); // i / 4, rounding toward zero
+	i = _mm512_sub_epi32(_mm512_set1_epi32(0x4f542107), q); // log-approximation hack
+	__m512 x = _mm512_castsi512_ps(i);
+	x = _mm512_mul_ps(x, _mm512_fmadd_ps(_mm512_mul_ps(_mm512_set1_ps(-0.277446f), y), _mm512_mul_ps(_mm512_mul_ps(x, x), _mm512_mul_ps(x, x)), _mm512_set1_ps(1.277446f))); // newtonian step #1
+	return x;
+}
+RB_AVX512_END
+#endif
+
+inline void rb_inv_4_root_batch(const float *y, float *x, const size_t count)
+{
+#if defined(__AVX512F__)
+	rb_simd_batch<16>(y, x, count, [](const float *in, float *out)
+		{_mm512_storeu_ps(out, rb_inv_4_root_avx512(_mm512_loadu_ps(in)));});
+#elif defined(__AVX2__) && defined(__FMA__)
+	rb_simd_batch<8>(y, x, count, [](const float *in, float *out)
+		{_mm256_storeu_ps(out, rb_inv_4_root_avx2(_mm256_loadu_ps(in)));});
+#elif defined(__SSE4_1__)
+	rb_simd_batch<4>(y, x, count, [](const float *in, float *out)
+		{_mm_storeu_ps(out, rb_inv_4_root_sse41(_mm_loadu_ps(in)));});
+#else
+	for (size_t i = 0; i < count; ++i) x[i] = rb_inv_4_root(y[i]);
+#endif
+}
+
+#if defined(__SSE4_1__)
+inline __m128 rb_safe_inv_4_root_sse41(const __m128 y)
+{
+	const __m128i ordinary = _mm_add_epi32(_mm_castps_si128(y), _mm_set1_epi32((int32_t)0x7f800000u));
+	if (_mm_movemask_epi8(_mm_cmpgt_epi32(_mm_set1_epi32((int32_t)0xff000000u), ordinary)) == 0xffff) return rb_inv_4_root_sse41(y);
+	const __m128i u = _mm_castps_si128(y), sign = _mm_and_si128(u, _mm_set1_epi32((int32_t)0x80000000u));
+	const __m128 a = _mm_castsi128_ps(_mm_xor_si128(u, sign));
+	const __m128 tiny = _mm_cmpgt_ps(_mm_castsi128_ps(_mm_set1_epi32((int32_t)0x800000u)), a); // zero or denormal, scaled into normal range
+	const __m128 finite = _mm_and_ps(_mm_cmpgt_ps(a, _mm_setzero_ps()), _mm_cmpgt_ps(_mm_castsi128_ps(_mm_set1_epi32((int32_t)0x7f800000u)), a));
+	const __m128 number = _mm_cmpgt_ps(a, _mm_set1_ps(-1.0f)); // all but NaN, which keeps its bits
+	__m128 x = rb_inv_4_root_sse41(_mm_mul_ps(a, _mm_blendv_ps(_mm_set1_ps(1.0f), _mm_castsi128_ps(_mm_set1_epi32((int32_t)0x4b800000u)), tiny)));
+	x = _mm_mul_ps(x, _mm_blendv_ps(_mm_set1_ps(1.0f), _mm_castsi128_ps(_mm_set1_epi32((int32_t)0x42800000u)), tiny));
+	x = _mm_blendv_ps(_mm_blendv_ps(a, _mm_castsi128_ps(_mm_sub_epi32(_mm_set1_epi32((int32_t)0x7f800000u), _mm_castps_si128(a))), number), x, finite); // zero, infinity and NaN
+	x = _mm_castsi128_ps(_mm_or_si128(_mm_castps_si128(x), sign));
+	x = _mm_blendv_ps(x, _mm_castsi128_ps(_mm_set1_epi32((int32_t)0x7fc00000u)), _mm_cmpgt_ps(_mm_setzero_ps(), y)); // even root of a negative
+	return x;
+}
+#endif
+
+#if defined(__AVX2__) && defined(__FMA__)
+inline __m256 rb_safe_inv_4_root_avx2(const __m256 y)
+{
+	const __m256i ordinary = _mm256_add_epi32(_mm256_castps_si256(y), _mm256_set1_epi32((int32_t)0x7f800000u));
+	if (_mm256_movemask_epi8(_mm256_cmpgt_epi32(_mm256_set1_epi32((int32_t)0xff000000u), ordinary)) == -1) return rb_inv_4_root_avx2(y);
+	const __m256i u = _mm256_castps_si256(y), sign = _mm256_and_si256(u, _mm256_set1_epi32((int32_t)0x80000000u));
+	const __m256 a = _mm256_castsi256_ps(_mm256_xor_si256(u, sign));
+	const __m256 tiny = _mm256_cmp_ps(_mm256_castsi256_ps(_mm256_set1_epi32((int32_t)0x800000u)), a, _CMP_GT_OQ); // zero or denormal, scaled into normal range
+	const __m256 finite = _mm256_and_ps(_mm256_cmp_ps(a, _mm256_setzero_ps(), _CMP_GT_OQ), _mm256_cmp_ps(_mm256_castsi256_ps(_mm256_set1_epi32((int32_t)0x7f800000u)), a, _CMP_GT_OQ));
+	const __m256 number = _mm256_cmp_ps(a, _mm256_set1_ps(-1.0f), _CMP_GT_OQ); // all but NaN, which keeps its bits
+	__m256 x = rb_inv_4_root_avx2(_mm256_mul_ps(a, _mm256_blendv_ps(_mm256_set1_ps(1.0f), _mm256_castsi256_ps(_mm256_set1_epi32((int32_t)0x4b800000u)), tiny)));
+	x = _mm256_mul_ps(x, _mm256_blendv_ps(_mm256_set1_ps(1.0f), _mm256_castsi256_ps(_mm256_set1_epi32((int32_t)0x42800000u)), tiny));
+	x = _mm256_blendv_ps(_mm256_blendv_ps(a, _mm256_castsi256_ps(_mm256_sub_epi32(_mm256_set1_epi32((int32_t)0x7f800000u), _mm256_castps_si256(a))), number), x, finite); // zero, infinity and NaN
+	x = _mm256_castsi256_ps(_mm256_or_si256(_mm256_castps_si256(x), sign));
+	x = _mm256_blendv_ps(x, _mm256_castsi256_ps(_mm256_set1_epi32((int32_t)0x7fc00000u)), _mm256_cmp_ps(_mm256_setzero_ps(), y, _CMP_GT_OQ)); // even root of a negative
+	return x;
+}
+#endif
+
+#if defined(__AVX512F__)
+RB_AVX512_BEGIN
+inline __m512 rb_safe_inv_4_root_avx512(const __m512 y)
+{
+	const __m512i ordinary = _mm512_add_epi32(_mm512_castps_si512(y), _mm512_set1_epi32((int32_t)0x7f800000u));
+	if (_mm512_cmplt_epi32_mask(ordinary, _mm512_set1_epi32((int32_t)0xff000000u)) == (__mmask16)0xffff) return rb_inv_4_root_avx512(y);
+	const __m512i u = _mm512_castps_si512(y), sign = _mm512_and_si512(u, _mm512_set1_epi32((int32_t)0x80000000u));
+	const __m512 a = _mm512_castsi512_ps(_mm512_xor_si512(u, sign));
+	const __mmask16 tiny = _mm512_cmp_ps_mask(_mm512_castsi512_ps(_mm512_set1_epi32((int32_t)0x800000u)), a, _CMP_GT_OQ); // zero or denormal, scaled into normal range
+	const __mmask16 finite = (__mmask16)(_mm512_cmp_ps_mask(a, _mm512_setzero_ps(), _CMP_GT_OQ) & _mm512_cmp_ps_mask(_mm512_castsi512_ps(_mm512_set1_epi32((int32_t)0x7f800000u)), a, _CMP_GT_OQ));
+	const __mmask16 number = _mm512_cmp_ps_mask(a, _mm512_set1_ps(-1.0f), _CMP_GT_OQ); // all but NaN, which keeps its bits
+	__m512 x = rb_inv_4_root_avx512(_mm512_mul_ps(a, _mm512_mask_blend_ps(tiny, _mm512_set1_ps(1.0f), _mm512_castsi512_ps(_mm512_set1_epi32((int32_t)0x4b800000u)))));
+	x = _mm512_mul_ps(x, _mm512_mask_blend_ps(tiny, _mm512_set1_ps(1.0f), _mm512_castsi512_ps(_mm512_set1_epi32((int32_t)0x42800000u))));
+	x = _mm512_mask_blend_ps(finite, _mm512_mask_blend_ps(number, a, _mm512_castsi512_ps(_mm512_sub_epi32(_mm512_set1_epi32((int32_t)0x7f800000u), _mm512_castps_si512(a)))), x); // zero, infinity and NaN
+	x = _mm512_castsi512_ps(_mm512_or_si512(_mm512_castps_si512(x), sign));
+	x = _mm512_mask_blend_ps(_mm512_cmp_ps_mask(_mm512_setzero_ps(), y, _CMP_GT_OQ), x, _mm512_castsi512_ps(_mm512_set1_epi32((int32_t)0x7fc00000u))); // even root of a negative
+	return x;
+}
+RB_AVX512_END
+#endif
+
+inline void rb_safe_inv_4_root_batch(const float *y, float *x, const size_t count)
+{
+#if defined(__AVX512F__)
+	rb_simd_batch<16>(y, x, count, [](const float *in, float *out)
+		{_mm512_storeu_ps(out, rb_safe_inv_4_root_avx512(_mm512_loadu_ps(in)));});
+#elif defined(__AVX2__) && defined(__FMA__)
+	rb_simd_batch<8>(y, x, count, [](const float *in, float *out)
+		{_mm256_storeu_ps(out, rb_safe_inv_4_root_avx2(_mm256_loadu_ps(in)));});
+#elif defined(__SSE4_1__)
+	rb_simd_batch<4>(y, x, count, [](const float *in, float *out)
+		{_mm_storeu_ps(out, rb_safe_inv_4_root_sse41(_mm_loadu_ps(in)));});
+#else
+	for (size_t i = 0; i < count; ++i) x[i] = rb_safe_inv_4_root(y[i]);
+#endif
+}
+
+#if defined(__SSE4_1__)
+inline __m128 rb0_2_root_sse41(const __m128 y)
+{
+	__m128i i = _mm_castps_si128(y); // interpret float as integer
+	__m128i q = _mm_srai_epi32(_mm_add_epi32(i, _mm_srli_epi32(_mm_srai_epi32(i, 31), 31)), 1); // i / 2, rounding toward zero
+	i = _mm_add_epi32(_mm_set1_epi32(0x1fbb4f2e), q); // log-approximation hack
+	__m128 x = _mm_castsi128_ps(i);
+	return x;
+}
+#endif
+
+#if defined(__AVX2__) && defined(__FMA__)
+inline __m256 rb0_2_root_avx2(const __m256 y)
+{
+	__m256i i = _mm256_castps_si256(y); // interpret float as integer
+	__m256i q = _mm256_srai_epi32(_mm256_add_epi32(i, _mm256_srli_epi32(_mm256_srai_epi32(i, 31), 31)), 1); // i / 2, rounding toward zero
+	i = _mm256_add_epi32(_mm256_set1_epi32(0x1fbb4f2e), q); // log-approximation hack
+	__m256 x = _mm256_castsi256_ps(i);
+	return x;
+}
+#endif
+
+#if defined(__AVX512F__)
+RB_AVX512_BEGIN
+inline __m512 rb0_2_root_avx512(const __m512 y)
+{
+	__m512i i = _mm512_castps_si512(y); // interpret float as integer
+	__m512i q = _mm512_srai_epi32(_mm512_add_epi32(i, _mm512_srli_epi32(_mm512_srai_epi32(i, 31), 31)), 1); // i / 2, rounding toward zero
+	i = _mm512_add_epi32(_mm512_set1_epi32(0x1fbb4f2e), q); // log-approximation hack
+	__m512 x = _mm512_castsi512_ps(i);
+	return x;
+}
+RB_AVX512_END
+#endif
+
+inline void rb0_2_root_batch(const float *y, float *x, const size_t count)
+{
+#if defined(__AVX512F__)
+	rb_simd_batch<16>(y, x, count, [](const float *in, float *out)
+		{_mm512_storeu_ps(out, rb0_2_root_avx512(_mm512_loadu_ps(in)));});
+#elif defined(__AVX2__) && defined(__FMA__)
+	rb_simd_batch<8>(y, x, count, [](const float *in, float *out)
+		{_mm256_storeu_ps(out, rb0_2_root_avx2(_mm256_loadu_ps(in)));});
+#elif defined(__SSE4_1__)
+	rb_simd_batch<4>(y, x, count, [](const float *in, float *out)
+		{_mm_storeu_ps(out, rb0_2_root_sse41(_mm_loadu_ps(in)));});
+#else
+	for (size_t i = 0; i < count; ++i) x[i] = rb0_2_root(y[i]);
+#endif
+}
+
+#if defined(__SSE4_1__)
+inline __m128 rb0_safe_2_root_sse41(const __m128 y)
+{
+	const __m128i ordinary = _mm_add_epi32(_mm_castps_si128(y), _mm_set1_epi32((int32_t)0x7f800000u));
+	if (_mm_movemask_epi8(_mm_cmpgt_epi32(_mm_set1_epi32((int32_t)0xff000000u), ordinary)) == 0xffff) return rb0_2_root_sse41(y);
+	const __m128i u = _mm_castps_si128(y), sign = _mm_and_si128(u, _mm_set1_epi32((int32_t)0x80000000u));
+	const __m128 a = _mm_castsi128_ps(_mm_xor_si128(u, sign));
+	const __m128 tiny = _mm_cmpgt_ps(_mm_castsi128_ps(_mm_set1_epi32((int32_t)0x800000u)), a); // zero or denormal, scaled into normal range
+	const __m128 finite = _mm_and_ps(_mm_cmpgt_ps(a, _mm_setzero_ps()), _mm_cmpgt_ps(_mm_castsi128_ps(_mm_set1_epi32((int32_t)0x7f800000u)), a));
+	__m128 x = rb0_2_root_sse41(_mm_mul_ps(a, _mm_blendv_ps(_mm_set1_ps(1.0f), _mm_castsi128_ps(_mm_set1_epi32((int32_t)0x4b800000u)), tiny)));
+	x = _mm_mul_ps(x, _mm_blendv_ps(_mm_set1_ps(1.0f), _mm_castsi128_ps(_mm_set1_epi32((int32_t)0x39800000u)), tiny));
+	x = _mm_blendv_ps(a, x, finite); // zero, infinity and NaN
+	x = _mm_castsi128_ps(_mm_or_si128(_mm_castps_si128(x), sign));
+	x = _mm_blendv_ps(x, _mm_castsi128_ps(_mm_set1_epi32((int32_t)0x7fc00000u)), _mm_cmpgt_ps(_mm_setzero_ps(), y)); // even root of a negative
+	return x;
+}
+#endif
+
+#if defined(__AVX2__) && defined(__FMA__)
+inline __m256 rb0_safe_2_root_avx2(const __m256 y)
+{
+	const __m256i ordinary = _mm256_add_epi32(_mm256_castps_si256(y), _mm256_set1_epi32((int32_t)0x7f800000u));
+	if (_mm256_movemask_epi8(_mm256_cmpgt_epi32(_mm256_set1_epi32((int32_t)0xff000000u), ordinary)) == -1) return rb0_2_root_avx2(y);
+	const __m256i u = _mm256_castps_si256(y), sign = _mm256_and_si256(u, _mm256_set1_epi32((int32_t)0x80000000u));
+	const __m256 a = _mm256_castsi256_ps(_mm256_xor_si256(u, sign));
+	const __m256 tiny = _mm256_cmp_ps(_mm256_castsi256_ps(_mm256_set1_epi32((int32_t)0x800000u)), a, _CMP_GT_OQ); // zero or denormal, scaled into normal range
+	const __m256 finite = _mm256_and_ps(_mm256_cmp_ps(a, _mm256_setzero_ps(), _CMP_GT_OQ), _mm256_cmp_ps(_mm256_castsi256_ps(_mm256_set1_epi32((int32_t)0x7f800000u)), a, _CMP_GT_OQ));
+	__m256 x = rb0_2_root_avx2(_mm256_mul_ps(a, _mm256_blendv_ps(_mm256_set1_ps(1.0f), _mm256_castsi256_ps(_mm256_set1_epi32((int32_t)0x4b800000u)), tiny)));
+	x = _mm256_mul_ps(x, _mm256_blendv_ps(_mm256_set1_ps(1.0f), _mm256_castsi256_ps(_mm256_set1_epi32((int32_t)0x39800000u)), tiny));
+	x = _mm256_blendv_ps(a, x, finite); // zero, infinity and NaN
+	x = _mm256_castsi256_ps(_mm256_or_si256(_mm256_castps_si256(x), sign));
+	x = _mm256_blendv_ps(x, _mm256_castsi256_ps(_mm256_set1_epi32((int32_t)0x7fc00000u)), _mm256_cmp_ps(_mm256_setzero_ps(), y, _CMP_GT_OQ)); // even root of a negative
+	return x;
+}
+#endif
+
+#if defined(__AVX512F__)
+RB_AVX512_BEGIN
+inline __m512 rb0_safe_2_root_avx512(const __m512 y)
+{
+	const __m512i ordinary = _mm512_add_epi32(_mm512_castps_si512(y), _mm512_set1_epi32((int32_t)0x7f800000u));
+	if (_mm512_cmplt_epi32_mask(ordinary, _mm512_set1_epi32((int32_t)0xff000000u)) == (__mmask16)0xffff) return rb0_2_root_avx512(y);
+	const __m512i u = _mm512_castps_si512(y), sign = _mm512_and_si512(u, _mm512_set1_epi32((int32_t)0x80000000u));
+	const __m512 a = _mm512_castsi512_ps(_mm512_xor_si512(u, sign));
+	const __mmask16 tiny = _mm512_cmp_ps_mask(_mm512_castsi512_ps(_mm512_set1_epi32((int32_t)0x800000u)), a, _CMP_GT_OQ); // zero or denormal, scaled into normal range
+	const __mmask16 finite = (__mmask16)(_mm512_cmp_ps_mask(a, _mm512_setzero_ps(), _CMP_GT_OQ) & _mm512_cmp_ps_mask(_mm512_castsi512_ps(_mm512_set1_epi32((int32_t)0x7f800000u)), a, _CMP_GT_OQ));
+	__m512 x = rb0_2_root_avx512(_mm512_mul_ps(a, _mm512_mask_blend_ps(tiny, _mm512_set1_ps(1.0f), _mm512_castsi512_ps(_mm512_set1_epi32((int32_t)0x4b800000u)))));
+	x = _mm512_mul_ps(x, _mm512_mask_blend_ps(tiny, _mm512_set1_ps(1.0f), _mm512_castsi512_ps(_mm512_set1_epi32((int32_t)0x39800000u))));
+	x = _mm512_mask_blend_ps(finite, a, x); // zero, infinity and NaN
+	x = _mm512_castsi512_ps(_mm512_or_si512(_mm512_castps_si512(x), sign));
+	x = _mm512_mask_blend_ps(_mm512_cmp_ps_mask(_mm512_setzero_ps(), y, _CMP_GT_OQ), x, _mm512_castsi512_ps(_mm512_set1_epi32((int32_t)0x7fc00000u))); // even root of a negative
+	return x;
+}
+RB_AVX512_END
+#endif
+
+inline void rb0_safe_2_root_batch(const float *y, float *x, const size_t count)
+{
+#if defined(__AVX512F__)
+	rb_simd_batch<16>(y, x, count, [](const float *in, float *out)
+		{_mm512_storeu_ps(out, rb0_safe_2_root_avx512(_mm512_loadu_ps(in)));});
+#elif defined(__AVX2__) && defined(__FMA__)
+	rb_simd_batch<8>(y, x, count, [](const float *in, float *out)
+		{_mm256_storeu_ps(out, rb0_safe_2_root_avx2(_mm256_loadu_ps(in)));});
+#elif defined(__SSE4_1__)
+	rb_simd_batch<4>(y, x, count, [](const float *in, float *out)
+		{_mm_storeu_ps(out, rb0_safe_2_root_sse41(_mm_loadu_ps(in)));});
+#else
+	for (size_t i = 0; i < count; ++i) x[i] = rb0_safe_2_root(y[i]);
+#endif
+}
+
+#if defined(__SSE4_1__)
+inline __m128 rb0_inv_2_root_sse41(const __m128 y)
+{
+	__m128i i = _mm_castps_si128(y); // interpret float as integer
+	__m128i q = _mm_srai_epi32(_mm_add_epi32(i, _mm_srli_epi32(_mm_srai_epi32(i, 31), 31)), 1); // i / 2, rounding toward zero
+	i = _mm_sub_epi32(_mm_set1_epi32(0x5f37642f), q); // log-approximation hack
+	__m128 x = _mm_castsi128_ps(i);
+	return x;
+}
+#endif
+
+#if defined(__AVX2__) && defined(__FMA__)
+inline __m256 rb0_inv_2_root_avx2(const __m256 y)
+{
+	__m256i i = _mm256_castps_si256(y); // interpret float as integer
+	__m256i q = _mm256_srai_epi32(_mm256_add_epi32(i, _mm256_srli_epi32(_mm256_srai_epi32(i, 31), 31)), 1); // i / 2, rounding toward zero
+	i = _mm256_sub_epi32(_mm256_set1_epi32(0x5f37642f), q); // log-approximation hack
+	__m256 x = _mm256_castsi256_ps(i);
+	return x;
+}
+#endif
+
+#if defined(__AVX512F__)
+RB_AVX512_BEGIN
+inline __m512 rb0_inv_2_root_avx512(const __m512 y)
+{
+	__m512i i = _mm512_castps_si512(y); // interpret float as integer
+	__m512i q = _mm512_srai_epi32(_mm512_add_epi32(i, _mm512_srli_epi32(_mm512_srai_epi32(i, 31), 31)), 1); // i / 2, rounding toward zero
+	i = _mm512_sub_epi32(_mm512_set1_epi32(0x5f37642f), q); // log-approximation hack
+	__m512 x = _mm512_castsi512_ps(i);
+	return x;
+}
+RB_AVX512_END
+#endif
+
+inline void rb0_inv_2_root_batch(const float *y, float *x, const size_t count)
+{
+#if defined(__AVX512F__)
+	rb_simd_batch<16>(y, x, count, [](const float *in, float *out)
+		{_mm512_storeu_ps(out, rb0_inv_2_root_avx512(_mm512_loadu_ps(in)));});
+#elif defined(__AVX2__) && defined(__FMA__)
+	rb_simd_batch<8>(y, x, count, [](const float *in, float *out)
+		{_mm256_storeu_ps(out, rb0_inv_2_root_avx2(_mm256_loadu_ps(in)));});
+#elif defined(__SSE4_1__)
+	rb_simd_batch<4>(y, x, count, [](const float *in, float *out)
+		{_mm_storeu_ps(out, rb0_inv_2_root_sse41(_mm_loadu_ps(in)));});
+#else
+	for (size_t i = 0; i < count; ++i) x[i] = rb0_inv_2_root(y[i]);
+#endif
+}
+
+#if defined(__SSE4_1__)
+inline __m128 rb0_safe_inv_2_root_sse41(const __m128 y)
+{
+	const __m128i ordinary = _mm_add_epi32(_mm_castps_si128(y), _mm_set1_epi32((int32_t)0x7f800000u));
+	if (_mm_movemask_epi8(_mm_cmpgt_epi32(_mm_set1_epi32((int32_t)0xff000000u), ordinary)) == 0xffff) return rb0_inv_2_root_sse41(y);
+	const __m128i u = _mm_castps_si128(y), sign = _mm_and_si128(u, _mm_set1_epi32((int32_t)0x80000000u));
+	const __m128 a = _mm_castsi128_ps(_mm_xor_si128(u, sign));
+	const __m128 tiny = _mm_cmpgt_ps(_mm_castsi128_ps(_mm_set1_epi32((int32_t)0x800000u)), a); // zero or denormal, scaled into normal range
+	const __m128 finite = _mm_and_ps(_mm_cmpgt_ps(a, _mm_setzero_ps()), _mm_cmpgt_ps(_mm_castsi128_ps(_mm_set1_epi32((int32_t)0x7f800000u)), a));
+	const __m128 number = _mm_cmpgt_ps(a, _mm_set1_ps(-1.0f)); // all but NaN, which keeps its bits
+	__m128 x = rb0_inv_2_root_sse41(_mm_mul_ps(a, _mm_blendv_ps(_mm_set1_ps(1.0f), _mm_castsi128_ps(_mm_set1_epi32((int32_t)0x4b800000u)), tiny)));
+	x = _mm_mul_ps(x, _mm_blendv_ps(_mm_set1_ps(1.0f), _mm_castsi128_ps(_mm_set1_epi32((int32_t)0x45800000u)), tiny));
+	x = _mm_blendv_ps(_mm_blendv_ps(a, _mm_castsi128_ps(_mm_sub_epi32(_mm_set1_epi32((int32_t)0x7f800000u), _mm_castps_si128(a))), number), x, finite); // zero, infinity and NaN
+	x = _mm_castsi128_ps(_mm_or_si128(_mm_castps_si128(x), sign));
+	x = _mm_blendv_ps(x, _mm_castsi128_ps(_mm_set1_epi32((int32_t)0x7fc00000u)), _mm_cmpgt_ps(_mm_setzero_ps(), y)); // even root of a negative
+	return x;
+}
+#endif
+
+#if defined(__AVX2__) && defined(__FMA__)
+inline __m256 rb0_safe_inv_2_root_avx2(const __m256 y)
+{
+	const __m256i ordinary = _mm256_add_epi32(_mm256_castps_si256(y), _mm256_set1_epi32((int32_t)0x7f800000u));
+	if (_mm256_movemask_epi8(_mm256_cmpgt_epi32(_mm256_set1_epi32((int32_t)0xff000000u), ordinary)) == -1) return rb0_inv_2_root_avx2(y);
+	const __m256i u = _mm256_castps_si256(y), sign = _mm256_and_si256(u, _mm256_set1_epi32((int32_t)0x80000000u));
+	const __m256 a = _mm256_castsi256_ps(_mm256_xor_si256(u, sign));
+	const __m256 tiny = _mm256_cmp_ps(_mm256_castsi256_ps(_mm256_set1_epi32((int32_t)0x800000u)), a, _CMP_GT_OQ); // zero or denormal, scaled into normal range
+	const __m256 finite = _mm256_and_ps(_mm256_cmp_ps(a, _mm256_setzero_ps(), _CMP_GT_OQ), _mm256_cmp_ps(_mm256_castsi256_ps(_mm256_set1_epi32((int32_t)0x7f800000u)), a, _CMP_GT_OQ));
+	const __m256 number = _mm256_cmp_ps(a, _mm256_set1_ps(-1.0f), _CMP_GT_OQ); // all but NaN, which keeps its bits
+	__m256 x = rb0_inv_2_root_avx2(_mm256_mul_ps(a, _mm256_blendv_ps(_mm256_set1_ps(1.0f), _mm256_castsi256_ps(_mm256_set1_epi32((int32_t)0x4b800000u)), tiny)));
+	x = _mm256_mul_ps(x, _mm256_blendv_ps(_mm256_set1_ps(1.0f), _mm256_castsi256_ps(_mm256_set1_epi32((int32_t)0x45800000u)), tiny));
+	x = _mm256_blendv_ps(_mm256_blendv_ps(a, _mm256_castsi256_ps(_mm256_sub_epi32(_mm256_set1_epi32((int32_t)0x7f800000u), _mm256_castps_si256(a))), number), x, finite); // zero, infinity and NaN
+	x = _mm256_castsi256_ps(_mm256_or_si256(_mm256_castps_si256(x), sign));
+	x = _mm256_blendv_ps(x, _mm256_castsi256_ps(_mm256_set1_epi32((int32_t)0x7fc00000u)), _mm256_cmp_ps(_mm256_setzero_ps(), y, _CMP_GT_OQ)); // even root of a negative
+	return x;
+}
+#endif
+
+#if defined(__AVX512F__)
+RB_AVX512_BEGIN
+inline __m512 rb0_safe_inv_2_root_avx512(const __m512 y)
+{
+	const __m512i ordinary = _mm512_add_epi32(_mm512_castps_si512(y), _mm512_set1_epi32((int32_t)0x7f800000u));
+	if (_mm512_cmplt_epi32_mask(ordinary, _mm512_set1_epi32((int32_t)0xff000000u)) == (__mmask16)0xffff) return rb0_inv_2_root_avx512(y);
+	const __m512i u = _mm512_castps_si512(y), sign = _mm512_and_si512(u, _mm512_set1_epi32((int32_t)0x80000000u));
+	const __m512 a = _mm512_castsi512_ps(_mm512_xor_si512(u, sign));
+	const __mmask16 tiny = _mm512_cmp_ps_mask(_mm512_castsi512_ps(_mm512_set1_epi32((int32_t)0x800000u)), a, _CMP_GT_OQ); // zero or denormal, scaled into normal range
+	const __mmask16 finite = (__mmask16)(_mm512_cmp_ps_mask(a, _mm512_setzero_ps(), _CMP_GT_OQ) & _mm512_cmp_ps_mask(_mm512_castsi512_ps(_mm512_set1_epi32((int32_t)0x7f800000u)), a, _CMP_GT_OQ));
+	const __mmask16 number = _mm512_cmp_ps_mask(a, _mm512_set1_ps(-1.0f), _CMP_GT_OQ); // all but NaN, which keeps its bits
+	__m512 x = rb0_inv_2_root_avx512(_mm512_mul_ps(a, _mm512_mask_blend_ps(tiny, _mm512_set1_ps(1.0f), _mm512_castsi512_ps(_mm512_set1_epi32((int32_t)0x4b800000u)))));
+	x = _mm512_mul_ps(x, _mm512_mask_blend_ps(tiny, _mm512_set1_ps(1.0f), _mm512_castsi512_ps(_mm512_set1_epi32((int32_t)0x45800000u))));
+	x = _mm512_mask_blend_ps(finite, _mm512_mask_blend_ps(number, a, _mm512_castsi512_ps(_mm512_sub_epi32(_mm512_set1_epi32((int32_t)0x7f800000u), _mm512_castps_si512(a)))), x); // zero, infinity and NaN
+	x = _mm512_castsi512_ps(_mm512_or_si512(_mm512_castps_si512(x), sign));
+	x = _mm512_mask_blend_ps(_mm512_cmp_ps_mask(_mm512_setzero_ps(), y, _CMP_GT_OQ), x, _mm512_castsi512_ps(_mm512_set1_epi32((int32_t)0x7fc00000u))); // even root of a negative
+	return x;
+}
+RB_AVX512_END
+#endif
+
+inline void rb0_safe_inv_2_root_batch(const float *y, float *x, const size_t count)
+{
+#if defined(__AVX512F__)
+	rb_simd_batch<16>(y, x, count, [](const float *in, float *out)
+		{_mm512_storeu_ps(out, rb0_safe_inv_2_root_avx512(_mm512_loadu_ps(in)));});
+#elif defined(__AVX2__) && defined(__FMA__)
+	rb_simd_batch<8>(y, x, count, [](const float *in, float *out)
+		{_mm256_storeu_ps(out, rb0_safe_inv_2_root_avx2(_mm256_loadu_ps(in)));});
+#elif defined(__SSE4_1__)
+	rb_simd_batch<4>(y, x, count, [](const float *in, float *out)
+		{_mm_storeu_ps(out, rb0_safe_inv_2_root_sse41(_mm_loadu_ps(in)));});
+#else
+	for (size_t i = 0; i < count; ++i) x[i] = rb0_safe_inv_2_root(y[i]);
+#endif
+}
+
+#if defined(__SSE4_1__)
+inline __m128 rb0_3_root_sse41(const __m128 y)
+{
+	__m128i i = _mm_castps_si128(y); // interpret float as integer
+	__m128i q = rb_mulhi_epi32_sse41(i, _mm_set1_epi32((int32_t)0x55555556u));
+	q = _mm_sub_epi32(q, _mm_srai_epi32(i, 31)); // i / 3, rounding toward zero
+	i = _mm_add_epi32(_mm_set1_epi32(0x2a510680), q); // log-approximation hack
+	__m128 x = _mm_castsi128_ps(i);
+	return x;
+}
+#endif
+
+#if defined(__AVX2__) && defined(__FMA__)
+inline __m256 rb0_3_root_avx2(const __m256 y)
+{
+	__m256i i = _mm256_castps_si256(y); // interpret float as integer
+	__m256i q = rb_mulhi_epi32_avx2(i, _mm256_set1_epi32((int32_t)0x55555556u));
+	q = _mm256_sub_epi32(q, _mm256_srai_epi32(i, 31)); // i / 3, rounding toward zero
+	i = _mm256_add_epi32(_mm256_set1_epi32(0x2a510680), q); // log-approximation hack
+	__m256 x = _mm256_castsi256_ps(i);
+	return x;
+}
+#endif
+
+#if defined(__AVX512F__)
+RB_AVX512_BEGIN
+inline __m512 rb0_3_root_avx512(const __m512 y)
+{
+	__m512i i = _mm512_castps_si512(y); // interpret float as integer
+	__m512i q = rb_mulhi_epi32_avx512(i, _mm512_set1_epi32((int32_t)0x55555556u));
+	q = _mm512_sub_epi32(q, _mm512_srai_epi32(i, 31)); // i / 3, rounding toward zero
+	i = _mm512_add_epi32(_mm512_set1_epi32(0x2a510680), q); // log-approximation hack
+	__m512 x = _mm512_castsi512_ps(i);
+	return x;
+}
+RB_AVX512_END
+#endif
+
+inline void rb0_3_root_batch(const float *y, float *x, const size_t count)
+{
+#if defined(__AVX512F__)
+	rb_simd_batch<16>(y, x, count, [](const float *in, float *out)
+		{_mm512_storeu_ps(out, rb0_3_root_avx512(_mm512_loadu_ps(in)));});
+#elif defined(__AVX2__) && defined(__FMA__)
+	rb_simd_batch<8>(y, x, count, [](const float *in, float *out)
+		{_mm256_storeu_ps(out, rb0_3_root_avx2(_mm256_loadu_ps(in)));});
+#elif defined(__SSE4_1__)
+	rb_simd_batch<4>(y, x, count, [](const float *in, float *out)
+		{_mm_storeu_ps(out, rb0_3_root_sse41(_mm_loadu_ps(in)));});
+#else
+	for (size_t i = 0; i < count; ++i) x[i] = rb0_3_root(y[i]);
+#endif
+}
+
+#if defined(__SSE4_1__)
+inline __m128 rb0_safe_3_root_sse41(const __m128 y)
+{
+	const __m128i ordinary = _mm_add_epi32(_mm_castps_si128(y), _mm_set1_epi32((int32_t)0x7f800000u));
+	if (_mm_movemask_epi8(_mm_cmpgt_epi32(_mm_set1_epi32((int32_t)0xff000000u), ordinary)) == 0xffff) return rb0_3_root_sse41(y);
+	const __m128i u = _mm_castps_si128(y), sign = _mm_and_si128(u, _mm_set1_epi32((int32_t)0x80000000u));
+	const __m128 a = _mm_castsi128_ps(_mm_xor_si128(u, sign));
+	const __m128 tiny = _mm_cmpgt_ps(_mm_castsi128_ps(_mm_set1_epi32((int32_t)0x800000u)), a); // zero or denormal, scaled into normal range
+	const __m128 finite = _mm_and_ps(_mm_cmpgt_ps(a, _mm_setzero_ps()), _mm_cmpgt_ps(_mm_castsi128_ps(_mm_set1_epi32((int32_t)0x7f800000u)), a));
+	__m128 x = rb0_3_root_sse41(_mm_mul_ps(a, _mm_blendv_ps(_mm_set1_ps(1.0f), _mm_castsi128_ps(_mm_set1_epi32((int32_t)0x4b800000u)), tiny)));
+	x = _mm_mul_ps(x, _mm_blendv_ps(_mm_set1_ps(1.0f), _mm_castsi128_ps(_mm_set1_epi32((int32_t)0x3b800000u)), tiny));
+	x = _mm_blendv_ps(a, x, finite); // zero, infinity and NaN
+	x = _mm_castsi128_ps(_mm_or_si128(_mm_castps_si128(x), sign));
+	return x;
+}
+#endif
+
+#if defined(__AVX2__) && defined(__FMA__)
+inline __m256 rb0_safe_3_root_avx2(const __m256 y)
+{
+	const __m256i ordinary = _mm256_add_epi32(_mm256_castps_si256(y), _mm256_set1_epi32((int32_t)0x7f800000u));
+	if (_mm256_movemask_epi8(_mm256_cmpgt_epi32(_mm256_set1_epi32((int32_t)0xff000000u), ordinary)) == -1) return rb0_3_root_avx2(y);
+	const __m256i u = _mm256_castps_si256(y), sign = _mm256_and_si256(u, _mm256_set1_epi32((int32_t)0x80000000u));
+	const __m256 a = _mm256_castsi256_ps(_mm256_xor_si256(u, sign));
+	const __m256 tiny = _mm256_cmp_ps(_mm256_castsi256_ps(_mm256_set1_epi32((int32_t)0x800000u)), a, _CMP_GT_OQ); // zero or denormal, scaled into normal range
+	const __m256 finite = _mm256_and_ps(_mm256_cmp_ps(a, _mm256_setzero_ps(), _CMP_GT_OQ), _mm256_cmp_ps(_mm256_castsi256_ps(_mm256_set1_epi32((int32_t)0x7f800000u)), a, _CMP_GT_OQ));
+	__m256 x = rb0_3_root_avx2(_mm256_mul_ps(a, _mm256_blendv_ps(_mm256_set1_ps(1.0f), _mm256_castsi256_ps(_mm256_set1_epi32((int32_t)0x4b800000u)), tiny)));
+	x = _mm256_mul_ps(x, _mm256_blendv_ps(_mm256_set1_ps(1.0f), _mm256_castsi256_ps(_mm256_set1_epi32((int32_t)0x3b800000u)), tiny));
+	x = _mm256_blendv_ps(a, x, finite); // zero, infinity and NaN
+	x = _mm256_castsi256_ps(_mm256_or_si256(_mm256_castps_si256(x), sign));
+	return x;
+}
+#endif
+
+#if defined(__AVX512F__)
+RB_AVX512_BEGIN
+inline __m512 rb0_safe_3_root_avx512(const __m512 y)
+{
+	const __m512i ordinary = _mm512_add_epi32(_mm512_castps_si512(y), _mm512_set1_epi32((int32_t)0x7f800000u));
+	if (_mm512_cmplt_epi32_mask(ordinary, _mm512_set1_epi32((int32_t)0xff000000u)) == (__mmask16)0xffff) return rb0_3_root_avx512(y);
+	const __m512i u = _mm512_castps_si512(y), sign = _mm512_and_si512(u, _mm512_set1_epi32((int32_t)0x80000000u));
+	const __m512 a = _mm512_castsi512_ps(_mm512_xor_si512(u, sign));
+	const __mmask16 tiny = _mm512_cmp_ps_mask(_mm512_castsi512_ps(_mm512_set1_epi32((int32_t)0x800000u)), a, _CMP_GT_OQ); // zero or denormal, scaled into normal range
+	const __mmask16 finite = (__mmask16)(_mm512_cmp_ps_mask(a, _mm512_setzero_ps(), _CMP_GT_OQ) & _mm512_cmp_ps_mask(_mm512_castsi512_ps(_mm512_set1_epi32((int32_t)0x7f800000u)), a, _CMP_GT_OQ));
+	__m512 x = rb0_3_root_avx512(_mm512_mul_ps(a, _mm512_mask_blend_ps(tiny, _mm512_set1_ps(1.0f), _mm512_castsi512_ps(_mm512_set1_epi32((int32_t)0x4b800000u)))));
+	x = _mm512_mul_ps(x, _mm512_mask_blend_ps(tiny, _mm512_set1_ps(1.0f), _mm512_castsi512_ps(_mm512_set1_epi32((int32_t)0x3b800000u))));
+	x = _mm512_mask_blend_ps(finite, a, x); // zero, infinity and NaN
+	x = _mm512_castsi512_ps(_mm512_or_si512(_mm512_castps_si512(x), sign));
+	return x;
+}
+RB_AVX512_END
+#endif
+
+inline void rb0_safe_3_root_batch(const float *y, float *x, const size_t count)
+{
+#if defined(__AVX512F__)
+	rb_simd_batch<16>(y, x, count, [](const float *in, float *out)
+		{_mm512_storeu_ps(out, rb0_safe_3_root_avx512(_mm512_loadu_ps(in)));});
+#elif defined(__AVX2__) && defined(__FMA__)
+	rb_simd_batch<8>(y, x, count, [](const float *in, float *out)
+		{_mm256_storeu_ps(out, rb0_safe_3_root_avx2(_mm256_loadu_ps(in)));});
+#elif defined(__SSE4_1__)
+	rb_simd_batch<4>(y, x, count, [](const float *in, float *out)
+		{_mm_storeu_ps(out, rb0_safe_3_root_sse41(_mm_loadu_ps(in)));});
+#else
+	for (size_t i = 0; i < count; ++i) x[i] = rb0_safe_3_root(y[i]);
+#endif
+}
+
+#if defined(__SSE4_1__)
+inline __m128 rb0_inv_3_root_sse41(const __m128 y)
+{
+	__m128i i = _mm_castps_si128(y); // interpret float as integer
+	__m128i q = rb_mulhi_epi32_sse41(i, _mm_set1_epi32((int32_t)0x55555556u));
+	q = _mm_sub_epi32(q, _mm_srai_epi32(i, 31)); // i / 3, rounding toward zero
+	i = _mm_sub_epi32(_mm_set1_epi32(0x54a232a3), q); // log-approximation hack
+	__m128 x = _mm_castsi128_ps(i);
+	return x;
+}
+#endif
+
+#if defined(__AVX2__) && defined(__FMA__)
+inline __m256 rb0_inv_3_root_avx2(const __m256 y)
+{
+	__m256i i = _mm256_castps_si256(y); // interpret float as integer
+	__m256i q = rb_mulhi_epi32_avx2(i, _mm256_set1_epi32((int32_t)0x55555556u));
+	q = _mm256_sub_epi32(q, _mm256_srai_epi32(i, 31)); // i / 3, rounding toward zero
+	i = _mm256_sub_epi32(_mm256_set1_epi32(0x54a232a3), q); // log-approximation hack
+	__m256 x = _mm256_castsi256_ps(i);
+	return x;
+}
+#endif
+
+#if defined(__AVX512F__)
+RB_AVX512_BEGIN
+inline __m512 rb0_inv_3_root_avx512(const __m512 y)
+{
+	__m512i i = _mm512_castps_si512(y); // interpret float as integer
+	__m512i q = rb_mulhi_epi32_avx512(i, _mm512_set1_epi32((int32_t)0x55555556u));
+	q = _mm512_sub_epi32(q, _mm512_srai_epi32(i, 31)); // i / 3, rounding toward zero
+	i = _mm512_sub_epi32(_mm512_set1_epi32(0x54a232a3), q); // log-approximation hack
+	__m512 x = _mm512_castsi512_ps(i);
+	return x;
+}
+RB_AVX512_END
+#endif
+
+inline void rb0_inv_3_root_batch(const float *y, float *x, const size_t count)
+{
+#if defined(__AVX512F__)
+	rb_simd_batch<16>(y, x, count, [](const float *in, float *out)
+		{_mm512_storeu_ps(out, rb0_inv_3_root_avx512(_mm512_loadu_ps(in)));});
+#elif defined(__AVX2__) && defined(__FMA__)
+	rb_simd_batch<8>(y, x, count, [](const float *in, float *out)
+		{_mm256_storeu_ps(out, rb0_inv_3_root_avx2(_mm256_loadu_ps(in)));});
+#elif defined(__SSE4_1__)
+	rb_simd_batch<4>(y, x, count, [](const float *in, float *out)
+		{_mm_storeu_ps(out, rb0_inv_3_root_sse41(_mm_loadu_ps(in)));});
+#else
+	for (size_t i = 0; i < count; ++i) x[i] = rb0_inv_3_root(y[i]);
+#endif
+}
+
+#if defined(__SSE4_1__)
+inline __m128 rb0_safe_inv_3_root_sse41(const __m128 y)
+{
+	const __m128i ordinary = _mm_add_epi32(_mm_castps_si128(y), _mm_set1_epi32((int32_t)0x7f800000u));
+	if (_mm_movemask_epi8(_mm_cmpgt_epi32(_mm_set1_epi32((int32_t)0xff000000u), ordinary)) == 0xffff) return rb0_inv_3_root_sse41(y);
+	const __m128i u = _mm_castps_si128(y), sign = _mm_and_si128(u, _mm_set1_epi32((int32_t)0x80000000u));
+	const __m128 a = _mm_castsi128_ps(_mm_xor_si128(u, sign));
+	const __m128 tiny = _mm_cmpgt_ps(_mm_castsi128_ps(_mm_set1_epi32((int32_t)0x800000u)), a); // zero or denormal, scaled into normal range
+	const __m128 finite = _mm_and_ps(_mm_cmpgt_ps(a, _mm_setzero_ps()), _mm_cmpgt_ps(_mm_castsi128_ps(_mm_set1_epi32((int32_t)0x7f800000u)), a));
+	const __m128 number = _mm_cmpgt_ps(a, _mm_set1_ps(-1.0f)); // all but NaN, which keeps its bits
+	__m128 x = rb0_inv_3_root_sse41(_mm_mul_ps(a, _mm_blendv_ps(_mm_set1_ps(1.0f), _mm_castsi128_ps(_mm_set1_epi32((int32_t)0x4b800000u)), tiny)));
+	x = _mm_mul_ps(x, _mm_blendv_ps(_mm_set1_ps(1.0f), _mm_castsi128_ps(_mm_set1_epi32((int32_t)0x43800000u)), tiny));
+	x = _mm_blendv_ps(_mm_blendv_ps(a, _mm_castsi128_ps(_mm_sub_epi32(_mm_set1_epi32((int32_t)0x7f800000u), _mm_castps_si128(a))), number), x, finite); // zero, infinity and NaN
+	x = _mm_castsi128_ps(_mm_or_si128(_mm_castps_si128(x), sign));
+	return x;
+}
+#endif
+
+#if defined(__AVX2__) && defined(__FMA__)
+inline __m256 rb0_safe_inv_3_root_avx2(const __m256 y)
+{
+	const __m256i ordinary = _mm256_add_epi32(_mm256_castps_si256(y), _mm256_set1_epi32((int32_t)0x7f800000u));
+	if (_mm256_movemask_epi8(_mm256_cmpgt_epi32(_mm256_set1_epi32((int32_t)0xff000000u), ordinary)) == -1) return rb0_inv_3_root_avx2(y);
+	const __m256i u = _mm256_castps_si256(y), sign = _mm256_and_si256(u, _mm256_set1_epi32((int32_t)0x80000000u));
+	const __m256 a = _mm256_castsi256_ps(_mm256_xor_si256(u, sign));
+	const __m256 tiny = _mm256_cmp_ps(_mm256_castsi256_ps(_mm256_set1_epi32((int32_t)0x800000u)), a, _CMP_GT_OQ); // zero or denormal, scaled into normal range
+	const __m256 finite = _mm256_and_ps(_mm256_cmp_ps(a, _mm256_setzero_ps(), _CMP_GT_OQ), _mm256_cmp_ps(_mm256_castsi256_ps(_mm256_set1_epi32((int32_t)0x7f800000u)), a, _CMP_GT_OQ));
+	const __m256 number = _mm256_cmp_ps(a, _mm256_set1_ps(-1.0f), _CMP_GT_OQ); // all but NaN, which keeps its bits
+	__m256 x = rb0_inv_3_root_avx2(_mm256_mul_ps(a, _mm256_blendv_ps(_mm256_set1_ps(1.0f), _mm256_castsi256_ps(_mm256_set1_epi32((int32_t)0x4b800000u)), tiny)));
+	x = _mm256_mul_ps(x, _mm256_blendv_ps(_mm256_set1_ps(1.0f), _mm256_castsi256_ps(_mm256_set1_epi32((int32_t)0x43800000u)), tiny));
+	x = _mm256_blendv_ps(_mm256_blendv_ps(a, _mm256_castsi256_ps(_mm256_sub_epi32(_mm256_set1_epi32((int32_t)0x7f800000u), _mm256_castps_si256(a))), number), x, finite); // zero, infinity and NaN
+	x = _mm256_castsi256_ps(_mm256_or_si256(_mm256_castps_si256(x), sign));
+	return x;
+}
+#endif
+
+#if defined(__AVX512F__)
+RB_AVX512_BEGIN
+inline __m512 rb0_safe_inv_3_root_avx512(const __m512 y)
+{
+	const __m512i ordinary = _mm512_add_epi32(_mm512_castps_si512(y), _mm512_set1_epi32((int32_t)0x7f800000u));
+	if (_mm512_cmplt_epi32_mask(ordinary, _mm512_set1_epi32((int32_t)0xff000000u)) == (__mmask16)0xffff) return rb0_inv_3_root_avx512(y);
+	const __m512i u = _mm512_castps_si512(y), sign = _mm512_and_si512(u, _mm512_set1_epi32((int32_t)0x80000000u));
+	const __m512 a = _mm512_castsi512_ps(_mm512_xor_si512(u, sign));
+	const __mmask16 tiny = _mm512_cmp_ps_mask(_mm512_castsi512_ps(_mm512_set1_epi32((int32_t)0x800000u)), a, _CMP_GT_OQ); // zero or denormal, scaled into normal range
+	const __mmask16 finite = (__mmask16)(_mm512_cmp_ps_mask(a, _mm512_setzero_ps(), _CMP_GT_OQ) & _mm512_cmp_ps_mask(_mm512_castsi512_ps(_mm512_set1_epi32((int32_t)0x7f800000u)), a, _CMP_GT_OQ));
+	const __mmask16 number = _mm512_cmp_ps_mask(a, _mm512_set1_ps(-1.0f), _CMP_GT_OQ); // all but NaN, which keeps its bits
+	__m512 x = rb0_inv_3_root_avx512(_mm512_mul_ps(a, _mm512_mask_blend_ps(tiny, _mm512_set1_ps(1.0f), _mm512_castsi512_ps(_mm512_set1_epi32((int32_t)0x4b800000u)))));
+	x = _mm512_mul_ps(x, _mm512_mask_blend_ps(tiny, _mm512_set1_ps(1.0f), _mm512_castsi512_ps(_mm512_set1_epi32((int32_t)0x43800000u))));
+	x = _mm512_mask_blend_ps(finite, _mm512_mask_blend_ps(number, a, _mm512_castsi512_ps(_mm512_sub_epi32(_mm512_set1_epi32((int32_t)0x7f800000u), _mm512_castps_si512(a)))), x); // zero, infinity and NaN
+	x = _mm512_castsi512_ps(_mm512_or_si512(_mm512_castps_si512(x), sign));
+	return x;
+}
+RB_AVX512_END
+#endif
+
+inline void rb0_safe_inv_3_root_batch(const float *y, float *x, const size_t count)
+{
+#if defined(__AVX512F__)
+	rb_simd_batch<16>(y, x, count, [](const float *in, float *out)
+		{_mm512_storeu_ps(out, rb0_safe_inv_3_root_avx512(_mm512_loadu_ps(in)));});
+#elif defined(__AVX2__) && defined(__FMA__)
+	rb_simd_batch<8>(y, x, count, [](const float *in, float *out)
+		{_mm256_storeu_ps(out, rb0_safe_inv_3_root_avx2(_mm256_loadu_ps(in)));});
+#elif defined(__SSE4_1__)
+	rb_simd_batch<4>(y, x, count, [](const float *in, float *out)
+		{_mm_storeu_ps(out, rb0_safe_inv_3_root_sse41(_mm_loadu_ps(in)));});
+#else
+	for (size_t i = 0; i < count; ++i) x[i] = rb0_safe_inv_3_root(y[i]);
+#endif
+}
+
+#if defined(__SSE4_1__)
+inline __m128 rb0_4_root_sse41(const __m128 y)
+{
+	__m128i i = _mm_castps_si128(y); // interpret float as integer
+	__m128i q = _mm_srai_epi32(_mm_add_epi32(i, _mm_srli_epi32(_mm_srai_epi32(i, 31), 30)), 2); // i / 4, rounding toward zero
+	i = _mm_add_epi32(_mm_set1_epi32(0x2f9b374e), q); // log-approximation hack
+	__m128 x = _mm_castsi128_ps(i);
+	return x;
+}
+#endif
+
+#if defined(__AVX2__) && defined(__FMA__)
+inline __m256 rb0_4_root_avx2(const __m256 y)
+{
+	__m256i i = _mm256_castps_si256(y); // interpret float as integer
+	__m256i q = _mm256_srai_epi32(_mm256_add_epi32(i, _mm256_srli_epi32(_mm256_srai_epi32(i, 31), 30)), 2); // i / 4, rounding toward zero
+	i = _mm256_add_epi32(_mm256_set1_epi32(0x2f9b374e), q); // log-approximation hack
+	__m256 x = _mm256_castsi256_ps(i);
+	return x;
+}
+#endif
+
+#if defined(__AVX512F__)
+RB_AVX512_BEGIN
+inline __m512 rb0_4_root_avx512(const __m512 y)
+{
+	__m512i i = _mm512_castps_si512(y); // interpret float as integer
+	__m512i q = _mm512_srai_epi32(_mm512_add_epi32(i, _mm512_srli_epi32(_mm512_srai_epi32(i, 31), 30)), 2); // i / 4, rounding toward zero
+	i = _mm512_add_epi32(_mm512_set1_epi32(0x2f9b374e), q); // log-approximation hack
+	__m512 x = _mm512_castsi512_ps(i);
+	return x;
+}
+RB_AVX512_END
+#endif
+
+inline void rb0_4_root_batch(const float *y, float *x, const size_t count)
+{
+#if defined(__AVX512F__)
+	rb_simd_batch<16>(y, x, count, [](const float *in, float *out)
+		{_mm512_storeu_ps(out, rb0_4_root_avx512(_mm512_loadu_ps(in)));});
+#elif defined(__AVX2__) && defined(__FMA__)
+	rb_simd_batch<8>(y, x, count, [](const float *in, float *out)
+		{_mm256_storeu_ps(out, rb0_4_root_avx2(_mm256_loadu_ps(in)));});
+#elif defined(__SSE4_1__)
+	rb_simd_batch<4>(y, x, count, [](const float *in, float *out)
+		{_mm_storeu_ps(out, rb0_4_root_sse41(_mm_loadu_ps(in)));});
+#else
+	for (size_t i = 0; i < count; ++i) x[i] = rb0_4_root(y[i]);
+#endif
+}
+
+#if defined(__SSE4_1__)
+inline __m128 rb0_safe_4_root_sse41(const __m128 y)
+{
+	const __m128i ordinary = _mm_add_epi32(_mm_castps_si128(y), _mm_set1_epi32((int32_t)0x7f800000u));
+	if (_mm_movemask_epi8(_mm_cmpgt_epi32(_mm_set1_epi32((int32_t)0xff000000u), ordinary)) == 0xffff) return rb0_4_root_sse41(y);
+	const __m128i u = _mm_castps_si128(y), sign = _mm_and_si128(u, _mm_set1_epi32((int32_t)0x80000000u));
+	const __m128 a = _mm_castsi128_ps(_mm_xor_si128(u, sign));
+	const __m128 tiny = _mm_cmpgt_ps(_mm_castsi128_ps(_mm_set1_epi32((int32_t)0x800000u)), a); // zero or denormal, scaled into normal range
+	const __m128 finite = _mm_and_ps(_mm_cmpgt_ps(a, _mm_setzero_ps()), _mm_cmpgt_ps(_mm_castsi128_ps(_mm_set1_epi32((int32_t)0x7f800000u)), a));
+	__m128 x = rb0_4_root_sse41(_mm_mul_ps(a, _mm_blendv_ps(_mm_set1_ps(1.0f), _mm_castsi128_ps(_mm_set1_epi32((int32_t)0x4b800000u)), tiny)));
+	x = _mm_mul_ps(x, _mm_blendv_ps(_mm_set1_ps(1.0f), _mm_castsi128_ps(_mm_set1_epi32((int32_t)0x3c800000u)), tiny));
+	x = _mm_blendv_ps(a, x, finite); // zero, infinity and NaN
+	x = _mm_castsi128_ps(_mm_or_si128(_mm_castps_si128(x), sign));
+	x = _mm_blendv_ps(x, _mm_castsi128_ps(_mm_set1_epi32((int32_t)0x7fc00000u)), _mm_cmpgt_ps(_mm_setzero_ps(), y)); // even root of a negative
+	return x;
+}
+#endif
+
+#if defined(__AVX2__) && defined(__FMA__)
+inline __m256 rb0_safe_4_root_avx2(const __m256 y)
+{
+	const __m256i ordinary = _mm256_add_epi32(_mm256_castps_si256(y), _mm256_set1_epi32((int32_t)0x7f800000u));
+	if (_mm256_movemask_epi8(_mm256_cmpgt_epi32(_mm256_set1_epi32((int32_t)0xff000000u), ordinary)) == -1) return rb0_4_root_avx2(y);
+	const __m256i u = _mm256_castps_si256(y), sign = _mm256_and_si256(u, _mm256_set1_epi32((int32_t)0x80000000u));
+	const __m256 a = _mm256_castsi256_ps(_mm256_xor_si256(u, sign));
+	const __m256 tiny = _mm256_cmp_ps(_mm256_castsi256_ps(_mm256_set1_epi32((int32_t)0x800000u)), a, _CMP_GT_OQ); // zero or denormal, scaled into normal range
+	const __m256 finite = _mm256_and_ps(_mm256_cmp_ps(a, _mm256_setzero_ps(), _CMP_GT_OQ), _mm256_cmp_ps(_mm256_castsi256_ps(_mm256_set1_epi32((int32_t)0x7f800000u)), a, _CMP_GT_OQ));
+	__m256 x = rb0_4_root_avx2(_mm256_mul_ps(a, _mm256_blendv_ps(_mm256_set1_ps(1.0f), _mm256_castsi256_ps(_mm256_set1_epi32((int32_t)0x4b800000u)), tiny)));
+	x = _mm256_mul_ps(x, _mm256_blendv_ps(_mm256_set1_ps(1.0f), _mm256_castsi256_ps(_mm256_set1_epi32((int32_t)0x3c800000u)), tiny));
+	x = _mm256_blendv_ps(a, x, finite); // zero, infinity and NaN
+	x = _mm256_castsi256_ps(_mm256_or_si256(_mm256_castps_si256(x), sign));
+	x = _mm256_blendv_ps(x, _mm256_castsi256_ps(_mm256_set1_epi32((int32_t)0x7fc00000u)), _mm256_cmp_ps(_mm256_setzero_ps(), y, _CMP_GT_OQ)); // even root of a negative
+	return x;
+}
+#endif
+
+#if defined(__AVX512F__)
+RB_AVX512_BEGIN
+inline __m512 rb0_safe_4_root_avx512(const __m512 y)
+{
+	const __m512i ordinary = _mm512_add_epi32(_mm512_castps_si512(y), _mm512_set1_epi32((int32_t)0x7f800000u));
+	if (_mm512_cmplt_epi32_mask(ordinary, _mm512_set1_epi32((int32_t)0xff000000u)) == (__mmask16)0xffff) return rb0_4_root_avx512(y);
+	const __m512i u = _mm512_castps_si512(y), sign = _mm512_and_si512(u, _mm512_set1_epi32((int32_t)0x80000000u));
+	const __m512 a = _mm512_castsi512_ps(_mm512_xor_si512(u, sign));
+	const __mmask16 tiny = _mm512_cmp_ps_mask(_mm512_castsi512_ps(_mm512_set1_epi32((int32_t)0x800000u)), a, _CMP_GT_OQ); // zero or denormal, scaled into normal range
+	const __mmask16 finite = (__mmask16)(_mm512_cmp_ps_mask(a, _mm512_setzero_ps(), _CMP_GT_OQ) & _mm512_cmp_ps_mask(_mm512_castsi512_ps(_mm512_set1_epi32((int32_t)0x7f800000u)), a, _CMP_GT_OQ));
+	__m512 x = rb0_4_root_avx512(_mm512_mul_ps(a, _mm512_mask_blend_ps(tiny, _mm512_set1_ps(1.0f), _mm512_castsi512_ps(_mm512_set1_epi32((int32_t)0x4b800000u)))));
+	x = _mm512_mul_ps(x, _mm512_mask_blend_ps(tiny, _mm512_set1_ps(1.0f), _mm512_castsi512_ps(_mm512_set1_epi32((int32_t)0x3c800000u))));
+	x = _mm512_mask_blend_ps(finite, a, x); // zero, infinity and NaN
+	x = _mm512_castsi512_ps(_mm512_or_si512(_mm512_castps_si512(x), sign));
+	x = _mm512_mask_blend_ps(_mm512_cmp_ps_mask(_mm512_setzero_ps(), y, _CMP_GT_OQ), x, _mm512_castsi512_ps(_mm512_set1_epi32((int32_t)0x7fc00000u))); // even root of a negative
+	return x;
+}
+RB_AVX512_END
+#endif
+
+inline void rb0_safe_4_root_batch(const float *y, float *x, const size_t count)
+{
+#if defined(__AVX512F__)
+	rb_simd_batch<16>(y, x, count, [](const float *in, float *out)
+		{_mm512_storeu_ps(out, rb0_safe_4_root_avx512(_mm512_loadu_ps(in)));});
+#elif defined(__AVX2__) && defined(__FMA__)
+	rb_simd_batch<8>(y, x, count, [](const float *in, float *out)
+		{_mm256_storeu_ps(out, rb0_safe_4_root_avx2(_mm256_loadu_ps(in)));});
+#elif defined(__SSE4_1__)
+	rb_simd_batch<4>(y, x, count, [](const float *in, float *out)
+		{_mm_storeu_ps(out, rb0_safe_4_root_sse41(_mm_loadu_ps(in)));});
+#else
+	for (size_t i = 0; i < count; ++i) x[i] = rb0_safe_4_root(y[i]);
+#endif
+}
+
+#if defined(__SSE4_1__)
+inline __m128 rb0_inv_4_root_sse41(const __m128 y)
+{
+	__m128i i = _mm_castps_si128(y); // interpret float as integer
+	__m128i q = _mm_srai_epi32(_mm_add_epi32(i, _mm_srli_epi32(_mm_srai_epi32(i, 31), 30)), 2); // i / 4, rounding toward zero
+	i = _mm_sub_epi32(_mm_set1_epi32(0x4f58605b), q); // log-approximation hack
+	__m128 x = _mm_castsi128_ps(i);
+	return x;
+}
+#endif
+
+#if defined(__AVX2__) && defined(__FMA__)
+inline __m256 rb0_inv_4_root_avx2(const __m256 y)
+{
+	__m256i i = _mm256_castps_si256(y); // interpret float as integer
+	__m256i q = _mm256_srai_epi32(_mm256_add_epi32(i, _mm256_srli_epi32(_mm256_srai_epi32(i, 31), 30)), 2); // i / 4, rounding toward zero
+	i = _mm256_sub_epi32(_mm256_set1_epi32(0x4f58605b), q); // log-approximation hack
+	__m256 x = _mm256_castsi256_ps(i);
+	return x;
+}
+#endif
+
+#if defined(__AVX512F__)
+RB_AVX512_BEGIN
+inline __m512 rb0_inv_4_root_avx512(const __m512 y)
+{
+	__m512i i = _mm512_castps_si512(y); // interpret float as integer
+	__m512i q = _mm512_srai_epi32(_mm512_add_epi32(i, _mm512_srli_epi32(_mm512_srai_epi32(i, 31), 30)), 2); // i / 4, rounding toward zero
+	i = _mm512_sub_epi32(_mm512_set1_epi32(0x4f58605b), q); // log-approximation hack
+	__m512 x = _mm512_castsi512_ps(i);
+	return x;
+}
+RB_AVX512_END
+#endif
+
+inline void rb0_inv_4_root_batch(const float *y, float *x, const size_t count)
+{
+#if defined(__AVX512F__)
+	rb_simd_batch<16>(y, x, count, [](const float *in, float *out)
+		{_mm512_storeu_ps(out, rb0_inv_4_root_avx512(_mm512_loadu_ps(in)));});
+#elif defined(__AVX2__) && defined(__FMA__)
+	rb_simd_batch<8>(y, x, count, [](const float *in, float *out)
+		{_mm256_storeu_ps(out, rb0_inv_4_root_avx2(_mm256_loadu_ps(in)));});
+#elif defined(__SSE4_1__)
+	rb_simd_batch<4>(y, x, count, [](const float *in, float *out)
+		{_mm_storeu_ps(out, rb0_inv_4_root_sse41(_mm_loadu_ps(in)));});
+#else
+	for (size_t i = 0; i < count; ++i) x[i] = rb0_inv_4_root(y[i]);
+#endif
+}
+
+#if defined(__SSE4_1__)
+inline __m128 rb0_safe_inv_4_root_sse41(const __m128 y)
+{
+	const __m128i ordinary = _mm_add_epi32(_mm_castps_si128(y), _mm_set1_epi32((int32_t)0x7f800000u));
+	if (_mm_movemask_epi8(_mm_cmpgt_epi32(_mm_set1_epi32((int32_t)0xff000000u), ordinary)) == 0xffff) return rb0_inv_4_root_sse41(y);
+	const __m128i u = _mm_castps_si128(y), sign = _mm_and_si128(u, _mm_set1_epi32((int32_t)0x80000000u));
+	const __m128 a = _mm_castsi128_ps(_mm_xor_si128(u, sign));
+	const __m128 tiny = _mm_cmpgt_ps(_mm_castsi128_ps(_mm_set1_epi32((int32_t)0x800000u)), a); // zero or denormal, scaled into normal range
+	const __m128 finite = _mm_and_ps(_mm_cmpgt_ps(a, _mm_setzero_ps()), _mm_cmpgt_ps(_mm_castsi128_ps(_mm_set1_epi32((int32_t)0x7f800000u)), a));
+	const __m128 number = _mm_cmpgt_ps(a, _mm_set1_ps(-1.0f)); // all but NaN, which keeps its bits
+	__m128 x = rb0_inv_4_root_sse41(_mm_mul_ps(a, _mm_blendv_ps(_mm_set1_ps(1.0f), _mm_castsi128_ps(_mm_set1_epi32((int32_t)0x4b800000u)), tiny)));
+	x = _mm_mul_ps(x, _mm_blendv_ps(_mm_set1_ps(1.0f), _mm_castsi128_ps(_mm_set1_epi32((int32_t)0x42800000u)), tiny));
+	x = _mm_blendv_ps(_mm_blendv_ps(a, _mm_castsi128_ps(_mm_sub_epi32(_mm_set1_epi32((int32_t)0x7f800000u), _mm_castps_si128(a))), number), x, finite); // zero, infinity and NaN
+	x = _mm_castsi128_ps(_mm_or_si128(_mm_castps_si128(x), sign));
+	x = _mm_blendv_ps(x, _mm_castsi128_ps(_mm_set1_epi32((int32_t)0x7fc00000u)), _mm_cmpgt_ps(_mm_setzero_ps(), y)); // even root of a negative
+	return x;
+}
+#endif
+
+#if defined(__AVX2__) && defined(__FMA__)
+inline __m256 rb0_safe_inv_4_root_avx2(const __m256 y)
+{
+	const __m256i ordinary = _mm256_add_epi32(_mm256_castps_si256(y), _mm256_set1_epi32((int32_t)0x7f800000u));
+	if (_mm256_movemask_epi8(_mm256_cmpgt_epi32(_mm256_set1_epi32((int32_t)0xff000000u), ordinary)) == -1) return rb0_inv_4_root_avx2(y);
+	const __m256i u = _mm256_castps_si256(y), sign = _mm256_and_si256(u, _mm256_set1_epi32((int32_t)0x80000000u));
+	const __m256 a = _mm256_castsi256_ps(_mm256_xor_si256(u, sign));
+	const __m256 tiny = _mm256_cmp_ps(_mm256_castsi256_ps(_mm256_set1_epi32((int32_t)0x800000u)), a, _CMP_GT_OQ); // zero or denormal, scaled into normal range
+	const __m256 finite = _mm256_and_ps(_mm256_cmp_ps(a, _mm256_setzero_ps(), _CMP_GT_OQ), _mm256_cmp_ps(_mm256_castsi256_ps(_mm256_set1_epi32((int32_t)0x7f800000u)), a, _CMP_GT_OQ));
+	const __m256 number = _mm256_cmp_ps(a, _mm256_set1_ps(-1.0f), _CMP_GT_OQ); // all but NaN, which keeps its bits
+	__m256 x = rb0_inv_4_root_avx2(_mm256_mul_ps(a, _mm256_blendv_ps(_mm256_set1_ps(1.0f), _mm256_castsi256_ps(_mm256_set1_epi32((int32_t)0x4b800000u)), tiny)));
+	x = _mm256_mul_ps(x, _mm256_blendv_ps(_mm256_set1_ps(1.0f), _mm256_castsi256_ps(_mm256_set1_epi32((int32_t)0x42800000u)), tiny));
+	x = _mm256_blendv_ps(_mm256_blendv_ps(a, _mm256_castsi256_ps(_mm256_sub_epi32(_mm256_set1_epi32((int32_t)0x7f800000u), _mm256_castps_si256(a))), number), x, finite); // zero, infinity and NaN
+	x = _mm256_castsi256_ps(_mm256_or_si256(_mm256_castps_si256(x), sign));
+	x = _mm256_blendv_ps(x, _mm256_castsi256_ps(_mm256_set1_epi32((int32_t)0x7fc00000u)), _mm256_cmp_ps(_mm256_setzero_ps(), y, _CMP_GT_OQ)); // even root of a negative
+	return x;
+}
+#endif
+
+#if defined(__AVX512F__)
+RB_AVX512_BEGIN
+inline __m512 rb0_safe_inv_4_root_avx512(const __m512 y)
+{
+	const __m512i ordinary = _mm512_add_epi32(_mm512_castps_si512(y), _mm512_set1_epi32((int32_t)0x7f800000u));
+	if (_mm512_cmplt_epi32_mask(ordinary, _mm512_set1_epi32((int32_t)0xff000000u)) == (__mmask16)0xffff) return rb0_inv_4_root_avx512(y);
+	const __m512i u = _mm512_castps_si512(y), sign = _mm512_and_si512(u, _mm512_set1_epi32((int32_t)0x80000000u));
+	const __m512 a = _mm512_castsi512_ps(_mm512_xor_si512(u, sign));
+	const __mmask16 tiny = _mm512_cmp_ps_mask(_mm512_castsi512_ps(_mm512_set1_epi32((int32_t)0x800000u)), a, _CMP_GT_OQ); // zero or denormal, scaled into normal range
+	const __mmask16 finite = (__mmask16)(_mm512_cmp_ps_mask(a, _mm512_setzero_ps(), _CMP_GT_OQ) & _mm512_cmp_ps_mask(_mm512_castsi512_ps(_mm512_set1_epi32((int32_t)0x7f800000u)), a, _CMP_GT_OQ));
+	const __mmask16 number = _mm512_cmp_ps_mask(a, _mm512_set1_ps(-1.0f), _CMP_GT_OQ); // all but NaN, which keeps its bits
+	__m512 x = rb0_inv_4_root_avx512(_mm512_mul_ps(a, _mm512_mask_blend_ps(tiny, _mm512_set1_ps(1.0f), _mm512_castsi512_ps(_mm512_set1_epi32((int32_t)0x4b800000u)))));
+	x = _mm512_mul_ps(x, _mm512_mask_blend_ps(tiny, _mm512_set1_ps(1.0f), _mm512_castsi512_ps(_mm512_set1_epi32((int32_t)0x42800000u))));
+	x = _mm512_mask_blend_ps(finite, _mm512_mask_blend_ps(number, a, _mm512_castsi512_ps(_mm512_sub_epi32(_mm512_set1_epi32((int32_t)0x7f800000u), _mm512_castps_si512(a)))), x); // zero, infinity and NaN
+	x = _mm512_castsi512_ps(_mm512_or_si512(_mm512_castps_si512(x), sign));
+	x = _mm512_mask_blend_ps(_mm512_cmp_ps_mask(_mm512_setzero_ps(), y, _CMP_GT_OQ), x, _mm512_castsi512_ps(_mm512_set1_epi32((int32_t)0x7fc00000u))); // even root of a negative
+	return x;
+}
+RB_AVX512_END
+#endif
+
+inline void rb0_safe_inv_4_root_batch(const float *y, float *x, const size_t count)
+{
+#if defined(__AVX512F__)
+	rb_simd_batch<16>(y, x, count, [](const float *in, float *out)
+		{_mm512_storeu_ps(out, rb0_safe_inv_4_root_avx512(_mm512_loadu_ps(in)));});
+#elif defined(__AVX2__) && defined(__FMA__)
+	rb_simd_batch<8>(y, x, count, [](const float *in, float *out)
+		{_mm256_storeu_ps(out, rb0_safe_inv_4_root_avx2(_mm256_loadu_ps(in)));});
+#elif defined(__SSE4_1__)
+	rb_simd_batch<4>(y, x, count, [](const float *in, float *out)
+		{_mm_storeu_ps(out, rb0_safe_inv_4_root_sse41(_mm_loadu_ps(in)));});
+#else
+	for (size_t i = 0; i < count; ++i) x[i] = rb0_safe_inv_4_root(y[i]);
+#endif
+}
+
+#if defined(__SSE4_1__)
+inline __m128 rb2_2_root_sse41(const __m128 y)
+{
+	__m128i i = _mm_castps_si128(y); // interpret float as integer
+	__m128i q = _mm_srai_epi32(_mm_add_epi32(i, _mm_srli_epi32(_mm_srai_epi32(i, 31), 31)), 1); // i / 2, rounding toward zero
+	i = _mm_add_epi32(_mm_set1_epi32(0x1fbb75ad), q); // log-approximation hack
+	__m128 x = _mm_castsi128_ps(i);
+	x = _mm_add_ps(_mm_mul_ps(x, _mm_set1_ps(0.499878f)), _mm_div_ps(_mm_mul_ps(_mm_set1_ps(0.500122f), y), x)); // newtonian step #1
+	x = _mm_add_ps(_mm_mul_ps(x, _mm_set1_ps(0.499878f)), _mm_div_ps(_mm_mul_ps(_mm_set1_ps(0.500122f), y), x)); // newtonian step #2
+	return x;
+}
+#endif
+
+#if defined(__AVX2__) && defined(__FMA__)
+inline __m256 rb2_2_root_avx2(const __m256 y)
+{
+	__m256i i = _mm256_castps_si256(y); // interpret float as integer
+	__m256i q = _mm256_srai_epi32(_mm256_add_epi32(i, _mm256_srli_epi32(_mm256_srai_epi32(i, 31), 31)), 1); // i / 2, rounding toward zero
+	i = _mm256_add_epi32(_mm256_set1_epi32(0x1fbb75ad), q); // log-approximation hack
+	__m256 x = _mm256_castsi256_ps(i);
+	x = _mm256_fmadd_ps(x, _mm256_set1_ps(0.499878f), _mm256_div_ps(_mm256_mul_ps(_mm256_set1_ps(0.500122f), y), x)); // newtonian step #1
+	x = _mm256_fmadd_ps(x, _mm256_set1_ps(0.499878f), _mm256_div_ps(_mm256_mul_ps(_mm256_set1_ps(0.500122f), y), x)); // newtonian step #2
+	return x;
+}
+#endif
+
+#if defined(__AVX512F__)
+RB_AVX512_BEGIN
+inline __m512 rb2_2_root_avx512(const __m512 y)
+{
+	__m512i i = _mm512_castps_si512(y); // interpret float as integer
+	__m512i q = _mm512_srai_epi32(_mm512_add_epi32(i, _mm512_srli_epi32(_mm512_srai_epi32(i, 31), 31)), 1); // i / 2, rounding toward zero
+	i = _mm512_add_epi32(_mm512_set1_epi32(0x1fbb75ad), q); // log-approximation hack
+	__m512 x = _mm512_castsi512_ps(i);
+	x = _mm512_fmadd_ps(x, _mm512_set1_ps(0.499878f), _mm512_div_ps(_mm512_mul_ps(_mm512_set1_ps(0.500122f), y), x)); // newtonian step #1
+	x = _mm512_fmadd_ps(x, _mm512_set1_ps(0.499878f), _mm512_div_ps(_mm512_mul_ps(_mm512_set1_ps(0.500122f), y), x)); // newtonian step #2
+	return x;
+}
+RB_AVX512_END
+#endif
+
+inline void rb2_2_root_batch(const float *y, float *x, const size_t count)
+{
+#if defined(__AVX512F__)
+	rb_simd_batch<16>(y, x, count, [](const float *in, float *out)
+		{_mm512_storeu_ps(out, rb2_2_root_avx512(_mm512_loadu_ps(in)));});
+#elif defined(__AVX2__) && defined(__FMA__)
+	rb_simd_batch<8>(y, x, count, [](const float *in, float *out)
+		{_mm256_storeu_ps(out, rb2_2_root_avx2(_mm256_loadu_ps(in)));});
+#elif defined(__SSE4_1__)
+	rb_simd_batch<4>(y, x, count, [](const float *in, float *out)
+		{_mm_storeu_ps(out, rb2_2_root_sse41(_mm_loadu_ps(in)));});
+#else
+	for (size_t i = 0; i < count; ++i) x[i] = rb2_2_root(y[i]);
+#endif
+}
+
+#if defined(__SSE4_1__)
+inline __m128 rb2_safe_2_root_sse41(const __m128 y)
+{
+	const __m128i ordinary = _mm_add_epi32(_mm_castps_si128(y), _mm_set1_epi32((int32_t)0x7f800000u));
+	if (_mm_movemask_epi8(_mm_cmpgt_epi32(_mm_set1_epi32((int32_t)0xff000000u), ordinary)) == 0xffff) return rb2_2_root_sse41(y);
+	const __m128i u = _mm_castps_si128(y), sign = _mm_and_si128(u, _mm_set1_epi32((int32_t)0x80000000u));
+	const __m128 a = _mm_castsi128_ps(_mm_xor_si128(u, sign));
+	const __m128 tiny = _mm_cmpgt_ps(_mm_castsi128_ps(_mm_set1_epi32((int32_t)0x800000u)), a); // zero or denormal, scaled into normal range
+	const __m128 finite = _mm_and_ps(_mm_cmpgt_ps(a, _mm_setzero_ps()), _mm_cmpgt_ps(_mm_castsi128_ps(_mm_set1_epi32((int32_t)0x7f800000u)), a));
+	__m128 x = rb2_2_root_sse41(_mm_mul_ps(a, _mm_blendv_ps(_mm_set1_ps(1.0f), _mm_castsi128_ps(_mm_set1_epi32((int32_t)0x4b800000u)), tiny)));
+	x = _mm_mul_ps(x, _mm_blendv_ps(_mm_set1_ps(1.0f), _mm_castsi128_ps(_mm_set1_epi32((int32_t)0x39800000u)), tiny));
+	x = _mm_blendv_ps(a, x, finite); // zero, infinity and NaN
+	x = _mm_castsi128_ps(_mm_or_si128(_mm_castps_si128(x), sign));
+	x = _mm_blendv_ps(x, _mm_castsi128_ps(_mm_set1_epi32((int32_t)0x7fc00000u)), _mm_cmpgt_ps(_mm_setzero_ps(), y)); // even root of a negative
+	return x;
+}
+#endif
+
+#if defined(__AVX2__) && defined(__FMA__)
+inline __m256 rb2_safe_2_root_avx2(const __m256 y)
+{
+	const __m256i ordinary = _mm256_add_epi32(_mm256_castps_si256(y), _mm256_set1_epi32((int32_t)0x7f800000u));
+	if (_mm256_movemask_epi8(_mm256_cmpgt_epi32(_mm256_set1_epi32((int32_t)0xff000000u), ordinary)) == -1) return rb2_2_root_avx2(y);
+	const __m256i u = _mm256_castps_si256(y), sign = _mm256_and_si256(u, _mm256_set1_epi32((int32_t)0x80000000u));
+	const __m256 a = _mm256_castsi256_ps(_mm256_xor_si256(u, sign));
+	const __m256 tiny = _mm256_cmp_ps(_mm256_castsi256_ps(_mm256_set1_epi32((int32_t)0x800000u)), a, _CMP_GT_OQ); // zero or denormal, scaled into normal range
+	const __m256 finite = _mm256_and_ps(_mm256_cmp_ps(a, _mm256_setzero_ps(), _CMP_GT_OQ), _mm256_cmp_ps(_mm256_castsi256_ps(_mm256_set1_epi32((int32_t)0x7f800000u)), a, _CMP_GT_OQ));
+	__m256 x = rb2_2_root_avx2(_mm256_mul_ps(a, _mm256_blendv_ps(_mm256_set1_ps(1.0f), _mm256_castsi256_ps(_mm256_set1_epi32((int32_t)0x4b800000u)), tiny)));
+	x = _mm256_mul_ps(x, _mm256_blendv_ps(_mm256_set1_ps(1.0f), _mm256_castsi256_ps(_mm256_set1_epi32((int32_t)0x39800000u)), tiny));
+	x = _mm256_blendv_ps(a, x, finite); // zero, infinity and NaN
+	x = _mm256_castsi256_ps(_mm256_or_si256(_mm256_castps_si256(x), sign));
+	x = _mm256_blendv_ps(x, _mm256_castsi256_ps(_mm256_set1_epi32((int32_t)0x7fc00000u)), _mm256_cmp_ps(_mm256_setzero_ps(), y, _CMP_GT_OQ)); // even root of a negative
+	return x;
+}
+#endif
+
+#if defined(__AVX512F__)
+RB_AVX512_BEGIN
+inline __m512 rb2_safe_2_root_avx512(const __m512 y)
+{
+	const __m512i ordinary = _mm512_add_epi32(_mm512_castps_si512(y), _mm512_set1_epi32((int32_t)0x7f800000u));
+	if (_mm512_cmplt_epi32_mask(ordinary, _mm512_set1_epi32((int32_t)0xff000000u)) == (__mmask16)0xffff) return rb2_2_root_avx512(y);
+	const __m512i u = _mm512_castps_si512(y), sign = _mm512_and_si512(u, _mm512_set1_epi32((int32_t)0x80000000u));
+	const __m512 a = _mm512_castsi512_ps(_mm512_xor_si512(u, sign));
+	const __mmask16 tiny = _mm512_cmp_ps_mask(_mm512_castsi512_ps(_mm512_set1_epi32((int32_t)0x800000u)), a, _CMP_GT_OQ); // zero or denormal, scaled into normal range
+	const __mmask16 finite = (__mmask16)(_mm512_cmp_ps_mask(a, _mm512_setzero_ps(), _CMP_GT_OQ) & _mm512_cmp_ps_mask(_mm512_castsi512_ps(_mm512_set1_epi32((int32_t)0x7f800000u)), a, _CMP_GT_OQ));
+	__m512 x = rb2_2_root_avx512(_mm512_mul_ps(a, _mm512_mask_blend_ps(tiny, _mm512_set1_ps(1.0f), _mm512_castsi512_ps(_mm512_set1_epi32((int32_t)0x4b800000u)))));
+	x = _mm512_mul_ps(x, _mm512_mask_blend_ps(tiny, _mm512_set1_ps(1.0f), _mm512_castsi512_ps(_mm512_set1_epi32((int32_t)0x39800000u))));
+	x = _mm512_mask_blend_ps(finite, a, x); // zero, infinity and NaN
+	x = _mm512_castsi512_ps(_mm512_or_si512(_mm512_castps_si512(x), sign));
+	x = _mm512_mask_blend_ps(_mm512_cmp_ps_mask(_mm512_setzero_ps(), y, _CMP_GT_OQ), x, _mm512_castsi512_ps(_mm512_set1_epi32((int32_t)0x7fc00000u))); // even root of a negative
+	return x;
+}
+RB_AVX512_END
+#endif
+
+inline void rb2_safe_2_root_batch(const float *y, float *x, const size_t count)
+{
+#if defined(__AVX512F__)
+	rb_simd_batch<16>(y, x, count, [](const float *in, float *out)
+		{_mm512_storeu_ps(out, rb2_safe_2_root_avx512(_mm512_loadu_ps(in)));});
+#elif defined(__AVX2__) && defined(__FMA__)
+	rb_simd_batch<8>(y, x, count, [](const float *in, float *out)
+		{_mm256_storeu_ps(out, rb2_safe_2_root_avx2(_mm256_loadu_ps(in)));});
+#elif defined(__SSE4_1__)
+	rb_simd_batch<4>(y, x, count, [](const float *in, float *out)
+		{_mm_storeu_ps(out, rb2_safe_2_root_sse41(_mm_loadu_ps(in)));});
+#else
+	for (size_t i = 0; i < count; ++i) x[i] = rb2_safe_2_root(y[i]);
+#endif
+}
+
+#if defined(__SSE4_1__)
+inline __m128 rb2_inv_2_root_sse41(const __m128 y)
+{
+	__m128i i = _mm_castps_si128(y); // interpret float as integer
+	__m128i q = _mm_srai_epi32(_mm_add_epi32(i, _mm_srli_epi32(_mm_srai_epi32(i, 31), 31)), 1); // i / 2, rounding toward zero
+	i = _mm_sub_epi32(_mm_set1_epi32(0x5f3634f9), q); // log-approximation hack
+	__m128 x = _mm_castsi128_ps(i);
+	x = _mm_mul_ps(x, _mm_add_ps(_mm_mul_ps(_mm_mul_ps(_mm_set1_ps(-0.501326f), y), _mm_mul_ps(x, x)), _mm_set1_ps(1.5013261f))); // newtonian step #1
+	x = _mm_mul_ps(x, _mm_add_ps(_mm_mul_ps(_mm_mul_ps(_mm_set1_ps(-0.501326f), y), _mm_mul_ps(x, x)), _mm_set1_ps(1.5013261f))); // newtonian step #2
+	return x;
+}
+#endif
+
+#if defined(__AVX2__) && defined(__FMA__)
+inline __m256 rb2_inv_2_root_avx2(const __m256 y)
+{
+	__m256i i = _mm256_castps_si256(y); // interpret float as integer
+	__m256i q = _mm256_srai_epi32(_mm256_add_epi32(i, _mm256_srli_epi32(_mm256_srai_epi32(i, 31), 31)), 1); // i / 2, rounding toward zero
+	i = _mm256_sub_epi32(_mm256_set1_epi32(0x5f3634f9), q); // log-approximation hack
+	__m256 x = _mm256_castsi256_ps(i);
+	x = _mm256_mul_ps(x, _mm256_fmadd_ps(_mm256_mul_ps(_mm256_set1_ps(-0.501326f), y), _mm256_mul_ps(x, x), _mm256_set1_ps(1.5013261f))); // newtonian step #1
+	x = _mm256_mul_ps(x, _mm256_fmadd_ps(_mm256_mul_ps(_mm256_set1_ps(-0.501326f), y), _mm256_mul_ps(x, x), _mm256_set1_ps(1.5013261f))); // newtonian step #2
+	return x;
+}
+#endif
+
+#if defined(__AVX512F__)
+RB_AVX512_BEGIN
+inline __m512 rb2_inv_2_root_avx512(const __m512 y)
+{
+	__m512i i = _mm512_castps_si512(y); // interpret float as integer
+	__m512i q = _mm512_srai_epi32(_mm512_add_epi32(i, _mm512_srli_epi32(_mm512_srai_epi32(i, 31), 31)), 1); // i / 2, rounding toward zero
+	i = _mm512_sub_epi32(_mm512_set1_epi32(0x5f3634f9), q); // log-approximation hack
+	__m512 x = _mm512_castsi512_ps(i);
+	x = _mm512_mul_ps(x, _mm512_fmadd_ps(_mm512_mul_ps(_mm512_set1_ps(-0.501326f), y), _mm512_mul_ps(x, x), _mm512_set1_ps(1.5013261f))); // newtonian step #1
+	x = _mm512_mul_ps(x, _mm512_fmadd_ps(_mm512_mul_ps(_mm512_set1_ps(-0.501326f), y), _mm512_mul_ps(x, x), _mm512_set1_ps(1.5013261f))); // newtonian step #2
+	return x;
+}
+RB_AVX512_END
+#endif
+
+inline void rb2_inv_2_root_batch(const float *y, float *x, const size_t count)
+{
+#if defined(__AVX512F__)
+	rb_simd_batch<16>(y, x, count, [](const float *in, float *out)
+		{_mm512_storeu_ps(out, rb2_inv_2_root_avx512(_mm512_loadu_ps(in)));});
+#elif defined(__AVX2__) && defined(__FMA__)
+	rb_simd_batch<8>(y, x, count, [](const float *in, float *out)
+		{_mm256_storeu_ps(out, rb2_inv_2_root_avx2(_mm256_loadu_ps(in)));});
+#elif defined(__SSE4_1__)
+	rb_simd_batch<4>(y, x, count, [](const float *in, float *out)
+		{_mm_storeu_ps(out, rb2_inv_2_root_sse41(_mm_loadu_ps(in)));});
+#else
+	for (size_t i = 0; i < count; ++i) x[i] = rb2_inv_2_root(y[i]);
+#endif
+}
+
+#if defined(__SSE4_1__)
+inline __m128 rb2_safe_inv_2_root_sse41(const __m128 y)
+{
+	const __m128i ordinary = _mm_add_epi32(_mm_castps_si128(y), _mm_set1_epi32((int32_t)0x7f800000u));
+	if (_mm_movemask_epi8(_mm_cmpgt_epi32(_mm_set1_epi32((int32_t)0xff000000u), ordinary)) == 0xffff) return rb2_inv_2_root_sse41(y);
+	const __m128i u = _mm_castps_si128(y), sign = _mm_and_si128(u, _mm_set1_epi32((int32_t)0x80000000u));
+	const __m128 a = _mm_castsi128_ps(_mm_xor_si128(u, sign));
+	const __m128 tiny = _mm_cmpgt_ps(_mm_castsi128_ps(_mm_set1_epi32((int32_t)0x800000u)), a); // zero or denormal, scaled into normal range
+	const __m128 finite = _mm_and_ps(_mm_cmpgt_ps(a, _mm_setzero_ps()), _mm_cmpgt_ps(_mm_castsi128_ps(_mm_set1_epi32((int32_t)0x7f800000u)), a));
+	const __m128 number = _mm_cmpgt_ps(a, _mm_set1_ps(-1.0f)); // all but NaN, which keeps its bits
+	__m128 x = rb2_inv_2_root_sse41(_mm_mul_ps(a, _mm_blendv_ps(_mm_set1_ps(1.0f), _mm_castsi128_ps(_mm_set1_epi32((int32_t)0x4b800000u)), tiny)));
+	x = _mm_mul_ps(x, _mm_blendv_ps(_mm_set1_ps(1.0f), _mm_castsi128_ps(_mm_set1_epi32((int32_t)0x45800000u)), tiny));
+	x = _mm_blendv_ps(_mm_blendv_ps(a, _mm_castsi128_ps(_mm_sub_epi32(_mm_set1_epi32((int32_t)0x7f800000u), _mm_castps_si128(a))), number), x, finite); // zero, infinity and NaN
+	x = _mm_castsi128_ps(_mm_or_si128(_mm_castps_si128(x), sign));
+	x = _mm_blendv_ps(x, _mm_castsi128_ps(_mm_set1_epi32((int32_t)0x7fc00000u)), _mm_cmpgt_ps(_mm_setzero_ps(), y)); // even root of a negative
+	return x;
+}
+#endif
+
+#if defined(__AVX2__) && defined(__FMA__)
+inline __m256 rb2_safe_inv_2_root_avx2(const __m256 y)
+{
+	const __m256i ordinary = _mm256_add_epi32(_mm256_castps_si256(y), _mm256_set1_epi32((int32_t)0x7f800000u));
+	if (_mm256_movemask_epi8(_mm256_cmpgt_epi32(_mm256_set1_epi32((int32_t)0xff000000u), ordinary)) == -1) return rb2_inv_2_root_avx2(y);
+	const __m256i u = _mm256_castps_si256(y), sign = _mm256_and_si256(u, _mm256_set1_epi32((int32_t)0x80000000u));
+	const __m256 a = _mm256_castsi256_ps(_mm256_xor_si256(u, sign));
+	const __m256 tiny = _mm256_cmp_ps(_mm256_castsi256_ps(_mm256_set1_epi32((int32_t)0x800000u)), a, _CMP_GT_OQ); // zero or denormal, scaled into normal range
+	const __m256 finite = _mm256_and_ps(_mm256_cmp_ps(a, _mm256_setzero_ps(), _CMP_GT_OQ), _mm256_cmp_ps(_mm256_castsi256_ps(_mm256_set1_epi32((int32_t)0x7f800000u)), a, _CMP_GT_OQ));
+	const __m256 number = _mm256_cmp_ps(a, _mm256_set1_ps(-1.0f), _CMP_GT_OQ); // all but NaN, which keeps its bits
+	__m256 x = rb2_inv_2_root_avx2(_mm256_mul_ps(a, _mm256_blendv_ps(_mm256_set1_ps(1.0f), _mm256_castsi256_ps(_mm256_set1_epi32((int32_t)0x4b800000u)), tiny)));
+	x = _mm256_mul_ps(x, _mm256_blendv_ps(_mm256_set1_ps(1.0f), _mm256_castsi256_ps(_mm256_set1_epi32((int32_t)0x45800000u)), tiny));
+	x = _mm256_blendv_ps(_mm256_blendv_ps(a, _mm256_castsi256_ps(_mm256_sub_epi32(_mm256_set1_epi32((int32_t)0x7f800000u), _mm256_castps_si256(a))), number), x, finite); // zero, infinity and NaN
+	x = _mm256_castsi256_ps(_mm256_or_si256(_mm256_castps_si256(x), sign));
+	x = _mm256_blendv_ps(x, _mm256_castsi256_ps(_mm256_set1_epi32((int32_t)0x7fc00000u)), _mm256_cmp_ps(_mm256_setzero_ps(), y, _CMP_GT_OQ)); // even root of a negative
+	return x;
+}
+#endif
+
+#if defined(__AVX512F__)
+RB_AVX512_BEGIN
+inline __m512 rb2_safe_inv_2_root_avx512(const __m512 y)
+{
+	const __m512i ordinary = _mm512_add_epi32(_mm512_castps_si512(y), _mm512_set1_epi32((int32_t)0x7f800000u));
+	if (_mm512_cmplt_epi32_mask(ordinary, _mm512_set1_epi32((int32_t)0xff000000u)) == (__mmask16)0xffff) return rb2_inv_2_root_avx512(y);
+	const __m512i u = _mm512_castps_si512(y), sign = _mm512_and_si512(u, _mm512_set1_epi32((int32_t)0x80000000u));
+	const __m512 a = _mm512_castsi512_ps(_mm512_xor_si512(u, sign));
+	const __mmask16 tiny = _mm512_cmp_ps_mask(_mm512_castsi512_ps(_mm512_set1_epi32((int32_t)0x800000u)), a, _CMP_GT_OQ); // zero or denormal, scaled into normal range
+	const __mmask16 finite = (__mmask16)(_mm512_cmp_ps_mask(a, _mm512_setzero_ps(), _CMP_GT_OQ) & _mm512_cmp_ps_mask(_mm512_castsi512_ps(_mm512_set1_epi32((int32_t)0x7f800000u)), a, _CMP_GT_OQ));
+	const __mmask16 number = _mm512_cmp_ps_mask(a, _mm512_set1_ps(-1.0f), _CMP_GT_OQ); // all but NaN, which keeps its bits
+	__m512 x = rb2_inv_2_root_avx512(_mm512_mul_ps(a, _mm512_mask_blend_ps(tiny, _mm512_set1_ps(1.0f), _mm512_castsi512_ps(_mm512_set1_epi32((int32_t)0x4b800000u)))));
+	x = _mm512_mul_ps(x, _mm512_mask_blend_ps(tiny, _mm512_set1_ps(1.0f), _mm512_castsi512_ps(_mm512_set1_epi32((int32_t)0x45800000u))));
+	x = _mm512_mask_blend_ps(finite, _mm512_mask_blend_ps(number, a, _mm512_castsi512_ps(_mm512_sub_epi32(_mm512_set1_epi32((int32_t)0x7f800000u), _mm512_castps_si512(a)))), x); // zero, infinity and NaN
+	x = _mm512_castsi512_ps(_mm512_or_si512(_mm512_castps_si512(x), sign));
+	x = _mm512_mask_blend_ps(_mm512_cmp_ps_mask(_mm512_setzero_ps(), y, _CMP_GT_OQ), x, _mm512_castsi512_ps(_mm512_set1_epi32((int32_t)0x7fc00000u))); // even root of a negative
+	return x;
+}
+RB_AVX512_END
+#endif
+
+inline void rb2_safe_inv_2_root_batch(const float *y, float *x, const size_t count)
+{
+#if defined(__AVX512F__)
+	rb_simd_batch<16>(y, x, count, [](const float *in, float *out)
+		{_mm512_storeu_ps(out, rb2_safe_inv_2_root_avx512(_mm512_loadu_ps(in)));});
+#elif defined(__AVX2__) && defined(__FMA__)
+	rb_simd_batch<8>(y, x, count, [](const float *in, float *out)
+		{_mm256_storeu_ps(out, rb2_safe_inv_2_root_avx2(_mm256_loadu_ps(in)));});
+#elif defined(__SSE4_1__)
+	rb_simd_batch<4>(y, x, count, [](const float *in, float *out)
+		{_mm_storeu_ps(out, rb2_safe_inv_2_root_sse41(_mm_loadu_ps(in)));});
+#else
+	for (size_t i = 0; i < count; ++i) x[i] = rb2_safe_inv_2_root(y[i]);
+#endif
+}
+
+#if defined(__SSE4_1__)
+inline __m128 rb2_3_root_sse41(const __m128 y)
+{
+	__m128i i = _mm_castps_si128(y); // interpret float as integer
+	__m128i q = rb_mulhi_epi32_sse41(i, _mm_set1_epi32((int32_t)0x55555556u));
+	q = _mm_sub_epi32(q, _mm_srai_epi32(i, 31)); // i / 3, rounding toward zero
+	i = _mm_add_epi32(_mm_set1_epi32(0x2a4fcd03), q); // log-approximation hack
+	__m128 x = _mm_castsi128_ps(i);
+	x = _mm_add_ps(_mm_mul_ps(x, _mm_set1_ps(0.66618204f)), _mm_div_ps(_mm_mul_ps(_mm_set1_ps(0.333818f), y), _mm_mul_ps(x, x))); // newtonian step #1
+	x = _mm_add_ps(_mm_mul_ps(x, _mm_set1_ps(0.66618204f)), _mm_div_ps(_mm_mul_ps(_mm_set1_ps(0.333818f), y), _mm_mul_ps(x, x))); // newtonian step #2
+	return x;
+}
+#endif
+
+#if defined(__AVX2__) && defined(__FMA__)
+inline __m256 rb2_3_root_avx2(const __m256 y)
+{
+	__m256i i = _mm256_castps_si256(y); // interpret float as integer
+	__m256i q = rb_mulhi_epi32_avx2(i, _mm256_set1_epi32((int32_t)0x55555556u));
+	q = _mm256_sub_epi32(q, _mm256_srai_epi32(i, 31)); // i / 3, rounding toward zero
+	i = _mm256_add_epi32(_mm256_set1_epi32(0x2a4fcd03), q); // log-approximation hack
+	__m256 x = _mm256_castsi256_ps(i);
+	x = _mm256_fmadd_ps(x, _mm256_set1_ps(0.66618204f), _mm256_div_ps(_mm256_mul_ps(_mm256_set1_ps(0.333818f), y), _mm256_mul_ps(x, x))); // newtonian step #1
+	x = _mm256_fmadd_ps(x, _mm256_set1_ps(0.66618204f), _mm256_div_ps(_mm256_mul_ps(_mm256_set1_ps(0.333818f), y), _mm256_mul_ps(x, x))); // newtonian step #2
+	return x;
+}
+#endif
+
+#if defined(__AVX512F__)
+RB_AVX512_BEGIN
+inline __m512 rb2_3_root_avx512(const __m512 y)
+{
+	__m512i i = _mm512_castps_si512(y); // interpret float as integer
+	__m512i q = rb_mulhi_epi32_avx512(i, _mm512_set1_epi32((int32_t)0x55555556u));
+	q = _mm512_sub_epi32(q, _mm512_srai_epi32(i, 31)); // i / 3, rounding toward zero
+	i = _mm512_add_epi32(_mm512_set1_epi32(0x2a4fcd03), q); // log-approximation hack
+	__m512 x = _mm512_castsi512_ps(i);
+	x = _mm512_fmadd_ps(x, _mm512_set1_ps(0.66618204f), _mm512_div_ps(_mm512_mul_ps(_mm512_set1_ps(0.333818f), y), _mm512_mul_ps(x, x))); // newtonian step #1
+	x = _mm512_fmadd_ps(x, _mm512_set1_ps(0.66618204f), _mm512_div_ps(_mm512_mul_ps(_mm512_set1_ps(0.333818f), y), _mm512_mul_ps(x, x))); // newtonian step #2
+	return x;
+}
+RB_AVX512_END
+#endif
+
+inline void rb2_3_root_batch(const float *y, float *x, const size_t count)
+{
+#if defined(__AVX512F__)
+	rb_simd_batch<16>(y, x, count, [](const float *in, float *out)
+		{_mm512_storeu_ps(out, rb2_3_root_avx512(_mm512_loadu_ps(in)));});
+#elif defined(__AVX2__) && defined(__FMA__)
+	rb_simd_batch<8>(y, x, count, [](const float *in, float *out)
+		{_mm256_storeu_ps(out, rb2_3_root_avx2(_mm256_loadu_ps(in)));});
+#elif defined(__SSE4_1__)
+	rb_simd_batch<4>(y, x, count, [](const float *in, float *out)
+		{_mm_storeu_ps(out, rb2_3_root_sse41(_mm_loadu_ps(in)));});
+#else
+	for (size_t i = 0; i < count; ++i) x[i] = rb2_3_root(y[i]);
+#endif
+}
+
+#if defined(__SSE4_1__)
+inline __m128 rb2_safe_3_root_sse41(const __m128 y)
+{
+	const __m128i ordinary = _mm_add_epi32(_mm_castps_si128(y), _mm_set1_epi32((int32_t)0x7f800000u));
+	if (_mm_movemask_epi8(_mm_cmpgt_epi32(_mm_set1_epi32((int32_t)0xff000000u), ordinary)) == 0xffff) return rb2_3_root_sse41(y);
+	const __m128i u = _mm_castps_si128(y), sign = _mm_and_si128(u, _mm_set1_epi32((int32_t)0x80000000u));
+	const __m128 a = _mm_castsi128_ps(_mm_xor_si128(u, sign));
+	const __m128 tiny = _mm_cmpgt_ps(_mm_castsi128_ps(_mm_set1_epi32((int32_t)0x800000u)), a); // zero or denormal, scaled into normal range
+	const __m128 finite = _mm_and_ps(_mm_cmpgt_ps(a, _mm_setzero_ps()), _mm_cmpgt_ps(_mm_castsi128_ps(_mm_set1_epi32((int32_t)0x7f800000u)), a));
+	__m128 x = rb2_3_root_sse41(_mm_mul_ps(a, _mm_blendv_ps(_mm_set1_ps(1.0f), _mm_castsi128_ps(_mm_set1_epi32((int32_t)0x4b800000u)), tiny)));
+	x = _mm_mul_ps(x, _mm_blendv_ps(_mm_set1_ps(1.0f), _mm_castsi128_ps(_mm_set1_epi32((int32_t)0x3b800000u)), tiny));
+	x = _mm_blendv_ps(a, x, finite); // zero, infinity and NaN
+	x = _mm_castsi128_ps(_mm_or_si128(_mm_castps_si128(x), sign));
+	return x;
+}
+#endif
+
+#if defined(__AVX2__) && defined(__FMA__)
+inline __m256 rb2_safe_3_root_avx2(const __m256 y)
+{
+	const __m256i ordinary = _mm256_add_epi32(_mm256_castps_si256(y), _mm256_set1_epi32((int32_t)0x7f800000u));
+	if (_mm256_movemask_epi8(_mm256_cmpgt_epi32(_mm256_set1_epi32((int32_t)0xff000000u), ordinary)) == -1) return rb2_3_root_avx2(y);
+	const __m256i u = _mm256_castps_si256(y), sign = _mm256_and_si256(u, _mm256_set1_epi32((int32_t)0x80000000u));
+	const __m256 a = _mm256_castsi256_ps(_mm256_xor_si256(u, sign));
+	const __m256 tiny = _mm256_cmp_ps(_mm256_castsi256_ps(_mm256_set1_epi32((int32_t)0x800000u)), a, _CMP_GT_OQ); // zero or denormal, scaled into normal range
+	const __m256 finite = _mm256_and_ps(_mm256_cmp_ps(a, _mm256_setzero_ps(), _CMP_GT_OQ), _mm256_cmp_ps(_mm256_castsi256_ps(_mm256_set1_epi32((int32_t)0x7f800000u)), a, _CMP_GT_OQ));
+	__m256 x = rb2_3_root_avx2(_mm256_mul_ps(a, _mm256_blendv_ps(_mm256_set1_ps(1.0f), _mm256_castsi256_ps(_mm256_set1_epi32((int32_t)0x4b800000u)), tiny)));
+	x = _mm256_mul_ps(x, _mm256_blendv_ps(_mm256_set1_ps(1.0f), _mm256_castsi256_ps(_mm256_set1_epi32((int32_t)0x3b800000u)), tiny));
+	x = _mm256_blendv_ps(a, x, finite); // zero, infinity and NaN
+	x = _mm256_castsi256_ps(_mm256_or_si256(_mm256_castps_si256(x), sign));
+	return x;
+}
+#endif
+
+#if defined(__AVX512F__)
+RB_AVX512_BEGIN
+inline __m512 rb2_safe_3_root_avx512(const __m512 y)
+{
+	const __m512i ordinary = _mm512_add_epi32(_mm512_castps_si512(y), _mm512_set1_epi32((int32_t)0x7f800000u));
+	if (_mm512_cmplt_epi32_mask(ordinary, _mm512_set1_epi32((int32_t)0xff000000u)) == (__mmask16)0xffff) return rb2_3_root_avx512(y);
+	const __m512i u = _mm512_castps_si512(y), sign = _mm512_and_si512(u, _mm512_set1_epi32((int32_t)0x80000000u));
+	const __m512 a = _mm512_castsi512_ps(_mm512_xor_si512(u, sign));
+	const __mmask16 tiny = _mm512_cmp_ps_mask(_mm512_castsi512_ps(_mm512_set1_epi32((int32_t)0x800000u)), a, _CMP_GT_OQ); // zero or denormal, scaled into normal range
+	const __mmask16 finite = (__mmask16)(_mm512_cmp_ps_mask(a, _mm512_setzero_ps(), _CMP_GT_OQ) & _mm512_cmp_ps_mask(_mm512_castsi512_ps(_mm512_set1_epi32((int32_t)0x7f800000u)), a, _CMP_GT_OQ));
+	__m512 x = rb2_3_root_avx512(_mm512_mul_ps(a, _mm512_mask_blend_ps(tiny, _mm512_set1_ps(1.0f), _mm512_castsi512_ps(_mm512_set1_epi32((int32_t)0x4b800000u)))));
+	x = _mm512_mul_ps(x, _mm512_mask_blend_ps(tiny, _mm512_set1_ps(1.0f), _mm512_castsi512_ps(_mm512_set1_epi32((int32_t)0x3b800000u))));
+	x = _mm512_mask_blend_ps(finite, a, x); // zero, infinity and NaN
+	x = _mm512_castsi512_ps(_mm512_or_si512(_mm512_castps_si512(x), sign));
+	return x;
+}
+RB_AVX512_END
+#endif
+
+inline void rb2_safe_3_root_batch(const float *y, float *x, const size_t count)
+{
+#if defined(__AVX512F__)
+	rb_simd_batch<16>(y, x, count, [](const float *in, float *out)
+		{_mm512_storeu_ps(out, rb2_safe_3_root_avx512(_mm512_loadu_ps(in)));});
+#elif defined(__AVX2__) && defined(__FMA__)
+	rb_simd_batch<8>(y, x, count, [](const float *in, float *out)
+		{_mm256_storeu_ps(out, rb2_safe_3_root_avx2(_mm256_loadu_ps(in)));});
+#elif defined(__SSE4_1__)
+	rb_simd_batch<4>(y, x, count, [](const float *in, float *out)
+		{_mm_storeu_ps(out, rb2_safe_3_root_sse41(_mm_loadu_ps(in)));});
+#else
+	for (size_t i = 0; i < count; ++i) x[i] = rb2_safe_3_root(y[i]);
+#endif
+}
+
+#if defined(__SSE4_1__)
+inline __m128 rb2_inv_3_root_sse41(const __m128 y)
+{
+	__m128i i = _mm_castps_si128(y); // interpret float as integer
+	__m128i q = rb_mulhi_epi32_sse41(i, _mm_set1_epi32((int32_t)0x55555556u));
+	q = _mm_sub_epi32(q, _mm_srai_epi32(i, 31)); // i / 3, rounding toward zero
+	i = _mm_sub_epi32(_mm_set1_epi32(0x54a1b99d), q); // log-approximation hack
+	__m128 x = _mm_castsi128_ps(i);
+	x = _mm_mul_ps(x, _mm_add_ps(_mm_mul_ps(_mm_mul_ps(_mm_set1_ps(-0.334677f), y), _mm_mul_ps(_mm_mul_ps(x, x), x)), _mm_set1_ps(1.334677f))); // newtonian step #1
+	x = _mm_mul_ps(x, _mm_add_ps(_mm_mul_ps(_mm_mul_ps(_mm_set1_ps(-0.334677f), y), _mm_mul_ps(_mm_mul_ps(x, x), x)), _mm_set1_ps(1.334677f))); // newtonian step #2
+	return x;
+}
+#endif
+
+#if defined(__AVX2__) && defined(__FMA__)
+inline __m256 rb2_inv_3_root_avx2(const __m256 y)
+{
+	__m256i i = _mm256_castps_si256(y); // interpret float as integer
+	__m256i q = rb_mulhi_epi32_avx2(i, _mm256_set1_epi32((int32_t)0x55555556u));
+	q = _mm256_sub_epi32(q, _mm256_srai_epi32(i, 31)); // i / 3, rounding toward zero
+	i = _mm256_sub_epi32(_mm256_set1_epi32(0x54a1b99d), q); // log-approximation hack
+	__m256 x = _mm256_castsi256_ps(i);
+	x = _mm256_mul_ps(x, _mm256_fmadd_ps(_mm256_mul_ps(_mm256_set1_ps(-0.334677f), y), _mm256_mul_ps(_mm256_mul_ps(x, x), x), _mm256_set1_ps(1.334677f))); // newtonian step #1
+	x = _mm256_mul_ps(x, _mm256_fmadd_ps(_mm256_mul_ps(_mm256_set1_ps(-0.334677f), y), _mm256_mul_ps(_mm256_mul_ps(x, x), x), _mm256_set1_ps(1.334677f))); // newtonian step #2
+	return x;
+}
+#endif
+
+#if defined(__AVX512F__)
+RB_AVX512_BEGIN
+inline __m512 rb2_inv_3_root_avx512(const __m512 y)
+{
+	__m512i i = _mm512_castps_si512(y); // interpret float as integer
+	__m512i q = rb_mulhi_epi32_avx512(i, _mm512_set1_epi32((int32_t)0x55555556u));
+	q = _mm512_sub_epi32(q, _mm512_srai_epi32(i, 31)); // i / 3, rounding toward zero
+	i = _mm512_sub_epi32(_mm512_set1_epi32(0x54a1b99d), q); // log-approximation hack
+	__m512 x = _mm512_castsi512_ps(i);
+	x = _mm512_mul_ps(x, _mm512_fmadd_ps(_mm512_mul_ps(_mm512_set1_ps(-0.334677f), y), _mm512_mul_ps(_mm512_mul_ps(x, x), x), _mm512_set1_ps(1.334677f))); // newtonian step #1
+	x = _mm512_mul_ps(x, _mm512_fmadd_ps(_mm512_mul_ps(_mm512_set1_ps(-0.334677f), y), _mm512_mul_ps(_mm512_mul_ps(x, x), x), _mm512_set1_ps(1.334677f))); // newtonian step #2
+	return x;
+}
+RB_AVX512_END
+#endif
+
+inline void rb2_inv_3_root_batch(const float *y, float *x, const size_t count)
+{
+#if defined(__AVX512F__)
+	rb_simd_batch<16>(y, x, count, [](const float *in, float *out)
+		{_mm512_storeu_ps(out, rb2_inv_3_root_avx512(_mm512_loadu_ps(in)));});
+#elif defined(__AVX2__) && defined(__FMA__)
+	rb_simd_batch<8>(y, x, count, [](const float *in, float *out)
+		{_mm256_storeu_ps(out, rb2_inv_3_root_avx2(_mm256_loadu_ps(in)));});
+#elif defined(__SSE4_1__)
+	rb_simd_batch<4>(y, x, count, [](const float *in, float *out)
+		{_mm_storeu_ps(out, rb2_inv_3_root_sse41(_mm_loadu_ps(in)));});
+#else
+	for (size_t i = 0; i < count; ++i) x[i] = rb2_inv_3_root(y[i]);
+#endif
+}
+
+#if defined(__SSE4_1__)
+inline __m128 rb2_safe_inv_3_root_sse41(const __m128 y)
+{
+	const __m128i ordinary = _mm_add_epi32(_mm_castps_si128(y), _mm_set1_epi32((int32_t)0x7f800000u));
+	if (_mm_movemask_epi8(_mm_cmpgt_epi32(_mm_set1_epi32((int32_t)0xff000000u), ordinary)) == 0xffff) return rb2_inv_3_root_sse41(y);
+	const __m128i u = _mm_castps_si128(y), sign = _mm_and_si128(u, _mm_set1_epi32((int32_t)0x80000000u));
+	const __m128 a = _mm_castsi128_ps(_mm_xor_si128(u, sign));
+	const __m128 tiny = _mm_cmpgt_ps(_mm_castsi128_ps(_mm_set1_epi32((int32_t)0x800000u)), a); // zero or denormal, scaled into normal range
+	const __m128 finite = _mm_and_ps(_mm_cmpgt_ps(a, _mm_setzero_ps()), _mm_cmpgt_ps(_mm_castsi128_ps(_mm_set1_epi32((int32_t)0x7f800000u)), a));
+	const __m128 number = _mm_cmpgt_ps(a, _mm_set1_ps(-1.0f)); // all but NaN, which keeps its bits
+	__m128 x = rb2_inv_3_root_sse41(_mm_mul_ps(a, _mm_blendv_ps(_mm_set1_ps(1.0f), _mm_castsi128_ps(_mm_set1_epi32((int32_t)0x4b800000u)), tiny)));
+	x = _mm_mul_ps(x, _mm_blendv_ps(_mm_set1_ps(1.0f), _mm_castsi128_ps(_mm_set1_epi32((int32_t)0x43800000u)), tiny));
+	x = _mm_blendv_ps(_mm_blendv_ps(a, _mm_castsi128_ps(_mm_sub_epi32(_mm_set1_epi32((int32_t)0x7f800000u), _mm_castps_si128(a))), number), x, finite); // zero, infinity and NaN
+	x = _mm_castsi128_ps(_mm_or_si128(_mm_castps_si128(x), sign));
+	return x;
+}
+#endif
+
+#if defined(__AVX2__) && defined(__FMA__)
+inline __m256 rb2_safe_inv_3_root_avx2(const __m256 y)
+{
+	const __m256i ordinary = _mm256_add_epi32(_mm256_castps_si256(y), _mm256_set1_epi32((int32_t)0x7f800000u));
+	if (_mm256_movemask_epi8(_mm256_cmpgt_epi32(_mm256_set1_epi32((int32_t)0xff000000u), ordinary)) == -1) return rb2_inv_3_root_avx2(y);
+	const __m256i u = _mm256_castps_si256(y), sign = _mm256_and_si256(u, _mm256_set1_epi32((int32_t)0x80000000u));
+	const __m256 a = _mm256_castsi256_ps(_mm256_xor_si256(u, sign));
+	const __m256 tiny = _mm256_cmp_ps(_mm256_castsi256_ps(_mm256_set1_epi32((int32_t)0x800000u)), a, _CMP_GT_OQ); // zero or denormal, scaled into normal range
+	const __m256 finite = _mm256_and_ps(_mm256_cmp_ps(a, _mm256_setzero_ps(), _CMP_GT_OQ), _mm256_cmp_ps(_mm256_castsi256_ps(_mm256_set1_epi32((int32_t)0x7f800000u)), a, _CMP_GT_OQ));
+	const __m256 number = _mm256_cmp_ps(a, _mm256_set1_ps(-1.0f), _CMP_GT_OQ); // all but NaN, which keeps its bits
+	__m256 x = rb2_inv_3_root_avx2(_mm256_mul_ps(a, _mm256_blendv_ps(_mm256_set1_ps(1.0f), _mm256_castsi256_ps(_mm256_set1_epi32((int32_t)0x4b800000u)), tiny)));
+	x = _mm256_mul_ps(x, _mm256_blendv_ps(_mm256_set1_ps(1.0f), _mm256_castsi256_ps(_mm256_set1_epi32((int32_t)0x43800000u)), tiny));
+	x = _mm256_blendv_ps(_mm256_blendv_ps(a, _mm256_castsi256_ps(_mm256_sub_epi32(_mm256_set1_epi32((int32_t)0x7f800000u), _mm256_castps_si256(a))), number), x, finite); // zero, infinity and NaN
+	x = _mm256_castsi256_ps(_mm256_or_si256(_mm256_castps_si256(x), sign));
+	return x;
+}
+#endif
+
+#if defined(__AVX512F__)
+RB_AVX512_BEGIN
+inline __m512 rb2_safe_inv_3_root_avx512(const __m512 y)
+{
+	const __m512i ordinary = _mm512_add_epi32(_mm512_castps_si512(y), _mm512_set1_epi32((int32_t)0x7f800000u));
+	if (_mm512_cmplt_epi32_mask(ordinary, _mm512_set1_epi32((int32_t)0xff000000u)) == (__mmask16)0xffff) return rb2_inv_3_root_avx512(y);
+	const __m512i u = _mm512_castps_si512(y), sign = _mm512_and_si512(u, _mm512_set1_epi32((int32_t)0x80000000u));
+	const __m512 a = _mm512_castsi512_ps(_mm512_xor_si512(u, sign));
+	const __mmask16 tiny = _mm512_cmp_ps_mask(_mm512_castsi512_ps(_mm512_set1_epi32((int32_t)0x800000u)), a, _CMP_GT_OQ); // zero or denormal, scaled into normal range
+	const __mmask16 finite = (__mmask16)(_mm512_cmp_ps_mask(a, _mm512_setzero_ps(), _CMP_GT_OQ) & _mm512_cmp_ps_mask(_mm512_castsi512_ps(_mm512_set1_epi32((int32_t)0x7f800000u)), a, _CMP_GT_OQ));
+	const __mmask16 number = _mm512_cmp_ps_mask(a, _mm512_set1_ps(-1.0f), _CMP_GT_OQ); // all but NaN, which keeps its bits
+	__m512 x = rb2_inv_3_root_avx512(_mm512_mul_ps(a, _mm512_mask_blend_ps(tiny, _mm512_set1_ps(1.0f), _mm512_castsi512_ps(_mm512_set1_epi32((int32_t)0x4b800000u)))));
+	x = _mm512_mul_ps(x, _mm512_mask_blend_ps(tiny, _mm512_set1_ps(1.0f), _mm512_castsi512_ps(_mm512_set1_epi32((int32_t)0x43800000u))));
+	x = _mm512_mask_blend_ps(finite, _mm512_mask_blend_ps(number, a, _mm512_castsi512_ps(_mm512_sub_epi32(_mm512_set1_epi32((int32_t)0x7f800000u), _mm512_castps_si512(a)))), x); // zero, infinity and NaN
+	x = _mm512_castsi512_ps(_mm512_or_si512(_mm512_castps_si512(x), sign));
+	return x;
+}
+RB_AVX512_END
+#endif
+
+inline void rb2_safe_inv_3_root_batch(const float *y, float *x, const size_t count)
+{
+#if defined(__AVX512F__)
+	rb_simd_batch<16>(y, x, count, [](const float *in, float *out)
+		{_mm512_storeu_ps(out, rb2_safe_inv_3_root_avx512(_mm512_loadu_ps(in)));});
+#elif defined(__AVX2__) && defined(__FMA__)
+	rb_simd_batch<8>(y, x, count, [](const float *in, float *out)
+		{_mm256_storeu_ps(out, rb2_safe_inv_3_root_avx2(_mm256_loadu_ps(in)));});
+#elif defined(__SSE4_1__)
+	rb_simd_batch<4>(y, x, count, [](const float *in, float *out)
+		{_mm_storeu_ps(out, rb2_safe_inv_3_root_sse41(_mm_loadu_ps(in)));});
+#else
+	for (size_t i = 0; i < count; ++i) x[i] = rb2_safe_inv_3_root(y[i]);
+#endif
+}
+
+#if defined(__SSE4_1__)
+inline __m128 rb2_4_root_sse41(const __m128 y)
+{
+	__m128i i = _mm_castps_si128(y); // interpret float as integer
+	__m128i q = _mm_srai_epi32(_mm_add_epi32(i, _mm_srli_epi32(_mm_srai_epi32(i, 31), 30)), 2); // i / 4, rounding toward zero
+	i = _mm_add_epi32(_mm_set1_epi32(0x2f9b8068), q); // log-approximation hack
+	__m128 x = _mm_castsi128_ps(i);
+	x = _mm_add_ps(_mm_mul_ps(x, _mm_set1_ps(0.749466f)), _mm_div_ps(_mm_mul_ps(_mm_set1_ps(0.250534f), y), _mm_mul_ps(_mm_mul_ps(x, x), x))); // newtonian step #1
+	x = _mm_add_ps(_mm_mul_ps(x, _mm_set1_ps(0.749466f)), _mm_div_ps(_mm_mul_ps(_mm_set1_ps(0.250534f), y), _mm_mul_ps(_mm_mul_ps(x, x), x))); // newtonian step #2
+	return x;
+}
+#endif
+
+#if defined(__AVX2__) && defined(__FMA__)
+inline __m256 rb2_4_root_avx2(const __m256 y)
+{
+	__m256i i = _mm256_castps_si256(y); // interpret float as integer
+	__m256i q = _mm256_srai_epi32(_mm256_add_epi32(i, _mm256_srli_epi32(_mm256_srai_epi32(i, 31), 30)), 2); // i / 4, rounding toward zero
+	i = _mm256_add_epi32(_mm256_set1_epi32(0x2f9b8068), q); // log-approximation hack
+	__m256 x = _mm256_castsi256_ps(i);
+	x = _mm256_fmadd_ps(x, _mm256_set1_ps(0.749466f), _mm256_div_ps(_mm256_mul_ps(_mm256_set1_ps(0.250534f), y), _mm256_mul_ps(_mm256_mul_ps(x, x), x))); // newtonian step #1
+	x = _mm256_fmadd_ps(x, _mm256_set1_ps(0.749466f), _mm256_div_ps(_mm256_mul_ps(_mm256_set1_ps(0.250534f), y), _mm256_mul_ps(_mm256_mul_ps(x, x), x))); // newtonian step #2
+	return x;
+}
+#endif
+
+#if defined(__AVX512F__)
+RB_AVX512_BEGIN
+inline __m512 rb2_4_root_avx512(const __m512 y)
+{
+	__m512i i = _mm512_castps_si512(y); // interpret float as integer
+	__m512i q = _mm512_srai_epi32(_mm512_add_epi32(i, _mm512_srli_epi32(_mm512_srai_epi32(i, 31), 30)), 2); // i / 4, rounding toward zero
+	i = _mm512_add_epi32(_mm512_set1_epi32(0x2f9b8068), q); // log-approximation hack
+	__m512 x = _mm512_castsi512_ps(i);
+	x = _mm512_fmadd_ps(x, _mm512_set1_ps(0.749466f), _mm512_div_ps(_mm512_mul_ps(_mm512_set1_ps(0.250534f), y), _mm512_mul_ps(_mm512_mul_ps(x, x), x))); // newtonian step #1
+	x = _mm512_fmadd_ps(x, _mm512_set1_ps(0.749466f), _mm512_div_ps(_mm512_mul_ps(_mm512_set1_ps(0.250534f), y), _mm512_mul_ps(_mm512_mul_ps(x, x), x))); // newtonian step #2
+	return x;
+}
+RB_AVX512_END
+#endif
+
+inline void rb2_4_root_batch(const float *y, float *x, const size_t count)
+{
+#if defined(__AVX512F__)
+	rb_simd_batch<16>(y, x, count, [](const float *in, float *out)
+		{_mm512_storeu_ps(out, rb2_4_root_avx512(_mm512_loadu_ps(in)));});
+#elif defined(__AVX2__) && defined(__FMA__)
+	rb_simd_batch<8>(y, x, count, [](const float *in, float *out)
+		{_mm256_storeu_ps(out, rb2_4_root_avx2(_mm256_loadu_ps(in)));});
+#elif defined(__SSE4_1__)
+	rb_simd_batch<4>(y, x, count, [](const float *in, float *out)
+		{_mm_storeu_ps(out, rb2_4_root_sse41(_mm_loadu_ps(in)));});
+#else
+	for (size_t i = 0; i < count; ++i) x[i] = rb2_4_root(y[i]);
+#endif
+}
+
+#if defined(__SSE4_1__)
+inline __m128 rb2_safe_4_root_sse41(const __m128 y)
+{
+	const __m128i ordinary = _mm_add_epi32(_mm_castps_si128(y), _mm_set1_epi32((int32_t)0x7f800000u));
+	if (_mm_movemask_epi8(_mm_cmpgt_epi32(_mm_set1_epi32((int32_t)0xff000000u), ordinary)) == 0xffff) return rb2_4_root_sse41(y);
+	const __m128i u = _mm_castps_si128(y), sign = _mm_and_si128(u, _mm_set1_epi32((int32_t)0x80000000u));
+	const __m128 a = _mm_castsi128_ps(_mm_xor_si128(u, sign));
+	const __m128 tiny = _mm_cmpgt_ps(_mm_castsi128_ps(_mm_set1_epi32((int32_t)0x800000u)), a); // zero or denormal, scaled into normal range
+	const __m128 finite = _mm_and_ps(_mm_cmpgt_ps(a, _mm_setzero_ps()), _mm_cmpgt_ps(_mm_castsi128_ps(_mm_set1_epi32((int32_t)0x7f800000u)), a));
+	__m128 x = rb2_4_root_sse41(_mm_mul_ps(a, _mm_blendv_ps(_mm_set1_ps(1.0f), _mm_castsi128_ps(_mm_set1_epi32((int32_t)0x4b800000u)), tiny)));
+	x = _mm_mul_ps(x, _mm_blendv_ps(_mm_set1_ps(1.0f), _mm_castsi128_ps(_mm_set1_epi32((int32_t)0x3c800000u)), tiny));
+	x = _mm_blendv_ps(a, x, finite); // zero, infinity and NaN
+	x = _mm_castsi128_ps(_mm_or_si128(_mm_castps_si128(x), sign));
+	x = _mm_blendv_ps(x, _mm_castsi128_ps(_mm_set1_epi32((int32_t)0x7fc00000u)), _mm_cmpgt_ps(_mm_setzero_ps(), y)); // even root of a negative
+	return x;
+}
+#endif
+
+#if defined(__AVX2__) && defined(__FMA__)
+inline __m256 rb2_safe_4_root_avx2(const __m256 y)
+{
+	const __m256i ordinary = _mm256_add_epi32(_mm256_castps_si256(y), _mm256_set1_epi32((int32_t)0x7f800000u));
+	if (_mm256_movemask_epi8(_mm256_cmpgt_epi32(_mm256_set1_epi32((int32_t)0xff000000u), ordinary)) == -1) return rb2_4_root_avx2(y);
+	const __m256i u = _mm256_castps_si256(y), sign = _mm256_and_si256(u, _mm256_set1_epi32((int32_t)0x80000000u));
+	const __m256 a = _mm256_castsi256_ps(_mm256_xor_si256(u, sign));
+	const __m256 tiny = _mm256_cmp_ps(_mm256_castsi256_ps(_mm256_set1_epi32((int32_t)0x800000u)), a, _CMP_GT_OQ); // zero or denormal, scaled into normal range
+	const __m256 finite = _mm256_and_ps(_mm256_cmp_ps(a, _mm256_setzero_ps(), _CMP_GT_OQ), _mm256_cmp_ps(_mm256_castsi256_ps(_mm256_set1_epi32((int32_t)0x7f800000u)), a, _CMP_GT_OQ));
+	__m256 x = rb2_4_root_avx2(_mm256_mul_ps(a, _mm256_blendv_ps(_mm256_set1_ps(1.0f), _mm256_castsi256_ps(_mm256_set1_epi32((int32_t)0x4b800000u)), tiny)));
+	x = _mm256_mul_ps(x, _mm256_blendv_ps(_mm256_set1_ps(1.0f), _mm256_castsi256_ps(_mm256_set1_epi32((int32_t)0x3c800000u)), tiny));
+	x = _mm256_blendv_ps(a, x, finite); // zero, infinity and NaN
+	x = _mm256_castsi256_ps(_mm256_or_si256(_mm256_castps_si256(x), sign));
+	x = _mm256_blendv_ps(x, _mm256_castsi256_ps(_mm256_set1_epi32((int32_t)0x7fc00000u)), _mm256_cmp_ps(_mm256_setzero_ps(), y, _CMP_GT_OQ)); // even root of a negative
+	return x;
+}
+#endif
+
+#if defined(__AVX512F__)
+RB_AVX512_BEGIN
+inline __m512 rb2_safe_4_root_avx512(const __m512 y)
+{
+	const __m512i ordinary = _mm512_add_epi32(_mm512_castps_si512(y), _mm512_set1_epi32((int32_t)0x7f800000u));
+	if (_mm512_cmplt_epi32_mask(ordinary, _mm512_set1_epi32((int32_t)0xff000000u)) == (__mmask16)0xffff) return rb2_4_root_avx512(y);
+	const __m512i u = _mm512_castps_si512(y), sign = _mm512_and_si512(u, _mm512_set1_epi32((int32_t)0x80000000u));
+	const __m512 a = _mm512_castsi512_ps(_mm512_xor_si512(u, sign));
+	const __mmask16 tiny = _mm512_cmp_ps_mask(_mm512_castsi512_ps(_mm512_set1_epi32((int32_t)0x800000u)), a, _CMP_GT_OQ); // zero or denormal, scaled into normal range
+	const __mmask16 finite = (__mmask16)(_mm512_cmp_ps_mask(a, _mm512_setzero_ps(), _CMP_GT_OQ) & _mm512_cmp_ps_mask(_mm512_castsi512_ps(_mm512_set1_epi32((int32_t)0x7f800000u)), a, _CMP_GT_OQ));
+	__m512 x = rb2_4_root_avx512(_mm512_mul_ps(a, _mm512_mask_blend_ps(tiny, _mm512_set1_ps(1.0f), _mm512_castsi512_ps(_mm512_set1_epi32((int32_t)0x4b800000u)))));
+	x = _mm512_mul_ps(x, _mm512_mask_blend_ps(tiny, _mm512_set1_ps(1.0f), _mm512_castsi512_ps(_mm512_set1_epi32((int32_t)0x3c800000u))));
+	x = _mm512_mask_blend_ps(finite, a, x); // zero, infinity and NaN
+	x = _mm512_castsi512_ps(_mm512_or_si512(_mm512_castps_si512(x), sign));
+	x = _mm512_mask_blend_ps(_mm512_cmp_ps_mask(_mm512_setzero_ps(), y, _CMP_GT_OQ), x, _mm512_castsi512_ps(_mm512_set1_epi32((int32_t)0x7fc00000u))); // even root of a negative
+	return x;
+}
+RB_AVX512_END
+#endif
+
+inline void rb2_safe_4_root_batch(const float *y, float *x, const size_t count)
+{
+#if defined(__AVX512F__)
+	rb_simd_batch<16>(y, x, count, [](const float *in, float *out)
+		{_mm512_storeu_ps(out, rb2_safe_4_root_avx512(_mm512_loadu_ps(in)));});
+#elif defined(__AVX2__) && defined(__FMA__)
+	rb_simd_batch<8>(y, x, count, [](const float *in, float *out)
+		{_mm256_storeu_ps(out, rb2_safe_4_root_avx2(_mm256_loadu_ps(in)));});
+#elif defined(__SSE4_1__)
+	rb_simd_batch<4>(y, x, count, [](const float *in, float *out)
+		{_mm_storeu_ps(out, rb2_safe_4_root_sse41(_mm_loadu_ps(in)));});
+#else
+	for (size_t i = 0; i < count; ++i) x[i] = rb2_safe_4_root(y[i]);
+#endif
+}
+
+#if defined(__SSE4_1__)
+inline __m128 rb2_inv_4_root_sse41(const __m128 y)
+{
+	__m128i i = _mm_castps_si128(y); // interpret float as integer
+	__m128i q = _mm_srai_epi32(_mm_add_epi32(i, _mm_srli_epi32(_mm_srai_epi32(i, 31), 30)), 2); // i / 4, rounding toward zero
+	i = _mm_sub_epi32(_mm_set1_epi32(0x4f58020d), q); // log-approximation hack
+	__m128 x = _mm_castsi128_ps(i);
+	x = _mm_mul_ps(x, _mm_add_ps(_mm_mul_ps(_mm_mul_ps(_mm_set1_ps(-0.251282f), y), _mm_mul_ps(_mm_mul_ps(x, x), _mm_mul_ps(x, x))), _mm_set1_ps(1.251282f))); // newtonian step #1
+	x = _mm_mul_ps(x, _mm_add_ps(_mm_mul_ps(_mm_mul_ps(_mm_set1_ps(-0.251282f), y), _mm_mul_ps(_mm_mul_ps(x, x), _mm_mul_ps(x, x))), _mm_set1_ps(1.251282f))); // newtonian step #2
+	return x;
+}
+#endif
+
+#if defined(__AVX2__) && defined(__FMA__)
+inline __m256 rb2_inv_4_root_avx2(const __m256 y)
+{
+	__m256i i = _mm256_castps_si256(y); // interpret float as integer
+	__m256i q = _mm256_srai_epi32(_mm256_add_epi32(i, _mm256_srli_epi32(_mm256_srai_epi32(i, 31), 30)), 2); // i / 4, rounding toward zero
+	i = _mm256_sub_epi32(_mm256_set1_epi32(0x4f58020d), q); // log-approximation hack
+	__m256 x = _mm256_castsi256_ps(i);
+	x = _mm256_mul_ps(x, _mm256_fmadd_ps(_mm256_mul_ps(_mm256_set1_ps(-0.251282f), y), _mm256_mul_ps(_mm256_mul_ps(x, x), _mm256_mul_ps(x, x)), _mm256_set1_ps(1.251282f))); // newtonian step #1
+	x = _mm256_mul_ps(x, _mm256_fmadd_ps(_mm256_mul_ps(_mm256_set1_ps(-0.251282f), y), _mm256_mul_ps(_mm256_mul_ps(x, x), _mm256_mul_ps(x, x)), _mm256_set1_ps(1.251282f))); // newtonian step #2
+	return x;
+}
+#endif
+
+#if defined(__AVX512F__)
+RB_AVX512_BEGIN
+inline __m512 rb2_inv_4_root_avx512(const __m512 y)
+{
+	__m512i i = _mm512_castps_si512(y); // interpret float as integer
+	__m512i q = _mm512_srai_epi32(_mm512_add_epi32(i, _mm512_srli_epi32(_mm512_srai_epi32(i, 31), 30)), 2); // i / 4, rounding toward zero
+	i = _mm512_sub_epi32(_mm512_set1_epi32(0x4f58020d), q); // log-approximation hack
+	__m512 x = _mm512_castsi512_ps(i);
+	x = _mm512_mul_ps(x, _mm512_fmadd_ps(_mm512_mul_ps(_mm512_set1_ps(-0.251282f), y), _mm512_mul_ps(_mm512_mul_ps(x, x), _mm512_mul_ps(x, x)), _mm512_set1_ps(1.251282f))); // newtonian step #1
+	x = _mm512_mul_ps(x, _mm512_fmadd_ps(_mm512_mul_ps(_mm512_set1_ps(-0.251282f), y), _mm512_mul_ps(_mm512_mul_ps(x, x), _mm512_mul_ps(x, x)), _mm512_set1_ps(1.251282f))); // newtonian step #2
+	return x;
+}
+RB_AVX512_END
+#endif
+
+inline void rb2_inv_4_root_batch(const float *y, float *x, const size_t count)
+{
+#if defined(__AVX512F__)
+	rb_simd_batch<16>(y, x, count, [](const float *in, float *out)
+		{_mm512_storeu_ps(out, rb2_inv_4_root_avx512(_mm512_loadu_ps(in)));});
+#elif defined(__AVX2__) && defined(__FMA__)
+	rb_simd_batch<8>(y, x, count, [](const float *in, float *out)
+		{_mm256_storeu_ps(out, rb2_inv_4_root_avx2(_mm256_loadu_ps(in)));});
+#elif defined(__SSE4_1__)
+	rb_simd_batch<4>(y, x, count, [](const float *in, float *out)
+		{_mm_storeu_ps(out, rb2_inv_4_root_sse41(_mm_loadu_ps(in)));});
+#else
+	for (size_t i = 0; i < count; ++i) x[i] = rb2_inv_4_root(y[i]);
+#endif
+}
+
+#if defined(__SSE4_1__)
+inline __m128 rb2_safe_inv_4_root_sse41(const __m128 y)
+{
+	const __m128i ordinary = _mm_add_epi32(_mm_castps_si128(y), _mm_set1_epi32((int32_t)0x7f800000u));
+	if (_mm_movemask_epi8(_mm_cmpgt_epi32(_mm_set1_epi32((int32_t)0xff000000u), ordinary)) == 0xffff) return rb2_inv_4_root_sse41(y);
+	const __m128i u = _mm_castps_si128(y), sign = _mm_and_si128(u, _mm_set1_epi32((int32_t)0x80000000u));
+	const __m128 a = _mm_castsi128_ps(_mm_xor_si128(u, sign));
+	const __m128 tiny = _mm_cmpgt_ps(_mm_castsi128_ps(_mm_set1_epi32((int32_t)0x800000u)), a); // zero or denormal, scaled into normal range
+	const __m128 finite = _mm_and_ps(_mm_cmpgt_ps(a, _mm_setzero_ps()), _mm_cmpgt_ps(_mm_castsi128_ps(_mm_set1_epi32((int32_t)0x7f800000u)), a));
+	const __m128 number = _mm_cmpgt_ps(a, _mm_set1_ps(-1.0f)); // all but NaN, which keeps its bits
+	__m128 x = rb2_inv_4_root_sse41(_mm_mul_ps(a, _mm_blendv_ps(_mm_set1_ps(1.0f), _mm_castsi128_ps(_mm_set1_epi32((int32_t)0x4b800000u)), tiny)));
+	x = _mm_mul_ps(x, _mm_blendv_ps(_mm_set1_ps(1.0f), _mm_castsi128_ps(_mm_set1_epi32((int32_t)0x42800000u)), tiny));
+	x = _mm_blendv_ps(_mm_blendv_ps(a, _mm_castsi128_ps(_mm_sub_epi32(_mm_set1_epi32((int32_t)0x7f800000u), _mm_castps_si128(a))), number), x, finite); // zero, infinity and NaN
+	x = _mm_castsi128_ps(_mm_or_si128(_mm_castps_si128(x), sign));
+	x = _mm_blendv_ps(x, _mm_castsi128_ps(_mm_set1_epi32((int32_t)0x7fc00000u)), _mm_cmpgt_ps(_mm_setzero_ps(), y)); // even root of a negative
+	return x;
+}
+#endif
+
+#if defined(__AVX2__) && defined(__FMA__)
+inline __m256 rb2_safe_inv_4_root_avx2(const __m256 y)
+{
+	const __m256i ordinary = _mm256_add_epi32(_mm256_castps_si256(y), _mm256_set1_epi32((int32_t)0x7f800000u));
+	if (_mm256_movemask_epi8(_mm256_cmpgt_epi32(_mm256_set1_epi32((int32_t)0xff000000u), ordinary)) == -1) return rb2_inv_4_root_avx2(y);
+	const __m256i u = _mm256_castps_si256(y), sign = _mm256_and_si256(u, _mm256_set1_epi32((int32_t)0x80000000u));
+	const __m256 a = _mm256_castsi256_ps(_mm256_xor_si256(u, sign));
+	const __m256 tiny = _mm256_cmp_ps(_mm256_castsi256_ps(_mm256_set1_epi32((int32_t)0x800000u)), a, _CMP_GT_OQ); // zero or denormal, scaled into normal range
+	const __m256 finite = _mm256_and_ps(_mm256_cmp_ps(a, _mm256_setzero_ps(), _CMP_GT_OQ), _mm256_cmp_ps(_mm256_castsi256_ps(_mm256_set1_epi32((int32_t)0x7f800000u)), a, _CMP_GT_OQ));
+	const __m256 number = _mm256_cmp_ps(a, _mm256_set1_ps(-1.0f), _CMP_GT_OQ); // all but NaN, which keeps its bits
+	__m256 x = rb2_inv_4_root_avx2(_mm256_mul_ps(a, _mm256_blendv_ps(_mm256_set1_ps(1.0f), _mm256_castsi256_ps(_mm256_set1_epi32((int32_t)0x4b800000u)), tiny)));
+	x = _mm256_mul_ps(x, _mm256_blendv_ps(_mm256_set1_ps(1.0f), _mm256_castsi256_ps(_mm256_set1_epi32((int32_t)0x42800000u)), tiny));
+	x = _mm256_blendv_ps(_mm256_blendv_ps(a, _mm256_castsi256_ps(_mm256_sub_epi32(_mm256_set1_epi32((int32_t)0x7f800000u), _mm256_castps_si256(a))), number), x, finite); // zero, infinity and NaN
+	x = _mm256_castsi256_ps(_mm256_or_si256(_mm256_castps_si256(x), sign));
+	x = _mm256_blendv_ps(x, _mm256_castsi256_ps(_mm256_set1_epi32((int32_t)0x7fc00000u)), _mm256_cmp_ps(_mm256_setzero_ps(), y, _CMP_GT_OQ)); // even root of a negative
+	return x;
+}
+#endif
+
+#if defined(__AVX512F__)
+RB_AVX512_BEGIN
+inline __m512 rb2_safe_inv_4_root_avx512(const __m512 y)
+{
+	const __m512i ordinary = _mm512_add_epi32(_mm512_castps_si512(y), _mm512_set1_epi32((int32_t)0x7f800000u));
+	if (_mm512_cmplt_epi32_mask(ordinary, _mm512_set1_epi32((int32_t)0xff000000u)) == (__mmask16)0xffff) return rb2_inv_4_root_avx512(y);
+	const __m512i u = _mm512_castps_si512(y), sign = _mm512_and_si512(u, _mm512_set1_epi32((int32_t)0x80000000u));
+	const __m512 a = _mm512_castsi512_ps(_mm512_xor_si512(u, sign));
+	const __mmask16 tiny = _mm512_cmp_ps_mask(_mm512_castsi512_ps(_mm512_set1_epi32((int32_t)0x800000u)), a, _CMP_GT_OQ); // zero or denormal, scaled into normal range
+	const __mmask16 finite = (__mmask16)(_mm512_cmp_ps_mask(a, _mm512_setzero_ps(), _CMP_GT_OQ) & _mm512_cmp_ps_mask(_mm512_castsi512_ps(_mm512_set1_epi32((int32_t)0x7f800000u)), a, _CMP_GT_OQ));
+	const __mmask16 number = _mm512_cmp_ps_mask(a, _mm512_set1_ps(-1.0f), _CMP_GT_OQ); // all but NaN, which keeps its bits
+	__m512 x = rb2_inv_4_root_avx512(_mm512_mul_ps(a, _mm512_mask_blend_ps(tiny, _mm512_set1_ps(1.0f), _mm512_castsi512_ps(_mm512_set1_epi32((int32_t)0x4b800000u)))));
+	x = _mm512_mul_ps(x, _mm512_mask_blend_ps(tiny, _mm512_set1_ps(1.0f), _mm512_castsi512_ps(_mm512_set1_epi32((int32_t)0x42800000u))));
+	x = _mm512_mask_blend_ps(finite, _mm512_mask_blend_ps(number, a, _mm512_castsi512_ps(_mm512_sub_epi32(_mm512_set1_epi32((int32_t)0x7f800000u), _mm512_castps_si512(a)))), x); // zero, infinity and NaN
+	x = _mm512_castsi512_ps(_mm512_or_si512(_mm512_castps_si512(x), sign));
+	x = _mm512_mask_blend_ps(_mm512_cmp_ps_mask(_mm512_setzero_ps(), y, _CMP_GT_OQ), x, _mm512_castsi512_ps(_mm512_set1_epi32((int32_t)0x7fc00000u))); // even root of a negative
+	return x;
+}
+RB_AVX512_END
+#endif
+
+inline void rb2_safe_inv_4_root_batch(const float *y, float *x, const size_t count)
+{
+#if defined(__AVX512F__)
+	rb_simd_batch<16>(y, x, count, [](const float *in, float *out)
+		{_mm512_storeu_ps(out, rb2_safe_inv_4_root_avx512(_mm512_loadu_ps(in)));});
+#elif defined(__AVX2__) && defined(__FMA__)
+	rb_simd_batch<8>(y, x, count, [](const float *in, float *out)
+		{_mm256_storeu_ps(out, rb2_safe_inv_4_root_avx2(_mm256_loadu_ps(in)));});
+#elif defined(__SSE4_1__)
+	rb_simd_batch<4>(y, x, count, [](const float *in, float *out)
+		{_mm_storeu_ps(out, rb2_safe_inv_4_root_sse41(_mm_loadu_ps(in)));});
+#else
+	for (size_t i = 0; i < count; ++i) x[i] = rb2_safe_inv_4_root(y[i]);
+#endif
+}
+
@@ -0,0 +1,178 @@
+#pragma once
+
+
+#include <cstdint>
+#include <cstring>
+#include <cmath>
+#include <ostream>
+
+
+/*
+	16-bit floating-point formats.
+
+	float16 is IEEE binary16: 5 exponent bits and 10 mantissa bits.  It is the
+	compiler's _Float16 where the hardware does binary16 arithmetic (AVX-512
+	FP16, or ARMv8.2 FP16), and is emulated otherwise.  Elsewhere compilers
+	evaluate _Float16 in float with excess precision, rounding only where a
+	value is stored, which would change every design's errors.
+	bfloat16 is the upper half of a float: 8 exponent bits and 7 mantissa bits.
+	It is always emulated.
+
+	Emulated arithmetic converts to float, operates and rounds back to nearest,
+	which gives the correctly rounded result of each operation: float carries
+	more than twice the precision of either format plus two bits, so rounding
+	twice never differs from rounding once.  Emulated and native float16 thus
+	agree bit for bit.
+
+	Both formats are for storage and for designs whose arithmetic is 16-bit;
+	the batch kernels widen them to float lanes (see root_cellar_batch.h).
+*/
+namespace rootbeer
+{
+	namespace detail
+	{
+		inline uint32_t float_bits(const float f)       {uint32_t u; std::memcpy(&u, &f, sizeof(u)); return u;}
+		inline float    bits_float(const uint32_t u)    {float f; std::memcpy(&f, &u, sizeof(f)); return f;}
+
+		/*
+			binary16 from float, rounding to nearest even like F16C's vcvtps2ph.
+			NaNs stay quiet NaNs with the top bits of their payload.
+		*/
+		inline uint16_t float_to_half_bits(const float f)
+		{
+			uint32_t x = float_bits(f);
+			const uint32_t sign = (x >> 16) & 0x8000u;
+			x &= 0x7FFFFFFFu;
+			if (x >= 0x7F800000u) return uint16_t(sign | 0x7C00u | ((x > 0x7F800000u) ? (0x200u | ((x >> 13) & 0x3FFu)) : 0u));
+			if (x >= 0x477FF000u) return uint16_t(sign | 0x7C00u);  // rounds to infinity
+			if (x < 0x38800000u)
+			{
+				// Subnormal: the mantissa in units of 2^-24, rounded
+				if (x <= 0x33000000u) return uint16_t(sign);
+				const uint32_t m = (x & 0x7FFFFFu) | 0x800000u, shift = 126u - (x >> 23);
+				uint32_t h = m >> shift;
+				const uint32_t rem = m & ((1u << shift) - 1u), half = 1u << (shift - 1u);
+				if (rem > half || (rem == half && (h & 1u))) ++h;
+				return uint16_t(sign | h);
+			}
+			const uint32_t r = x - 0x38000000u;  // rebias the exponent from 127 to 15
+			uint32_t h = r >> 13;
+			const uint32_t rem = r & 0x1FFFu;
+			if (rem > 0x1000u || (rem == 0x1000u && (h & 1u))) ++h;
+			return uint16_t(sign | h);
+		}
+		inline float half_bits_to_float(const uint16_t h)
+		{
+			const uint32_t sign = uint32_t(h & 0x8000u) << 16, e = (h >> 10) & 0x1Fu, m = h & 0x3FFu;
+			if (e == 0x1Fu) return bits_float(sign | 0x7F800000u | (m << 13));
+			if (e)          return bits_float(sign | ((e + 112u) << 23) | (m << 13));
+			const float v = float(m) * (1.f / 16777216.f);
+			return sign ? -v : v;
+		}
+
+		// bfloat16 from float, rounding to nearest even; NaNs stay quiet NaNs
+		inline uint16_t float_to_bfloat16_bits(const float f)
+		{
+			const uint32_t x = float_bits(f);
+			if ((x & 0x7FFFFFFFu) > 0x7F800000u) return uint16_t((x >> 16) | 0x40u);
+			return uint16_t((x + 0x7FFFu + ((x >> 16) & 1u)) >> 16);
+		}
+		inline float bfloat16_bits_to_float(const uint16_t b)    {return bits_float(uint32_t(b) << 16);}
+
+		/*
+			double to float rounding to odd: truncate, then set the last bit if
+			anything was lost.  Rounding this again to a 16-bit format gives the
+			correctly rounded result, where rounding to nearest twice might not.
+		*/
+		inline float double_to_float_odd(const double v)
+		{
+			const float f = float(v);
+			if (!(double(f) != v) || v != v) return f;
+			uint32_t u = float_bits(f);
+			if (std::fabs(double(f)) > std::fabs(v)) --u;
+			return bits_float(u | 1u);
+		}
+
+		struct half_format
+		{
+			static uint16_t encode(const float f)       {return float_to_half_bits(f);}
+			static float    decode(const uint16_t b)    {return half_bits_to_float(b);}
+		};
+		struct bfloat16_format
+		{
+			static uint16_t encode(const float f)       {return float_to_bfloat16_bits(f);}
+			static float    decode(const uint16_t b)    {return bfloat16_bits_to_float(b);}
+		};
+
+		/*
+			A 16-bit float whose arithmetic is done in float and rounded back.
+			Like _Float16 it converts implicitly from other arithmetic types, but
+			only explicitly to them.
+		*/
+		template<typename T_Format>
+		struct emulated_float16
+		{
+			uint16_t bits;
+
+			emulated_float16() = default;
+			emulated_float16(const float  v) : bits(T_Format::encode(v)) {}
+			emulated_float16(const double v) : bits(T_Format::encode(double_to_float_odd(v))) {}
+			emulated_float16(const int    v) : bits(T_Format::encode(double_to_float_odd(double(v)))) {}
+
+			explicit operator float () const    {return T_Format::decode(bits);}
+			explicit operator double() const    {return double(T_Format::decode(bits));}
+
+			friend emulated_float16 operator+(const emulated_float16 a, const emulated_float16 b)    {return emulated_float16(float(a) + float(b));}
+			friend emulated_float16 operator-(const emulated_float16 a, const emulated_float16 b)    {return emulated_float16(float(a) - float(b));}
+			friend emulated_float16 operator*(const emulated_float16 a, const emulated_float16 b)    {return emulated_float16(float(a) * float(b));}
+			friend emulated_float16 operator/(const emulated_float16 a, const emulated_float16 b)    {return emulated_float16(float(a) / float(b));}
+			friend emulated_float16 operator-(const emulated_float16 a)    {emulated_float16 n; n.bits = uint16_t(a.bits ^ 0x8000u); return n;}
+
+			friend bool operator< (const emulated_float16 a, const emulated_float16 b)    {return float(a) <  float(b);}
+			friend bool operator> (const emulated_float16 a, const emulated_float16 b)    {return float(a) >  float(b);}
+			friend bool operator<=(const emulated_float16 a, const emulated_float16 b)    {return float(a) <= float(b);}
+			friend bool operator>=(const emulated_float16 a, const emulated_float16 b)    {return float(a) >= float(b);}
+			friend bool operator==(const emulated_float16 a, const emulated_float16 b)    {return float(a) == float(b);}
+			friend bool operator!=(const emulated_float16 a, const emulated_float16 b)    {return float(a) != float(b);}
+
+			friend std::ostream &operator<<(std::ostream &out, const emulated_float16 v)    {return out << float(v);}
+		};
+	}
+
+#if defined(__FLT16_MANT_DIG__) && (defined(__AVX512FP16__) || defined(__ARM_FEATURE_FP16_SCALAR_ARITHMETIC))
+	#define ROOTBEER_FLOAT16_NATIVE 1
+	using float16  = _Float16;
+#else
+	using float16  = detail::emulated_float16<detail::half_format>;
+#endif
+	using bfloat16 = detail::emulated_float16<detail::bfloat16_format>;
+
+
+	namespace detail
+	{
+		template<typename T_Float> struct float_traits;
+
+		template<> struct float_traits<float16>
+		{
+			using as_int_t  = int16_t;
+			using compute_t = float;
+			using format_t  = half_format;
+			static const as_int_t
+				bits_exponent =  5,
+				bits_mantissa = 10;
+			static const char *name() {return "float16";}
+			static const char *suffix() {return "";}
+		};
+		template<> struct float_traits<bfloat16>
+		{
+			using as_int_t  = int16_t;
+			using compute_t = float;
+			using format_t  = bfloat16_format;
+			static const as_int_t
+				bits_exponent =  8,
+				bits_mantissa =  7;
+			static const char *name() {return "bfloat16";}
+			static const char *suffix() {return "";}
+		};
+	}
+}
@@ -0,0 +1,80 @@
+#pragma once
+
+
+#include <cmath>
+#include <algorithm>
+
+
+namespace rootbeer
+{
+	namespace detail
+	{
+		/*
+			Closed interval of doubles, for error bounds that hold despite rounding.
+
+			Each operation rounds to nearest and then steps one ulp outward, which
+			contains the exact result of the operation on every pair of operands.
+			Division assumes the divisor excludes zero.
+		*/
+		struct interval
+		{
+			double lo, hi;
+
+			interval(const double v) : lo(v), hi(v) {}
+			interval(const double _lo, const double _hi) : lo(_lo), hi(_hi) {}
+
+			static double down(const double v)    {return std::nextafter(v, -HUGE_VAL);}
+			static double up  (const double v)    {return std::nextafter(v,  HUGE_VAL);}
+
+			friend interval operator+(const interval a, const interval b)    {return {down(a.lo+b.lo), up(a.hi+b.hi)};}
+			friend interval operator-(const interval a, const interval b)    {return {down(a.lo-b.hi), up(a.hi-b.lo)};}
+			friend interval operator*(const interval a, const interval b)
+			{
+				double p[4] = {a.lo*b.lo, a.lo*b.hi, a.hi*b.lo, a.hi*b.hi};
+				return {down(*std::min_element(p, p+4)), up(*std::max_element(p, p+4))};
+			}
+			friend interval operator/(const interval a, const interval b)
+			{
+				double q[4] = {a.lo/b.lo, a.lo/b.hi, a.hi/b.lo, a.hi/b.hi};
+				return {down(*std::min_element(q, q+4)), up(*std::max_element(q, q+4))};
+			}
+
+			static interval hull(const interval a, const interval b)    {return {std::min(a.lo, b.lo), std::max(a.hi, b.hi)};}
+
+			bool intersects(const interval o) const    {return lo <= o.hi && o.lo <= hi;}
+			interval clip(const interval o) const      {return {std::max(lo, o.lo), std::min(hi, o.hi)};}
+		};
+
+		// x^e for a positive interval x and integer e
+		inline interval pow_interval(const interval x, const int e)
+		{
+			interval p(1.0);
+			for (int i = 0; i < std::abs(e); ++i) p = p * x;
+			return (e < 0) ? interval(1.0) / p : p;
+		}
+
+		/*
+			Enclose y^(1/n) for a positive interval y and integer n.
+			libm's estimate is nudged until the enclosure is confirmed by
+			raising its bounds to the nth power in interval arithmetic.
+		*/
+		inline interval root_interval(const interval y, const int n)
+		{
+			const int d = std::abs(n);
+			double lo = std::pow(y.lo, 1.0/d), hi = std::pow(y.hi, 1.0/d);
+			while (pow_interval(lo, d).hi > y.lo) lo = interval::down(lo);
+			while (pow_interval(hi, d).lo < y.hi) hi = interval::up(hi);
+			return (n < 0) ? interval(1.0) / interval(lo, hi) : interval(lo, hi);
+		}
+
+		// Convert a bound to T, rounding outward
+		template<typename T> T round_down(const double v)    {T t = T(v); return (double(t) > v) ? std::nextafter(t, T(-HUGE_VAL)) : t;}
+		template<typename T> T round_up  (const double v)    {T t = T(v); return (double(t) < v) ? std::nextafter(t, T( HUGE_VAL)) : t;}
+
+		// Bound on relative error from k roundings with unit roundoff u
+		inline double gamma_bound(const unsigned k, const double u)
+		{
+			return interval::up((k*u) / interval::down(1.0 - k*u));
+		}
+	}
+}
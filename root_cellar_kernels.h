@@ -0,0 +1,191 @@
+/*
+	The vector kernels of batch evaluation, written once against an "ops"
+	structure (see root_cellar_batch.h).
+
+	This file has no include guard: root_cellar_batch.h includes it within
+	rootbeer::simd, and root_cellar_dispatch.h again within a namespace for
+	each instruction set under a target pragma, so that all a dispatched batch
+	runs is compiled for that instruction set.  Lambdas don't take the pragma,
+	so there are none here.
+*/
+
+
+/*
+	Integer powers of a vector, in the same order as pow_i.
+*/
+template<int E, typename Ops>
+inline typename Ops::vec_t pow_v(const typename Ops::vec_t x)
+{
+	static_assert(E >= 0, "negative powers are not used in kernels");
+	switch (E)
+	{
+	case 0: return Ops::set1(typename Ops::float_t(1));
+	case 1: return x;
+	case 2: return Ops::mul(x, x);
+	case 3: return Ops::mul(Ops::mul(x, x), x);
+	case 4: {auto x2 = Ops::mul(x, x); return Ops::mul(x2, x2);}
+	default: return Ops::mul(pow_v<((E>4) ? E-1 : 0), Ops>(x), x);
+	}
+}
+
+
+/*
+	RootApprox calculation over one vector.
+
+	Mirrors RootApprox::operator(), with the multiply-add of each
+	refinement fused where Ops allows.
+*/
+template<int N, unsigned NewtonSteps, typename Ops>
+struct root_kernel
+{
+	using float_t = typename Ops::float_t;
+	using vec_t   = typename Ops::vec_t;
+	using ivec_t  = typename Ops::ivec_t;
+
+	static const int DEG = ((N>0) ? N : -N);
+
+	ivec_t k;
+	vec_t  m[NewtonSteps ? NewtonSteps : 1], c1[NewtonSteps ? NewtonSteps : 1];
+
+	explicit root_kernel(const RootApprox<N, float_t, NewtonSteps> &approx) :
+		k (Ops::set1_i(approx.constant))
+	{
+		for (unsigned s = 0; s < NewtonSteps; ++s)
+		{
+			m[s]  = Ops::set1(approx.newton_m[s]);
+			c1[s] = Ops::set1(float_t(1) - approx.newton_m[s]);
+		}
+	}
+
+	vec_t operator()(const vec_t y) const
+	{
+		// Floating-point hack for initial estimate
+		ivec_t i = Ops::template div_i<DEG>(Ops::as_int(y));
+		return refine(y, Ops::as_float((N > 0) ? Ops::add_i(k, i) : Ops::sub_i(k, i)));
+	}
+
+	// Pseudo-newtonian refinements of an estimate x
+	vec_t refine(const vec_t y, vec_t x) const
+	{
+		for (unsigned s = 0; s < NewtonSteps; ++s)
+		{
+			vec_t my = Ops::mul(m[s], y), xp = pow_v<DEG - ((N>0) ? 1 : 0), Ops>(x);
+			if (N > 0) x = Ops::fmadd(x, c1[s], Ops::div(my, xp));
+			else       x = Ops::mul(x, Ops::fmadd(my, xp, c1[s]));
+		}
+		return x;
+	}
+};
+
+
+// Aligned or unaligned loads and stores
+template<typename Ops, bool ALIGNED>
+struct batch_io
+{
+	using float_t = typename Ops::float_t;
+	using vec_t   = typename Ops::vec_t;
+
+	static vec_t load (const float_t *p)             {return ALIGNED ? Ops::load(p) : Ops::loadu(p);}
+	static void  store(float_t *p, const vec_t v)    {if (ALIGNED) Ops::store(p, v); else Ops::storeu(p, v);}
+};
+
+/*
+	Run a kernel over an array, four vectors at a time where possible,
+	finishing with a scalar tail.  y and x may be the same array.
+*/
+template<typename Ops, bool ALIGNED, typename T_Kernel, typename T_Tail>
+void batch_loop(const T_Kernel &kernel, const T_Tail &tail,
+	const typename Ops::float_t *y, typename Ops::float_t *x, const size_t count)
+{
+	using vec_t = typename Ops::vec_t;
+	using io    = batch_io<Ops, ALIGNED>;
+	const size_t W = Ops::width;
+
+	size_t i = 0;
+	if (W > 1)
+	{
+		for (; i + 4*W <= count; i += 4*W)
+		{
+			vec_t
+				a = io::load(y + i),
+				b = io::load(y + i + W),
+				c = io::load(y + i + 2*W),
+				d = io::load(y + i + 3*W);
+			a = kernel(a); b = kernel(b); c = kernel(c); d = kernel(d);
+			io::store(x + i,       a);
+			io::store(x + i + W,   b);
+			io::store(x + i + 2*W, c);
+			io::store(x + i + 3*W, d);
+		}
+		for (; i + W <= count; i += W)
+			io::store(x + i, kernel(io::load(y + i)));
+	}
+	for (; i < count; ++i)
+		x[i] = tail(y[i]);
+}
+
+
+/*
+	RootApprox_Safe calculation over one vector, in the steps of its
+	operator() with blends for the selects.  Vectors of positive normal
+	inputs, for which those steps give root(y), skip them.
+*/
+template<int N, unsigned NewtonSteps, typename Ops>
+struct safe_kernel
+{
+	using float_t = typename Ops::float_t;
+	using vec_t   = typename Ops::vec_t;
+	using ivec_t  = typename Ops::ivec_t;
+	using mask_t  = typename Ops::mask_t;
+	using int_t   = float_as_int_t<float_t>;
+	using domain  = detail::root_domain<N, float_t>;
+
+	root_kernel<N, NewtonSteps, Ops> root;
+
+	explicit safe_kernel(const RootApprox<N, float_t, NewtonSteps> &approx) : root(approx) {}
+
+	static ivec_t bits  (const typename domain::uint_t v)    {return Ops::set1_i(int_t(v));}
+	static vec_t  bits_f(const typename domain::uint_t v)    {return Ops::as_float(bits(v));}
+
+	vec_t operator()(const vec_t y) const
+	{
+		// Positive normal bits, less min_normal, are below infinity's as unsigned;
+		// adding the sign bit too makes that one signed comparison
+		const ivec_t ordinary = Ops::add_i(Ops::as_int(y), bits(domain::sign - domain::min_normal));
+		if (Ops::all_lt_i(ordinary, bits(domain::sign + (domain::infinity - domain::min_normal)))) return root(y);
+
+		const vec_t zero = Ops::set1(float_t(0));
+		const ivec_t u = Ops::as_int(y), sign = Ops::and_i(u, bits(domain::sign));
+		const vec_t  a = Ops::abs(y);
+		const mask_t
+			tiny   = Ops::cmpgt(bits_f(domain::min_normal), a),
+			finite = Ops::mask_and(Ops::cmpgt(a, zero), Ops::cmpgt(bits_f(domain::infinity), a)),
+			number = Ops::cmpgt(a, Ops::set1(float_t(-1)));   // all but NaN, which keeps its bits
+
+		vec_t x = root(Ops::select(tiny, Ops::mul(a, bits_f(domain::scale_in)), a));
+		x = Ops::select(tiny, Ops::mul(x, bits_f(domain::scale_out)), x);
+		x = Ops::select(finite, x, (N > 0) ? a : Ops::select(number, Ops::as_float(Ops::sub_i(bits(domain::infinity), Ops::as_int(a))), a));
+		x = Ops::as_float(Ops::or_i(Ops::as_int(x), sign));
+		if (domain::DEG % 2 == 0) x = Ops::select(Ops::cmpgt(zero, y), bits_f(domain::quiet_nan), x);
+		return x;
+	}
+};
+
+
+/*
+	RootApprox or RootApprox_Safe over an array with the given ops, with a
+	scalar tail fused alike.
+*/
+template<ROOT_DOMAIN Domain, typename Ops, bool ALIGNED, int N, typename T_Float, unsigned NewtonSteps>
+void domain_batch(const RootApprox<N, T_Float, NewtonSteps> &approx,
+	const T_Float *y, T_Float *x, const size_t count)
+{
+	using tail_ops = ops_scalar<T_Float, Ops::fused>;
+	using kernel   = typename std::conditional<Domain == ROOT_SAFE,
+		safe_kernel<N, NewtonSteps, Ops>, root_kernel<N, NewtonSteps, Ops>>::type;
+	using tail     = typename std::conditional<Domain == ROOT_SAFE,
+		safe_kernel<N, NewtonSteps, tail_ops>, root_kernel<N, NewtonSteps, tail_ops>>::type;
+
+	// Parenthesized, as the kernels' ops would also find rootbeer::simd's by ADL
+	(batch_loop<Ops, ALIGNED>)(kernel(approx), tail(approx), y, x, count);
+}
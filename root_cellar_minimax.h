@@ -0,0 +1,446 @@
+#pragma once
+
+
+#include <cstdint>
+#include <cmath>
+#include <algorithm>
+#include <array>
+#include <utility>
+#include <vector>
+#include <ostream>
+#include <iostream>
+
+#include "root_cellar.h"
+
+
+/*
+	Roots refined by a minimax polynomial in place of newtonian steps.
+
+	A RootApprox estimate z of y^(-1/|N|) has some ratio r to the true value,
+	and r^|N| = y * z^|N| is known without division.  With t = y*z^|N| - 1,
+	.	y^(-1/|N|) = z * (1+t)^(-1/|N|)
+	.	y^( 1/|N|) = y * z^(|N|-1) * (1+t)^(-(|N|-1)/|N|)
+	so one polynomial in t, fitted to (1+t)^P over the estimate's range of t,
+	refines any root with multiplies and additions alone.  Positive roots
+	avoid the division of a newtonian step, and higher degrees buy accuracy
+	at the cost of one multiply-add each, with short dependency chains.
+
+	Polynomials are fitted for least worst-case relative error by the Remez
+	exchange algorithm, and evaluated by Horner's scheme up to degree 2 and
+	by pairs of terms in t and t^2 (the first level of Estrin's scheme) above.
+*/
+namespace rootbeer
+{
+	namespace detail
+	{
+		using remez_real_t = long double;
+
+		// Relative error of a polynomial in t against (1+t)^P
+		template<typename T_Coeff>
+		remez_real_t minimax_error_at(const T_Coeff *coeff, const unsigned degree, const remez_real_t P, const remez_real_t t)
+		{
+			remez_real_t q = remez_real_t(coeff[degree]);
+			for (unsigned j = degree; j-- > 0;) q = remez_real_t(coeff[j]) + t * q;
+			return q / std::pow(remez_real_t(1) + t, P) - remez_real_t(1);
+		}
+
+		/*
+			The extreme error of each run of one sign over [a, b], located on a
+			grid and then by golden-section search between its neighbours.
+			Successive extrema alternate in sign.
+		*/
+		template<typename T_Coeff>
+		std::vector<std::pair<remez_real_t, remez_real_t>> minimax_extrema(
+			const T_Coeff *coeff, const unsigned degree, const remez_real_t P, const remez_real_t a, const remez_real_t b)
+		{
+			static const int GRID = 2048;
+			auto error = [&](const remez_real_t t)    {return minimax_error_at(coeff, degree, P, t);};
+			auto at    = [&](const int i)             {return (i == GRID) ? b : a + (b - a) * remez_real_t(i) / GRID;};
+
+			std::vector<std::pair<remez_real_t, remez_real_t>> extrema;
+			int best = 0;
+			remez_real_t best_error = error(a);
+			for (int i = 1; i <= GRID + 1; ++i)
+			{
+				const remez_real_t e = (i <= GRID) ? error(at(i)) : 0;
+				if (i <= GRID && (e < 0) == (best_error < 0))
+				{
+					if (std::abs(e) > std::abs(best_error)) {best = i; best_error = e;}
+					continue;
+				}
+
+				// A run has ended; polish its extremum unless it lies on an end
+				remez_real_t t = at(best);
+				if (best > 0 && best < GRID)
+				{
+					const remez_real_t s = (best_error < 0) ? -1 : 1, g = (std::sqrt(remez_real_t(5)) - 1) / 2;
+					remez_real_t lo = at(best-1), hi = at(best+1);
+					for (int k = 0; k < 48; ++k)
+					{
+						const remez_real_t m1 = hi - g*(hi-lo), m2 = lo + g*(hi-lo);
+						if (s*error(m1) > s*error(m2)) hi = m2;
+						else                           lo = m1;
+					}
+					t = (lo + hi) / 2;
+					if (std::abs(error(t)) < std::abs(best_error)) t = at(best);
+				}
+				extrema.push_back(std::make_pair(t, error(t)));
+				best = i;
+				best_error = e;
+			}
+			return extrema;
+		}
+
+		/*
+			Fit a polynomial of the given degree to (1+t)^P over [a, b] for least
+			worst-case relative error, by the Remez exchange algorithm.
+			Returns the coefficients, lowest order first.
+		*/
+		inline std::vector<remez_real_t> Remez_Fit_Power(const remez_real_t P, const remez_real_t a, const remez_real_t b, const unsigned degree)
+		{
+			const unsigned n = degree + 2;
+			const remez_real_t pi = std::acos(remez_real_t(-1));
+
+			// Begin with the extrema of a Chebyshev polynomial
+			std::vector<remez_real_t> ref(n), coeff(degree + 1);
+			for (unsigned i = 0; i < n; ++i)
+				ref[i] = (a + b) / 2 - (b - a) / 2 * std::cos(pi * remez_real_t(i) / remez_real_t(n-1));
+
+			for (int iteration = 0; iteration < 64; ++iteration)
+			{
+				// Solve for the coefficients and a levelled error E alternating over the reference
+				std::vector<std::vector<remez_real_t>> A(n, std::vector<remez_real_t>(n + 1));
+				for (unsigned i = 0; i < n; ++i)
+				{
+					const remez_real_t f = std::pow(remez_real_t(1) + ref[i], P);
+					remez_real_t tj = 1;
+					for (unsigned j = 0; j <= degree; ++j, tj *= ref[i]) A[i][j] = tj;
+					A[i][degree+1] = ((i & 1) ? f : -f);
+					A[i][n] = f;
+				}
+				for (unsigned c = 0; c < n; ++c)
+				{
+					unsigned pivot = c;
+					for (unsigned r = c+1; r < n; ++r) if (std::abs(A[r][c]) > std::abs(A[pivot][c])) pivot = r;
+					std::swap(A[c], A[pivot]);
+					for (unsigned r = 0; r < n; ++r) if (r != c)
+					{
+						const remez_real_t k = A[r][c] / A[c][c];
+						for (unsigned j = c; j <= n; ++j) A[r][j] -= k * A[c][j];
+					}
+				}
+				for (unsigned j = 0; j <= degree; ++j) coeff[j] = A[j][n] / A[j][j];
+
+				// Exchange the reference for the extrema of the new error
+				auto extrema = minimax_extrema(coeff.data(), degree, P, a, b);
+				while (extrema.size() > n)
+				{
+					if (std::abs(extrema.front().second) < std::abs(extrema.back().second)) extrema.erase(extrema.begin());
+					else                                                                    extrema.pop_back();
+				}
+				if (extrema.size() < n) break;
+
+				remez_real_t e_min = HUGE_VALL, e_max = 0;
+				for (unsigned i = 0; i < n; ++i)
+				{
+					ref[i] = extrema[i].first;
+					e_min = std::min(e_min, std::abs(extrema[i].second));
+					e_max = std::max(e_max, std::abs(extrema[i].second));
+				}
+				if (e_max - e_min <= e_max * remez_real_t(1e-9)) break;
+			}
+			return coeff;
+		}
+	}
+
+
+	template<int N, typename T_Float, unsigned Degree = 2>
+	struct RootMinimaxApprox
+	{
+		static_assert(N != 0, "0th root is invalid");
+		static_assert(Degree >= 1 && Degree <= 6, "polynomial degree should be 1 to 6");
+
+		static constexpr int DEG = ((N>0) ? N : -N);
+
+		using float_t  = T_Float;
+		using range_t  = std::pair<float_t, float_t>;
+		using as_int_t = float_as_int_t<float_t>;
+
+		using estimate_t = RootApprox<-DEG, float_t, 0>;
+		using coeff_t    = std::array<float_t, Degree+1>;
+
+		estimate_t estimate;  // Of y^(-1/|N|)
+		coeff_t    coeff;     // Of the polynomial in t, lowest order first
+
+		constexpr RootMinimaxApprox(as_int_t _constant, const coeff_t &_coeff) :
+			estimate(_constant), coeff(_coeff) {}
+
+		// The exponent of (1+t) the polynomial approximates
+		static constexpr double power()    {return (N > 0) ? 1.0/double(N) - 1.0 : 1.0/double(N);}
+
+		/*
+			The polynomial, by Horner's scheme or by pairs of terms.
+		*/
+		ROOTBEER_CONSTEXPR float_t polynomial(const float_t t) const
+		{
+			if (Degree <= 2)
+			{
+				float_t q = coeff[Degree];
+				for (unsigned j = Degree; j-- > 0;) q = coeff[j] + t * q;
+				return q;
+			}
+			const float_t t2 = t * t;
+			float_t q = (Degree & 1) ? (coeff[Degree-1] + coeff[Degree] * t) : coeff[Degree];
+			for (unsigned j = Degree & ~1u; j > 0;)
+			{
+				j -= 2;
+				q = (coeff[j] + coeff[j+1] * t) + t2 * q;
+			}
+			return q;
+		}
+
+		/*
+			Complete calculation.
+		*/
+		ROOTBEER_CONSTEXPR float_t operator()(const float_t y) const
+		{
+			const float_t z = estimate.initialEstimate(y);
+			if (N > 0)
+			{
+				const float_t x = y * pow_i<DEG-1>(z), t = x * z - float_t(1);
+				return x * polynomial(t);
+			}
+			const float_t t = y * pow_i<DEG>(z) - float_t(1);
+			return z * polynomial(t);
+		}
+
+		static range_t test_param_range()
+		{
+			return std::make_pair(float_t(1), float_t(1<<std::abs(N)));
+		}
+
+		/*
+			Range of t over normal inputs, from the estimate's certified ratio.
+		*/
+		std::pair<double, double> tRange() const
+		{
+			const detail::interval r = estimate.errorInterval_initial();
+			return std::make_pair(
+				detail::pow_interval(r.lo, DEG).lo - 1.0,
+				detail::pow_interval(r.hi, DEG).hi - 1.0);
+		}
+
+		/*
+			Fit the polynomial to the estimate's range of t.
+		*/
+		void fit()
+		{
+			const auto t = tRange();
+			const auto fitted = detail::Remez_Fit_Power(detail::remez_real_t(power()), t.first, t.second, Degree);
+			for (unsigned j = 0; j <= Degree; ++j) coeff[j] = float_t(fitted[j]);
+		}
+
+		/*
+			Range of the ratio x / y^(1/N), disregarding rounding in evaluation.
+			The ratio is within an ulp of 1 for higher degrees, so the worst case
+			is taken from the extremes of error before they are rounded.
+		*/
+		std::vector<std::pair<detail::remez_real_t, detail::remez_real_t>> errorExtrema() const
+		{
+			const auto t = tRange();
+			return detail::minimax_extrema(coeff.data(), Degree, detail::remez_real_t(power()), t.first, t.second);
+		}
+
+		range_t errorRange() const
+		{
+			range_t range(float_t(1e20), float_t(-1e20));
+			for (auto &e : errorExtrema())
+			{
+				range.first  = std::min(range.first,  float_t(1 + e.second));
+				range.second = std::max(range.second, float_t(1 + e.second));
+			}
+			return range;
+		}
+
+		float_t error_worstCase() const
+		{
+			detail::remez_real_t worst = 0;
+			for (auto &e : errorExtrema()) worst = std::max(worst, std::abs(e.second));
+			return float_t(worst);
+		}
+	};
+
+
+	/*
+		Score a design on the given basis; lower is better.
+		There is no certified bound for polynomials, so CERTIFIED_WORST_CASE
+		uses the analytic range like APPROX_WORST_CASE.
+	 */
+	template<BEST_APPROX_BASIS Basis, int N, typename T_Float, unsigned Degree>
+	T_Float RootMinimaxApprox_Score(const RootMinimaxApprox<N, T_Float, Degree> &candidate)
+	{
+		const auto range = RootMinimaxApprox<N, T_Float, Degree>::test_param_range();
+
+		switch (Basis)
+		{
+		default:
+		case BEST_WORST_CASE:   return T_Float(Test_Root_Approx<N>(candidate, range.first, range.second).worst_error());
+		case BEST_MEAN_SQUARE:  return T_Float(Test_Root_Approx<N>(candidate, range.first, range.second).mean_sq_error);
+		case APPROX_WORST_CASE:
+		case CERTIFIED_WORST_CASE: return candidate.error_worstCase();
+		}
+	}
+
+	/*
+		Search for the best minimax design.
+
+		Each constant k gives the estimate a range of t, and the polynomial is
+		fitted to that range by Remez exchange, so only k is searched.  k is
+		scanned coarsely around the estimate's identity and refined by a halving
+		stride, as in RootTableApprox_Best.  Fits are run on the executor's
+		threads; ties go to the earliest.
+	 */
+	template<int N, typename T_Float, unsigned Degree = 2,
+		BEST_APPROX_BASIS Basis = APPROX_WORST_CASE, typename T_Executor>
+	RootMinimaxApprox<N, T_Float, Degree> RootMinimaxApprox_Best(T_Executor &&executor)
+	{
+		using float_t  = T_Float;
+		using as_int_t = float_as_int_t<float_t>;
+		using design_t = RootMinimaxApprox<N, T_Float, Degree>;
+
+		static const int
+			DEG = design_t::DEG,
+			bits_mantissa = int(detail::float_traits<float_t>::bits_mantissa);
+		const as_int_t
+			identity = as_int_t(
+				((as_int_t(1) << (detail::float_traits<float_t>::bits_exponent-1)) - 1)
+				* (as_int_t(1) << bits_mantissa) / DEG * (DEG + 1)),
+			span = as_int_t(1) << (bits_mantissa - 1);
+
+		auto fitted = [&](const as_int_t k)
+		{
+			design_t design(k, typename design_t::coeff_t());
+			design.fit();
+			return design;
+		};
+
+		struct fit_t {float_t score; as_int_t k;};
+
+		std::cout << std::dec << "//Searching degree " << Degree << ", k in [0x" << std::hex << (identity - span)
+			<< ",0x" << (identity + span) << std::dec << "] ";
+
+		// Scan k coarsely, then halve a stride around the best until it vanishes
+		static const as_int_t COARSE = 32;
+		std::vector<as_int_t> ks;
+		for (as_int_t i = 0; i <= COARSE; ++i) ks.push_back(identity - span + 2 * span * i / COARSE);
+		as_int_t stride = 2 * span / COARSE;
+
+		fit_t best = {float_t(1e20), identity};
+		std::vector<fit_t> fits;
+		while (ks.size())
+		{
+			std::cout << '.' << std::flush;
+			fits.resize(ks.size());
+			executor.parallel_for(ks.size(), [&](const size_t i)
+			{
+				fits[i] = {RootMinimaxApprox_Score<Basis>(fitted(ks[i])), ks[i]};
+			});
+			bool moved = false;
+			for (auto &f : fits) if (f.score < best.score) {best = f; moved = true;}
+
+			if (!moved) stride /= 2;
+			ks.clear();
+			if (stride > 0) ks = {best.k - stride, best.k + stride};
+		}
+		std::cout << std::endl;
+
+		design_t result = fitted(best.k);
+		std::cout << "//  ...best design k=0x" << std::hex << best.k << std::dec
+			<< " with error score " << best.score << std::endl;
+		return result;
+	}
+
+	template<int N, typename T_Float, unsigned Degree = 2, BEST_APPROX_BASIS Basis = APPROX_WORST_CASE>
+	RootMinimaxApprox<N, T_Float, Degree> RootMinimaxApprox_Best()
+	{
+		return RootMinimaxApprox_Best<N, T_Float, Degree, Basis>(SerialExecutor());
+	}
+
+	template<int N, typename T_Float, unsigned Degree = 2, BEST_APPROX_BASIS Basis = APPROX_WORST_CASE>
+	RootMinimaxApprox<N, T_Float, Degree> RootMinimaxApprox_Best_Parallel(unsigned threads = 0)
+	{
+		ThreadPool pool(threads);
+		return RootMinimaxApprox_Best<N, T_Float, Degree, Basis>(pool);
+	}
+
+
+	/*
+		Emit a minimax design as a scalar function, named like Print_Generated_Root's.
+		Operations are in the order of RootMinimaxApprox::operator(), so that the
+		function reproduces it bit for bit (where the compiler doesn't contract
+		multiply-adds).  Requires the definitions from Print_Generated_Preamble.
+	 */
+	template<int N, typename T_Float, unsigned Degree>
+	std::ostream &Print_Generated_Root_Minimax(std::ostream &out,
+		const RootMinimaxApprox<N, T_Float, Degree> &approx, const char *prefix = "rbm")
+	{
+		static const int absN = ((N<0)?-N:N);
+
+		using float_t = T_Float;
+		const char *float_decl = detail::float_traits<float_t>::name();
+		using as_int_t = float_as_int_t<float_t>;
+		const char *int_decl = detail::int_traits<as_int_t>::name();
+		auto c = [&](const unsigned j)    {return detail::exact_literal(approx.coeff[j]);};
+		auto term = [&](const unsigned j, const char *factor)  // + factor * coeff[j], with its sign
+		{
+			return std::string((approx.coeff[j] < 0) ? " - " : " + ") + factor + " * " + detail::exact_literal(std::abs(approx.coeff[j]));
+		};
+
+		out << "RB_CONSTEXPR " << float_decl << " " << detail::generated_name(prefix, N) << "(const " << float_decl << " y)\n";
+		out << "{\n";
+		out << "\t" << int_decl << " i = rb_bit_cast<" << int_decl << ">(y); // interpret float as integer\n";
+		const char *q = "i";
+		if (absN > 1)
+		{
+			detail::print_div_i<as_int_t, absN>(out, "q", "i");
+			q = "q";
+		}
+		out << std::hex << "\ti = 0x" << approx.estimate.constant << " - " << q << "; // log-approximation hack, for y^(-1/"
+			<< std::dec << absN << ")\n";
+		out << "\t" << float_decl << " z = rb_bit_cast<" << float_decl << ">(i);\n";
+		if (N > 0)
+		{
+			out << "\t" << float_decl << " x = y";
+			if (absN > 1) out << " * " << detail::power_expression("z", absN-1);
+			out << ", t = x * z - " << detail::exact_literal(float_t(1)) << "; // x = y^(1/" << absN << ") * (1+t)^(" << (absN-1) << "/" << absN << ")\n";
+		}
+		else
+		{
+			out << "\t" << float_decl << " x = z, t = y * " << detail::power_expression("z", absN) << " - " << detail::exact_literal(float_t(1))
+				<< "; // x = y^(-1/" << absN << ") * (1+t)^(1/" << absN << ")\n";
+		}
+
+		// The polynomial, as RootMinimaxApprox::polynomial evaluates it
+		std::string p;
+		if (Degree == 1)
+			p = c(0) + term(1, "t");
+		else if (Degree == 2)
+			p = c(0) + " + t * (" + c(1) + term(2, "t") + ")";
+		else
+		{
+			out << "\t" << float_decl << " t2 = t * t;\n";
+			auto pair = [&](const unsigned j)    {return "(" + c(j) + term(j+1, "t") + ")";};
+			bool single = ((Degree & 1) == 0);
+			p = single ? c(Degree) : pair(Degree-1);
+			for (unsigned j = Degree & ~1u; j > 0;)
+			{
+				j -= 2;
+				p = pair(j) + (single ? term(Degree, "t2") : " + t2 * " + ((j+4 > Degree) ? p : "(" + p + ")"));
+				single = false;
+			}
+		}
+		out << "\treturn x * (" << p << "); // minimax polynomial of degree " << Degree << "\n";
+		out << "}";
+		return out;
+	}
+}
@@ -0,0 +1,446 @@
+#pragma once
+#include <stdint.h>
+#include <string.h>
+
+#ifndef RB_CONSTEXPR
+#if (__cplusplus >= 202002L) || (defined(_MSVC_LANG) && _MSVC_LANG >= 202002L)
+	#include <bit>
+#endif
+#if defined(__has_builtin)
+	#if __has_builtin(__builtin_bit_cast)
+		#define RB_BUILTIN_BIT_CAST 1
+	#endif
+#elif defined(_MSC_VER) && (_MSC_VER >= 1927)
+	#define RB_BUILTIN_BIT_CAST 1
+#endif
+#if defined(__cpp_lib_bit_cast)
+	#define RB_CONSTEXPR constexpr
+	template<typename To, typename From> constexpr To rb_bit_cast(const From &v) {return std::bit_cast<To>(v);}
+#elif defined(RB_BUILTIN_BIT_CAST)
+	#define RB_CONSTEXPR constexpr
+	template<typename To, typename From> constexpr To rb_bit_cast(const From &v) {return __builtin_bit_cast(To, v);}
+#else
+	#define RB_CONSTEXPR inline
+	template<typename To, typename From> inline To rb_bit_cast(const From &v) {To t; memcpy(&t, &v, sizeof(To)); return t;}
+#endif
+#endif
+
+#ifndef RB_MULHI
+#define RB_MULHI 1
+// High half of a product, for division by a magic reciprocal
+#if defined(__SIZEOF_INT128__)
+__extension__ typedef unsigned __int128 rb_uint128;
+#endif
+RB_CONSTEXPR uint32_t rb_mulhi(uint32_t a, uint32_t b) {return (uint32_t)(((uint64_t)a * b) >> 32);}
+RB_CONSTEXPR uint64_t rb_mulhi(uint64_t a, uint64_t b)
+{
+#if defined(__SIZEOF_INT128__)
+	return (uint64_t)(((rb_uint128)a * b) >> 64);
+#else
+	uint64_t a1 = a >> 32, a0 = a & 0xFFFFFFFFu, b1 = b >> 32, b0 = b & 0xFFFFFFFFu;
+	uint64_t mid = ((a0*b0) >> 32) + ((a1*b0) & 0xFFFFFFFFu) + ((a0*b1) & 0xFFFFFFFFu);
+	return a1*b1 + ((a1*b0) >> 32) + ((a0*b1) >> 32) + (mid >> 32);
+#endif
+}
+#endif
+
+
+// Roots refined by minimax polynomials of degree 2 to 4, optimized for worst-case error
+
+
+//Searching degree 2, k in [0x5f000000,0x5f800000] .....................
+//  ...best design k=0x5f600800 with error score 1.59492e-05
+/*
+	Approximate x^(1/2) with a minimax polynomial of degree 2
+	Error:
+		RMS:  1.12987e-05
+		mean: 4.27527e-06
+		min:  -1.61053e-05 @ 2.4392
+		max:  1.60883e-05 @ 1.38801
+	Analytic worst-case error, before rounding: 1.59492e-05
+*/
+RB_CONSTEXPR float rbm2_2_root(const float y)
+{
+	int32_t i = rb_bit_cast<int32_t>(y); // interpret float as integer
+	int32_t q = (i + (i < 0 ? 1 : 0)) >> 1; // i / 2, rounding toward zero
+	i = 0x5f600800 - q; // log-approximation hack, for y^(-1/2)
+	float z = rb_bit_cast<float>(i);
+	float x = y * z, t = x * z - 1.0f; // x = y^(1/2) * (1+t)^(1/2)
+	return x * (0.9812038f + t * (-0.38800904f + t * 0.117134646f)); // minimax polynomial of degree 2
+}
+
+//Searching degree 2, k in [0x5f000000,0x5f800000] .....................
+//  ...best design k=0x5f600800 with error score 1.59492e-05
+/*
+	Approximate x^(1/-2) with a minimax polynomial of degree 2
+	Error:
+		RMS:  1.12987e-05
+		mean: 4.27525e-06
+		min:  -1.61208e-05 @ 2.4441
+		max:  1.61309e-05 @ 3.0096
+	Analytic worst-case error, before rounding: 1.59492e-05
+*/
+RB_CONSTEXPR float rbm2_inv_2_root(const float y)
+{
+	int32_t i = rb_bit_cast<int32_t>(y); // interpret float as integer
+	int32_t q = (i + (i < 0 ? 1 : 0)) >> 1; // i / 2, rounding toward zero
+	i = 0x5f600800 - q; // log-approximation hack, for y^(-1/2)
+	float z = rb_bit_cast<float>(i);
+	float x = z, t = y * (z*z) - 1.0f; // x = y^(-1/2) * (1+t)^(1/2)
+	return x * (0.9812038f + t * (-0.38800904f + t * 0.117134646f)); // minimax polynomial of degree 2
+}
+
+//Searching degree 2, k in [0x546aaaa8,0x54eaaaa8] .......................
+//  ...best design k=0x548e8aa8 with error score 7.55963e-05
+/*
+	Approximate x^(1/3) with a minimax polynomial of degree 2
+	Error:
+		RMS:  5.50017e-05
+		mean: 9.58182e-06
+		min:  -7.57771e-05 @ 1.24591
+		max:  7.57686e-05 @ 2.6722
+	Analytic worst-case error, before rounding: 7.55963e-05
+*/
+RB_CONSTEXPR float rbm2_3_root(const float y)
+{
+	int32_t i = rb_bit_cast<int32_t>(y); // interpret float as integer
+	int32_t q = (int32_t)(rb_mulhi((uint32_t)i, 0x55555556u) - (i < 0 ? 0x55555556u : 0u));
+	q += (i < 0); // i / 3, rounding toward zero
+	i = 0x548e8aa8 - q; // log-approximation hack, for y^(-1/3)
+	float z = rb_bit_cast<float>(i);
+	float x = y * (z*z), t = x * z - 1.0f; // x = y^(1/3) * (1+t)^(2/3)
+	return x * (1.0214775f + t * (-0.4392373f + t * 1.2809037f)); // minimax polynomial of degree 2
+}
+
+//Searching degree 2, k in [0x546aaaa8,0x54eaaaa8] .........................
+//  ...best design k=0x54e32e68 with error score 2.64713e-05
+/*
+	Approximate x^(1/-3) with a minimax polynomial of degree 2
+	Error:
+		RMS:  1.89677e-05
+		mean: 3.77261e-06
+		min:  -2.66772e-05 @ 7.87108
+		max:  2.66329e-05 @ 3.14423
+	Analytic worst-case error, before rounding: 2.64713e-05
+*/
+RB_CONSTEXPR float rbm2_inv_3_root(const float y)
+{
+	int32_t i = rb_bit_cast<int32_t>(y); // interpret float as integer
+	int32_t q = (int32_t)(rb_mulhi((uint32_t)i, 0x55555556u) - (i < 0 ? 0x55555556u : 0u));
+	q += (i < 0); // i / 3, rounding toward zero
+	i = 0x54e32e68 - q; // log-approximation hack, for y^(-1/3)
+	float z = rb_bit_cast<float>(i);
+	float x = z, t = y * (z*z*z) - 1.0f; // x = y^(-1/3) * (1+t)^(1/3)
+	return x * (0.9223329f + t * (-0.15190274f + t * 0.018703967f)); // minimax polynomial of degree 2
+}
+
+//Searching degree 2, k in [0x4f200000,0x4fa00000] .....................
+//  ...best design k=0x4f500020 with error score 0.000245039
+/*
+	Approximate x^(1/4) with a minimax polynomial of degree 2
+	Error:
+		RMS:  0.000178048
+		mean: -2.78661e-05
+		min:  -0.000245232 @ 2.18118
+		max:  0.000245239 @ 1.07963
+	Analytic worst-case error, before rounding: 0.000245039
+*/
+RB_CONSTEXPR float rbm2_4_root(const float y)
+{
+	int32_t i = rb_bit_cast<int32_t>(y); // interpret float as integer
+	int32_t q = (i + (i < 0 ? 3 : 0)) >> 2; // i / 4, rounding toward zero
+	i = 0x4f500020 - q; // log-approximation hack, for y^(-1/4)
+	float z = rb_bit_cast<float>(i);
+	float x = y * (z*z*z), t = x * z - 1.0f; // x = y^(1/4) * (1+t)^(3/4)
+	return x * (1.002211f + t * (-0.69373035f + t * 1.0377386f)); // minimax polynomial of degree 2
+}
+
+//Searching degree 2, k in [0x4f200000,0x4fa00000] ......................
+//  ...best design k=0x4f8fee00 with error score 4.77834e-05
+/*
+	Approximate x^(1/-4) with a minimax polynomial of degree 2
+	Error:
+		RMS:  3.4896e-05
+		mean: -5.42975e-06
+		min:  -4.79783e-05 @ 8.67697
+		max:  4.79766e-05 @ 2.47091
+	Analytic worst-case error, before rounding: 4.77834e-05
+*/
+RB_CONSTEXPR float rbm2_inv_4_root(const float y)
+{
+	int32_t i = rb_bit_cast<int32_t>(y); // interpret float as integer
+	int32_t q = (i + (i < 0 ? 3 : 0)) >> 2; // i / 4, rounding toward zero
+	i = 0x4f8fee00 - q; // log-approximation hack, for y^(-1/4)
+	float z = rb_bit_cast<float>(i);
+	float x = z, t = y * ((z*z)*(z*z)) - 1.0f; // x = y^(-1/4) * (1+t)^(1/4)
+	return x * (0.9251302f + t * (-0.102843195f + t * 0.010089825f)); // minimax polynomial of degree 2
+}
+
+//Searching degree 3, k in [0x5f000000,0x5f800000] ....................
+//  ...best design k=0x5f5c0000 with error score 4.21346e-07
+/*
+	Approximate x^(1/2) with a minimax polynomial of degree 3
+	Error:
+		RMS:  2.67735e-07
+		mean: 4.17214e-08
+		min:  -5.96537e-07 @ 1.43763
+		max:  6.12396e-07 @ 1.36414
+	Analytic worst-case error, before rounding: 4.21346e-07
+*/
+RB_CONSTEXPR float rbm3_2_root(const float y)
+{
+	int32_t i = rb_bit_cast<int32_t>(y); // interpret float as integer
+	int32_t q = (i + (i < 0 ? 1 : 0)) >> 1; // i / 2, rounding toward zero
+	i = 0x5f5c0000 - q; // log-approximation hack, for y^(-1/2)
+	float z = rb_bit_cast<float>(i);
+	float x = y * z, t = x * z - 1.0f; // x = y^(1/2) * (1+t)^(1/2)
+	float t2 = t * t;
+	return x * ((0.9955382f - t * 0.46176872f) + t2 * (0.24293542f - t * 0.07112965f)); // minimax polynomial of degree 3
+}
+
+//Searching degree 3, k in [0x5f000000,0x5f800000] ....................
+//  ...best design k=0x5f5c0000 with error score 4.21346e-07
+/*
+	Approximate x^(1/-2) with a minimax polynomial of degree 3
+	Error:
+		RMS:  2.69054e-07
+		mean: 4.16939e-08
+		min:  -6.21714e-07 @ 3.02217
+		max:  6.29027e-07 @ 1.37497
+	Analytic worst-case error, before rounding: 4.21346e-07
+*/
+RB_CONSTEXPR float rbm3_inv_2_root(const float y)
+{
+	int32_t i = rb_bit_cast<int32_t>(y); // interpret float as integer
+	int32_t q = (i + (i < 0 ? 1 : 0)) >> 1; // i / 2, rounding toward zero
+	i = 0x5f5c0000 - q; // log-approximation hack, for y^(-1/2)
+	float z = rb_bit_cast<float>(i);
+	float x = z, t = y * (z*z) - 1.0f; // x = y^(-1/2) * (1+t)^(1/2)
+	float t2 = t * t;
+	return x * ((0.9955382f - t * 0.46176872f) + t2 * (0.24293542f - t * 0.07112965f)); // minimax polynomial of degree 3
+}
+
+//Searching degree 3, k in [0x546aaaa8,0x54eaaaa8] ......................
+//  ...best design k=0x548f2ea8 with error score 2.94963e-06
+/*
+	Approximate x^(1/3) with a minimax polynomial of degree 3
+	Error:
+		RMS:  2.02843e-06
+		mean: 9.22496e-07
+		min:  -3.12499e-06 @ 1.09263
+		max:  3.15115e-06 @ 3.21156
+	Analytic worst-case error, before rounding: 2.94963e-06
+*/
+RB_CONSTEXPR float rbm3_3_root(const float y)
+{
+	int32_t i = rb_bit_cast<int32_t>(y); // interpret float as integer
+	int32_t q = (int32_t)(rb_mulhi((uint32_t)i, 0x55555556u) - (i < 0 ? 0x55555556u : 0u));
+	q += (i < 0); // i / 3, rounding toward zero
+	i = 0x548f2ea8 - q; // log-approximation hack, for y^(-1/3)
+	float z = rb_bit_cast<float>(i);
+	float x = y * (z*z), t = x * z - 1.0f; // x = y^(1/3) * (1+t)^(2/3)
+	float t2 = t * t;
+	return x * ((0.99404484f - t * 0.7556689f) + t2 * (0.081507064f - t * 1.4946917f)); // minimax polynomial of degree 3
+}
+
+//Searching degree 3, k in [0x546aaaa8,0x54eaaaa8] .....................
+//  ...best design k=0x548eaab0 with error score 9.37829e-07
+/*
+	Approximate x^(1/-3) with a minimax polynomial of degree 3
+	Error:
+		RMS:  6.36553e-07
+		mean: 2.65471e-07
+		min:  -1.16761e-06 @ 1.09595
+		max:  1.1729e-06 @ 1.86029
+	Analytic worst-case error, before rounding: 9.37829e-07
+*/
+RB_CONSTEXPR float rbm3_inv_3_root(const float y)
+{
+	int32_t i = rb_bit_cast<int32_t>(y); // interpret float as integer
+	int32_t q = (int32_t)(rb_mulhi((uint32_t)i, 0x55555556u) - (i < 0 ? 0x55555556u : 0u));
+	q += (i < 0); // i / 3, rounding toward zero
+	i = 0x548eaab0 - q; // log-approximation hack, for y^(-1/3)
+	float z = rb_bit_cast<float>(i);
+	float x = z, t = y * (z*z*z) - 1.0f; // x = y^(-1/3) * (1+t)^(1/3)
+	float t2 = t * t;
+	return x * ((0.9979939f - t * 0.36254707f) + t2 * (0.07027331f - t * 0.48762822f)); // minimax polynomial of degree 3
+}
+
+//Searching degree 3, k in [0x4f200000,0x4fa00000] .....................
+//  ...best design k=0x4f508000 with error score 1.35256e-05
+/*
+	Approximate x^(1/4) with a minimax polynomial of degree 3
+	Error:
+		RMS:  9.2864e-06
+		mean: 2.50495e-06
+		min:  -1.37632e-05 @ 1.28822
+		max:  1.37592e-05 @ 1.02022
+	Analytic worst-case error, before rounding: 1.35256e-05
+*/
+RB_CONSTEXPR float rbm3_4_root(const float y)
+{
+	int32_t i = rb_bit_cast<int32_t>(y); // interpret float as integer
+	int32_t q = (i + (i < 0 ? 3 : 0)) >> 2; // i / 4, rounding toward zero
+	i = 0x4f508000 - q; // log-approximation hack, for y^(-1/4)
+	float z = rb_bit_cast<float>(i);
+	float x = y * (z*z*z), t = x * z - 1.0f; // x = y^(1/4) * (1+t)^(3/4)
+	float t2 = t * t;
+	return x * ((0.9997825f - t * 0.7585008f) + t2 * (0.5515306f - t * 1.080692f)); // minimax polynomial of degree 3
+}
+
+//Searching degree 3, k in [0x4f200000,0x4fa00000] .....................
+//  ...best design k=0x4f2ffc00 with error score 2.2867e-06
+/*
+	Approximate x^(1/-4) with a minimax polynomial of degree 3
+	Error:
+		RMS:  1.58651e-06
+		mean: 4.81378e-07
+		min:  -2.55981e-06 @ 3.68353
+		max:  2.56933e-06 @ 2.91139
+	Analytic worst-case error, before rounding: 2.2867e-06
+*/
+RB_CONSTEXPR float rbm3_inv_4_root(const float y)
+{
+	int32_t i = rb_bit_cast<int32_t>(y); // interpret float as integer
+	int32_t q = (i + (i < 0 ? 3 : 0)) >> 2; // i / 4, rounding toward zero
+	i = 0x4f2ffc00 - q; // log-approximation hack, for y^(-1/4)
+	float z = rb_bit_cast<float>(i);
+	float x = z, t = y * ((z*z)*(z*z)) - 1.0f; // x = y^(-1/4) * (1+t)^(1/4)
+	float t2 = t * t;
+	return x * ((0.81179976f - t * 1.3905635f) + t2 * (-2.2318192f - t * 1.9201467f)); // minimax polynomial of degree 3
+}
+
+//Searching degree 4, k in [0x5f000000,0x5f800000] ..........................
+//  ...best design k=0x5f2d2058 with error score 1.37492e-08
+/*
+	Approximate x^(1/2) with a minimax polynomial of degree 4
+	Error:
+		RMS:  6.10182e-08
+		mean: 2.57363e-09
+		min:  -2.35189e-07 @ 1.02765
+		max:  2.38415e-07 @ 1.00003
+	Analytic worst-case error, before rounding: 1.37492e-08
+*/
+RB_CONSTEXPR float rbm4_2_root(const float y)
+{
+	int32_t i = rb_bit_cast<int32_t>(y); // interpret float as integer
+	int32_t q = (i + (i < 0 ? 1 : 0)) >> 1; // i / 2, rounding toward zero
+	i = 0x5f2d2058 - q; // log-approximation hack, for y^(-1/2)
+	float z = rb_bit_cast<float>(i);
+	float x = y * z, t = x * z - 1.0f; // x = y^(1/2) * (1+t)^(1/2)
+	float t2 = t * t;
+	return x * ((1.0000014f - t * 0.4999027f) + t2 * ((0.37745062f - t * 0.28403166f) + t2 * 0.42305815f)); // minimax polynomial of degree 4
+}
+
+//Searching degree 4, k in [0x5f000000,0x5f800000] ..........................
+//  ...best design k=0x5f2d2058 with error score 1.37492e-08
+/*
+	Approximate x^(1/-2) with a minimax polynomial of degree 4
+	Error:
+		RMS:  6.67003e-08
+		mean: 2.56235e-09
+		min:  -2.49669e-07 @ 1.0966
+		max:  2.62978e-07 @ 2.16291
+	Analytic worst-case error, before rounding: 1.37492e-08
+*/
+RB_CONSTEXPR float rbm4_inv_2_root(const float y)
+{
+	int32_t i = rb_bit_cast<int32_t>(y); // interpret float as integer
+	int32_t q = (i + (i < 0 ? 1 : 0)) >> 1; // i / 2, rounding toward zero
+	i = 0x5f2d2058 - q; // log-approximation hack, for y^(-1/2)
+	float z = rb_bit_cast<float>(i);
+	float x = z, t = y * (z*z) - 1.0f; // x = y^(-1/2) * (1+t)^(1/2)
+	float t2 = t * t;
+	return x * ((1.0000014f - t * 0.4999027f) + t2 * ((0.37745062f - t * 0.28403166f) + t2 * 0.42305815f)); // minimax polynomial of degree 4
+}
+
+//Searching degree 4, k in [0x546aaaa8,0x54eaaaa8] ......................
+//  ...best design k=0x54b7eaa8 with error score 1.18454e-07
+/*
+	Approximate x^(1/3) with a minimax polynomial of degree 4
+	Error:
+		RMS:  1.00531e-07
+		mean: -1.81829e-08
+		min:  -3.26377e-07 @ 6.0909
+		max:  3.37314e-07 @ 1.19176
+	Analytic worst-case error, before rounding: 1.18454e-07
+*/
+RB_CONSTEXPR float rbm4_3_root(const float y)
+{
+	int32_t i = rb_bit_cast<int32_t>(y); // interpret float as integer
+	int32_t q = (int32_t)(rb_mulhi((uint32_t)i, 0x55555556u) - (i < 0 ? 0x55555556u : 0u));
+	q += (i < 0); // i / 3, rounding toward zero
+	i = 0x54b7eaa8 - q; // log-approximation hack, for y^(-1/3)
+	float z = rb_bit_cast<float>(i);
+	float x = y * (z*z), t = x * z - 1.0f; // x = y^(1/3) * (1+t)^(2/3)
+	float t2 = t * t;
+	return x * ((0.9989434f - t * 0.6529315f) + t2 * ((0.48185104f - t * 0.2811277f) + t2 * 0.08549455f)); // minimax polynomial of degree 4
+}
+
+//Searching degree 4, k in [0x546aaaa8,0x54eaaaa8] ........................
+//  ...best design k=0x54c23298 with error score 4.596e-08
+/*
+	Approximate x^(1/-3) with a minimax polynomial of degree 4
+	Error:
+		RMS:  6.47039e-08
+		mean: 5.00686e-09
+		min:  -2.59562e-07 @ 1.29034
+		max:  2.50571e-07 @ 2.75162
+	Analytic worst-case error, before rounding: 4.596e-08
+*/
+RB_CONSTEXPR float rbm4_inv_3_root(const float y)
+{
+	int32_t i = rb_bit_cast<int32_t>(y); // interpret float as integer
+	int32_t q = (int32_t)(rb_mulhi((uint32_t)i, 0x55555556u) - (i < 0 ? 0x55555556u : 0u));
+	q += (i < 0); // i / 3, rounding toward zero
+	i = 0x54c23298 - q; // log-approximation hack, for y^(-1/3)
+	float z = rb_bit_cast<float>(i);
+	float x = z, t = y * (z*z*z) - 1.0f; // x = y^(-1/3) * (1+t)^(1/3)
+	float t2 = t * t;
+	return x * ((0.9981131f - t * 0.31798023f) + t2 * ((0.16930592f - t * 0.070193894f) + t2 * 0.014465948f)); // minimax polynomial of degree 4
+}
+
+//Searching degree 4, k in [0x4f200000,0x4fa00000] .......................
+//  ...best design k=0x4f51f7ff with error score 7.67181e-07
+/*
+	Approximate x^(1/4) with a minimax polynomial of degree 4
+	Error:
+		RMS:  6.08647e-07
+		mean: 3.37149e-08
+		min:  -1.00363e-06 @ 5.68489
+		max:  1.02777e-06 @ 1.80989
+	Analytic worst-case error, before rounding: 7.67181e-07
+*/
+RB_CONSTEXPR float rbm4_4_root(const float y)
+{
+	int32_t i = rb_bit_cast<int32_t>(y); // interpret float as integer
+	int32_t q = (i + (i < 0 ? 3 : 0)) >> 2; // i / 4, rounding toward zero
+	i = 0x4f51f7ff - q; // log-approximation hack, for y^(-1/4)
+	float z = rb_bit_cast<float>(i);
+	float x = y * (z*z*z), t = x * z - 1.0f; // x = y^(1/4) * (1+t)^(3/4)
+	float t2 = t * t;
+	return x * ((1.0000038f - t * 0.7496276f) + t2 * ((0.6663865f - t * 0.49389088f) + t2 * 1.0262481f)); // minimax polynomial of degree 4
+}
+
+//Searching degree 4, k in [0x4f200000,0x4fa00000] ....................
+//  ...best design k=0x4f700000 with error score 1.15675e-07
+/*
+	Approximate x^(1/-4) with a minimax polynomial of degree 4
+	Error:
+		RMS:  1.03995e-07
+		mean: 1.31981e-08
+		min:  -3.55603e-07 @ 15.6406
+		max:  3.45086e-07 @ 13.8709
+	Analytic worst-case error, before rounding: 1.15675e-07
+*/
+RB_CONSTEXPR float rbm4_inv_4_root(const float y)
+{
+	int32_t i = rb_bit_cast<int32_t>(y); // interpret float as integer
+	int32_t q = (i + (i < 0 ? 3 : 0)) >> 2; // i / 4, rounding toward zero
+	i = 0x4f700000 - q; // log-approximation hack, for y^(-1/4)
+	float z = rb_bit_cast<float>(i);
+	float x = z, t = y * ((z*z)*(z*z)) - 1.0f; // x = y^(-1/4) * (1+t)^(1/4)
+	float t2 = t * t;
+	return x * ((0.998808f - t * 0.24009897f) + t2 * ((0.12163879f - t * 0.0496157f) + t2 * 0.010169976f)); // minimax polynomial of degree 4
+}
+
@@ -0,0 +1,130 @@
+#pragma once
+
+
+#include <cstddef>
+#include <cstdint>
+#include <algorithm>
+#include <atomic>
+#include <functional>
+#include <mutex>
+#include <condition_variable>
+#include <thread>
+#include <vector>
+
+
+namespace rootbeer
+{
+	/*
+		Executors run task(0) ... task(count-1) and return when all have finished.
+		Any type with a compatible parallel_for and concurrency may be used.
+	*/
+	struct SerialExecutor
+	{
+		template<typename T_Task>
+		void parallel_for(const size_t count, const T_Task &task) const
+		{
+			for (size_t i = 0; i < count; ++i) task(i);
+		}
+
+		unsigned concurrency() const    {return 1;}
+	};
+
+	/*
+		A fixed set of worker threads.  The calling thread joins in each job.
+		Jobs from different threads are run one after another;
+		calling parallel_for from within a task is not supported.
+	*/
+	class ThreadPool
+	{
+	public:
+		// Zero threads means one per hardware thread.
+		explicit ThreadPool(unsigned threads = 0)
+		{
+			if (!threads) threads = std::max(1u, std::thread::hardware_concurrency());
+			for (unsigned i = 1; i < threads; ++i)
+				workers.emplace_back([this]() {work();});
+		}
+		~ThreadPool()
+		{
+			{
+				std::lock_guard<std::mutex> lock(mutex);
+				stopping = true;
+			}
+			wake.notify_all();
+			for (auto &worker : workers) worker.join();
+		}
+
+		ThreadPool(const ThreadPool&) = delete;
+		ThreadPool &operator=(const ThreadPool&) = delete;
+
+		unsigned concurrency() const    {return unsigned(workers.size()) + 1;}
+
+		template<typename T_Task>
+		void parallel_for(const size_t count, const T_Task &task)
+		{
+			std::lock_guard<std::mutex> one_job(submit);
+
+			Job job;
+			job.count = count;
+			job.run   = [&task](const size_t i) {task(i);};
+			{
+				std::lock_guard<std::mutex> lock(mutex);
+				current = &job;
+				++generation;
+			}
+			wake.notify_all();
+
+			drain(job);
+
+			// Wait for the workers to finish and let go of the job
+			std::unique_lock<std::mutex> lock(mutex);
+			done.wait(lock, [&]() {return active == 0 && job.finished == job.count;});
+			current = nullptr;
+		}
+
+	private:
+		struct Job
+		{
+			std::function<void(size_t)> run;
+			size_t                      count = 0;
+			std::atomic<size_t>         next{0}, finished{0};
+		};
+
+		static void drain(Job &job)
+		{
+			for (size_t i; (i = job.next++) < job.count; ++job.finished)
+				job.run(i);
+		}
+
+		void work()
+		{
+			uint64_t seen = 0;
+			while (true)
+			{
+				Job *job;
+				{
+					std::unique_lock<std::mutex> lock(mutex);
+					wake.wait(lock, [&]() {return stopping || (current && generation != seen);});
+					if (stopping) return;
+					seen = generation;
+					job = current;
+					++active;
+				}
+				drain(*job);
+				{
+					std::lock_guard<std::mutex> lock(mutex);
+					--active;
+				}
+				done.notify_all();
+			}
+		}
+
+		std::vector<std::thread> workers;
+		std::mutex               submit, mutex;
+		std::condition_variable  wake, done;
+		Job                     *current = nullptr;
+		uint64_t                 generation = 0;
+		unsigned                 active = 0;
+		bool                     stopping = false;
+	};
+}
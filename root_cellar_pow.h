@@ -0,0 +1,498 @@
+#pragma once
+
+
+#include <cstdint>
+#include <cmath>
+#include <algorithm>
+#include <limits>
+#include <utility>
+#include <vector>
+#include <ostream>
+#include <string>
+
+#include "root_cellar.h"
+
+
+/*
+	Approximations of fixed rational powers y^(P/Q), such as y^1.5 or y^(-3/4).
+
+	These generalize RootApprox, which is the case P = ±1:
+		The estimate reinterprets K + i*P/Q, with i the bits of y.
+		Refinements are pseudo-newtonian steps toward x^Q = y^P.
+	The refinements form y^P / x^(Q-1), or y^|P| * x^Q for negative P, one
+	factor at a time, taking y or x by which keeps the product nearest 1
+	(pow_chain).  Partial products are powers of y no further from 1 than
+	y^±1 or the result, so refinements overflow only where y^(P/Q) or 1/y
+	is within the approximation's error of the float range's limits.
+*/
+namespace rootbeer
+{
+	namespace detail
+	{
+		constexpr int gcd(const int a, const int b)    {return b ? gcd(b, a % b) : a;}
+
+		/*
+			acc times NY factors of y and NX steps by x, multiplying or (for
+			positive P) dividing.  E tracks the power of y the product
+			approximates, in units of 1/Q: y raises it by Q and each step by x
+			lowers it by |P|.  y is taken once E is at most 0, keeping E near 0.
+		*/
+		template<int P, int Q, int NY, int NX, int E, bool DONE = (NY == 0 && NX == 0)>
+		struct pow_chain_
+		{
+			static constexpr bool TAKE_Y = (NY > 0) && (E <= 0 || NX == 0);
+			template<typename X> static constexpr X calc(const X acc, const X y, const X x)
+			{
+				return pow_chain_<P, Q, NY - (TAKE_Y ? 1 : 0), NX - (TAKE_Y ? 0 : 1), E + (TAKE_Y ? Q : ((P<0) ? P : -P))>
+					::calc(TAKE_Y ? acc*y : ((P > 0) ? acc/x : acc*x), y, x);
+			}
+		};
+		template<int P, int Q, int NY, int NX, int E>
+		struct pow_chain_<P, Q, NY, NX, E, true>
+		{
+			template<typename X> static constexpr X calc(const X acc, const X, const X)    {return acc;}
+		};
+
+		// y^P / x^(Q-1) for positive P, or y^|P| * x^Q for negative P, with y first
+		template<int P, int Q, typename X>
+		constexpr X pow_chain(const X y, const X x)
+		{
+			return pow_chain_<P, Q, ((P<0) ? -P : P) - 1, (P>0) ? Q-1 : Q, Q>::calc(y, y, x);
+		}
+
+		// The expression pow_chain evaluates, in the same order, such as (y/x*y*y)
+		inline std::string pow_chain_expression(const int P, const int Q)
+		{
+			const int abs_p = (P<0) ? -P : P;
+			int ny = abs_p - 1, nx = (P>0) ? Q-1 : Q, e = Q;
+			std::string expr = "y";
+			while (ny > 0 || nx > 0)
+			{
+				const bool take_y = (ny > 0) && (e <= 0 || nx == 0);
+				if (take_y) {expr += "*y"; --ny; e += Q;}
+				else        {expr += (P > 0) ? "/x" : "*x"; --nx; e -= abs_p;}
+			}
+			return (expr.size() > 1) ? "(" + expr + ")" : expr;
+		}
+
+		// y^(P/Q) in extended precision, as the reference for measuring error
+		template<int P, int Q>
+		double pow_reference(const double y)
+		{
+			return double(std::pow((long double)(y), (long double)(P) / (long double)(Q)));
+		}
+	}
+
+	/*
+		A formula for approximate rational powers affording fast implementation.
+	*/
+	template<int P, int Q, typename T_Float, unsigned NewtonSteps = 1>
+	struct PowApprox
+	{
+		static_assert(P != 0, "zero exponent is invalid");
+		static_assert(Q > 0, "exponent denominator must be positive");
+		static_assert(detail::gcd((P<0) ? -P : P, Q) == 1, "exponent must be in lowest terms");
+
+		static constexpr int ABS_P = ((P<0) ? -P : P);
+
+		// Refinements map the ratio x / y^(P/Q) like RootApprox<ROOT_EQUIV>'s
+		static constexpr int ROOT_EQUIV = ((P>0) ? Q : -Q);
+
+		using float_t  = T_Float;
+		using range_t  = std::pair<float_t, float_t>;
+		using as_int_t = float_as_int_t<float_t>;
+		using uint_t   = typename std::make_unsigned<as_int_t>::type;
+
+		using steps_t  = std::array<float_t, NewtonSteps>;
+
+		as_int_t constant;
+		steps_t  newton_m;  // Pseudo-newtonian constant for each refinement
+
+		constexpr PowApprox(as_int_t _constant) :
+			constant(_constant), newton_m(detail::fill_array<NewtonSteps>(float_t(1) / float_t(ROOT_EQUIV))) {}
+		constexpr PowApprox(as_int_t _constant, float_t _newton_m) :
+			constant(_constant), newton_m(detail::fill_array<NewtonSteps>(_newton_m)) {}
+		constexpr PowApprox(as_int_t _constant, const steps_t &_newton_m) :
+			constant(_constant), newton_m(_newton_m) {}
+
+		/*
+			Initial estimate based on float-reinterpretation hack.
+			i*P/Q is computed as (i/Q)*P + ((i%Q)*P)/Q, which truncates the
+			same way without overflowing; arithmetic on the result wraps.
+		*/
+		ROOTBEER_CONSTEXPR float_t initialEstimate(const float_t y) const
+		{
+			const as_int_t
+				i = reinterpret_float_int(y),
+				q = detail::div_i<Q>(i),
+				r = detail::div_i<Q>(as_int_t((i - q*Q) * P));
+			return reinterpret_int_float(as_int_t(uint_t(constant) + uint_t(q) * uint_t(P) + uint_t(r)));
+		}
+
+		/*
+			One step of newtonian refinement.
+		*/
+		constexpr float_t newtonianRefinement(const float_t y, const float_t x, const unsigned step) const
+		{
+			const float_t m = newton_m[step];
+			if (P > 0) return x *  (float_t(1)-m) + m * detail::pow_chain<P, Q>(y, x);
+			else       return x * ((float_t(1)-m) + m * detail::pow_chain<P, Q>(y, x));
+		}
+
+		/*
+			Complete calculation.
+		*/
+		ROOTBEER_CONSTEXPR float_t operator()(const float_t y) const
+		{
+			float_t x = initialEstimate(y);
+
+			for (unsigned i = 0; i < NewtonSteps; ++i)
+				x = newtonianRefinement(y, x, i);
+
+			return x;
+		}
+
+		/*
+			The constant mapping 1 to 1, (1 - P/Q) times the bits of 1.
+			It overflows for some exponents and is wrapped like the estimate;
+			designs differ from it by a small offset.
+		*/
+		static as_int_t constant_identity()
+		{
+			const as_int_t one = reinterpret_float_int(float_t(1));
+			return as_int_t(uint_t(one / Q) * uint_t(Q-P) + uint_t(one % Q * (Q-P) / Q));
+		}
+		as_int_t constant_offset() const
+		{
+			return as_int_t(uint_t(constant) - uint_t(constant_identity()));
+		}
+
+		// The error repeats every Q binades of y, as the estimate gains P binades.
+		static range_t test_param_range()
+		{
+			return std::make_pair(float_t(1), float_t(1<<Q));
+		}
+
+		/*
+			Calculate range of the ratio x / y^(P/Q) for the initial estimate.
+
+			Between the binade boundaries of y and those of the estimate, the
+			estimate is linear in y: a + b*y.  The ratio is then extreme at the
+			ends of each section or where b*y*(1 - P/Q) = a*P/Q.
+		*/
+		range_t errorRange_initial() const
+		{
+			const double
+				e = double(P) / double(Q),
+				L = std::ldexp(1.0, int(detail::float_traits<float_t>::bits_mantissa)),
+				B = double((as_int_t(1) << (detail::float_traits<float_t>::bits_exponent-1)) - 1);
+			range_t range(float_t(1e20), float_t(-1e20));
+
+			auto consider = [&](const double y)
+			{
+				const float_t yf = float_t(y);
+				const double ratio = double(initialEstimate(yf)) / detail::pow_reference<P, Q>(yf);
+				range.first  = std::min(range.first,  float_t(ratio));
+				range.second = std::max(range.second, float_t(ratio));
+			};
+
+			// Section boundaries: each binade of y, and where the estimate changes binade
+			const range_t domain = test_param_range();
+			std::vector<double> cuts;
+			for (int j = 0; j <= Q; ++j) cuts.push_back(std::ldexp(1.0, j));
+			for (int j = std::min(0, P) - 1; j <= std::max(0, P) + 1; ++j)
+			{
+				const double bits = ((B + j) * L - (1.0 - e) * B * L - double(constant_offset())) / e;
+				if (!(bits > 0.0) || !(bits < double(std::numeric_limits<as_int_t>::max()))) continue;
+				const double y = reinterpret_int_float(as_int_t(bits));
+				if (y > domain.first && y < domain.second) cuts.push_back(y);
+			}
+			std::sort(cuts.begin(), cuts.end());
+
+			for (size_t s = 0; s+1 < cuts.size(); ++s)
+			{
+				const double
+					y1 = cuts[s], y2 = cuts[s+1],
+					x1 = initialEstimate(float_t(y1)), x2 = initialEstimate(float_t(y2));
+				consider(y1);
+				if (!(y1 < y2) || x1 == x2) continue;
+
+				const double b = (x2-x1) / (y2-y1), a = x1 - b*y1, yM = e*a / (b*(1.0 - e));
+				if (yM > y1 && yM < y2) consider(yM);
+			}
+			consider(cuts.back());
+
+			return range;
+		}
+		range_t errorRange_refine(range_t prevRange, const unsigned step) const
+		{
+			return RootApprox<ROOT_EQUIV, float_t, NewtonSteps>(constant, newton_m).errorRange_refine(prevRange, step);
+		}
+
+		range_t errorRange() const
+		{
+			range_t range = errorRange_initial();
+
+			for (unsigned i = 0; i < NewtonSteps; ++i)
+				range = errorRange_refine(range, i);
+
+			return range;
+		}
+
+		float_t error_worstCase() const
+		{
+			range_t range = errorRange();
+			return std::max(std::abs(range.first-float_t(1)), std::abs(range.second-float_t(1)));
+		}
+	};
+
+
+	/*
+		Exhaustively measure error of an approximation of y^(P/Q) for every float
+		between range_min and range_max, against an extended-precision reference.
+		Chunks of the range are distributed over the executor's threads.
+	 */
+	template<int P, int Q, typename T_Approx, typename T_Float, typename T_Executor>
+	inline PowApprox_Stats Test_Pow_Approx(
+		const T_Approx &approx,
+		T_Float range_min,
+		T_Float range_max,
+		T_Executor &&executor)
+	{
+		using float_t = T_Float;
+		using int_t = float_as_int_t<float_t>;
+		int_t
+			ib = reinterpret_float_int(range_min),
+			ie = reinterpret_float_int(range_max);
+
+		std::vector<PowApprox_Accumulator> partial(detail::count_chunks(ib, ie));
+		executor.parallel_for(partial.size(), [&](const size_t c)
+		{
+			PowApprox_Accumulator &acc = partial[c];
+			detail::scan_chunk(c, ib, ie, [&](const int_t i)
+			{
+				float_t y = reinterpret_int_float(i);
+				double x = detail::pow_reference<P, Q>(y);
+				acc.add((double(approx(y)) - x) / x, y);
+			});
+		});
+
+		PowApprox_Accumulator total;
+		for (auto &p : partial) total.merge(p);
+		return total.stats();
+	}
+
+	template<int P, int Q, typename T_Approx, typename T_Float>
+	inline PowApprox_Stats Test_Pow_Approx(
+		const T_Approx &approx,
+		T_Float range_min,
+		T_Float range_max)
+	{
+		return Test_Pow_Approx<P, Q>(approx, range_min, range_max, SerialExecutor());
+	}
+
+	template<int P, int Q, typename T_Approx, typename T_Float>
+	inline PowApprox_Stats Test_Pow_Approx_Parallel(
+		const T_Approx &approx,
+		T_Float range_min,
+		T_Float range_max,
+		unsigned threads = 0)
+	{
+		ThreadPool pool(threads);
+		return Test_Pow_Approx<P, Q>(approx, range_min, range_max, pool);
+	}
+
+
+	/*
+		Score a design on the given basis; lower is better.
+		There is no certified bound for powers, so CERTIFIED_WORST_CASE
+		uses the analytic range like APPROX_WORST_CASE.
+	 */
+	template<BEST_APPROX_BASIS Basis, int P, int Q, typename T_Float, unsigned NewtonSteps>
+	T_Float PowApprox_Score(const PowApprox<P, Q, T_Float, NewtonSteps> &candidate)
+	{
+		const auto range = PowApprox<P, Q, T_Float, NewtonSteps>::test_param_range();
+
+		switch (Basis)
+		{
+		default:
+		case BEST_WORST_CASE:   return T_Float(Test_Pow_Approx<P, Q>(candidate, range.first, range.second).worst_error());
+		case BEST_MEAN_SQUARE:  return T_Float(Test_Pow_Approx<P, Q>(candidate, range.first, range.second).mean_sq_error);
+		case APPROX_WORST_CASE:
+		case CERTIFIED_WORST_CASE: return candidate.error_worstCase();
+		}
+	}
+
+	/*
+		Search for the best design over (k, m).
+
+		Worst-case error has several local minima in k for these exponents, which
+		trap the grids of RootApprox_Best.  Instead, m is fitted to each k, and
+		k is scanned coarsely and then refined around the best by a halving stride.
+		Fits are run on the executor's threads; ties go to the earliest.
+		The analytic basis takes about a second; exhaustive bases scan Q binades
+		per candidate and are much slower.
+	 */
+	template<int P, int Q, typename T_Float, unsigned NewtonSteps = 1, BEST_APPROX_BASIS Basis = APPROX_WORST_CASE, typename T_Executor>
+	PowApprox<P,Q,T_Float,NewtonSteps> PowApprox_Best(T_Executor &&executor)
+	{
+		using float_t  = T_Float;
+		using as_int_t = float_as_int_t<float_t>;
+		using design_t = PowApprox<P, Q, T_Float, NewtonSteps>;
+
+		// Worst-case value of x - log2(1 + x)
+		const double
+			sigma_min = .00000,
+			sigma_max = .08608;
+
+		/*
+			k is searched as an offset from constant_identity.  The estimate's error
+			scales with the larger of |P/Q| and |1 - P/Q|, and worst-case error has
+			several local minima in k, so the range extends both ways.
+		*/
+		const double
+			L = std::ldexp(1.0, int(detail::float_traits<float_t>::bits_mantissa)),
+			e = double(P) / double(Q),
+			k_reach = 1.5 * std::max({1.0, std::abs(e), std::abs(1.0 - e)}) * L * (sigma_max - sigma_min);
+		const float_t
+			p = float_t(1)/float_t(design_t::ROOT_EQUIV);
+		as_int_t
+			k_min = as_int_t(std::floor(-k_reach)),
+			k_max = as_int_t(std::ceil ( k_reach)),
+			m_min = reinterpret_float_int(p*float_t(.75)),
+			m_max = reinterpret_float_int(p*float_t(1.5));
+		if (m_min > m_max) std::swap(m_min, m_max);
+		if (NewtonSteps == 0) m_max = m_min;
+
+		using uint_t = typename design_t::uint_t;
+		const uint_t identity = uint_t(design_t::constant_identity());
+		auto constant = [=](as_int_t k)    {return as_int_t(identity + uint_t(k));};
+
+		auto get_score = [=](as_int_t k, as_int_t m) -> float_t
+		{
+			return PowApprox_Score<Basis>(design_t(constant(k), reinterpret_int_float(m)));
+		};
+
+		// Fit m to a given k by ternary search, finishing exhaustively
+		struct fit_t {float_t score; as_int_t k, m;};
+		auto fit = [&](const as_int_t k) -> fit_t
+		{
+			as_int_t lo = m_min, hi = m_max;
+			while (hi - lo > 2)
+			{
+				as_int_t a = lo + (hi-lo)/3, b = hi - (hi-lo)/3;
+				if (get_score(k, a) < get_score(k, b)) hi = b;
+				else                                   lo = a;
+			}
+			fit_t best = {get_score(k, lo), k, lo};
+			for (as_int_t m = lo+1; m <= hi; ++m)
+			{
+				float_t score = get_score(k, m);
+				if (score < best.score) best = {score, k, m};
+			}
+			return best;
+		};
+
+		std::cout << std::hex << "//Searching k in [0x"
+			<< uint_t(constant(k_min)) << ",0x" << uint_t(constant(k_max))
+			<< "], m in [" << reinterpret_int_float(m_min)
+			<< "," << reinterpret_int_float(m_max) << "] ";
+
+		// Scan k coarsely, then halve a stride around the best until it vanishes
+		static const size_t COARSE = 64;
+		std::vector<as_int_t> ks;
+		for (size_t i = 0; i <= COARSE; ++i) ks.push_back(as_int_t(k_min + (k_max-k_min) / as_int_t(COARSE) * as_int_t(i)));
+		as_int_t stride = nextpow2(as_int_t((k_max-k_min) / as_int_t(COARSE)));
+
+		fit_t best = {float_t(1e20), 0, m_min};
+		std::vector<fit_t> fits;
+		while (ks.size())
+		{
+			std::cout << '.' << std::flush;
+			fits.resize(ks.size());
+			executor.parallel_for(ks.size(), [&](const size_t i)
+			{
+				fits[i] = fit(ks[i]);
+			});
+			bool moved = false;
+			for (auto &f : fits) if (f.score < best.score) {best = f; moved = true;}
+
+			if (!moved) stride /= 2;
+			ks.clear();
+			if (stride > 0) ks = {best.k - stride, best.k + stride};
+		}
+		std::cout << std::endl;
+
+		design_t result(constant(best.k), reinterpret_int_float(best.m));
+
+		std::cout << "//  ...best design k=" << uint_t(result.constant)
+			<< ", m=" << reinterpret_int_float(best.m)
+			<< " with error score " << best.score << std::endl;
+		return result;
+	}
+
+	template<int P, int Q, typename T_Float, unsigned NewtonSteps = 1, BEST_APPROX_BASIS Basis = APPROX_WORST_CASE>
+	PowApprox<P,Q,T_Float,NewtonSteps> PowApprox_Best()
+	{
+		return PowApprox_Best<P, Q, T_Float, NewtonSteps, Basis>(SerialExecutor());
+	}
+
+	template<int P, int Q, typename T_Float, unsigned NewtonSteps = 1, BEST_APPROX_BASIS Basis = APPROX_WORST_CASE>
+	PowApprox<P,Q,T_Float,NewtonSteps> PowApprox_Best_Parallel(unsigned threads = 0)
+	{
+		ThreadPool pool(threads);
+		return PowApprox_Best<P, Q, T_Float, NewtonSteps, Basis>(pool);
+	}
+}
+
+
+/*
+	Emit a design as a function named rb_pow_P_Q, or rb_inv_pow_P_Q for negative powers.
+	Requires the definitions from Print_Generated_Preamble.
+*/
+template<int P, int Q, typename T_Float, unsigned NewtonSteps>
+std::ostream &operator<<(std::ostream &out,
+	const rootbeer::PowApprox<P, Q, T_Float, NewtonSteps> &approx)
+{
+	static const int absP = ((P<0)?-P:P);
+
+	using float_t = T_Float;
+	const char *float_decl = rootbeer::detail::float_traits<float_t>::name();
+	using as_int_t = rootbeer::float_as_int_t<float_t>;
+	using uint_t   = typename std::make_unsigned<as_int_t>::type;
+	const char *int_decl  = rootbeer::detail::int_traits<as_int_t>::name();
+	const char *uint_decl = rootbeer::detail::int_traits<uint_t>::name();
+
+	out << std::dec;
+	out << "RB_CONSTEXPR " << float_decl << " rb_";
+	if (P < 0) out << "inv_";
+	out << "pow_" << absP << "_" << Q << "(const " << float_decl << " y)\n";
+	out << "{\n";
+	out << "\t" << int_decl << " i = rb_bit_cast<" << int_decl << ">(y); // interpret float as integer\n";
+
+	// Magic line: K + i*P/Q, computed as (i/Q)*P + ((i%Q)*P)/Q with wrapping arithmetic
+	rootbeer::detail::print_div_i<as_int_t, Q>(out, "q", "i");
+	out << std::dec << "\t" << int_decl << " r = (i - q*" << Q << ") * " << P << ";\n";
+	rootbeer::detail::print_div_i<as_int_t, Q>(out, "s", "r");
+	out << "\ti = (" << int_decl << ")(0x" << std::hex << uint_t(approx.constant) << "u "
+		<< ((P>0) ? "+" : "-") << " (" << uint_decl << ")q * " << std::dec << absP << "u + (" << uint_decl << ")s);"
+		<< " // log-approximation hack\n";
+	out << "\t" << float_decl << " x = rb_bit_cast<" << float_decl << ">(i);\n";
+
+	// Newtonian lines
+	for (unsigned i = 0; i < NewtonSteps; ++i)
+	{
+		const float_t m = approx.newton_m[i];
+		if (P > 0)
+			out << "\tx = " << rootbeer::detail::exact_literal(float_t(1)-m) << " * x + " << rootbeer::detail::exact_literal(m);
+		else
+			out << "\tx *= " << rootbeer::detail::exact_literal(float_t(1)-m) << " - " << rootbeer::detail::exact_literal(float_t(-m));
+		out << " * " << rootbeer::detail::pow_chain_expression(P, Q);
+		out << "; // newtonian step #" << (i+1) << "\n";
+	}
+	out << "\treturn x;\n";
+
+	out << "}";
+
+	return out;
+}
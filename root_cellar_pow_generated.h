@@ -0,0 +1,180 @@
+#pragma once
+#include <stdint.h>
+#include <string.h>
+
+#ifndef RB_CONSTEXPR
+#if (__cplusplus >= 202002L) || (defined(_MSVC_LANG) && _MSVC_LANG >= 202002L)
+	#include <bit>
+#endif
+#if defined(__has_builtin)
+	#if __has_builtin(__builtin_bit_cast)
+		#define RB_BUILTIN_BIT_CAST 1
+	#endif
+#elif defined(_MSC_VER) && (_MSC_VER >= 1927)
+	#define RB_BUILTIN_BIT_CAST 1
+#endif
+#if defined(__cpp_lib_bit_cast)
+	#define RB_CONSTEXPR constexpr
+	template<typename To, typename From> constexpr To rb_bit_cast(const From &v) {return std::bit_cast<To>(v);}
+#elif defined(RB_BUILTIN_BIT_CAST)
+	#define RB_CONSTEXPR constexpr
+	template<typename To, typename From> constexpr To rb_bit_cast(const From &v) {return __builtin_bit_cast(To, v);}
+#else
+	#define RB_CONSTEXPR inline
+	template<typename To, typename From> inline To rb_bit_cast(const From &v) {To t; memcpy(&t, &v, sizeof(To)); return t;}
+#endif
+#endif
+
+#ifndef RB_MULHI
+#define RB_MULHI 1
+// High half of a product, for division by a magic reciprocal
+#if defined(__SIZEOF_INT128__)
+__extension__ typedef unsigned __int128 rb_uint128;
+#endif
+RB_CONSTEXPR uint32_t rb_mulhi(uint32_t a, uint32_t b) {return (uint32_t)(((uint64_t)a * b) >> 32);}
+RB_CONSTEXPR uint64_t rb_mulhi(uint64_t a, uint64_t b)
+{
+#if defined(__SIZEOF_INT128__)
+	return (uint64_t)(((rb_uint128)a * b) >> 64);
+#else
+	uint64_t a1 = a >> 32, a0 = a & 0xFFFFFFFFu, b1 = b >> 32, b0 = b & 0xFFFFFFFFu;
+	uint64_t mid = ((a0*b0) >> 32) + ((a1*b0) & 0xFFFFFFFFu) + ((a0*b1) & 0xFFFFFFFFu);
+	return a1*b1 + ((a1*b0) >> 32) + ((a0*b1) >> 32) + (mid >> 32);
+#endif
+}
+#endif
+
+
+// Rational powers optimized for worst-case error
+
+
+/*
+	Approximate x^(3/2) with 1 newtonian steps
+	Error:
+		RMS:  0.000872762
+		mean: -0.000606582
+		min:  -0.00114229 @ 1.75416
+		max:  0.00114227 @ 1.6085
+	Analytic worst-case error: 0.00114214
+*/
+RB_CONSTEXPR float rb_pow_3_2(const float y)
+{
+	int32_t i = rb_bit_cast<int32_t>(y); // interpret float as integer
+	int32_t q = (i + (i < 0 ? 1 : 0)) >> 1; // i / 2, rounding toward zero
+	int32_t r = (i - q*2) * 3;
+	int32_t s = (r + (r < 0 ? 1 : 0)) >> 1; // r / 2, rounding toward zero
+	i = (int32_t)(0xe04b2b4au + (uint32_t)q * 3u + (uint32_t)s); // log-approximation hack
+	float x = rb_bit_cast<float>(i);
+	x = 0.4761094f * x + 0.5238906f * (y/x*y*y); // newtonian step #1
+	return x;
+}
+
+/*
+	Approximate x^(-3/2) with 1 newtonian steps
+	Error:
+		RMS:  0.00183098
+		mean: 0.000746321
+		min:  -0.00242359 @ 3.05006
+		max:  0.00242376 @ 1.56287
+	Analytic worst-case error: 0.00242352
+*/
+RB_CONSTEXPR float rb_inv_pow_3_2(const float y)
+{
+	int32_t i = rb_bit_cast<int32_t>(y); // interpret float as integer
+	int32_t q = (i + (i < 0 ? 1 : 0)) >> 1; // i / 2, rounding toward zero
+	int32_t r = (i - q*2) * -3;
+	int32_t s = (r + (r < 0 ? 1 : 0)) >> 1; // r / 2, rounding toward zero
+	i = (int32_t)(0x9ea811a2u - (uint32_t)q * 3u + (uint32_t)s); // log-approximation hack
+	float x = rb_bit_cast<float>(i);
+	x *= 1.5636046f - 0.56360453f * (y*x*y*x*y); // newtonian step #1
+	return x;
+}
+
+/*
+	Approximate x^(2/3) with 1 newtonian steps
+	Error:
+		RMS:  0.000775061
+		mean: -0.00053723
+		min:  -0.00101529 @ 1.00813
+		max:  0.00101532 @ 3.1737
+	Analytic worst-case error: 0.00101519
+*/
+RB_CONSTEXPR float rb_pow_2_3(const float y)
+{
+	int32_t i = rb_bit_cast<int32_t>(y); // interpret float as integer
+	int32_t q = (int32_t)(rb_mulhi((uint32_t)i, 0x55555556u) - (i < 0 ? 0x55555556u : 0u));
+	q += (i < 0); // i / 3, rounding toward zero
+	int32_t r = (i - q*3) * 2;
+	int32_t s = (int32_t)(rb_mulhi((uint32_t)r, 0x55555556u) - (r < 0 ? 0x55555556u : 0u));
+	s += (r < 0); // r / 3, rounding toward zero
+	i = (int32_t)(0x15234164u + (uint32_t)q * 2u + (uint32_t)s); // log-approximation hack
+	float x = rb_bit_cast<float>(i);
+	x = 0.68767756f * x + 0.31232244f * (y/x/x*y); // newtonian step #1
+	return x;
+}
+
+/*
+	Approximate x^(-2/3) with 1 newtonian steps
+	Error:
+		RMS:  0.00108612
+		mean: 0.000440408
+		min:  -0.00143718 @ 1.52488
+		max:  0.00143739 @ 6.62602
+	Analytic worst-case error: 0.00143719
+*/
+RB_CONSTEXPR float rb_inv_pow_2_3(const float y)
+{
+	int32_t i = rb_bit_cast<int32_t>(y); // interpret float as integer
+	int32_t q = (int32_t)(rb_mulhi((uint32_t)i, 0x55555556u) - (i < 0 ? 0x55555556u : 0u));
+	q += (i < 0); // i / 3, rounding toward zero
+	int32_t r = (i - q*3) * -2;
+	int32_t s = (int32_t)(rb_mulhi((uint32_t)r, 0x55555556u) - (r < 0 ? 0x55555556u : 0u));
+	s += (r < 0); // r / 3, rounding toward zero
+	i = (int32_t)(0x69c566c1u - (uint32_t)q * 2u + (uint32_t)s); // log-approximation hack
+	float x = rb_bit_cast<float>(i);
+	x *= 1.3707042f - 0.3707042f * (y*x*x*y*x); // newtonian step #1
+	return x;
+}
+
+/*
+	Approximate x^(3/4) with 1 newtonian steps
+	Error:
+		RMS:  0.00138253
+		mean: -0.00103219
+		min:  -0.00177596 @ 7.19308
+		max:  0.00177589 @ 4
+	Analytic worst-case error: 0.00177586
+*/
+RB_CONSTEXPR float rb_pow_3_4(const float y)
+{
+	int32_t i = rb_bit_cast<int32_t>(y); // interpret float as integer
+	int32_t q = (i + (i < 0 ? 3 : 0)) >> 2; // i / 4, rounding toward zero
+	int32_t r = (i - q*4) * 3;
+	int32_t s = (r + (r < 0 ? 3 : 0)) >> 2; // r / 4, rounding toward zero
+	i = (int32_t)(0xfe4ca52u + (uint32_t)q * 3u + (uint32_t)s); // log-approximation hack
+	float x = rb_bit_cast<float>(i);
+	x = 0.72361004f * x + 0.27639f * (y/x/x*y/x*y); // newtonian step #1
+	return x;
+}
+
+/*
+	Approximate x^(-3/4) with 1 newtonian steps
+	Error:
+		RMS:  0.00150051
+		mean: 0.000718383
+		min:  -0.00203151 @ 14.5807
+		max:  0.00203162 @ 5.55697
+	Analytic worst-case error: 0.00203145
+*/
+RB_CONSTEXPR float rb_inv_pow_3_4(const float y)
+{
+	int32_t i = rb_bit_cast<int32_t>(y); // interpret float as integer
+	int32_t q = (i + (i < 0 ? 3 : 0)) >> 2; // i / 4, rounding toward zero
+	int32_t r = (i - q*4) * -3;
+	int32_t s = (r + (r < 0 ? 3 : 0)) >> 2; // r / 4, rounding toward zero
+	i = (int32_t)(0x6f0ef7b8u - (uint32_t)q * 3u + (uint32_t)s); // log-approximation hack
+	float x = rb_bit_cast<float>(i);
+	x *= 1.2877108f - 0.2877108f * (y*x*x*y*x*y*x); // newtonian step #1
+	return x;
+}
+
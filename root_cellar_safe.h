@@ -0,0 +1,149 @@
+#pragma once
+
+
+#include <cstdint>
+#include <cstddef>
+#include <cassert>
+#include <type_traits>
+
+#include "root_cellar_batch.h"
+
+
+/*
+	Domain-safe root approximations (ROOT_SAFE in root_cellar.h).
+
+	RootApprox computes its formula on the bits of any input, which is only
+	meaningful for positive normal numbers.  RootApprox_Safe runs the same
+	formula on |y|, scaled by a power of two when it is denormal, and then
+	selects results for zero, infinity, NaN and negative inputs.  Every input
+	takes the same path, so the selects compile to blends or conditional moves
+	and loops over it vectorize like the fast formula.
+
+	For positive normal inputs RootApprox_Safe gives exactly the results of
+	RootApprox, and its batches those of RootApprox::apply.  Denormal inputs
+	have the accuracy of the formula at their scaled value.
+*/
+namespace rootbeer
+{
+	template<int N, typename T_Float, unsigned NewtonSteps = 1>
+	struct RootApprox_Safe : RootApprox<N, T_Float, NewtonSteps>
+	{
+		using base_t   = RootApprox<N, T_Float, NewtonSteps>;
+		using float_t  = typename base_t::float_t;
+		using as_int_t = typename base_t::as_int_t;
+
+		using base_t::base_t;
+		constexpr RootApprox_Safe(const base_t &design) : base_t(design) {}
+
+		/*
+			Complete calculation, with selects for inputs outside the formula's domain.
+		*/
+		ROOTBEER_CONSTEXPR float_t operator()(const float_t y) const
+		{
+			using domain = detail::root_domain<N, float_t>;
+			using uint_t = typename domain::uint_t;
+
+			const uint_t u = detail::bit_cast<uint_t>(y), sign = uint_t(u & domain::sign), a = uint_t(u ^ sign);
+
+			// Zero and denormals are scaled into the normal range
+			const bool tiny = (a < domain::min_normal);
+			const float_t x = base_t::operator()(float_t(detail::bit_cast<float_t>(a) * detail::bit_cast<float_t>(tiny ? domain::scale_in : domain::one)))
+				* detail::bit_cast<float_t>(tiny ? domain::scale_out : domain::one);
+
+			// Zero, infinity and NaN, which keeps its bits; then the sign of y,
+			// which even roots of negative numbers replace with NaN
+			uint_t r = (uint_t(a - 1) < uint_t(domain::infinity - 1)) ? detail::bit_cast<uint_t>(x)
+				: ((N > 0 || a > domain::infinity) ? a : uint_t(domain::infinity - a));
+			r = uint_t(r | sign);
+			if (domain::DEG % 2 == 0) r = (uint_t(u - domain::sign - 1) < domain::infinity) ? domain::quiet_nan : r;
+			return detail::bit_cast<float_t>(r);
+		}
+
+		/*
+			Batch calculation over arrays, using SIMD where available.
+			y and x may be the same array.
+		*/
+		void apply        (const float_t *y, float_t *x, size_t count) const;
+		void apply        (float_t *yx, size_t count) const;
+		void apply_aligned(const float_t *y, float_t *x, size_t count) const;
+		void apply_aligned(float_t *yx, size_t count) const;
+	};
+
+	/*
+		RootApprox or RootApprox_Safe, by policy.
+	*/
+	template<int N, typename T_Float, unsigned NewtonSteps = 1, ROOT_DOMAIN Domain = ROOT_FAST>
+	using RootApprox_Domain = typename std::conditional<Domain == ROOT_SAFE,
+		RootApprox_Safe<N, T_Float, NewtonSteps>, RootApprox<N, T_Float, NewtonSteps>>::type;
+
+
+	namespace simd
+	{
+		template<bool ALIGNED, int N, typename T_Float, unsigned NewtonSteps>
+		void safe_batch(const RootApprox<N, T_Float, NewtonSteps> &approx,
+			const T_Float *y, T_Float *x, const size_t count)
+		{
+			using ops = native_ops<T_Float>;
+
+			assert(!ALIGNED || (reinterpret_cast<uintptr_t>(y) % (sizeof(T_Float)*ops::width)) == 0);
+			assert(!ALIGNED || (reinterpret_cast<uintptr_t>(x) % (sizeof(T_Float)*ops::width)) == 0);
+
+			domain_batch<ROOT_SAFE, ops, ALIGNED>(approx, y, x, count);
+		}
+
+		/*
+			16-bit formats loop over RootApprox_Safe::operator().
+		*/
+		template<bool ALIGNED, int N, unsigned NewtonSteps>
+		void safe_batch(const RootApprox<N, float16, NewtonSteps> &approx,
+			const float16 *y, float16 *x, const size_t count)
+		{
+			const RootApprox_Safe<N, float16, NewtonSteps> safe(approx);
+			for (size_t i = 0; i < count; ++i) x[i] = safe(y[i]);
+		}
+		template<bool ALIGNED, int N, unsigned NewtonSteps>
+		void safe_batch(const RootApprox<N, bfloat16, NewtonSteps> &approx,
+			const bfloat16 *y, bfloat16 *x, const size_t count)
+		{
+			const RootApprox_Safe<N, bfloat16, NewtonSteps> safe(approx);
+			for (size_t i = 0; i < count; ++i) x[i] = safe(y[i]);
+		}
+	}
+
+	template<int N, typename T_Float, unsigned NewtonSteps>
+	void RootApprox_Safe<N, T_Float, NewtonSteps>::apply(const float_t *y, float_t *x, size_t count) const
+		{simd::safe_batch<false>(*this, y, x, count);}
+	template<int N, typename T_Float, unsigned NewtonSteps>
+	void RootApprox_Safe<N, T_Float, NewtonSteps>::apply(float_t *yx, size_t count) const
+		{simd::safe_batch<false>(*this, yx, yx, count);}
+	template<int N, typename T_Float, unsigned NewtonSteps>
+	void RootApprox_Safe<N, T_Float, NewtonSteps>::apply_aligned(const float_t *y, float_t *x, size_t count) const
+		{simd::safe_batch<true>(*this, y, x, count);}
+	template<int N, typename T_Float, unsigned NewtonSteps>
+	void RootApprox_Safe<N, T_Float, NewtonSteps>::apply_aligned(float_t *yx, size_t count) const
+		{simd::safe_batch<true>(*this, yx, yx, count);}
+
+
+	/*
+		Batch versions of the rb_safe_* functions, using the published designs,
+		as rb_root is for the rb_* functions.
+	*/
+	template<int N, unsigned NewtonSteps = 1, typename T_Float>
+	void rb_root_safe(const T_Float *y, T_Float *x, size_t count)
+	{
+		static const RootApprox_Safe<N, T_Float, NewtonSteps> design = RootApprox_Tuned<N, T_Float, NewtonSteps>();
+		design.apply(y, x, count);
+	}
+	template<int N, unsigned NewtonSteps = 1, typename T_Float>
+	void rb_root_safe(T_Float *yx, size_t count)
+	{
+		static const RootApprox_Safe<N, T_Float, NewtonSteps> design = RootApprox_Tuned<N, T_Float, NewtonSteps>();
+		design.apply(yx, count);
+	}
+	template<int N, unsigned NewtonSteps = 1, typename T_Float>
+	void rb_root_safe_aligned(const T_Float *y, T_Float *x, size_t count)
+	{
+		static const RootApprox_Safe<N, T_Float, NewtonSteps> design = RootApprox_Tuned<N, T_Float, NewtonSteps>();
+		design.apply_aligned(y, x, count);
+	}
+}
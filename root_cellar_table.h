@@ -0,0 +1,439 @@
+#pragma once
+
+
+#include <cstdint>
+#include <cmath>
+#include <algorithm>
+#include <array>
+#include <utility>
+#include <vector>
+#include <ostream>
+
+#include "root_cellar.h"
+
+
+/*
+	Roots with table-seeded initial estimates.
+
+	The estimate of RootApprox is a linear function of the input's bits, and
+	its error repeats over each period of |N| binades of y.  Within a period
+	the estimate's bits pass once through a binade, so the top mantissa bits of
+	the estimate identify where in the period y lies.  RootTableApprox uses
+	those bits to index a small table of offsets, added to the estimate's bits:
+	in effect a constant k for each of 2^TableBits segments of the period.
+	Refinements are as in RootApprox, with one m per step.
+
+	Tables may have 2 to 1024 entries, 32 by default, and error falls in
+	proportion to table size.  The generated functions use 256 entries, with
+	which the estimate is good to about a tenth of a percent and one
+	refinement is comparable to two refinements of RootApprox.
+*/
+namespace rootbeer
+{
+	template<int N, typename T_Float, unsigned NewtonSteps = 1, unsigned TableBits = 5>
+	struct RootTableApprox
+	{
+		static_assert(N != 0, "0th root is invalid");
+		static_assert(TableBits >= 1 && TableBits <= 10, "table should have 2 to 1024 entries");
+
+		static constexpr int DEG = ((N>0) ? N : -N);
+
+		using float_t  = T_Float;
+		using range_t  = std::pair<float_t, float_t>;
+		using as_int_t = float_as_int_t<float_t>;
+
+		static constexpr size_t table_size  = size_t(1) << TableBits;
+		static constexpr int    index_shift = int(detail::float_traits<float_t>::bits_mantissa) - int(TableBits);
+
+		using steps_t  = std::array<float_t, NewtonSteps>;
+		using table_t  = std::array<as_int_t, table_size>;
+
+		as_int_t constant;
+		table_t  offset;    // Added to the estimate's bits, by segment
+		steps_t  newton_m;  // Pseudo-newtonian constant for each refinement
+
+		constexpr RootTableApprox(as_int_t _constant, const table_t &_offset, float_t _newton_m) :
+			constant(_constant), offset(_offset), newton_m(detail::fill_array<NewtonSteps>(_newton_m)) {}
+		constexpr RootTableApprox(as_int_t _constant, const table_t &_offset, const steps_t &_newton_m) :
+			constant(_constant), offset(_offset), newton_m(_newton_m) {}
+
+		/*
+			The constant mapping 1 to 1, before offsets.
+		*/
+		static constexpr as_int_t constant_identity()
+		{
+			return as_int_t(
+				((as_int_t(1) << (detail::float_traits<float_t>::bits_exponent-1)) - 1)
+				* (as_int_t(1) << detail::float_traits<float_t>::bits_mantissa) / DEG * (DEG + ((N>0) ? -1 : 1)));
+		}
+
+		static constexpr size_t segment(const as_int_t i)    {return size_t(i >> index_shift) & (table_size - 1);}
+
+		/*
+			Initial estimate: the hack of RootApprox, corrected by segment.
+		*/
+		ROOTBEER_CONSTEXPR float_t initialEstimate(const float_t y) const
+		{
+			as_int_t i = reinterpret_float_int(y);
+			const as_int_t q = detail::div_i<DEG>(i);
+			i = (N > 0) ? (constant + q) : (constant - q);
+			i += offset[segment(i)];
+			return reinterpret_int_float(i);
+		}
+		constexpr float_t newtonianRefinement(const float_t y, const float_t x, const unsigned step) const
+		{
+			const float_t m = newton_m[step];
+			if (N > 0) return x *  (float_t(1)-m) + m * y / pow_i<N-1>(x);
+			else       return x * ((float_t(1)-m) + m * y * pow_i<-N>(x));
+		}
+		ROOTBEER_CONSTEXPR float_t operator()(const float_t y) const
+		{
+			float_t x = initialEstimate(y);
+			for (unsigned i = 0; i < NewtonSteps; ++i)
+				x = newtonianRefinement(y, x, i);
+			return x;
+		}
+
+		static range_t test_param_range()
+		{
+			return std::make_pair(float_t(1), float_t(1<<std::abs(N)));
+		}
+
+		/*
+			Range of the ratio x / y^(1/N) of the initial estimate in each segment,
+			disregarding truncation.  Over a period, the estimate's bits divide
+			into pieces where y and x each stay within a binade; in each piece x
+			is linear in y, and the ratio has its extremes at the ends or at the
+			one stationary point, as in RootApprox::errorRange_initial.
+		*/
+		std::vector<std::pair<double, double>> errorRange_segments() const
+		{
+			using real_t = long double;
+			const int  bits_mantissa = int(detail::float_traits<float_t>::bits_mantissa);
+			const real_t
+				L = std::ldexp(real_t(1), bits_mantissa),
+				W = std::ldexp(real_t(1), index_shift),
+				B = real_t((as_int_t(1) << (detail::float_traits<float_t>::bits_exponent-1)) - 1),
+				K = real_t(constant),
+				s = ((N>0) ? 1 : -1);
+
+			// Value of a positive, normal bit pattern, continuous between integers
+			auto value = [&](const real_t bits)
+			{
+				const real_t e = std::floor(bits / L);
+				return std::ldexp(real_t(1) + (bits / L - e), int(e - B));
+			};
+			auto estimate_bits = [&](const real_t y_bits)    {return K + s * y_bits / real_t(DEG);};
+			auto input_bits    = [&](const real_t p)         {return s * (p - K) * real_t(DEG);};
+
+			const real_t
+				p_a = estimate_bits(B * L),
+				p_b = estimate_bits((B + real_t(DEG)) * L),
+				p_lo = std::min(p_a, p_b), p_hi = std::max(p_a, p_b);
+
+			// Breaks between pieces: segments, binades of y, binades of corrected x
+			std::vector<real_t> cuts = {p_lo, p_hi};
+			for (real_t p = std::ceil(p_lo / W) * W; p < p_hi; p += W) cuts.push_back(p);
+			for (int e = 1; e < DEG; ++e) cuts.push_back(estimate_bits((B + real_t(e)) * L));
+			for (size_t j = 0; j < table_size; ++j)
+				for (real_t p = std::ceil((p_lo + real_t(offset[j])) / L) * L - real_t(offset[j]); p < p_hi; p += L)
+					cuts.push_back(p);
+			std::sort(cuts.begin(), cuts.end());
+
+			std::vector<std::pair<double, double>> ranges(table_size, std::make_pair(1e20, -1e20));
+			for (size_t c = 0; c+1 < cuts.size(); ++c)
+			{
+				const real_t p1 = cuts[c], p2 = cuts[c+1];
+				if (!(p1 < p2) || p1 < p_lo || p2 > p_hi) continue;
+				const size_t j = size_t(std::floor((p1 + p2) / 2 / W)) & (table_size - 1);
+				const real_t
+					d  = real_t(offset[j]),
+					y1 = value(input_bits(p1)), y2 = value(input_bits(p2)),
+					x1 = value(p1 + d),         x2 = value(p2 + d);
+				auto &range = ranges[j];
+				auto consider = [&](const real_t y, const real_t x)
+				{
+					const double ratio = double(x / std::pow(y, real_t(1) / real_t(N)));
+					range.first  = std::min(range.first,  ratio);
+					range.second = std::max(range.second, ratio);
+				};
+				consider(y1, x1);
+				consider(y2, x2);
+				if (N != 1 && y1 != y2)
+				{
+					const real_t b = (x2 - x1) / (y2 - y1), a = x1 - b*y1, yM = a / (real_t(N-1) * b);
+					if (yM > std::min(y1, y2) && yM < std::max(y1, y2)) consider(yM, a + b*yM);
+				}
+			}
+			return ranges;
+		}
+
+		range_t errorRange_initial() const
+		{
+			range_t range(float_t(1e20), float_t(-1e20));
+			for (auto &r : errorRange_segments())
+			{
+				if (r.first > r.second) continue;
+				range.first  = std::min(range.first,  float_t(r.first));
+				range.second = std::max(range.second, float_t(r.second));
+			}
+			return range;
+		}
+
+		// Refinements map the ratio as RootApprox's do
+		range_t errorRange() const
+		{
+			const RootApprox<N, float_t, NewtonSteps> refinements(constant, newton_m);
+			range_t range = errorRange_initial();
+			for (unsigned i = 0; i < NewtonSteps; ++i)
+				range = refinements.errorRange_refine(range, i);
+			return range;
+		}
+
+		float_t error_worstCase() const
+		{
+			range_t range = errorRange();
+			return std::max(std::abs(range.first-float_t(1)), std::abs(range.second-float_t(1)));
+		}
+
+		/*
+			Set the offsets so that each segment's ratio range is centered on target,
+			in the geometric sense.  An offset of d bits scales x by about
+			1 + d / (L * (1+f)), where f is the mantissa of x, so a few passes settle.
+		*/
+		void center(const double target)
+		{
+			const double
+				L = std::ldexp(1.0, int(detail::float_traits<float_t>::bits_mantissa)),
+				W = std::ldexp(1.0, index_shift);
+			for (int pass = 0; pass < 4; ++pass)
+			{
+				const auto ranges = errorRange_segments();
+				for (size_t j = 0; j < table_size; ++j)
+				{
+					if (ranges[j].first > ranges[j].second) continue;
+					const double
+						f     = ((double(j) + .5) * W + double(offset[j])) / L,
+						scale = target / std::sqrt(ranges[j].first * ranges[j].second),
+						frac  = f - std::floor(f);
+					offset[j] += as_int_t(std::llround((scale - 1.0) * L * (1.0 + frac)));
+				}
+			}
+		}
+	};
+
+
+	/*
+		Score a design on the given basis; lower is better.
+		There is no certified bound for tables, so CERTIFIED_WORST_CASE
+		uses the analytic range like APPROX_WORST_CASE.
+	 */
+	template<BEST_APPROX_BASIS Basis, int N, typename T_Float, unsigned NewtonSteps, unsigned TableBits>
+	T_Float RootTableApprox_Score(const RootTableApprox<N, T_Float, NewtonSteps, TableBits> &candidate)
+	{
+		const auto range = RootTableApprox<N, T_Float, NewtonSteps, TableBits>::test_param_range();
+
+		switch (Basis)
+		{
+		default:
+		case BEST_WORST_CASE:   return T_Float(Test_Root_Approx<N>(candidate, range.first, range.second).worst_error());
+		case BEST_MEAN_SQUARE:  return T_Float(Test_Root_Approx<N>(candidate, range.first, range.second).mean_sq_error);
+		case APPROX_WORST_CASE:
+		case CERTIFIED_WORST_CASE: return candidate.error_worstCase();
+		}
+	}
+
+	/*
+		Search for the best table design.
+
+		Offsets center every segment on a common target ratio t, so that all
+		segments share the error range of the widest.  Refinements then prefer
+		some t slightly off 1, as a RootApprox prefers some k: t is scanned
+		coarsely and refined by a halving stride, with m fitted to each t by
+		ternary search, as in PowApprox_Best.  Fits are run on the executor's
+		threads; ties go to the earliest.
+	 */
+	template<int N, typename T_Float, unsigned NewtonSteps = 1, unsigned TableBits = 5,
+		BEST_APPROX_BASIS Basis = APPROX_WORST_CASE, typename T_Executor>
+	RootTableApprox<N, T_Float, NewtonSteps, TableBits> RootTableApprox_Best(T_Executor &&executor)
+	{
+		using float_t  = T_Float;
+		using as_int_t = float_as_int_t<float_t>;
+		using design_t = RootTableApprox<N, T_Float, NewtonSteps, TableBits>;
+
+		// Targets are in steps of 2^-24 around 1, within the centered error range
+		design_t base(design_t::constant_identity(), typename design_t::table_t(), float_t(1)/float_t(N));
+		base.center(1.0);
+		const auto spread = base.errorRange_initial();
+		const double t_unit = std::ldexp(1.0, -24);
+		const int64_t
+			t_min = int64_t(std::floor((double(spread.first)  - 1.0) / t_unit)),
+			t_max = int64_t(std::ceil ((double(spread.second) - 1.0) / t_unit));
+
+		const float_t p = float_t(1)/float_t(N);
+		as_int_t
+			m_min = reinterpret_float_int(p),
+			m_max = reinterpret_float_int(p*float_t(1.5));
+		if (m_min > m_max) std::swap(m_min, m_max);
+		if (NewtonSteps == 0) m_max = m_min;
+
+		auto centered = [&](const int64_t t)
+		{
+			design_t design = base;
+			design.center(1.0 + double(t) * t_unit);
+			return design;
+		};
+
+		// Fit m to a given target by ternary search, finishing exhaustively
+		struct fit_t {float_t score; int64_t t; as_int_t m;};
+		auto fit = [&](const int64_t t) -> fit_t
+		{
+			design_t design = centered(t);
+			auto get_score = [&](const as_int_t m)
+			{
+				design.newton_m = detail::fill_array<NewtonSteps>(reinterpret_int_float(m));
+				return RootTableApprox_Score<Basis>(design);
+			};
+			as_int_t lo = m_min, hi = m_max;
+			while (hi - lo > 2)
+			{
+				as_int_t a = lo + (hi-lo)/3, b = hi - (hi-lo)/3;
+				if (get_score(a) < get_score(b)) hi = b;
+				else                             lo = a;
+			}
+			fit_t best = {get_score(lo), t, lo};
+			for (as_int_t m = lo+1; m <= hi; ++m)
+			{
+				float_t score = get_score(m);
+				if (score < best.score) best = {score, t, m};
+			}
+			return best;
+		};
+
+		std::cout << std::dec << "//Searching " << design_t::table_size << " segments, target in [1"
+			<< std::showpos << double(t_min) * t_unit << ",1" << double(t_max) * t_unit << std::noshowpos
+			<< "], m in [" << reinterpret_int_float(m_min) << "," << reinterpret_int_float(m_max) << "] ";
+
+		// Scan targets coarsely, then halve a stride around the best until it vanishes
+		static const int64_t COARSE = 32;
+		std::vector<int64_t> ts;
+		for (int64_t i = 0; i <= COARSE; ++i) ts.push_back(t_min + (t_max - t_min) * i / COARSE);
+		int64_t stride = std::max<int64_t>(1, (t_max - t_min) / COARSE);
+
+		fit_t best = {float_t(1e20), 0, m_min};
+		std::vector<fit_t> fits;
+		while (ts.size())
+		{
+			std::cout << '.' << std::flush;
+			fits.resize(ts.size());
+			executor.parallel_for(ts.size(), [&](const size_t i)
+			{
+				fits[i] = fit(ts[i]);
+			});
+			bool moved = false;
+			for (auto &f : fits) if (f.score < best.score) {best = f; moved = true;}
+
+			if (!moved) stride /= 2;
+			ts.clear();
+			if (stride > 0) ts = {best.t - stride, best.t + stride};
+		}
+		std::cout << std::endl;
+
+		design_t result = centered(best.t);
+		result.newton_m = detail::fill_array<NewtonSteps>(reinterpret_int_float(best.m));
+
+		std::cout << "//  ...best design target=1" << std::showpos << double(best.t) * t_unit << std::noshowpos
+			<< ", m=" << reinterpret_int_float(best.m)
+			<< " with error score " << best.score << std::endl;
+		return result;
+	}
+
+	template<int N, typename T_Float, unsigned NewtonSteps = 1, unsigned TableBits = 5, BEST_APPROX_BASIS Basis = APPROX_WORST_CASE>
+	RootTableApprox<N, T_Float, NewtonSteps, TableBits> RootTableApprox_Best()
+	{
+		return RootTableApprox_Best<N, T_Float, NewtonSteps, TableBits, Basis>(SerialExecutor());
+	}
+
+	template<int N, typename T_Float, unsigned NewtonSteps = 1, unsigned TableBits = 5, BEST_APPROX_BASIS Basis = APPROX_WORST_CASE>
+	RootTableApprox<N, T_Float, NewtonSteps, TableBits> RootTableApprox_Best_Parallel(unsigned threads = 0)
+	{
+		ThreadPool pool(threads);
+		return RootTableApprox_Best<N, T_Float, NewtonSteps, TableBits, Basis>(pool);
+	}
+
+
+	/*
+		Emit a table design as a scalar function and its table, named like
+		Print_Generated_Root's (rbt_inv_2_root, rbt_inv_2_root_table).
+		Requires the definitions from Print_Generated_Preamble.
+	 */
+	template<int N, typename T_Float, unsigned NewtonSteps, unsigned TableBits>
+	std::ostream &Print_Generated_Root_Table(std::ostream &out,
+		const RootTableApprox<N, T_Float, NewtonSteps, TableBits> &approx, const char *prefix = "rbt")
+	{
+		using design_t = RootTableApprox<N, T_Float, NewtonSteps, TableBits>;
+		static const int absN = ((N<0)?-N:N);
+
+		using float_t = T_Float;
+		const char *float_decl = detail::float_traits<float_t>::name();
+		using as_int_t = float_as_int_t<float_t>;
+		const char *int_decl = detail::int_traits<as_int_t>::name();
+		const std::string name = detail::generated_name(prefix, N);
+
+		// The table, eight entries to a line
+		out << std::dec;
+		out << "static RB_TABLE_CONSTEXPR " << int_decl << " " << name << "_table[" << design_t::table_size << "] =\n{";
+		for (size_t j = 0; j < design_t::table_size; ++j)
+		{
+			out << ((j % 8) ? " " : "\n\t") << approx.offset[j];
+			if (j+1 < design_t::table_size) out << ",";
+		}
+		out << "\n};\n";
+
+		out << "RB_CONSTEXPR " << float_decl << " " << name << "(const " << float_decl << " y)\n";
+		out << "{\n";
+		out << "\t" << int_decl << " i = rb_bit_cast<" << int_decl << ">(y); // interpret float as integer\n";
+		const char *q = "i";
+		if (absN > 1)
+		{
+			detail::print_div_i<as_int_t, absN>(out, "q", "i");
+			q = "q";
+		}
+		out << std::hex << "\ti = 0x" << approx.constant << ((N>0) ? " + " : " - ") << q << "; // log-approximation hack\n";
+		out << std::dec << "\ti += " << name << "_table[(i >> " << design_t::index_shift << ") & " << (design_t::table_size - 1)
+			<< "]; // correction by segment\n";
+		out << "\t" << float_decl << " x = rb_bit_cast<" << float_decl << ">(i);\n";
+
+		const int refine_power = absN - (N>0);
+		for (unsigned i = 0; i < NewtonSteps; ++i)
+		{
+			const float_t m = approx.newton_m[i];
+			out << "\tx" << ((N>0) ? " = " : " *= ")
+				<< detail::exact_literal(float_t(1)-m) << ((N>0) ? " * x" : "")
+				<< ((N>0) ? " + " : " - ")
+				<< detail::exact_literal((N>0) ? m : -m) << " * y";
+			if (refine_power != 0)
+				out << ((N>0) ? " / " : " * ") << detail::power_expression("x", refine_power);
+			out << "; // newtonian step #" << (i+1) << "\n";
+		}
+		out << "\treturn x;\n";
+		out << "}";
+		return out;
+	}
+
+	/*
+		Definitions for generated table functions, following Print_Generated_Preamble:
+		tables are constexpr where the functions reading them may be.
+	 */
+	inline std::ostream &Print_Generated_Table_Preamble(std::ostream &out)
+	{
+		return out <<
+			"#ifndef RB_TABLE_CONSTEXPR\n"
+			"#if defined(RB_BUILTIN_BIT_CAST) || defined(__cpp_lib_bit_cast)\n"
+			"\t#define RB_TABLE_CONSTEXPR constexpr\n"
+			"#else\n"
+			"\t#define RB_TABLE_CONSTEXPR const\n"
+			"#endif\n"
+			"#endif\n";
+	}
+}
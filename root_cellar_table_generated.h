@@ -0,0 +1,739 @@
+#pragma once
+#include <stdint.h>
+#include <string.h>
+
+#ifndef RB_CONSTEXPR
+#if (__cplusplus >= 202002L) || (defined(_MSVC_LANG) && _MSVC_LANG >= 202002L)
+	#include <bit>
+#endif
+#if defined(__has_builtin)
+	#if __has_builtin(__builtin_bit_cast)
+		#define RB_BUILTIN_BIT_CAST 1
+	#endif
+#elif defined(_MSC_VER) && (_MSC_VER >= 1927)
+	#define RB_BUILTIN_BIT_CAST 1
+#endif
+#if defined(__cpp_lib_bit_cast)
+	#define RB_CONSTEXPR constexpr
+	template<typename To, typename From> constexpr To rb_bit_cast(const From &v) {return std::bit_cast<To>(v);}
+#elif defined(RB_BUILTIN_BIT_CAST)
+	#define RB_CONSTEXPR constexpr
+	template<typename To, typename From> constexpr To rb_bit_cast(const From &v) {return __builtin_bit_cast(To, v);}
+#else
+	#define RB_CONSTEXPR inline
+	template<typename To, typename From> inline To rb_bit_cast(const From &v) {To t; memcpy(&t, &v, sizeof(To)); return t;}
+#endif
+#endif
+
+#ifndef RB_MULHI
+#define RB_MULHI 1
+// High half of a product, for division by a magic reciprocal
+#if defined(__SIZEOF_INT128__)
+__extension__ typedef unsigned __int128 rb_uint128;
+#endif
+RB_CONSTEXPR uint32_t rb_mulhi(uint32_t a, uint32_t b) {return (uint32_t)(((uint64_t)a * b) >> 32);}
+RB_CONSTEXPR uint64_t rb_mulhi(uint64_t a, uint64_t b)
+{
+#if defined(__SIZEOF_INT128__)
+	return (uint64_t)(((rb_uint128)a * b) >> 64);
+#else
+	uint64_t a1 = a >> 32, a0 = a & 0xFFFFFFFFu, b1 = b >> 32, b0 = b & 0xFFFFFFFFu;
+	uint64_t mid = ((a0*b0) >> 32) + ((a1*b0) & 0xFFFFFFFFu) + ((a0*b1) & 0xFFFFFFFFu);
+	return a1*b1 + ((a1*b0) >> 32) + ((a0*b1) >> 32) + (mid >> 32);
+#endif
+}
+#endif
+#ifndef RB_TABLE_CONSTEXPR
+#if defined(RB_BUILTIN_BIT_CAST) || defined(__cpp_lib_bit_cast)
+	#define RB_TABLE_CONSTEXPR constexpr
+#else
+	#define RB_TABLE_CONSTEXPR const
+#endif
+#endif
+
+
+// Roots seeded from 256-entry tables, optimized for worst-case error
+
+
+//Searching 256 segments, target in [1-0.000567019,1+0.000567317], m in [0.5,0.5] ............
+//  ...best design target=1-1.19209e-07, m=0.5 with error score 0.000567198
+/*
+	Approximate x^(1/2) with a 256-entry table and 0 newtonian steps
+	Error:
+		RMS:  0.000158915
+		mean: -7.37918e-07
+		min:  -0.000567109 @ 2.01562
+		max:  0.000567212 @ 2
+	Analytic worst-case error: 0.000567198
+*/
+static RB_TABLE_CONSTEXPR int32_t rbt0_2_root_table[256] =
+{
+	-33, -160, -412, -789, -1289, -1911, -2653, -3513,
+	-4491, -5585, -6795, -8118, -9553, -11100, -12757, -14523,
+	-16397, -18377, -20463, -22654, -24948, -27345, -29843, -32441,
+	-35139, -37935, -40829, -43819, -46905, -50085, -53360, -56727,
+	-60186, -63736, -67377, -71107, -74926, -78833, -82826, -86907,
+	-91072, -95322, -99657, -104074, -108574, -113156, -117819, -122563,
+	-127386, -132288, -137269, -142327, -147463, -152675, -157962, -163325,
+	-168763, -174274, -179859, -185517, -191246, -197048, -202920, -208863,
+	-214876, -220958, -227110, -233329, -239617, -245971, -252393, -258880,
+	-265434, -272053, -278736, -285484, -292296, -299171, -306109, -313110,
+	-320172, -327296, -334482, -341728, -349034, -356400, -363825, -371310,
+	-378853, -386454, -394113, -401830, -409603, -417433, -425320, -433262,
+	-441259, -449312, -457420, -465582, -473797, -482067, -490390, -498766,
+	-507194, -515675, -524208, -532792, -541428, -550114, -558851, -567639,
+	-576477, -585364, -594301, -603286, -612321, -621404, -630535, -639714,
+	-648941, -658215, -667536, -676904, -686318, -695779, -705285, -714837,
+	-712900, -699506, -686291, -673251, -660385, -647691, -635167, -622811,
+	-610621, -598596, -586733, -575031, -563488, -552103, -540873, -529797,
+	-518874, -508102, -497479, -487004, -476676, -466492, -456452, -446553,
+	-436796, -427177, -417696, -408352, -399143, -390068, -381126, -372315,
+	-363634, -355082, -346657, -338360, -330187, -322139, -314214, -306412,
+	-298730, -291167, -283724, -276399, -269190, -262097, -255118, -248253,
+	-241502, -234861, -228332, -221913, -215602, -209400, -203305, -197316,
+	-191433, -185654, -179980, -174408, -168938, -163569, -158301, -153133,
+	-148063, -143092, -138218, -133441, -128760, -124174, -119682, -115284,
+	-110979, -106766, -102645, -98615, -94676, -90826, -87065, -83392,
+	-79807, -76309, -72898, -69572, -66332, -63176, -60104, -57116,
+	-54210, -51387, -48646, -45986, -43406, -40906, -38486, -36145,
+	-33883, -31698, -29591, -27561, -25607, -23729, -21926, -20198,
+	-18545, -16965, -15460, -14027, -12666, -11378, -10161, -9016,
+	-7941, -6937, -6002, -5137, -4341, -3613, -2954, -2362,
+	-1837, -1380, -989, -664, -405, -211, -82, -18
+};
+RB_CONSTEXPR float rbt0_2_root(const float y)
+{
+	int32_t i = rb_bit_cast<int32_t>(y); // interpret float as integer
+	int32_t q = (i + (i < 0 ? 1 : 0)) >> 1; // i / 2, rounding toward zero
+	i = 0x1fc00000 + q; // log-approximation hack
+	i += rbt0_2_root_table[(i >> 15) & 255]; // correction by segment
+	float x = rb_bit_cast<float>(i);
+	return x;
+}
+
+//Searching 256 segments, target in [1-0.000966609,1+0.000967503], m in [-0.5,-0.5] ............
+//  ...best design target=1-4.76837e-07, m=-0.5 with error score 0.000967085
+/*
+	Approximate x^(1/-2) with a 256-entry table and 0 newtonian steps
+	Error:
+		RMS:  0.00028134
+		mean: 7.19563e-07
+		min:  -0.000967026 @ 1
+		max:  0.000967146 @ 1.00781
+	Analytic worst-case error: 0.000967085
+*/
+static RB_TABLE_CONSTEXPR int32_t rbt0_inv_2_root_table[256] =
+{
+	-10885, -24447, -40637, -56729, -72721, -88613, -104404, -120092,
+	-135677, -151157, -166532, -181800, -196961, -212012, -226954, -241785,
+	-256503, -271108, -285599, -299974, -314231, -328371, -342390, -356289,
+	-370066, -383720, -397248, -410651, -423926, -437072, -450087, -462971,
+	-475721, -488337, -500816, -513158, -525360, -537421, -549339, -561113,
+	-572741, -584222, -595553, -606733, -617760, -628632, -639348, -649905,
+	-660302, -670536, -680607, -690511, -700246, -709811, -719204, -728422,
+	-737463, -746325, -755006, -763503, -771815, -779937, -787869, -795608,
+	-803151, -810496, -817639, -824579, -831313, -837837, -844150, -850247,
+	-856127, -861787, -867222, -872431, -877410, -882155, -886664, -890934,
+	-894960, -898739, -902268, -905543, -908561, -911317, -913808, -916030,
+	-917978, -919650, -921040, -922144, -922959, -923479, -923705, -923616,
+	-923225, -922520, -921497, -920151, -918476, -916467, -914119, -911426,
+	-908382, -904982, -901220, -897090, -892585, -887698, -882425, -876757,
+	-870688, -864211, -857318, -850003, -842258, -834075, -825446, -816362,
+	-806816, -796800, -786303, -775317, -763834, -751842, -739333, -726297,
+	-724394, -733855, -743178, -752362, -761405, -770307, -779065, -787679,
+	-796146, -804465, -812636, -820655, -828522, -836236, -843794, -851194,
+	-858436, -865518, -872438, -879194, -885784, -892207, -898461, -904545,
+	-910455, -916191, -921750, -927131, -932332, -937350, -942184, -946831,
+	-951290, -955558, -959634, -963514, -967198, -970682, -973964, -977042,
+	-979913, -982576, -985028, -987266, -989287, -991090, -992671, -994028,
+	-995159, -996060, -996728, -997161, -997359, -997311, -997021, -996485,
+	-995698, -994658, -993361, -991805, -989986, -987900, -985545, -982916,
+	-980010, -976824, -973354, -969595, -965545, -961199, -956553, -951604,
+	-946346, -940777, -934891, -928684, -922152, -915291, -908094, -900559,
+	-892680, -884451, -875869, -866928, -857623, -847948, -837897, -827467,
+	-816649, -805440, -793833, -781822, -769401, -756563, -743302, -729612,
+	-715485, -700916, -685896, -670419, -654477, -638063, -621169, -603788,
+	-585911, -567530, -548636, -529222, -509277, -488794, -467763, -446175,
+	-424019, -401286, -377966, -354048, -329521, -304375, -278599, -252180,
+	-225107, -197368, -168951, -139842, -110029, -79497, -48234, -16225
+};
+RB_CONSTEXPR float rbt0_inv_2_root(const float y)
+{
+	int32_t i = rb_bit_cast<int32_t>(y); // interpret float as integer
+	int32_t q = (i + (i < 0 ? 1 : 0)) >> 1; // i / 2, rounding toward zero
+	i = 0x5f400000 - q; // log-approximation hack
+	i += rbt0_inv_2_root_table[(i >> 15) & 255]; // correction by segment
+	float x = rb_bit_cast<float>(i);
+	return x;
+}
+
+//Searching 256 segments, target in [1-0.000707567,1+0.000708103], m in [0.333333,0.333333] .............
+//  ...best design target=1-2.98023e-07, m=0.333333 with error score 0.000707865
+/*
+	Approximate x^(1/3) with a 256-entry table and 0 newtonian steps
+	Error:
+		RMS:  0.000183519
+		mean: -1.25357e-06
+		min:  -0.000707878 @ 4.0625
+		max:  0.000707846 @ 4.01563
+	Analytic worst-case error: 0.000707865
+*/
+static RB_TABLE_CONSTEXPR int32_t rbt0_3_root_table[256] =
+{
+	-65, -317, -818, -1564, -2548, -3768, -5218, -6895,
+	-8795, -10913, -13245, -15789, -18540, -21495, -24651, -28003,
+	-31550, -35287, -39212, -43321, -47612, -52082, -56728, -61547,
+	-66537, -71695, -77018, -82505, -88153, -93958, -99920, -106036,
+	-112303, -118720, -125285, -131995, -138848, -145842, -152976, -160248,
+	-167656, -175197, -182871, -190675, -198608, -206669, -214855, -223165,
+	-231597, -240150, -248823, -257614, -266521, -275544, -284680, -293928,
+	-303288, -312757, -322335, -332021, -341812, -351708, -361707, -371809,
+	-382013, -392316, -402719, -413219, -423817, -434510, -445298, -456181,
+	-467155, -478222, -489380, -500627, -511964, -523389, -534901, -546499,
+	-558183, -569951, -581803, -593738, -605755, -613028, -606156, -598167,
+	-590487, -583110, -576032, -569246, -562747, -556530, -550590, -544922,
+	-539522, -534385, -529505, -524880, -520505, -516375, -512486, -508836,
+	-505419, -502232, -499272, -496535, -494017, -491716, -489627, -487748,
+	-486076, -484607, -483338, -482267, -481391, -480707, -480213, -479904,
+	-479776, -479838, -480074, -480487, -481074, -481833, -482762, -483858,
+	-485119, -486543, -488128, -489872, -491773, -493829, -496038, -498398,
+	-500907, -503563, -506366, -509312, -512400, -515629, -518997, -522502,
+	-526142, -529917, -533824, -537862, -542030, -546326, -550749, -555297,
+	-559968, -564763, -569678, -574714, -579868, -585140, -590527, -596030,
+	-601646, -607375, -613215, -619166, -625226, -631393, -637668, -644049,
+	-650534, -657123, -661735, -649095, -630381, -612058, -594121, -576561,
+	-559372, -542547, -526079, -509963, -494191, -478758, -463659, -448886,
+	-434436, -420301, -406478, -392961, -379745, -366826, -354198, -341856,
+	-329797, -318016, -306509, -295272, -284299, -273589, -263136, -252937,
+	-242988, -233286, -223827, -214607, -205624, -196873, -188353, -180059,
+	-171988, -164138, -156505, -149087, -141881, -134883, -128092, -121505,
+	-115119, -108931, -102940, -97141, -91534, -86116, -80885, -75837,
+	-70972, -66286, -61779, -57447, -53288, -49301, -45483, -41834,
+	-38350, -35029, -31871, -28873, -26034, -23351, -20823, -18448,
+	-16225, -14153, -12228, -10450, -8818, -7330, -5983, -4778,
+	-3712, -2784, -1992, -1336, -813, -423, -165, -35
+};
+RB_CONSTEXPR float rbt0_3_root(const float y)
+{
+	int32_t i = rb_bit_cast<int32_t>(y); // interpret float as integer
+	int32_t q = (int32_t)(rb_mulhi((uint32_t)i, 0x55555556u) - (i < 0 ? 0x55555556u : 0u));
+	q += (i < 0); // i / 3, rounding toward zero
+	i = 0x2a555554 + q; // log-approximation hack
+	i += rbt0_3_root_table[(i >> 15) & 255]; // correction by segment
+	float x = rb_bit_cast<float>(i);
+	return x;
+}
+
+//Searching 256 segments, target in [1-0.000962794,1+0.000963688], m in [-0.333333,-0.333333] ............
+//  ...best design target=1-4.76837e-07, m=-0.333333 with error score 0.000963271
+/*
+	Approximate x^(1/-3) with a 256-entry table and 0 newtonian steps
+	Error:
+		RMS:  0.000264325
+		mean: 4.94824e-07
+		min:  -0.00096333 @ 8
+		max:  0.000963309 @ 1.01172
+	Analytic worst-case error: 0.000963271
+*/
+static RB_TABLE_CONSTEXPR int32_t rbt0_inv_3_root_table[256] =
+{
+	-10871, -24405, -40530, -56521, -72379, -88100, -103683, -119126,
+	-134427, -149583, -164593, -179455, -194166, -208724, -223127, -237373,
+	-251458, -265382, -279141, -292732, -306154, -319402, -332476, -345372,
+	-358087, -370618, -382962, -395116, -407078, -418843, -430410, -441773,
+	-452931, -463879, -474614, -485132, -495429, -505502, -515347, -524959,
+	-534334, -543469, -552359, -560998, -569384, -577510, -585373, -592966,
+	-600286, -607326, -614082, -620547, -626716, -632584, -638144, -643389,
+	-648314, -652912, -657176, -661099, -664674, -667894, -670751, -673236,
+	-675342, -677061, -678384, -679301, -679805, -679888, -679529, -678731,
+	-677479, -675761, -673566, -670884, -667701, -664005, -659784, -655024,
+	-649711, -643830, -637367, -630307, -622632, -619850, -629838, -641692,
+	-653379, -664897, -676245, -687420, -698418, -709239, -719879, -730335,
+	-740605, -750686, -760576, -770271, -779769, -789066, -798160, -807047,
+	-815725, -824189, -832438, -840466, -848272, -855851, -863199, -870314,
+	-877190, -883826, -890215, -896354, -902240, -907868, -913233, -918331,
+	-923157, -927707, -931976, -935959, -939650, -943046, -946139, -948926,
+	-951400, -953555, -955386, -956886, -958050, -958871, -959342, -959466,
+	-959208, -958589, -957592, -956210, -954435, -952258, -949673, -946669,
+	-943239, -939373, -935063, -930299, -925070, -919367, -913179, -906496,
+	-899307, -891599, -883361, -874581, -865246, -855343, -844858, -833778,
+	-822088, -809772, -796816, -783203, -768917, -753940, -738254, -721841,
+	-704681, -686755, -671264, -670466, -676952, -683230, -689296, -695149,
+	-700784, -706198, -711389, -716354, -721088, -725589, -729853, -733877,
+	-737657, -741190, -744471, -747497, -750265, -752769, -755007, -756973,
+	-758664, -760076, -761203, -762042, -762587, -762837, -762779, -762416,
+	-761740, -760746, -759428, -757781, -755800, -753478, -750810, -747790,
+	-744412, -740669, -736555, -732063, -727187, -721918, -716251, -710178,
+	-703691, -696783, -689445, -681669, -673447, -664770, -655630, -646017,
+	-635921, -625333, -614244, -602642, -590517, -577859, -564655, -550896,
+	-536568, -521659, -506158, -490050, -473322, -455961, -437952, -419280,
+	-399930, -379886, -359133, -337652, -315427, -292439, -268670, -244101,
+	-218711, -192479, -165385, -137405, -108517, -78696, -47918, -16158
+};
+RB_CONSTEXPR float rbt0_inv_3_root(const float y)
+{
+	int32_t i = rb_bit_cast<int32_t>(y); // interpret float as integer
+	int32_t q = (int32_t)(rb_mulhi((uint32_t)i, 0x55555556u) - (i < 0 ? 0x55555556u : 0u));
+	q += (i < 0); // i / 3, rounding toward zero
+	i = 0x54aaaaa8 - q; // log-approximation hack
+	i += rbt0_inv_3_root_table[(i >> 15) & 255]; // correction by segment
+	float x = rb_bit_cast<float>(i);
+	return x;
+}
+
+//Searching 256 segments, target in [1-0.000778675,1+0.000779271], m in [0.25,0.25] ..............
+//  ...best design target=1-2.98023e-07, m=0.25 with error score 0.000778913
+/*
+	Approximate x^(1/4) with a 256-entry table and 0 newtonian steps
+	Error:
+		RMS:  0.000196388
+		mean: -2.17103e-06
+		min:  -0.000778948 @ 8.125
+		max:  0.000778925 @ 8
+	Analytic worst-case error: 0.000778913
+*/
+static RB_TABLE_CONSTEXPR int32_t rbt0_4_root_table[256] =
+{
+	-97, -474, -1220, -2325, -3779, -5575, -7704, -10156,
+	-12925, -16003, -19382, -23056, -27017, -31259, -35776, -40562,
+	-45611, -50916, -56473, -62277, -68321, -74602, -81114, -87853,
+	-94814, -101993, -109385, -116987, -124794, -132803, -141010, -149411,
+	-158002, -166781, -175744, -184887, -194207, -203702, -213368, -223203,
+	-233203, -243366, -253689, -264170, -274806, -285594, -296532, -307618,
+	-318849, -330224, -341739, -353393, -365184, -377109, -389167, -401356,
+	-413673, -426117, -438687, -451379, -464194, -477128, -490180, -503349,
+	-506989, -501237, -495924, -491038, -486568, -482504, -478835, -475551,
+	-472644, -470104, -467923, -466092, -464602, -463447, -462619, -462111,
+	-461904, -462024, -462433, -463134, -464122, -465392, -466936, -468750,
+	-470828, -473165, -475756, -478596, -481681, -485005, -488565, -492355,
+	-496372, -500612, -505070, -509743, -514627, -519719, -525014, -530510,
+	-536202, -542088, -548165, -554428, -560876, -567506, -574314, -581297,
+	-588454, -595780, -603274, -610933, -618755, -626737, -634876, -643171,
+	-651619, -660218, -668965, -677860, -686898, -696080, -705402, -714862,
+	-712991, -699951, -687433, -675422, -663907, -652873, -642310, -632206,
+	-622549, -613328, -604534, -596156, -588185, -580612, -573427, -566622,
+	-560189, -554119, -548405, -543040, -538015, -533324, -528961, -524918,
+	-521189, -517769, -514650, -511828, -509296, -507049, -505082, -503390,
+	-501967, -500809, -499911, -499268, -498877, -498721, -498829, -499164,
+	-499733, -500533, -501559, -502809, -504277, -505961, -507857, -509961,
+	-512272, -514785, -517497, -520405, -523507, -526799, -530278, -533942,
+	-537789, -541815, -546018, -550395, -554944, -559662, -564548, -569598,
+	-561174, -539467, -518380, -497897, -478002, -458681, -439920, -421703,
+	-404019, -386854, -370196, -354033, -338354, -323148, -308404, -294111,
+	-280261, -266843, -253848, -241267, -229092, -217314, -205925, -194917,
+	-184283, -174015, -164107, -154550, -145339, -136468, -127928, -119716,
+	-111824, -104247, -96979, -90015, -83349, -76976, -70892, -65091,
+	-59568, -54319, -49340, -44625, -40171, -35974, -32028, -28332,
+	-24879, -21667, -18693, -15951, -13440, -11155, -9093, -7250,
+	-5625, -4212, -3010, -2016, -1226, -637, -247, -53
+};
+RB_CONSTEXPR float rbt0_4_root(const float y)
+{
+	int32_t i = rb_bit_cast<int32_t>(y); // interpret float as integer
+	int32_t q = (i + (i < 0 ? 3 : 0)) >> 2; // i / 4, rounding toward zero
+	i = 0x2fa00000 + q; // log-approximation hack
+	i += rbt0_4_root_table[(i >> 15) & 255]; // correction by segment
+	float x = rb_bit_cast<float>(i);
+	return x;
+}
+
+//Searching 256 segments, target in [1-0.000959098,1+0.000959992], m in [-0.25,-0.25] ............
+//  ...best design target=1-4.76837e-07, m=-0.25 with error score 0.000959575
+/*
+	Approximate x^(1/-4) with a 256-entry table and 0 newtonian steps
+	Error:
+		RMS:  0.000255964
+		mean: 1.96036e-06
+		min:  -0.000959516 @ 1
+		max:  0.000959592 @ 1.01562
+	Analytic worst-case error: 0.000959575
+*/
+static RB_TABLE_CONSTEXPR int32_t rbt0_inv_4_root_table[256] =
+{
+	-10861, -24366, -40424, -56315, -72035, -87582, -102952, -118142,
+	-133149, -147970, -162600, -177035, -191274, -205310, -219141, -232762,
+	-246169, -259358, -272325, -285063, -297570, -309840, -321868, -333648,
+	-345176, -356446, -367452, -378188, -388649, -398827, -408718, -418312,
+	-427605, -436588, -445255, -453597, -461607, -469277, -476597, -483559,
+	-490154, -496373, -502205, -507640, -512668, -517278, -521457, -525195,
+	-528478, -531294, -533630, -535470, -536801, -537607, -537904, -537579,
+	-536711, -535250, -533177, -530471, -527112, -523078, -518345, -512890,
+	-516558, -529650, -542546, -555243, -567738, -580026, -592105, -603969,
+	-615616, -627040, -638238, -649206, -659938, -670430, -680678, -690676,
+	-700420, -709905, -719124, -728074, -736747, -745138, -753242, -761051,
+	-768560, -775762, -782651, -789219, -795459, -801363, -806925, -812135,
+	-816986, -821469, -825575, -829296, -832622, -835542, -838047, -840127,
+	-841770, -842965, -843701, -843989, -843744, -843026, -841796, -840041,
+	-837746, -834895, -831472, -827460, -822843, -817601, -811717, -805169,
+	-797937, -790000, -781334, -771917, -761722, -750724, -738896, -726208,
+	-724371, -733739, -742876, -751776, -760434, -768848, -777012, -784921,
+	-792571, -799957, -807074, -813917, -820480, -826757, -832744, -838434,
+	-843822, -848901, -853665, -858108, -862222, -866001, -869438, -872525,
+	-875255, -877620, -879612, -881222, -882443, -883265, -883678, -883674,
+	-883243, -882375, -881058, -879283, -877038, -874311, -871090, -867363,
+	-863117, -858339, -853014, -847127, -840665, -833611, -825949, -817662,
+	-808732, -799142, -788871, -777901, -766210, -753776, -740578, -726591,
+	-711791, -696152, -679647, -662248, -643924, -624646, -604380, -583091,
+	-574706, -579648, -584313, -588696, -592794, -596599, -600108, -603314,
+	-606212, -608795, -611059, -612996, -614600, -615866, -616786, -617352,
+	-617577, -617400, -616865, -615948, -614641, -612935, -610822, -608293,
+	-605340, -601953, -598121, -593837, -589088, -583866, -578158, -571953,
+	-565240, -558008, -550242, -541931, -533061, -523618, -513588, -502956,
+	-491707, -479824, -467292, -454092, -440207, -425618, -410306, -394251,
+	-377432, -359827, -341413, -322167, -302064, -281078, -259183, -236350,
+	-212550, -187752, -161924, -135032, -107042, -77916, -47615, -16099
+};
+RB_CONSTEXPR float rbt0_inv_4_root(const float y)
+{
+	int32_t i = rb_bit_cast<int32_t>(y); // interpret float as integer
+	int32_t q = (i + (i < 0 ? 3 : 0)) >> 2; // i / 4, rounding toward zero
+	i = 0x4f600000 - q; // log-approximation hack
+	i += rbt0_inv_4_root_table[(i >> 15) & 255]; // correction by segment
+	float x = rb_bit_cast<float>(i);
+	return x;
+}
+
+//Searching 256 segments, target in [1-0.000567019,1+0.000567317], m in [0.5,0.75] ...........
+//  ...best design target=1+0.000283718, m=0.500262 with error score 1.19209e-07
+/*
+	Approximate x^(1/2) with a 256-entry table and 1 newtonian steps
+	Error:
+		RMS:  1.14084e-07
+		mean: -9.57641e-08
+		min:  -3.08565e-07 @ 1.34329
+		max:  2.51953e-07 @ 2.01476
+	Analytic worst-case error: 1.19209e-07
+*/
+static RB_TABLE_CONSTEXPR int32_t rbt_2_root_table[256] =
+{
+	2353, 2235, 1992, 1624, 1133, 521, -212, -1063,
+	-2032, -3118, -4318, -5632, -7059, -8597, -10245, -12002,
+	-13867, -15839, -17916, -20098, -22383, -24771, -27261, -29851,
+	-32540, -35328, -38213, -41195, -44272, -47444, -50710, -54069,
+	-57520, -61062, -64694, -68416, -72227, -76125, -80111, -84183,
+	-88340, -92583, -96909, -101318, -105810, -110384, -115039, -119775,
+	-124590, -129485, -134457, -139508, -144635, -149839, -155119, -160474,
+	-165904, -171408, -176985, -182635, -188357, -194151, -200016, -205951,
+	-211956, -218031, -224175, -230387, -236666, -243014, -249428, -255908,
+	-262454, -269065, -275741, -282482, -289286, -296154, -303085, -310078,
+	-317133, -324250, -331428, -338667, -345966, -353325, -360743, -368220,
+	-375756, -383351, -391002, -398712, -406478, -414301, -422180, -430116,
+	-438106, -446152, -454252, -462407, -470616, -478879, -487195, -495564,
+	-503985, -512459, -520985, -529562, -538191, -546871, -555601, -564382,
+	-573213, -582093, -591023, -600002, -609030, -618106, -627231, -636403,
+	-645623, -654891, -664205, -673566, -682974, -692428, -701928, -711473,
+	-709526, -696120, -682891, -669838, -656959, -644252, -631715, -619346,
+	-607144, -595106, -583230, -571516, -559960, -548562, -537320, -526232,
+	-515296, -504512, -493877, -483390, -473049, -462853, -452800, -442890,
+	-433120, -423490, -413997, -404641, -395420, -386333, -377379, -368556,
+	-359863, -351299, -342863, -334554, -326370, -318311, -310374, -302560,
+	-294866, -287293, -279838, -272501, -265281, -258176, -251187, -244311,
+	-237547, -230896, -224356, -217925, -211604, -205390, -199284, -193285,
+	-187390, -181601, -175915, -170332, -164852, -159472, -154193, -149014,
+	-143934, -138952, -134068, -129280, -124588, -119991, -115489, -111080,
+	-106765, -102542, -98410, -94370, -90420, -86559, -82788, -79105,
+	-75510, -72001, -68580, -65244, -61993, -58827, -55745, -52747,
+	-49831, -46998, -44247, -41576, -38987, -36477, -34047, -31696,
+	-29423, -27229, -25112, -23071, -21108, -19220, -17407, -15670,
+	-14007, -12418, -10902, -9459, -8089, -6791, -5565, -4410,
+	-3326, -2312, -1367, -493, 313, 1050, 1719, 2320,
+	2854, 3321, 3722, 4056, 4324, 4528, 4666, 2979
+};
+RB_CONSTEXPR float rbt_2_root(const float y)
+{
+	int32_t i = rb_bit_cast<int32_t>(y); // interpret float as integer
+	int32_t q = (i + (i < 0 ? 1 : 0)) >> 1; // i / 2, rounding toward zero
+	i = 0x1fc00000 + q; // log-approximation hack
+	i += rbt_2_root_table[(i >> 15) & 255]; // correction by segment
+	float x = rb_bit_cast<float>(i);
+	x = 0.49973756f * x + 0.50026244f * y / x; // newtonian step #1
+	return x;
+}
+
+//Searching 256 segments, target in [1-0.000966609,1+0.000967503], m in [-0.5,-0.75] ...........
+//  ...best design target=1-0.000724852, m=-0.501109 with error score 7.15256e-07
+/*
+	Approximate x^(1/-2) with a 256-entry table and 1 newtonian steps
+	Error:
+		RMS:  6.75533e-07
+		mean: 6.40338e-07
+		min:  -7.77868e-07 @ 1.00778
+		max:  9.98992e-07 @ 1.66218
+	Analytic worst-case error: 7.15256e-07
+*/
+static RB_TABLE_CONSTEXPR int32_t rbt_inv_2_root_table[256] =
+{
+	-19251, -30542, -46744, -62848, -78852, -94756, -110559, -126260,
+	-141857, -157350, -172737, -188018, -203191, -218256, -233210, -248054,
+	-262786, -277404, -291908, -306296, -320567, -334720, -348753, -362666,
+	-376456, -390124, -403666, -417083, -430372, -443532, -456562, -469460,
+	-482225, -494855, -507349, -519705, -531922, -543998, -555932, -567721,
+	-579364, -590860, -602207, -613402, -624445, -635333, -646065, -656638,
+	-667051, -677302, -687389, -697309, -707062, -716644, -726053, -735288,
+	-744347, -753226, -761924, -770439, -778768, -786909, -794859, -802615,
+	-810177, -817540, -824702, -831660, -838413, -844956, -851288, -857405,
+	-863305, -868983, -874439, -879668, -884666, -889432, -893962, -898252,
+	-902299, -906099, -909649, -912946, -915985, -918763, -921276, -923520,
+	-925491, -927185, -928597, -929725, -930562, -931105, -931353, -931291,
+	-930923, -930243, -929244, -927922, -926272, -924289, -921966, -919299,
+	-916281, -912907, -909172, -905068, -900590, -895731, -890485, -884845,
+	-878804, -872355, -865492, -858206, -850490, -842336, -833737, -824684,
+	-815169, -805183, -794718, -783764, -772312, -760353, -747877, -734874,
+	-732995, -742473, -751813, -761015, -770075, -778994, -787770, -796401,
+	-804886, -813223, -821411, -829448, -837334, -845065, -852641, -860060,
+	-867321, -874421, -881360, -888135, -894744, -901186, -907459, -913562,
+	-919492, -925247, -930826, -936227, -941448, -946486, -951340, -956008,
+	-960487, -964776, -968872, -972774, -976478, -979983, -983287, -986386,
+	-989280, -991964, -994438, -996698, -998742, -1000567, -1002171, -1003550,
+	-1004704, -1005628, -1006319, -1006776, -1006996, -1006973, -1006707, -1006195,
+	-1005432, -1004417, -1003145, -1001614, -999820, -997759, -995429, -992826,
+	-989946, -986786, -983342, -979610, -975586, -971267, -966648, -961726,
+	-956496, -950955, -945097, -938918, -932415, -925582, -918415, -910908,
+	-903059, -894860, -886308, -877397, -868122, -858477, -848458, -838059,
+	-827273, -816096, -804521, -792542, -780154, -767349, -754121, -740465,
+	-726372, -711837, -696852, -681409, -665503, -649125, -632267, -614922,
+	-597081, -578737, -559881, -540505, -520599, -500154, -479162, -457613,
+	-435497, -412804, -389525, -365648, -341163, -316059, -290325, -263949,
+	-236919, -209224, -180851, -151787, -122019, -91533, -60317, -28354
+};
+RB_CONSTEXPR float rbt_inv_2_root(const float y)
+{
+	int32_t i = rb_bit_cast<int32_t>(y); // interpret float as integer
+	int32_t q = (i + (i < 0 ? 1 : 0)) >> 1; // i / 2, rounding toward zero
+	i = 0x5f400000 - q; // log-approximation hack
+	i += rbt_inv_2_root_table[(i >> 15) & 255]; // correction by segment
+	float x = rb_bit_cast<float>(i);
+	x *= 1.5011091f - 0.5011092f * y * (x*x); // newtonian step #1
+	return x;
+}
+
+//Searching 256 segments, target in [1-0.000707567,1+0.000708103], m in [0.333333,0.5] ...........
+//  ...best design target=1+0.000486851, m=0.333688 with error score 2.38419e-07
+/*
+	Approximate x^(1/3) with a 256-entry table and 1 newtonian steps
+	Error:
+		RMS:  2.29872e-07
+		mean: -2.17427e-07
+		min:  -4.16702e-07 @ 1.49842
+		max:  3.73599e-07 @ 4.06091
+	Analytic worst-case error: 2.38419e-07
+*/
+static RB_TABLE_CONSTEXPR int32_t rbt_3_root_table[256] =
+{
+	4030, 3793, 3308, 2578, 1609, 405, -1031, -2692,
+	-4577, -6680, -8998, -11527, -14263, -17204, -20345, -23683,
+	-27215, -30938, -34849, -38944, -43221, -47677, -52310, -57115,
+	-62092, -67236, -72546, -78020, -83654, -89447, -95396, -101498,
+	-107753, -114157, -120709, -127406, -134246, -141228, -148350, -155609,
+	-163004, -170533, -178195, -185987, -193908, -201957, -210131, -218429,
+	-226849, -235391, -244052, -252831, -261726, -270737, -279862, -289099,
+	-298447, -307905, -317472, -327146, -336926, -346811, -356799, -366890,
+	-377083, -387375, -397767, -408257, -418843, -429526, -440304, -451175,
+	-462139, -473195, -484343, -495580, -506906, -518320, -529822, -541410,
+	-553083, -564841, -576683, -588608, -600615, -607873, -600984, -592975,
+	-585275, -577879, -570781, -563976, -557458, -551222, -545263, -539577,
+	-534158, -529002, -524105, -519461, -515067, -510920, -507013, -503345,
+	-499911, -496706, -493729, -490974, -488439, -486121, -484015, -482119,
+	-480430, -478944, -477659, -476572, -475680, -474979, -474468, -474144,
+	-474002, -474045, -474266, -474663, -475235, -475978, -476891, -477972,
+	-479217, -480626, -482196, -483925, -485811, -487852, -490046, -492391,
+	-494885, -497527, -500315, -503247, -506321, -509535, -512888, -516379,
+	-520006, -523766, -527659, -531683, -535837, -540119, -544528, -549062,
+	-553720, -558501, -563403, -568425, -573566, -578824, -584198, -589688,
+	-595291, -601007, -606834, -612771, -618818, -624973, -631234, -637602,
+	-644075, -650651, -655244, -642587, -623848, -605500, -587538, -569954,
+	-552740, -535891, -519399, -503259, -487464, -472008, -456885, -442089,
+	-427616, -413459, -399613, -386073, -372835, -359893, -347243, -334879,
+	-322799, -310996, -299467, -288208, -277215, -266483, -256009, -245789,
+	-235820, -226097, -216617, -207377, -198373, -189602, -181062, -172747,
+	-164657, -156787, -149135, -141697, -134471, -127455, -120644, -114038,
+	-107633, -101426, -95415, -89598, -83973, -78536, -73286, -68220,
+	-63336, -58633, -54107, -49756, -45580, -41575, -37740, -34072,
+	-30570, -27233, -24057, -21042, -18185, -15485, -12939, -10548,
+	-8308, -6218, -4277, -2482, -833, 672, 2035, 3257,
+	4340, 5284, 6092, 6765, 7303, 7709, 7984, 5112
+};
+RB_CONSTEXPR float rbt_3_root(const float y)
+{
+	int32_t i = rb_bit_cast<int32_t>(y); // interpret float as integer
+	int32_t q = (int32_t)(rb_mulhi((uint32_t)i, 0x55555556u) - (i < 0 ? 0x55555556u : 0u));
+	q += (i < 0); // i / 3, rounding toward zero
+	i = 0x2a555554 + q; // log-approximation hack
+	i += rbt_3_root_table[(i >> 15) & 255]; // correction by segment
+	float x = rb_bit_cast<float>(i);
+	x = 0.66631186f * x + 0.33368817f * y / (x*x); // newtonian step #1
+	return x;
+}
+
+//Searching 256 segments, target in [1-0.000962794,1+0.000963688], m in [-0.333333,-0.5] ...........
+//  ...best design target=1-0.000721991, m=-0.334287 with error score 9.53674e-07
+/*
+	Approximate x^(1/-3) with a 256-entry table and 1 newtonian steps
+	Error:
+		RMS:  9.17068e-07
+		mean: 8.80603e-07
+		min:  -1.01328e-06 @ 1.00001
+		max:  1.2593e-06 @ 7.08554
+	Analytic worst-case error: 9.53674e-07
+*/
+static RB_TABLE_CONSTEXPR int32_t rbt_inv_3_root_table[256] =
+{
+	-19202, -30476, -46612, -62616, -78485, -94219, -109814, -125270,
+	-140583, -155752, -170775, -185650, -200374, -214945, -229361, -243620,
+	-257720, -271657, -285429, -299034, -312470, -325733, -338821, -351731,
+	-364460, -377006, -389365, -401534, -413511, -425291, -436873, -448252,
+	-459425, -470389, -481139, -491673, -501987, -512076, -521938, -531566,
+	-540959, -550111, -559017, -567674, -576078, -584222, -592102, -599714,
+	-607052, -614111, -620885, -627369, -633558, -639445, -645024, -650290,
+	-655235, -659853, -664138, -668082, -671678, -674919, -677797, -680304,
+	-682433, -684174, -685519, -686460, -686986, -687095, -686758, -685984,
+	-684756, -683063, -680894, -678237, -675080, -671411, -667216, -662483,
+	-657198, -651345, -644910, -637879, -630233, -627481, -637481, -649350,
+	-661052, -672586, -683949, -695139, -706154, -716990, -727646, -738118,
+	-748405, -758502, -768408, -778120, -787635, -796949, -806060, -814964,
+	-823659, -832141, -840407, -848454, -856277, -863874, -871241, -878374,
+	-885270, -891924, -898332, -904491, -910396, -916043, -921428, -926546,
+	-931392, -935963, -940252, -944256, -947968, -951385, -954500, -957308,
+	-959804, -961981, -963834, -965357, -966544, -967388, -967882, -968034,
+	-967796, -967201, -966228, -964871, -963120, -960969, -958409, -955431,
+	-952027, -948188, -943905, -939167, -933966, -928291, -922131, -915477,
+	-908316, -900637, -892429, -883679, -874374, -864502, -854048, -843000,
+	-831342, -819059, -806136, -792556, -778304, -763361, -747711, -731333,
+	-714209, -696319, -680859, -680089, -686594, -692891, -698977, -704849,
+	-710503, -715938, -721149, -726133, -730888, -735409, -739694, -743739,
+	-747540, -751093, -754396, -757443, -760232, -762759, -765018, -767007,
+	-768721, -770155, -771305, -772167, -772735, -773007, -772975, -772635,
+	-771983, -771013, -769720, -768098, -766142, -763845, -761203, -758209,
+	-754857, -751140, -747053, -742588, -737738, -732498, -726859, -720813,
+	-714355, -707475, -700166, -692419, -684227, -675580, -666470, -656887,
+	-646822, -636266, -625208, -613638, -601546, -588920, -575750, -562024,
+	-547730, -532856, -517389, -501316, -484625, -467299, -449327, -430692,
+	-411380, -391375, -370659, -349218, -327032, -304085, -280357, -255829,
+	-230481, -204292, -177240, -149304, -120461, -90685, -59953, -28239
+};
+RB_CONSTEXPR float rbt_inv_3_root(const float y)
+{
+	int32_t i = rb_bit_cast<int32_t>(y); // interpret float as integer
+	int32_t q = (int32_t)(rb_mulhi((uint32_t)i, 0x55555556u) - (i < 0 ? 0x55555556u : 0u));
+	q += (i < 0); // i / 3, rounding toward zero
+	i = 0x54aaaaa8 - q; // log-approximation hack
+	i += rbt_inv_3_root_table[(i >> 15) & 255]; // correction by segment
+	float x = rb_bit_cast<float>(i);
+	x *= 1.3342866f - 0.33428657f * y * (x*x*x); // newtonian step #1
+	return x;
+}
+
+//Searching 256 segments, target in [1-0.000778675,1+0.000779271], m in [0.25,0.375] ...........
+//  ...best design target=1+0.000535786, m=0.250428 with error score 4.76837e-07
+/*
+	Approximate x^(1/4) with a 256-entry table and 1 newtonian steps
+	Error:
+		RMS:  4.71648e-07
+		mean: -4.5747e-07
+		min:  -7.14831e-07 @ 1.00238
+		max:  5.64892e-07 @ 8.12344
+	Analytic worst-case error: 4.76837e-07
+*/
+static RB_TABLE_CONSTEXPR int32_t rbt_4_root_table[256] =
+{
+	4408, 4049, 3320, 2232, 795, -985, -3097, -5533,
+	-8286, -11348, -14711, -18369, -22315, -26542, -31044, -35814,
+	-40848, -46139, -51682, -57471, -63501, -69768, -76266, -82990,
+	-89938, -97103, -104482, -112070, -119864, -127859, -136053, -144441,
+	-153019, -161785, -170735, -179865, -189173, -198656, -208309, -218132,
+	-228120, -238271, -248582, -259051, -269675, -280451, -291377, -302452,
+	-313671, -325034, -336538, -348181, -359960, -371875, -383921, -396099,
+	-408405, -420839, -433397, -446079, -458883, -471806, -484848, -498006,
+	-501631, -495858, -490525, -485618, -481129, -477044, -473356, -470053,
+	-467127, -464568, -462368, -460518, -459011, -457838, -456991, -456465,
+	-456244, -456343, -456734, -457419, -458390, -459642, -461170, -462967,
+	-465029, -467350, -469925, -472749, -475817, -479126, -482670, -486444,
+	-490446, -494671, -499114, -503772, -508641, -513718, -518998, -524479,
+	-530157, -536028, -542091, -548340, -554774, -561390, -568184, -575153,
+	-582296, -589609, -597089, -604735, -612543, -620512, -628638, -636920,
+	-645354, -653940, -662675, -671557, -680583, -689751, -699061, -708509,
+	-706619, -693555, -681012, -668977, -657438, -646381, -635795, -625667,
+	-615987, -606745, -597928, -589528, -581536, -573941, -566734, -559908,
+	-553454, -547363, -541629, -536243, -531198, -526487, -522104, -518041,
+	-514293, -510853, -507715, -504874, -502323, -500057, -498072, -496361,
+	-494920, -493744, -492828, -492167, -491757, -491588, -491674, -491992,
+	-492544, -493327, -494336, -495568, -497020, -498687, -500566, -502655,
+	-504949, -507446, -510141, -513034, -516120, -519396, -522860, -526508,
+	-530339, -534350, -538537, -542899, -547433, -552136, -557007, -562043,
+	-553596, -531860, -510744, -490232, -470310, -450961, -432171, -413928,
+	-396217, -379025, -362340, -346151, -330446, -315214, -300445, -286127,
+	-272251, -258809, -245789, -233184, -220985, -209183, -197770, -186739,
+	-176082, -165791, -155859, -146280, -137047, -128153, -119592, -111357,
+	-103443, -95845, -88555, -81570, -74883, -68489, -62384, -56562,
+	-51019, -45750, -40750, -36015, -31541, -27324, -23359, -19643,
+	-16171, -12940, -9946, -7186, -4655, -2351, -271, 1590,
+	3235, 4665, 5885, 6898, 7706, 8313, 8720, 5625
+};
+RB_CONSTEXPR float rbt_4_root(const float y)
+{
+	int32_t i = rb_bit_cast<int32_t>(y); // interpret float as integer
+	int32_t q = (i + (i < 0 ? 3 : 0)) >> 2; // i / 4, rounding toward zero
+	i = 0x2fa00000 + q; // log-approximation hack
+	i += rbt_4_root_table[(i >> 15) & 255]; // correction by segment
+	float x = rb_bit_cast<float>(i);
+	x = 0.74957216f * x + 0.2504278f * y / (x*x*x); // newtonian step #1
+	return x;
+}
+
+//Searching 256 segments, target in [1-0.000959098,1+0.000959992], m in [-0.25,-0.375] ............
+//  ...best design target=1-0.00074923, m=-0.250907 with error score 1.19209e-06
+/*
+	Approximate x^(1/-4) with a 256-entry table and 1 newtonian steps
+	Error:
+		RMS:  1.15849e-06
+		mean: 1.11823e-06
+		min:  -1.25173e-06 @ 1.00009
+		max:  1.52441e-06 @ 8.4512
+	Analytic worst-case error: 1.19209e-06
+*/
+static RB_TABLE_CONSTEXPR int32_t rbt_inv_4_root_table[256] =
+{
+	-19505, -30666, -46736, -62639, -78372, -93932, -109315, -124519,
+	-139539, -154373, -169016, -183466, -197718, -211769, -225614, -239249,
+	-252671, -265874, -278855, -291609, -304131, -316416, -328460, -340256,
+	-351800, -363086, -374108, -384861, -395338, -405534, -415441, -425053,
+	-434363, -443364, -452049, -460410, -468438, -476126, -483466, -490447,
+	-497062, -503300, -509153, -514608, -519657, -524288, -528489, -532248,
+	-535554, -538392, -540750, -542614, -543968, -544798, -545118, -544819,
+	-543977, -542541, -540494, -537815, -534483, -530476, -525771, -520344,
+	-524035, -537141, -550052, -562764, -575274, -587578, -599672, -611552,
+	-623215, -634655, -645869, -656853, -667602, -678111, -688375, -698391,
+	-708152, -717654, -726891, -735858, -744549, -752959, -761081, -768909,
+	-776437, -783658, -790566, -797154, -803414, -809338, -814920, -820151,
+	-825023, -829527, -833655, -837397, -840745, -843688, -846216, -848318,
+	-849985, -851204, -851963, -852271, -852055, -851362, -850158, -848429,
+	-846160, -843335, -839940, -835956, -831366, -826153, -820297, -813779,
+	-806577, -798670, -790036, -780650, -770487, -759522, -747727, -735074,
+	-733262, -742648, -751802, -760720, -769397, -777829, -786011, -793939,
+	-801608, -809013, -816149, -823011, -829593, -835891, -841898, -847608,
+	-853017, -858116, -862901, -867365, -871501, -875301, -878760, -881870,
+	-884622, -887010, -889025, -890659, -891903, -892748, -893186, -893207,
+	-892801, -891957, -890667, -888917, -886698, -883998, -880804, -877105,
+	-872886, -868136, -862839, -856982, -850549, -843525, -835893, -827636,
+	-818738, -809179, -798941, -788003, -776346, -763946, -750782, -736831,
+	-722066, -706463, -689995, -672633, -654348, -635109, -614882, -593634,
+	-585280, -590242, -594928, -599333, -603452, -607279, -610810, -614038,
+	-616958, -619564, -621850, -623811, -625439, -626728, -627671, -628262,
+	-628506, -628359, -627849, -626957, -625675, -623995, -621909, -619406,
+	-616480, -613119, -609316, -605059, -600338, -595144, -589465, -583289,
+	-576606, -569403, -561668, -553388, -544549, -535138, -525140, -514541,
+	-503324, -491475, -478976, -465811, -451961, -437407, -422132, -406113,
+	-389331, -371764, -353388, -334181, -314118, -293172, -271318, -248526,
+	-224769, -200014, -174230, -147383, -119438, -90358, -60105, -28637
+};
+RB_CONSTEXPR float rbt_inv_4_root(const float y)
+{
+	int32_t i = rb_bit_cast<int32_t>(y); // interpret float as integer
+	int32_t q = (i + (i < 0 ? 3 : 0)) >> 2; // i / 4, rounding toward zero
+	i = 0x4f600000 - q; // log-approximation hack
+	i += rbt_inv_4_root_table[(i >> 15) & 255]; // correction by segment
+	float x = rb_bit_cast<float>(i);
+	x *= 1.250907f - 0.25090697f * y * ((x*x)*(x*x)); // newtonian step #1
+	return x;
+}
+
@@ -0,0 +1,270 @@
+#pragma once
+
+
+#include <cstdint>
+#include <cstddef>
+#include <cstdio>
+#include <cstring>
+#include <cinttypes>
+#include <cmath>
+#include <mutex>
+#include <vector>
+#include <ostream>
+#include <iomanip>
+
+#include "root_cellar.h"
+
+
+/*
+	Verification of float root approximations over every one of the 2^32 inputs,
+	including negatives, denormals, infinities and NaNs.
+
+	Results are kept per binade --- the 2^23 inputs sharing a sign and exponent.
+	Each binade is scanned by one task of the executor and, when a checkpoint
+	file is given, recorded there as soon as it completes.  An interrupted run
+	given the same file picks up where it left off.
+*/
+namespace rootbeer
+{
+	/*
+		Outcome of one binade (or several, merged).
+			unscored:   the exact root is zero, infinite or NaN; no relative error.
+			nonfinite:  the exact root is finite but the output is infinite or NaN.
+			sign_flips: the output's sign differs from the exact root's.
+		Relative error is measured wherever the exact root is finite and non-zero
+		and the output is finite.
+	 */
+	struct Verify_Binade
+	{
+		uint64_t samples = 0, unscored = 0, nonfinite = 0, sign_flips = 0;
+		PowApprox_Accumulator error;
+
+		void merge(const Verify_Binade &other)
+		{
+			samples    += other.samples;
+			unscored   += other.unscored;
+			nonfinite  += other.nonfinite;
+			sign_flips += other.sign_flips;
+			error.merge(other.error);
+		}
+	};
+
+	struct Verify_Report
+	{
+		static const unsigned binade_count = 512;
+		static const uint64_t binade_size  = uint64_t(1) << 23;
+		static const uint64_t input_count  = uint64_t(binade_count) * binade_size;
+
+		// Indexed by the top 9 bits of the input: sign, then biased exponent.
+		std::vector<Verify_Binade> binades = std::vector<Verify_Binade>(binade_count);
+
+		// Number of binades restored from the checkpoint rather than scanned.
+		unsigned resumed = 0;
+
+		Verify_Binade total() const
+		{
+			Verify_Binade sum;
+			for (auto &b : binades) sum.merge(b);
+			return sum;
+		}
+
+		// Whether every input was scanned, once.
+		bool complete() const    {return total().samples == input_count;}
+	};
+
+	namespace detail
+	{
+		/*
+			Checkpoint file: a header line identifying the function under test,
+			followed by one line per completed binade.  Doubles are written in
+			hexadecimal so that resumed statistics are exact.
+		 */
+		struct verify_checkpoint
+		{
+			std::FILE *file = nullptr;
+			std::mutex mutex;
+
+			~verify_checkpoint()    {if (file) std::fclose(file);}
+
+			static void write_binade(std::FILE *f, const unsigned index, const Verify_Binade &b)
+			{
+				const PowApprox_Accumulator &e = b.error;
+				std::fprintf(f,
+					"binade %u %" PRIu64 " %" PRIu64 " %" PRIu64 " %" PRIu64 " %" PRIu64 " %a %a %a %a %a %a\n",
+					index, b.samples, b.unscored, b.nonfinite, b.sign_flips, e.samples,
+					e.sum_error, e.sum_sq_error, e.min_error, e.min_error_arg, e.max_error, e.max_error_arg);
+			}
+
+			static bool read_binade(std::FILE *f, unsigned &index, Verify_Binade &b)
+			{
+				PowApprox_Accumulator &e = b.error;
+				return std::fscanf(f,
+					" binade %u %" SCNu64 " %" SCNu64 " %" SCNu64 " %" SCNu64 " %" SCNu64 " %la %la %la %la %la %la",
+					&index, &b.samples, &b.unscored, &b.nonfinite, &b.sign_flips, &e.samples,
+					&e.sum_error, &e.sum_sq_error, &e.min_error, &e.min_error_arg, &e.max_error, &e.max_error_arg) == 12
+					&& index < Verify_Report::binade_count && b.samples == Verify_Report::binade_size;
+			}
+
+			/*
+				Load the binades recorded under a matching header, then rewrite the
+				file with only those records, dropping any line cut short by an interruption.
+			 */
+			bool open(const char *path, const char *header, Verify_Report &report, std::vector<bool> &done)
+			{
+				if (std::FILE *old = std::fopen(path, "r"))
+				{
+					char line[256] = "";
+					if (std::fgets(line, sizeof(line), old) && std::strcmp(line, header) == 0)
+					{
+						unsigned index;
+						Verify_Binade b;
+						while (read_binade(old, index, b))
+						{
+							if (!done[index]) ++report.resumed;
+							report.binades[index] = b;
+							done[index] = true;
+							b = Verify_Binade();
+						}
+					}
+					std::fclose(old);
+				}
+
+				file = std::fopen(path, "w");
+				if (!file) return false;
+				std::fputs(header, file);
+				for (unsigned i = 0; i < Verify_Report::binade_count; ++i)
+					if (done[i]) write_binade(file, i, report.binades[i]);
+				std::fflush(file);
+				return true;
+			}
+
+			void record(const unsigned index, const Verify_Binade &b)
+			{
+				if (!file) return;
+				std::lock_guard<std::mutex> lock(mutex);
+				write_binade(file, index, b);
+				std::fflush(file);
+			}
+		};
+
+		/*
+			Identify a function by its outputs on a spread of inputs, so that a
+			checkpoint written for one design isn't resumed with another.
+		 */
+		template<typename T_Func>
+		uint64_t verify_fingerprint(const T_Func &func)
+		{
+			uint64_t hash = 0xcbf29ce484222325;
+			for (uint32_t i = 0; i < 4096; ++i)
+			{
+				float y = reinterpret_int_float(int32_t(i * 0x0010003bu)), x = float(func(y));
+				int32_t bits = reinterpret_float_int(x);
+				hash = (hash ^ uint32_t(bits)) * 0x100000001b3;
+			}
+			return hash;
+		}
+	}
+
+	/*
+		Verify a float approximation of y^(1/ROOT) --- a RootApprox, function pointer
+		or other callable --- against root_i<ROOT> over all 2^32 inputs.
+		checkpoint_path may be null to run without a checkpoint file.
+	 */
+	template<int ROOT, typename T_Func, typename T_Executor>
+	Verify_Report Verify_Root_Approx(
+		const T_Func &func,
+		T_Executor &&executor,
+		const char *checkpoint_path = nullptr)
+	{
+		Verify_Report report;
+		std::vector<bool> done(Verify_Report::binade_count, false);
+
+		detail::verify_checkpoint checkpoint;
+		if (checkpoint_path)
+		{
+			char header[64];
+			std::snprintf(header, sizeof(header), "rootbeer-verify %d %016" PRIx64 "\n",
+				ROOT, detail::verify_fingerprint(func));
+			checkpoint.open(checkpoint_path, header, report, done);
+		}
+
+		std::vector<unsigned> pending;
+		for (unsigned i = 0; i < Verify_Report::binade_count; ++i)
+			if (!done[i]) pending.push_back(i);
+
+		executor.parallel_for(pending.size(), [&](const size_t p)
+		{
+			const unsigned index = pending[p];
+			Verify_Binade b;
+			// 64-bit, as the last binade ends at 2^32
+			const uint64_t first = uint64_t(index) * Verify_Report::binade_size;
+			for (uint64_t bits = first; bits < first + Verify_Report::binade_size; ++bits)
+			{
+				float y = reinterpret_int_float(int32_t(uint32_t(bits))),
+					exact = root_i<ROOT>(y),
+					x = float(func(y));
+				++b.samples;
+
+				if (!std::isnan(x) && !std::isnan(exact) && std::signbit(x) != std::signbit(exact))
+					++b.sign_flips;
+
+				if (!std::isfinite(exact) || exact == 0.f) ++b.unscored;
+				else if (!std::isfinite(x))                ++b.nonfinite;
+				else b.error.add((double(x) - double(exact)) / double(exact), y);
+			}
+			report.binades[index] = b;
+			checkpoint.record(index, b);
+		});
+
+		return report;
+	}
+
+	template<int ROOT, typename T_Func>
+	Verify_Report Verify_Root_Approx_Parallel(
+		const T_Func &func,
+		const char *checkpoint_path = nullptr,
+		unsigned threads = 0)
+	{
+		ThreadPool pool(threads);
+		return Verify_Root_Approx<ROOT>(func, pool, checkpoint_path);
+	}
+}
+
+
+/*
+	Print a table of binades with their error statistics, then totals.
+	Binades are labeled by the range of their magnitudes.
+*/
+inline std::ostream &operator<<(std::ostream &out, const rootbeer::Verify_Report &report)
+{
+	auto print_row = [&](const char *sign, const char *range, const rootbeer::Verify_Binade &b)
+	{
+		rootbeer::PowApprox_Stats s = b.error.stats();
+		out << std::dec << std::setw(2) << sign << std::setw(14) << range << std::scientific << std::setprecision(3);
+		if (b.error.samples)
+			out << std::setw(12) << s.worst_error()
+				<< std::setw(12) << std::sqrt(s.mean_sq_error)
+				<< std::setw(12) << s.mean_error;
+		else
+			out << std::setw(12) << "-" << std::setw(12) << "-" << std::setw(12) << "-";
+		out << std::setw(12) << b.nonfinite
+			<< std::setw(12) << b.sign_flips
+			<< std::setw(12) << b.unscored << '\n';
+	};
+
+	out << std::setw(16) << "binade"
+		<< std::setw(12) << "max |err|" << std::setw(12) << "RMS" << std::setw(12) << "mean"
+		<< std::setw(12) << "non-finite" << std::setw(12) << "sign flips" << std::setw(12) << "unscored" << '\n';
+	for (unsigned i = 0; i < rootbeer::Verify_Report::binade_count; ++i)
+	{
+		unsigned biased = i & 255;
+		char range[32];
+		if      (biased == 0)   std::snprintf(range, sizeof(range), "denormal");
+		else if (biased == 255) std::snprintf(range, sizeof(range), "inf/nan");
+		else                    std::snprintf(range, sizeof(range), "2^%d", int(biased) - 127);
+		print_row((i & 256) ? "-" : "+", range, report.binades[i]);
+	}
+	print_row("", "all", report.total());
+	out << std::defaultfloat;
+	return out;
+}